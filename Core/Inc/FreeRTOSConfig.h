@@ -51,6 +51,10 @@
 #if defined(__ICCARM__) || defined(__CC_ARM) || defined(__GNUC__)
   #include <stdint.h>
   extern uint32_t SystemCoreClock;
+/* USER CODE BEGIN 0 */
+  extern void configureTimerForRunTimeStats(void);
+  extern unsigned long getRunTimeCounterValue(void);
+/* USER CODE END 0 */
 #endif
 #ifndef CMSIS_device_header
 #define CMSIS_device_header "stm32f4xx.h"
@@ -71,6 +75,7 @@
 #define configTOTAL_HEAP_SIZE                    ((size_t)15360)
 #define configMAX_TASK_NAME_LEN                  ( 16 )
 #define configUSE_TRACE_FACILITY                 1
+#define configGENERATE_RUN_TIME_STATS            1
 #define configUSE_16_BIT_TICKS                   0
 #define configUSE_MUTEXES                        1
 #define configQUEUE_REGISTRY_SIZE                8
@@ -117,6 +122,12 @@ to exclude the API function. */
 #define INCLUDE_xTaskGetCurrentTaskHandle    1
 #define INCLUDE_eTaskGetState                1
 
+/* USER CODE BEGIN 2 */
+/* Definitions needed when configGENERATE_RUN_TIME_STATS is on */
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS configureTimerForRunTimeStats
+#define portGET_RUN_TIME_COUNTER_VALUE getRunTimeCounterValue
+/* USER CODE END 2 */
+
 /*
  * The CMSIS-RTOS V2 FreeRTOS wrapper is dependent on the heap implementation used
  * by the application thus the correct define need to be enabled below
@@ -165,6 +176,37 @@ standard names. */
 
 /* USER CODE BEGIN Defines */
 /* Section where parameter definitions can be added (for instance, to override default ones in FreeRTOS.h) */
+
+/* Static-allocation build mode (rtos_static.h): all RTOS objects are reserved at link
+   time, so the heap only keeps a small reserve. */
+#include "rtos_static.h"
+#if RTOS_STATIC_ALLOC
+#undef configTOTAL_HEAP_SIZE
+#define configTOTAL_HEAP_SIZE                    ((size_t)RTOS_STATIC_HEAP_SIZE)
+#endif
+/* ucHeap is defined in freertos.c so that it can be placed in CCM (mem_layout.h) */
+#define configAPPLICATION_ALLOCATED_HEAP         1
+
+/* Kernel trace hooks feeding the run-time statistics (rtos_stats.h) and the binary trace
+   stream (trace.h). The macros expand inside tasks.c / queue.c, where pxCurrentTCB and
+   pxQueue are in scope. */
+#if defined(__ICCARM__) || defined(__CC_ARM) || defined(__GNUC__)
+#include "trace.h"
+#include "rtos_stats.h"
+#define traceTASK_SWITCHED_IN()                                                              \
+    do                                                                                       \
+    {                                                                                        \
+        RTOS_Stats_TaskSwitchedIn((uint32_t)pxCurrentTCB->uxTCBNumber);                      \
+        TRACE_EVENT(TRACE_EVT_TASK_SWITCH_IN, 0, pxCurrentTCB->uxTCBNumber);                 \
+    } while (0)
+#if TRACE_ENABLE
+#define traceTASK_SWITCHED_OUT()              Trace_Record(TRACE_EVT_TASK_SWITCH_OUT, 0, (uint16_t)pxCurrentTCB->uxTCBNumber)
+#define traceQUEUE_SEND(pxQueue)              Trace_Record(TRACE_EVT_QUEUE_SEND, 0, (uint16_t)(uintptr_t)(pxQueue))
+#define traceQUEUE_SEND_FROM_ISR(pxQueue)     Trace_Record(TRACE_EVT_QUEUE_SEND_FROM_ISR, 0, (uint16_t)(uintptr_t)(pxQueue))
+#define traceQUEUE_RECEIVE(pxQueue)           Trace_Record(TRACE_EVT_QUEUE_RECEIVE, 0, (uint16_t)(uintptr_t)(pxQueue))
+#define traceQUEUE_RECEIVE_FROM_ISR(pxQueue)  Trace_Record(TRACE_EVT_QUEUE_RECEIVE_FROM_ISR, 0, (uint16_t)(uintptr_t)(pxQueue))
+#endif /* TRACE_ENABLE */
+#endif
 /* USER CODE END Defines */
 
 #endif /* FREERTOS_CONFIG_H */
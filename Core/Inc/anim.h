@@ -0,0 +1,135 @@
+/**
+ * @file    anim.h
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Time-driven animation player: frame lists with per-frame durations, several at once.
+ *
+ * @details
+ * An animation is described by an AnimDesc_t: a frame list (image asset id and duration of each
+ * frame), the playback mode (once, loop, ping-pong) and the position on screen. Anim_FromAsset()
+ * builds the descriptor of an animation entry of the asset pack. Up to ANIM_MAX_PLAYERS
+ * animations play at the same time.
+ *
+ * Playback follows the tick passed to Anim_Update(), not the number of calls: a late call skips
+ * the frames whose time has passed, and each frame starts exactly where the previous one ended,
+ * so the animation does not drift. Anim_NextDue() tells the caller how long it may sleep before
+ * the next frame change. The player is not thread-safe; only the display task uses it.
+ */
+
+#ifndef ANIM_H
+#define ANIM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "asset_pack.h"
+#include "u8g2.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+/**
+ * @def ANIM_MAX_PLAYERS
+ * @brief Number of animations that can play at the same time.
+ */
+#define ANIM_MAX_PLAYERS        4U
+
+/**
+ * @def ANIM_HANDLE_NONE
+ * @brief Returned by Anim_Start() when every player is busy or the descriptor is empty.
+ */
+#define ANIM_HANDLE_NONE        0xFFU
+
+/**
+ * @def ANIM_NO_DEADLINE
+ * @brief Returned by Anim_NextDue() when no running animation will change frame.
+ */
+#define ANIM_NO_DEADLINE        0xFFFFFFFFUL
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @struct AnimDesc_t
+ * @brief One animation: what to show, for how long, how to repeat and where.
+ */
+typedef struct {
+    const AssetFrame_t *frames; /**< Frame list (image asset id, duration in ms); 0 ms counts as 1 ms */
+    uint16_t count;             /**< Number of frames */
+    uint8_t mode;               /**< AssetAnimMode_t */
+    u8g2_uint_t x;              /**< Left edge (pixels) */
+    u8g2_uint_t y;              /**< Top edge (pixels; a multiple of 8 for page images) */
+} AnimDesc_t;
+
+/** Player slot returned by Anim_Start() */
+typedef uint8_t AnimHandle_t;
+
+/* Exported functions --------------------------------------------------------*/
+/**
+ * @brief  Fill a descriptor from an animation entry of the asset pack.
+ * @param desc Descriptor to fill (frames point into flash).
+ * @param id   Asset id of an animation.
+ * @param x    Left edge (pixels).
+ * @param y    Top edge (pixels).
+ * @return 0 on success, -1 if the asset is not an animation (desc is then left unchanged).
+ */
+int Anim_FromAsset(AnimDesc_t *desc, AssetId_t id, u8g2_uint_t x, u8g2_uint_t y);
+
+/**
+ * @brief  Start an animation on its first frame.
+ * @param desc Descriptor; copied, but the frame list must stay valid while it plays.
+ * @param now  Current tick (ms).
+ * @return Player handle, or ANIM_HANDLE_NONE.
+ */
+AnimHandle_t Anim_Start(const AnimDesc_t *desc, uint32_t now);
+
+/**
+ * @brief  Stop an animation and free its player (it is no longer drawn).
+ * @param handle Handle from Anim_Start().
+ */
+void Anim_Stop(AnimHandle_t handle);
+
+/**
+ * @brief  Stop every animation.
+ */
+void Anim_StopAll(void);
+
+/**
+ * @brief  Advance every running animation to the frame due at a tick.
+ * @param now Current tick (ms).
+ * @return true if any animation changed frame (the screen needs a redraw).
+ */
+bool Anim_Update(uint32_t now);
+
+/**
+ * @brief  Time until the next frame change of any animation.
+ * @param now Current tick (ms).
+ * @return Milliseconds (0 if a change is already due), or ANIM_NO_DEADLINE.
+ */
+uint32_t Anim_NextDue(uint32_t now);
+
+/**
+ * @brief  Draw the current frame of every started animation (lowest handle first).
+ * @param u8g2 Pointer to the u8g2 display structure.
+ */
+void Anim_Draw(u8g2_t *u8g2);
+
+/**
+ * @brief  Current frame of an animation.
+ * @param handle Handle from Anim_Start().
+ * @return Frame index, 0 for a free player.
+ */
+uint16_t Anim_GetFrame(AnimHandle_t handle);
+
+/**
+ * @brief  Whether an animation still changes frames.
+ * @param handle Handle from Anim_Start().
+ * @return false once a "once" animation holds its last frame, or if the player is free.
+ */
+bool Anim_IsRunning(AnimHandle_t handle);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ANIM_H
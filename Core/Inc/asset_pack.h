@@ -0,0 +1,215 @@
+/**
+ * @file    asset_pack.h
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Flash-resident asset pack: images, animations and fonts looked up by id or name.
+ *
+ * @details
+ * Tools/asset_pack.py builds the pack from Image/assets.txt: a header, an index of fixed-size
+ * entries (name, type, encoding, size, data offset) and the data. Nothing is copied at run time:
+ * Asset_Get() and Asset_Find() return pointers into the index and Asset_Data() points at the
+ * bits in flash, ready for u8g2_DrawXBMP() or u8g2_SetFont().
+ *
+ * The pack lives in the last 128 KB flash sector (ASSET_PACK_ADDRESS, its own load region in the
+ * scatter file and GNU ld script), so it can be erased and rewritten without touching the
+ * firmware. With ASSET_PACK_EMBED=1 (default) the generated Image/asset_pack_data.h is linked there;
+ * with 0 the firmware only reads the sector, which is flashed from the packer's --bin output.
+ * Asset_Init() checks the magic, format and CRC-32 once; an invalid pack has no assets.
+ *
+ * Asset ids are indices in the manifest (Image/asset_ids.h). A separately flashed pack must
+ * keep the ids the firmware was built with, or the firmware must look its assets up by name.
+ */
+
+#ifndef ASSET_PACK_H
+#define ASSET_PACK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+/**
+ * @def ASSET_PACK_EMBED
+ * @brief Set to 0 to leave the asset sector out of the firmware image (pack flashed separately).
+ */
+#ifndef ASSET_PACK_EMBED
+#define ASSET_PACK_EMBED        1
+#endif
+
+/**
+ * @def ASSET_PACK_ADDRESS
+ * @brief Start of the asset sector (sector 23, the last 128 KB of the 2 MB flash).
+ */
+#define ASSET_PACK_ADDRESS      0x081E0000UL
+
+/**
+ * @def ASSET_PACK_MAX_SIZE
+ * @brief Size of the asset sector (bytes).
+ */
+#define ASSET_PACK_MAX_SIZE     0x20000UL
+
+/**
+ * @def ASSET_PACK_MAGIC
+ * @brief First word of a pack ("APK1").
+ */
+#define ASSET_PACK_MAGIC        0x314B5041UL
+
+/**
+ * @def ASSET_PACK_FORMAT
+ * @brief Layout version written by Tools/asset_pack.py.
+ */
+#define ASSET_PACK_FORMAT       1U
+
+/**
+ * @def ASSET_NAME_LEN
+ * @brief Size of the name field of an entry, including the terminating zero.
+ */
+#define ASSET_NAME_LEN          16U
+
+/**
+ * @def ASSET_ID_NONE
+ * @brief Returned by Asset_FindId() for an unknown name.
+ */
+#define ASSET_ID_NONE           0xFFFFU
+
+/* Exported macros -----------------------------------------------------------*/
+/**
+ * @def ASSET_PACK_SECTION
+ * @brief Place the embedded pack in the asset sector, word aligned.
+ */
+#if (defined(__GNUC__) || defined(__ARMCC_VERSION)) && !defined(__APPLE__)
+#define ASSET_PACK_SECTION      __attribute__((section(".rodata.assets"), used, aligned(4)))
+#else
+#define ASSET_PACK_SECTION
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @enum AssetType_t
+ * @brief Kind of asset.
+ */
+typedef enum {
+    ASSET_TYPE_IMAGE = 1,       /**< Monochrome bitmap */
+    ASSET_TYPE_ANIMATION,       /**< Frame list of images (AssetFrame_t) */
+    ASSET_TYPE_FONT             /**< u8g2 font */
+} AssetType_t;
+
+/**
+ * @enum AssetEncoding_t
+ * @brief Layout of the asset data.
+ */
+typedef enum {
+    ASSET_ENC_XBM = 1,          /**< XBM rows, LSB = leftmost pixel (u8g2_DrawXBMP) */
+    ASSET_ENC_PAGES,            /**< SH1106 pages: byte x of page p = column x, rows 8p .. 8p+7 */
+    ASSET_ENC_FRAMES,           /**< AssetFrame_t array */
+    ASSET_ENC_U8G2_FONT         /**< u8g2 font (u8g2_SetFont) */
+} AssetEncoding_t;
+
+/**
+ * @enum AssetAnimMode_t
+ * @brief Playback of an animation (AssetEntry_t::flags).
+ */
+typedef enum {
+    ASSET_ANIM_ONCE = 0,        /**< Stop on the last frame */
+    ASSET_ANIM_LOOP,            /**< Restart from the first frame */
+    ASSET_ANIM_PINGPONG         /**< Play forwards, then backwards */
+} AssetAnimMode_t;
+
+/**
+ * @struct AssetPackHeader_t
+ * @brief Start of a pack (16 bytes).
+ */
+typedef struct {
+    uint32_t magic;             /**< ASSET_PACK_MAGIC */
+    uint16_t format;            /**< ASSET_PACK_FORMAT */
+    uint16_t count;             /**< Number of index entries */
+    uint32_t size;              /**< Whole pack in bytes */
+    uint32_t crc;               /**< CRC-32 (zlib) of bytes 16 .. size - 1 */
+} AssetPackHeader_t;
+
+/**
+ * @struct AssetEntry_t
+ * @brief One index entry (32 bytes), following the header.
+ */
+typedef struct {
+    char name[ASSET_NAME_LEN];  /**< Zero-terminated name */
+    uint8_t type;               /**< AssetType_t */
+    uint8_t encoding;           /**< AssetEncoding_t */
+    uint16_t width;             /**< Pixels (images, first frame of an animation, largest glyph) */
+    uint16_t height;            /**< Pixels */
+    uint16_t flags;             /**< AssetAnimMode_t for animations, 0 otherwise */
+    uint32_t offset;            /**< Data offset from the start of the pack (4-byte aligned) */
+    uint32_t length;            /**< Data length in bytes */
+} AssetEntry_t;
+
+/**
+ * @struct AssetFrame_t
+ * @brief One animation frame.
+ */
+typedef struct {
+    uint16_t image;             /**< Asset id of the image */
+    uint16_t duration_ms;       /**< Time the frame stays on screen */
+} AssetFrame_t;
+
+/** Asset id: index of the entry in the pack (Image/asset_ids.h) */
+typedef uint16_t AssetId_t;
+
+/* Exported functions --------------------------------------------------------*/
+/**
+ * @brief  Validate the pack (magic, format, size, CRC). Later calls return the cached result.
+ * @return 0 if the pack is usable, -1 otherwise.
+ */
+int Asset_Init(void);
+
+/**
+ * @brief  Number of assets of a valid pack.
+ * @return Entry count, 0 if the pack is invalid.
+ */
+uint16_t Asset_Count(void);
+
+/**
+ * @brief  Index entry of an asset.
+ * @param id Asset id.
+ * @return Entry in flash, or NULL for an unknown id or invalid pack.
+ */
+const AssetEntry_t *Asset_Get(AssetId_t id);
+
+/**
+ * @brief  Index entry of an asset by name.
+ * @param name Asset name.
+ * @return Entry in flash, or NULL if there is none.
+ */
+const AssetEntry_t *Asset_Find(const char *name);
+
+/**
+ * @brief  Asset id of a name.
+ * @param name Asset name.
+ * @return Id, or ASSET_ID_NONE.
+ */
+AssetId_t Asset_FindId(const char *name);
+
+/**
+ * @brief  Data of an asset, in place in flash.
+ * @param entry Entry from Asset_Get() or Asset_Find().
+ * @return First data byte.
+ */
+const uint8_t *Asset_Data(const AssetEntry_t *entry);
+
+/**
+ * @brief  Frames of an animation.
+ * @param entry Entry of type ASSET_TYPE_ANIMATION.
+ * @param count Output, number of frames.
+ * @return First frame, or NULL (count 0) if the entry is not an animation.
+ */
+const AssetFrame_t *Asset_Frames(const AssetEntry_t *entry, uint16_t *count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ASSET_PACK_H
@@ -0,0 +1,68 @@
+/**
+ * @file    cmd_handler.h
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Executes command frames (cmd_proto.h) received on USART3.
+ *
+ * @details
+ * The console (log task) hands the RX ring to CmdHandler_Process() whenever its oldest byte is
+ * CMD_SYNC0. Commands reach the display task the same way the buttons do: as display command
+ * messages (display_cmd.h) queued without waiting; a full queue or text pool answers
+ * CMD_STATUS_BUSY. Nothing here waits for the display task, and the display task never parses. Every command is answered
+ * with CMD_RSP_ACK (or CMD_RSP_STATS) through UART_TX_TryWrite(), so a full TX ring drops the
+ * answer rather than stalling the log task.
+ */
+
+#ifndef CMD_HANDLER_H
+#define CMD_HANDLER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "cmd_proto.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+/**
+ * @def CMD_FRAME_TIMEOUT_MS
+ * @brief A frame still incomplete after this long is dropped (one byte at a time, to resync).
+ */
+#define CMD_FRAME_TIMEOUT_MS    50U
+
+/**
+ * @struct CmdHandlerStats_t
+ * @brief Command counters since boot.
+ */
+typedef struct {
+    uint32_t frames;        /**< Valid frames */
+    uint32_t sync_errors;   /**< Bytes skipped looking for a frame start */
+    uint32_t length_errors; /**< Frames with a length above CMD_MAX_PAYLOAD */
+    uint32_t crc_errors;    /**< Frames with a bad CRC */
+    uint32_t timeouts;      /**< Frames not completed within CMD_FRAME_TIMEOUT_MS */
+    uint32_t rejected;      /**< Valid frames answered with a status other than OK */
+    uint32_t dropped;       /**< Answers lost because the TX ring was full */
+} CmdHandlerStats_t;
+
+/* Exported functions --------------------------------------------------------*/
+/**
+ * @brief  Parse and execute the frame at the start of the received bytes (log task).
+ * @param view Received bytes; the first one is CMD_SYNC0.
+ * @param now  Current tick (ms).
+ * @return Bytes to consume; 0 while the rest of the frame has not arrived.
+ */
+size_t CmdHandler_Process(const UartRxView_t *view, uint32_t now);
+
+/**
+ * @brief  Copy the command counters.
+ * @param stats Destination for the counters.
+ */
+void CmdHandler_GetStats(CmdHandlerStats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CMD_HANDLER_H
@@ -0,0 +1,151 @@
+/**
+ * @file    cmd_proto.h
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Framed binary command protocol on USART3: wire format, parser and encoder.
+ *
+ * @details
+ * Commands from the host and responses from the board share one frame layout:
+ *
+ * @code
+ *   offset  size  field
+ *   0       2     sync 0xA5 0x5A
+ *   2       1     payload length n (at most CMD_MAX_PAYLOAD)
+ *   3       1     type (CmdType_t)
+ *   4       n     payload (multi-byte fields little-endian)
+ *   4+n     2     CRC-16/CCITT-FALSE of bytes 2 .. 4+n-1, little-endian
+ * @endcode
+ *
+ * The first sync byte is not a printable character, so frames and the single-key console
+ * share the RX ring: the console hands everything that starts with CMD_SYNC0 to the parser.
+ * Cmd_Parse() works on the ring in place (UartRxView_t) and never consumes a partial frame;
+ * only a payload that wraps around the end of the ring is copied. A frame with a bad sync,
+ * length or CRC gives up its first byte so the parser can resynchronise on the next one.
+ * No RTOS or HAL dependency; Host/bench/bench_cmd_proto.c fuzzes it.
+ */
+
+#ifndef CMD_PROTO_H
+#define CMD_PROTO_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "uart_rx.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+/** First sync byte */
+#define CMD_SYNC0           0xA5U
+/** Second sync byte */
+#define CMD_SYNC1           0x5AU
+/** Frame header: sync, length, type */
+#define CMD_HEADER_SIZE     4U
+/** Frame trailer: CRC-16 */
+#define CMD_CRC_SIZE        2U
+/** Largest payload */
+#define CMD_MAX_PAYLOAD     64U
+/** Largest frame */
+#define CMD_MAX_FRAME       (CMD_HEADER_SIZE + CMD_MAX_PAYLOAD + CMD_CRC_SIZE)
+
+/** Longest text of CMD_TEXT (bytes, without terminator) */
+#define CMD_TEXT_MAX        31U
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @enum CmdType_t
+ * @brief Frame types. Responses have bit 7 set.
+ */
+typedef enum {
+    CMD_MODE = 0x01,        /**< [mode]: show a screen (DisplayMode_t, not video) */
+    CMD_TEXT = 0x02,        /**< [field][text...]: replace a text field (DisplayTextField_t) */
+    CMD_FPS = 0x03,         /**< [fps]: refresh rate of live screens (1 .. 50) */
+    CMD_CONTRAST = 0x04,    /**< [level]: panel contrast (0 .. 255) */
+    CMD_STATS = 0x05,       /**< []: request CMD_RSP_STATS */
+    CMD_VALUE = 0x06,       /**< [field][int32]: set a dashboard value (0 .. 7) */
+    CMD_IMAGE = 0x07,       /**< [id u16]: show an image asset on the image screen */
+    CMD_ANIM = 0x08,        /**< [id u16][x][y]: start an animation asset on the current screen */
+    CMD_QR = 0x09,          /**< [data]: new QR code payload, 1 .. 63 bytes of any value */
+    CMD_RSP_ACK = 0x81,     /**< [type][CmdStatus_t]: result of a command */
+    CMD_RSP_STATS = 0x85    /**< CmdStatsPayload fields, CMD_STATS_FIELDS x uint32 */
+} CmdType_t;
+
+/**
+ * @enum CmdStatus_t
+ * @brief Status byte of CMD_RSP_ACK.
+ */
+typedef enum {
+    CMD_STATUS_OK = 0,      /**< Applied (or queued to the display task) */
+    CMD_STATUS_UNKNOWN,     /**< Unknown type */
+    CMD_STATUS_BAD_ARG,     /**< Payload length or value out of range */
+    CMD_STATUS_BUSY         /**< Display queue full, try again */
+} CmdStatus_t;
+
+/**
+ * @enum CmdStatsField_t
+ * @brief Order of the uint32 fields of CMD_RSP_STATS.
+ */
+typedef enum {
+    CMD_STAT_UPTIME_MS = 0, /**< Kernel tick */
+    CMD_STAT_MODE,          /**< Current DisplayMode_t */
+    CMD_STAT_CPU_PERMILLE,  /**< CPU load of the last window (0.1 %) */
+    CMD_STAT_HEAP_FREE,     /**< Free FreeRTOS heap (bytes) */
+    CMD_STAT_RX_BYTES,      /**< Bytes received on USART3 */
+    CMD_STAT_RX_OVERRUNS,   /**< Bytes lost by the RX ring */
+    CMD_STAT_FRAMES,        /**< Command frames accepted */
+    CMD_STAT_ERRORS,        /**< Command frames rejected (sync, length, CRC, timeout) */
+    CMD_STATS_FIELDS
+} CmdStatsField_t;
+
+/**
+ * @enum CmdParseResult_t
+ * @brief Result of Cmd_Parse().
+ */
+typedef enum {
+    CMD_PARSE_MORE = 0,     /**< Frame incomplete, nothing consumed */
+    CMD_PARSE_FRAME,        /**< Valid frame, see CmdFrame_t */
+    CMD_PARSE_BAD_SYNC,     /**< First bytes are not a frame start; skip one byte */
+    CMD_PARSE_BAD_LENGTH,   /**< Length above CMD_MAX_PAYLOAD; skip one byte */
+    CMD_PARSE_BAD_CRC       /**< CRC mismatch; skip one byte */
+} CmdParseResult_t;
+
+/**
+ * @struct CmdFrame_t
+ * @brief A parsed frame.
+ */
+typedef struct {
+    uint8_t type;               /**< CmdType_t */
+    uint8_t len;                /**< Payload length */
+    const uint8_t *payload;     /**< Payload, in the ring or in the scratch buffer */
+} CmdFrame_t;
+
+/* Exported functions --------------------------------------------------------*/
+/**
+ * @brief  Parse the frame at the start of the received bytes.
+ * @param view     Received bytes (one or two spans of the RX ring).
+ * @param scratch  CMD_MAX_PAYLOAD bytes, used only if the payload wraps.
+ * @param frame    Set on CMD_PARSE_FRAME (valid until the bytes are consumed).
+ * @param consumed Set to the bytes to consume: the frame, 1 after an error, 0 for MORE.
+ * @return CmdParseResult_t.
+ */
+CmdParseResult_t Cmd_Parse(const UartRxView_t *view, uint8_t *scratch, CmdFrame_t *frame,
+                           size_t *consumed);
+
+/**
+ * @brief  Build a frame.
+ * @param type    CmdType_t.
+ * @param payload Payload (may be NULL if len is 0).
+ * @param len     Payload length (at most CMD_MAX_PAYLOAD).
+ * @param out     Frame output.
+ * @param cap     Size of out.
+ * @return Frame length, 0 if len or cap is out of range.
+ */
+size_t Cmd_Encode(uint8_t type, const uint8_t *payload, size_t len, uint8_t *out, size_t cap);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CMD_PROTO_H
@@ -0,0 +1,39 @@
+/**
+ * @file    console.h
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Single-key command console on USART3 RX.
+ *
+ * @details
+ * Received characters are collected by the USART3 RX DMA ring (uart_rx.h) and executed
+ * later by the log task, so commands never run in interrupt context. Commands:
+ *   - 's': print the RTOS statistics report
+ *   - 'p': show the statistics page on the OLED
+ *   - 'v': hand USART3 to the video sink (video_sink.h) until the stream ends
+ *   - 'f': framebuffer mirror on/off (fb_mirror.h)
+ *   - 'h' or '?': list the commands
+ *
+ * Binary command frames (cmd_proto.h) can be mixed with the keys; they start with the
+ * non-printable CMD_SYNC0 and are executed by the command handler (cmd_handler.h).
+ */
+
+#ifndef CONSOLE_H
+#define CONSOLE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Exported functions --------------------------------------------------------*/
+/**
+ * @brief  Execute the commands received since the last call (log task context).
+ *
+ * Does nothing while the video sink owns the RX ring.
+ */
+void Console_Poll(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CONSOLE_H
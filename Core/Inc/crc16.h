@@ -0,0 +1,52 @@
+/**
+ * @file    crc16.h
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   CRC-16/CCITT-FALSE shared by the serial protocols (video stream, command frames).
+ *
+ * @details
+ * Polynomial 0x1021, initial value 0xFFFF, no reflection, no final XOR ("123456789" gives
+ * 0x29B1). A 16-entry nibble table keeps it at 32 bytes of flash. No RTOS or HAL dependency.
+ */
+
+#ifndef CRC16_H
+#define CRC16_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+/**
+ * @def CRC16_INIT
+ * @brief Initial value of a CRC-16/CCITT-FALSE computation.
+ */
+#define CRC16_INIT  0xFFFFU
+
+/* Exported functions --------------------------------------------------------*/
+/**
+ * @brief  Continue a CRC over another block (data split across buffers).
+ * @param crc  CRC so far (CRC16_INIT for the first block).
+ * @param data Data.
+ * @param len  Length in bytes.
+ * @return Updated CRC.
+ */
+uint16_t CRC16_Update(uint16_t crc, const uint8_t *data, size_t len);
+
+/**
+ * @brief  CRC of one block.
+ * @param data Data.
+ * @param len  Length in bytes.
+ * @return CRC.
+ */
+uint16_t CRC16_Compute(const uint8_t *data, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CRC16_H
@@ -0,0 +1,110 @@
+/**
+ * @file    deferred_log.h
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Deferred, non-blocking logger for ISRs and tasks on NUCLEO-F429ZI.
+ *
+ * @details
+ * Interrupt handlers must not format strings or wait for the UART. Instead they call
+ * Log_Write() with a format id and up to two integer arguments; the record is stored in a
+ * lock-free ring (see log_ring.h) and a low-priority log task formats and transmits it
+ * over UART3 later.
+ */
+
+#ifndef DEFERRED_LOG_H
+#define DEFERRED_LOG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include "cmsis_os2.h"
+
+/**
+ * @enum LogFormatId_t
+ * @brief Identifiers of the log messages known to the log task.
+ *
+ * Each id selects a printf-style format string in deferred_log.c; integer arguments
+ * are printed with %lu.
+ */
+typedef enum {
+    LOG_FMT_SW1_SHOW_BONGO = 0,   /**< "SW1: Show bongo cat screen" */
+    LOG_FMT_SW2_SHOW_QRCODE,      /**< "SW2: Show QR code page" */
+    LOG_FMT_SW_QUEUE_FULL,        /**< "SW<arg0>: Failed to send mode to queue" */
+    LOG_FMT_UNKNOWN_GPIO,         /**< "Unknown GPIO interrupt (pin=<arg0>), ignored!" */
+    LOG_FMT_SW_TOGGLE_HUD,        /**< "SW<arg0>: Perf HUD on=<arg1>" */
+    LOG_FMT_BOOT_SPLASH,          /**< "Boot: splash <arg0> us after reset, display task at tick <arg1>" */
+    LOG_FMT_ASSET_PACK_INVALID,   /**< "Assets: no valid pack at 0x<arg0>, <arg1> expected" */
+    LOG_FMT_VIDEO_START,          /**< "Video: sink at <arg0> baud, idle timeout <arg1> ms" */
+    LOG_FMT_VIDEO_STOP,           /**< "Video: stopped after <arg0> frames, <arg1> errors" */
+    LOG_FMT_MIRROR_ON,            /**< "Mirror: on, one frame per <arg0> ms at most, key frame every <arg1> ms" */
+    LOG_FMT_MIRROR_OFF,           /**< "Mirror: off after <arg0> frames, <arg1> bytes" */
+    LOG_FMT_DISPLAY_CMD_REJECTED, /**< "Display: command <arg0> rejected, id <arg1>" */
+    LOG_FMT_COUNT                 /**< Number of format ids (not a message) */
+} LogFormatId_t;
+
+/* Exported constants --------------------------------------------------------*/
+/**
+ * @def LOG_TASK_STACK_SIZE_BYTES
+ * @brief Stack size (bytes) for the log task (snprintf and stats sampling need headroom).
+ */
+#define LOG_TASK_STACK_SIZE_BYTES    (384 * 4)
+
+/**
+ * @def LOG_TASK_THREAD_NAME
+ * @brief Name of the log RTOS task.
+ */
+#define LOG_TASK_THREAD_NAME         "Log_Task"
+
+/**
+ * @def LOG_TASK_THREAD_PRIORITY
+ * @brief Priority of the log task (below the OLED task).
+ */
+#define LOG_TASK_THREAD_PRIORITY     osPriorityLow
+
+/**
+ * @def LOG_DRAIN_PERIOD_MS
+ * @brief Interval (milliseconds) at which the log task drains the ring.
+ */
+#define LOG_DRAIN_PERIOD_MS          20
+
+/**
+ * @def LOG_LINE_MAX_LEN
+ * @brief Maximum length of one formatted log line, including CR/LF.
+ */
+#define LOG_LINE_MAX_LEN             80
+
+/* Exported functions --------------------------------------------------------*/
+/**
+ * @brief  Initialize the log ring and create the log task.
+ *
+ * Call once before the RTOS kernel starts. On failure an error message is sent via UART3
+ * and Error_Handler() is called.
+ */
+void Log_Init(void);
+
+/**
+ * @brief  Record a log message without formatting or blocking.
+ *
+ * Safe to call from any ISR at or below configMAX_SYSCALL_INTERRUPT_PRIORITY and from
+ * any task. If the ring is full the record is dropped and counted.
+ *
+ * @param fmt_id Message format id.
+ * @param arg0   First integer argument (ignored by formats without arguments).
+ * @param arg1   Second integer argument.
+ */
+void Log_Write(LogFormatId_t fmt_id, uint32_t arg0, uint32_t arg1);
+
+/**
+ * @brief  Number of log records dropped because the ring was full.
+ * @return Dropped record count.
+ */
+uint32_t Log_GetDroppedCount(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DEFERRED_LOG_H
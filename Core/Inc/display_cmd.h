@@ -0,0 +1,170 @@
+/**
+ * @file    display_cmd.h
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Display command messages: what the display task is asked to show.
+ *
+ * @details
+ * Everything that changes the panel reaches the display task as a DisplayCmd_t on
+ * display_cmd_queue: a screen change (buttons, console, command frames), a redraw request,
+ * a new text or value for a field of a screen, an image or animation to show, the live
+ * refresh rate and the panel contrast. A message is 16 bytes and copied into the queue; a
+ * text payload travels as a pointer to a MEM_POOL_TEXT block, which the display task keeps
+ * as the field's text until the next one replaces it, so text is copied once, by the sender.
+ *
+ * The task applies every queued message before it draws, so a burst of updates costs one
+ * frame. All DisplayCmd_...() senders use a zero timeout and may be called from tasks and
+ * interrupt handlers; on osErrorResource nothing was queued and nothing leaks.
+ */
+
+#ifndef DISPLAY_CMD_H
+#define DISPLAY_CMD_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+#include "cmsis_os2.h"
+#include "rtos_tasks.h"
+#include "asset_pack.h"
+#include "mem_pool.h"
+
+/* Exported constants --------------------------------------------------------*/
+/**
+ * @def DISPLAY_TEXT_MAX
+ * @brief Longest text of a field (bytes, without terminator).
+ */
+#define DISPLAY_TEXT_MAX        (MEM_POOL_TEXT_SIZE - 1)
+
+/**
+ * @def DISPLAY_VALUE_COUNT
+ * @brief Number of value fields (shown on the dashboard).
+ */
+#define DISPLAY_VALUE_COUNT     SCREENS_DASHBOARD_VALUES
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @enum DisplayCmdType_t
+ * @brief Display command types.
+ */
+typedef enum {
+    DISPLAY_CMD_SHOW = 0,       /**< Show screen id (DisplayMode_t); the shown screen is redrawn */
+    DISPLAY_CMD_REFRESH,        /**< Redraw the current screen */
+    DISPLAY_CMD_SET_TEXT,       /**< Text field `field` becomes `text` */
+    DISPLAY_CMD_SET_VALUE,      /**< Value field `field` becomes `value` */
+    DISPLAY_CMD_SHOW_IMAGE,     /**< Show image asset id on the image screen */
+    DISPLAY_CMD_START_ANIM,     /**< Start animation asset id at (x, y) on the current screen */
+    DISPLAY_CMD_SET_FPS,        /**< Refresh rate of live screens: `value` frames/s */
+    DISPLAY_CMD_SET_CONTRAST,   /**< Panel contrast `value` */
+    DISPLAY_CMD_SET_QR          /**< QR code payload: `value` bytes of `text` */
+} DisplayCmdType_t;
+
+/**
+ * @enum DisplayTextField_t
+ * @brief Text fields.
+ */
+typedef enum {
+    DISPLAY_TEXT_INFO_0 = 0,    /**< First line of the info screen */
+    DISPLAY_TEXT_INFO_1,        /**< Second line of the info screen */
+    DISPLAY_TEXT_INFO_2,        /**< Third line of the info screen */
+    DISPLAY_TEXT_LABEL_0,       /**< Label of dashboard value 0; labels 1 .. 7 follow */
+    DISPLAY_TEXT_COUNT = DISPLAY_TEXT_LABEL_0 + DISPLAY_VALUE_COUNT  /**< Number of text fields */
+} DisplayTextField_t;
+
+/**
+ * @struct DisplayCmd_t
+ * @brief One message on display_cmd_queue.
+ */
+typedef struct {
+    uint8_t type;       /**< DisplayCmdType_t */
+    uint8_t field;      /**< Text or value field */
+    uint16_t id;        /**< Screen (SHOW) or asset id (SHOW_IMAGE, START_ANIM) */
+    int32_t value;      /**< SET_VALUE, SET_FPS, SET_CONTRAST; SET_QR: payload length */
+    char *text;         /**< SET_TEXT, SET_QR: NUL-terminated MEM_POOL_TEXT block, owned by the receiver */
+    uint8_t x;          /**< START_ANIM: left edge (pixels) */
+    uint8_t y;          /**< START_ANIM: top edge (pixels) */
+} DisplayCmd_t;
+
+/* Exported functions --------------------------------------------------------*/
+/**
+ * @brief  Show a screen (a screen already shown is redrawn, its animations keep running).
+ * @param mode Display mode.
+ * @return osOK, osErrorParameter or osErrorResource (queue full).
+ */
+osStatus_t DisplayCmd_Show(DisplayMode_t mode);
+
+/**
+ * @brief  Redraw the current screen.
+ * @return osOK or osErrorResource (queue full).
+ */
+osStatus_t DisplayCmd_Refresh(void);
+
+/**
+ * @brief  Replace the text of a field.
+ * @param field DisplayTextField_t.
+ * @param text  Text, not NUL-terminated (truncated to DISPLAY_TEXT_MAX bytes).
+ * @param len   Text length.
+ * @return osOK, osErrorParameter or osErrorResource (queue or text pool full).
+ */
+osStatus_t DisplayCmd_SetText(uint32_t field, const char *text, size_t len);
+
+/**
+ * @brief  Set a value field.
+ * @param field Field (0 .. DISPLAY_VALUE_COUNT - 1).
+ * @param value New value.
+ * @return osOK, osErrorParameter or osErrorResource (queue full).
+ */
+osStatus_t DisplayCmd_SetValue(uint32_t field, int32_t value);
+
+/**
+ * @brief  Show an image asset on the image screen and switch to it.
+ * @param id Asset id of an image.
+ * @return osOK or osErrorResource (queue full).
+ */
+osStatus_t DisplayCmd_ShowImage(AssetId_t id);
+
+/**
+ * @brief  Start an animation asset on the current screen (it stops when the screen changes).
+ * @param id Asset id of an animation.
+ * @param x  Left edge (pixels).
+ * @param y  Top edge (pixels).
+ * @return osOK or osErrorResource (queue full).
+ */
+osStatus_t DisplayCmd_StartAnim(AssetId_t id, uint8_t x, uint8_t y);
+
+/**
+ * @brief  Set the refresh rate of screens with live data (statistics page).
+ * @param fps Frames per second (1 .. OLED_REFRESH_FPS_MAX).
+ * @return osOK, osErrorParameter or osErrorResource (queue full).
+ */
+osStatus_t DisplayCmd_SetRefreshRate(uint32_t fps);
+
+/**
+ * @brief  Set the panel contrast.
+ * @param level Contrast (0 .. 255).
+ * @return osOK or osErrorResource (queue full).
+ */
+osStatus_t DisplayCmd_SetContrast(uint8_t level);
+
+/**
+ * @brief  Encode a new payload for the QR code screen.
+ * @param data Payload, any bytes (1 .. DISPLAY_TEXT_MAX).
+ * @param len  Payload length.
+ * @return osOK, osErrorParameter or osErrorResource (queue or text pool full).
+ */
+osStatus_t DisplayCmd_SetQRPayload(const uint8_t *data, size_t len);
+
+/**
+ * @brief  Free the payload of a message that was not kept (receiver side).
+ * @param cmd Message.
+ */
+void DisplayCmd_Release(DisplayCmd_t *cmd);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DISPLAY_CMD_H
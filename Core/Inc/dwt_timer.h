@@ -0,0 +1,71 @@
+/**
+ * @file    dwt_timer.h
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Cortex-M4 DWT cycle counter access for timestamps and profiling.
+ *
+ * @details
+ * The DWT cycle counter (CYCCNT) runs at the core clock (168 MHz on this board) and wraps
+ * every ~25.5 s. It is used for trace timestamps, for measuring short code sections and for
+ * busy-wait delays shorter than one RTOS tick (display controller timing).
+ */
+
+#ifndef DWT_TIMER_H
+#define DWT_TIMER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported functions --------------------------------------------------------*/
+/**
+ * @brief  Enable the trace unit and start the DWT cycle counter.
+ *
+ * Safe to call more than once; the counter is only reset on the first call.
+ */
+void DWT_Timer_Init(void);
+
+/**
+ * @brief  Current value of the free-running cycle counter.
+ * @return Core clock cycles (wraps at 2^32).
+ */
+static inline uint32_t DWT_Timer_GetCycles(void)
+{
+    return DWT->CYCCNT;
+}
+
+/**
+ * @brief  Convert a cycle count to microseconds at the current core clock.
+ * @param  cycles Cycle count.
+ * @return Microseconds (rounded down).
+ */
+uint32_t DWT_Timer_CyclesToUs(uint32_t cycles);
+
+/**
+ * @brief  Busy-wait for at least the given number of core clock cycles.
+ * @param  cycles Cycles to wait (below 2^31).
+ * @note   The cycle counter must be running (DWT_Timer_Init()). Interrupts and task
+ *         switches may lengthen the wait, never shorten it.
+ */
+void DWT_Timer_DelayCycles(uint32_t cycles);
+
+/**
+ * @brief  Busy-wait for at least the given number of microseconds.
+ * @param  us Microseconds (up to ~12 s at 168 MHz).
+ */
+void DWT_Timer_DelayUs(uint32_t us);
+
+/**
+ * @brief  Busy-wait for at least the given number of nanoseconds (rounded up to whole cycles).
+ * @param  ns Nanoseconds.
+ */
+void DWT_Timer_DelayNs(uint32_t ns);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DWT_TIMER_H
@@ -0,0 +1,102 @@
+/**
+ * @file    fb_mirror.h
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Framebuffer mirror: streams what the panel shows to the host over USART3.
+ *
+ * @details
+ * When enabled (console command 'f'), the display task hands its buffer to FbMirror_Update()
+ * after every wake-up. Frames go out in the video stream format (video_stream.h), as the
+ * tile delta against the last frame mirrored, each stamped with the tick at which it reached
+ * the panel (VIDEO_FLAG_STAMP). The packets share USART3 TX with the log; Host/build/fb_viewer
+ * finds them between the text, rebuilds the frames and reports the end-to-end latency.
+ *
+ * The mirror never slows the display down: at most one frame per FB_MIRROR_INTERVAL_MS and
+ * at most FB_MIRROR_LINE_SHARE percent of the line are used, and a packet is only queued if
+ * the TX ring has room for all of it (UART_TX_TryWrite()); otherwise the newest frame is
+ * tried again later. A key frame every FB_MIRROR_KEY_INTERVAL_MS lets a viewer join at any
+ * time. The mirror pauses while the video sink has switched the line rate.
+ */
+
+#ifndef FB_MIRROR_H
+#define FB_MIRROR_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @struct FbMirrorStats_t
+ * @brief Mirror counters since it was last enabled.
+ */
+typedef struct {
+    uint32_t frames;        /**< Packets queued */
+    uint32_t key_frames;    /**< Of which key frames */
+    uint32_t bytes;         /**< Bytes queued */
+    uint32_t deferred;      /**< Updates postponed by the rate limit */
+    uint32_t busy;          /**< Packets postponed because the TX ring was too full */
+    uint32_t encode_us;     /**< Encode time of the last packet */
+} FbMirrorStats_t;
+
+/* Exported constants --------------------------------------------------------*/
+/**
+ * @def FB_MIRROR_INTERVAL_MS
+ * @brief Shortest time between two mirrored frames.
+ */
+#define FB_MIRROR_INTERVAL_MS       100U
+
+/**
+ * @def FB_MIRROR_KEY_INTERVAL_MS
+ * @brief A key frame is sent at least this often, even for a static screen.
+ */
+#define FB_MIRROR_KEY_INTERVAL_MS   5000U
+
+/**
+ * @def FB_MIRROR_LINE_SHARE
+ * @brief Share of the console line rate the mirror may use on average (percent).
+ */
+#define FB_MIRROR_LINE_SHARE        50U
+
+/* Exported functions --------------------------------------------------------*/
+/**
+ * @brief  Switch the mirror on or off; switching on starts with a key frame.
+ * @param enable true to stream frames.
+ */
+void FbMirror_SetEnabled(bool enable);
+
+/**
+ * @brief  Whether the mirror is on.
+ * @return true if enabled.
+ */
+bool FbMirror_IsEnabled(void);
+
+/**
+ * @brief  Mirror the frame on the panel if it changed and the rate limit allows (display task).
+ * @param fb         u8g2 frame buffer, equal to what the panel shows.
+ * @param flushed_at Tick at which the last flush of @p fb ended.
+ * @param now        Current tick (ms).
+ */
+void FbMirror_Update(const uint8_t *fb, uint32_t flushed_at, uint32_t now);
+
+/**
+ * @brief  Time until a postponed frame may be sent.
+ * @param now Current tick (ms).
+ * @return Milliseconds, or osWaitForever if nothing is pending.
+ */
+uint32_t FbMirror_NextWait(uint32_t now);
+
+/**
+ * @brief  Copy the mirror counters.
+ * @param stats Destination for the counters.
+ */
+void FbMirror_GetStats(FbMirrorStats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // FB_MIRROR_H
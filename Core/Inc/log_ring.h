@@ -0,0 +1,106 @@
+/**
+ * @file    log_ring.h
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Lock-free multi-producer ring of compact binary log records.
+ *
+ * @details
+ * This header defines the fixed-size log record and the ring buffer used by the deferred
+ * logger. Producers (ISRs and tasks) only reserve a slot with a single compare-and-swap,
+ * copy a format id plus up to two 32-bit arguments, and publish the slot. All formatting
+ * and UART output happens later in a low-priority consumer task, so the producer cost is
+ * a few tens of cycles regardless of the message. The module has no HAL or RTOS dependency
+ * and can be compiled and benchmarked on the host.
+ */
+
+#ifndef LOG_RING_H
+#define LOG_RING_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Exported constants --------------------------------------------------------*/
+/**
+ * @def LOG_RING_CAPACITY
+ * @brief Number of records held by the ring (must be a power of two).
+ */
+#define LOG_RING_CAPACITY        64
+
+/**
+ * @def LOG_RECORD_MAX_ARGS
+ * @brief Maximum number of 32-bit arguments carried by one record.
+ */
+#define LOG_RECORD_MAX_ARGS      2
+
+/**
+ * @struct LogRecord_t
+ * @brief Compact binary log record (16 bytes).
+ */
+typedef struct {
+    uint32_t timestamp;                   /**< Producer timestamp (HAL tick, ms) */
+    uint16_t fmt_id;                      /**< Index into the consumer's format table */
+    uint8_t  nargs;                       /**< Number of valid entries in args[] */
+    volatile uint8_t committed;           /**< Non-zero once the producer has published the slot */
+    uint32_t args[LOG_RECORD_MAX_ARGS];   /**< Raw format arguments */
+} LogRecord_t;
+
+/**
+ * @struct LogRing_t
+ * @brief Multi-producer, single-consumer record ring.
+ */
+typedef struct {
+    LogRecord_t records[LOG_RING_CAPACITY]; /**< Record storage */
+    volatile uint32_t head;                 /**< Next slot to reserve (producers) */
+    volatile uint32_t tail;                 /**< Next slot to drain (consumer) */
+    volatile uint32_t dropped;              /**< Records rejected because the ring was full */
+} LogRing_t;
+
+/* Exported functions --------------------------------------------------------*/
+/**
+ * @brief Reset a ring to the empty state.
+ * @param ring Pointer to the ring.
+ */
+void LogRing_Init(LogRing_t *ring);
+
+/**
+ * @brief Append a record to the ring (ISR and task safe, never blocks).
+ *
+ * @param ring      Pointer to the ring.
+ * @param timestamp Timestamp stored with the record.
+ * @param fmt_id    Format identifier.
+ * @param nargs     Number of arguments used (0..LOG_RECORD_MAX_ARGS).
+ * @param arg0      First argument.
+ * @param arg1      Second argument.
+ * @retval true  Record stored.
+ * @retval false Ring full, record dropped and counted.
+ */
+bool LogRing_Push(LogRing_t *ring, uint32_t timestamp, uint16_t fmt_id, uint8_t nargs,
+                  uint32_t arg0, uint32_t arg1);
+
+/**
+ * @brief Remove the oldest published record (single consumer only).
+ *
+ * @param ring Pointer to the ring.
+ * @param out  Destination for the record.
+ * @retval true  A record was copied to @p out.
+ * @retval false Ring empty, or the oldest slot is still being written.
+ */
+bool LogRing_Pop(LogRing_t *ring, LogRecord_t *out);
+
+/**
+ * @brief Number of records dropped since initialization.
+ * @param ring Pointer to the ring.
+ * @return Dropped record count.
+ */
+uint32_t LogRing_GetDropped(const LogRing_t *ring);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LOG_RING_H
@@ -0,0 +1,111 @@
+/**
+ * @file    mem_layout.h
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Placement of hot CPU-only data in CCM RAM and of DMA buffers in main SRAM.
+ *
+ * @details
+ * The STM32F429 has 64 KB of core-coupled memory (CCM) at 0x10000000 on the Cortex-M4 D-bus.
+ * It has no wait states and no other bus master can reach it, so CPU accesses there never
+ * compete with DMA streams for SRAM1, but DMA cannot read or write it either.
+ *
+ * - CCM_SECTION(subsys) places a zero-initialised object in ".bss.ccm.<subsys>". Use it for
+ *   data only the CPU touches: task stacks, the RTOS heap, the u8g2 state, rings, statistics,
+ *   caches and scratch buffers.
+ * - DMA_SECTION(subsys) places a buffer in ".bss.dma.<subsys>", which the scatter file and the
+ *   GNU ld script keep in SRAM1 (they also assert that it does not overlap CCM). Every buffer
+ *   handed to a DMA stream must use it, or be in a RAM_SECTION() (rtos_static.h).
+ * - MemLayout_CheckDma() verifies the same at run time before a driver first uses a buffer.
+ *
+ * Never start a DMA transfer from or to a local variable: task stacks live in CCM.
+ * Build with MEM_CCM_ENABLE=0 to move everything back into main SRAM (e.g. to compare).
+ */
+
+#ifndef MEM_LAYOUT_H
+#define MEM_LAYOUT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+#include "rtos_static.h"
+
+/* Exported constants --------------------------------------------------------*/
+/**
+ * @def MEM_CCM_ENABLE
+ * @brief Set to 0 to place CCM_SECTION() objects in main SRAM instead.
+ */
+#ifndef MEM_CCM_ENABLE
+#define MEM_CCM_ENABLE          1
+#endif
+
+/**
+ * @def MEM_CCM_BASE
+ * @brief First address of the CCM data RAM.
+ */
+#define MEM_CCM_BASE            0x10000000UL
+
+/**
+ * @def MEM_CCM_SIZE
+ * @brief Size of the CCM data RAM (bytes).
+ */
+#define MEM_CCM_SIZE            0x10000UL
+
+/* Exported macros -----------------------------------------------------------*/
+/**
+ * @def CCM_SECTION
+ * @brief Place a zero-initialised, CPU-only object in CCM RAM.
+ * @param subsys Subsystem name as a string literal (reported by Tools/map_report.py).
+ */
+#if MEM_CCM_ENABLE && (defined(__GNUC__) || defined(__ARMCC_VERSION)) && !defined(__APPLE__)
+#define CCM_SECTION(subsys)     __attribute__((section(".bss.ccm." subsys)))
+#else
+#define CCM_SECTION(subsys)     RAM_SECTION(subsys)
+#endif
+
+/**
+ * @def DMA_SECTION
+ * @brief Place a zero-initialised DMA buffer in main SRAM (never CCM).
+ * @param subsys Subsystem name as a string literal.
+ */
+#if (defined(__GNUC__) || defined(__ARMCC_VERSION)) && !defined(__APPLE__)
+#define DMA_SECTION(subsys)     __attribute__((section(".bss.dma." subsys)))
+#else
+#define DMA_SECTION(subsys)
+#endif
+
+/**
+ * @def MEM_IN_CCM
+ * @brief Non-zero if the address lies in CCM RAM.
+ */
+#define MEM_IN_CCM(addr)        (((uintptr_t)(addr) - MEM_CCM_BASE) < MEM_CCM_SIZE)
+
+/* Exported functions --------------------------------------------------------*/
+/**
+ * @brief  Zero the CCM sections where the C library start-up does not (GNU ld builds).
+ *         Call first thing in main(); a no-op with Arm Compiler (scatter loading clears them).
+ */
+void MemLayout_Init(void);
+
+/**
+ * @brief  Stop with an error if a buffer meant for DMA overlaps CCM RAM.
+ * @param buf  Buffer.
+ * @param len  Length in bytes.
+ * @param name Buffer name for the panic message.
+ */
+void MemLayout_CheckDma(const void *buf, size_t len, const char *name);
+
+/**
+ * @brief  Measure CPU load/store cost in SRAM1 and CCM, with and without a concurrent
+ *         DMA2 memory-to-memory stream into SRAM1, and print the result over UART3.
+ */
+void MemLayout_RunBench(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MEM_LAYOUT_H
@@ -0,0 +1,114 @@
+/**
+ * @file    mem_pool.h
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Fixed-block memory pools for text payloads and frame buffers.
+ *
+ * @details
+ * Each pool is a CMSIS-RTOS2 osMemoryPool whose control block and block array are static,
+ * so the pools take nothing from the FreeRTOS heap and cannot fragment it. Allocation and
+ * release are O(1) (free list plus counting semaphore) and work from tasks and, with a zero
+ * timeout, from interrupt handlers. Usage counters (in use, peak, failures) are kept per pool
+ * and printed by MemPool_Print() (console key 'm').
+ */
+
+#ifndef MEM_POOL_H
+#define MEM_POOL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include "cmsis_os2.h"
+
+/**
+ * @enum MemPoolId_t
+ * @brief Available pools.
+ */
+typedef enum {
+    MEM_POOL_TEXT = 0,          /**< Text payloads attached to commands */
+    MEM_POOL_FRAME,             /**< Additional 128x64 frame buffers */
+    MEM_POOL_COUNT
+} MemPoolId_t;
+
+/**
+ * @struct MemPoolStats_t
+ * @brief Usage counters of one pool.
+ */
+typedef struct {
+    const char *name;       /**< Pool name */
+    uint32_t block_size;    /**< Usable bytes per block */
+    uint32_t capacity;      /**< Number of blocks */
+    uint32_t in_use;        /**< Blocks currently allocated */
+    uint32_t peak;          /**< Highest in_use since start-up */
+    uint32_t allocs;        /**< Successful allocations */
+    uint32_t failures;      /**< Allocations that returned NULL */
+} MemPoolStats_t;
+
+/* Exported constants --------------------------------------------------------*/
+/**
+ * @def MEM_POOL_TEXT_SIZE
+ * @brief Block size (bytes) of the text payload pool.
+ */
+#define MEM_POOL_TEXT_SIZE           64
+
+/**
+ * @def MEM_POOL_TEXT_COUNT
+ * @brief Number of text payload blocks.
+ */
+#define MEM_POOL_TEXT_COUNT          16
+
+/**
+ * @def MEM_POOL_FRAME_SIZE
+ * @brief Block size (bytes) of the frame buffer pool (128 x 64 / 8).
+ */
+#define MEM_POOL_FRAME_SIZE          1024
+
+/**
+ * @def MEM_POOL_FRAME_COUNT
+ * @brief Number of additional frame buffers (the mirror's last frame, lent to the 'c' bench while
+ *        the mirror is off).
+ */
+#define MEM_POOL_FRAME_COUNT         1
+
+/* Exported functions --------------------------------------------------------*/
+/**
+ * @brief  Create all pools (after osKernelInitialize(), before any task uses them).
+ */
+void MemPool_Init(void);
+
+/**
+ * @brief  Take one block from a pool.
+ * @param pool    Pool.
+ * @param timeout Ticks to wait for a free block (must be 0 in interrupt context).
+ * @return Block of at least the pool's block size, or NULL.
+ */
+void *MemPool_Alloc(MemPoolId_t pool, uint32_t timeout);
+
+/**
+ * @brief  Return a block to its pool (task or interrupt context).
+ * @param pool  Pool the block came from.
+ * @param block Block returned by MemPool_Alloc().
+ * @return osOK, or osErrorParameter if the block does not belong to the pool.
+ */
+osStatus_t MemPool_Free(MemPoolId_t pool, void *block);
+
+/**
+ * @brief  Copy the usage counters of a pool.
+ * @param pool  Pool.
+ * @param stats Destination.
+ */
+void MemPool_GetStats(MemPoolId_t pool, MemPoolStats_t *stats);
+
+/**
+ * @brief  Print the usage of every pool and of the FreeRTOS heap over UART3.
+ */
+void MemPool_Print(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MEM_POOL_H
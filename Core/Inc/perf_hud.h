@@ -0,0 +1,104 @@
+/**
+ * @file    perf_hud.h
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   On-screen performance overlay for the OLED display task.
+ *
+ * @details
+ * The HUD measures each frame of OLED_Display_Task (render time, flush time and I2C bytes per
+ * frame) with the DWT cycle counter, averages them over PERF_HUD_UPDATE_MS and draws them, with
+ * the frame rate and CPU load, in the top-right corner using a 4x6 font. Text is re-formatted
+ * only when a displayed value changes; otherwise the cached strings are just redrawn.
+ *
+ * Call sequence per frame:
+ *   PerfHUD_FrameStart() -> render screen -> PerfHUD_Draw() -> u8g2_SendBuffer() -> PerfHUD_FrameEnd()
+ * A partial frame (redrawn widgets, widget.h) passes its tile set to PerfHUD_Draw() and sends
+ * only those tiles. Between frames the overlay is a region of its own: when PerfHUD_Update()
+ * reports new text, PerfHUD_DrawOverlay() redraws just the box and the caller sends its tiles,
+ * so the HUD never forces a frame of the screen under it.
+ */
+
+#ifndef PERF_HUD_H
+#define PERF_HUD_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include "u8g2.h"
+#include "video_stream.h"
+
+/* Exported constants --------------------------------------------------------*/
+/**
+ * @def PERF_HUD_UPDATE_MS
+ * @brief Averaging window (milliseconds) of the displayed values.
+ */
+#define PERF_HUD_UPDATE_MS      1000
+
+/**
+ * @def PERF_HUD_ENABLED_AT_BOOT
+ * @brief Initial HUD state (0 = hidden until toggled).
+ */
+#define PERF_HUD_ENABLED_AT_BOOT  0
+
+/* Exported functions --------------------------------------------------------*/
+/**
+ * @brief  Show or hide the HUD (ISR safe).
+ */
+void PerfHUD_Toggle(void);
+
+/**
+ * @brief  Whether the HUD is currently shown.
+ * @return Non-zero if shown.
+ */
+uint8_t PerfHUD_IsEnabled(void);
+
+/**
+ * @brief  Mark the start of a frame (before the screen renderer runs).
+ */
+void PerfHUD_FrameStart(void);
+
+/**
+ * @brief  Close the render measurement and draw the overlay into the frame buffer.
+ *
+ * Call after the screen renderer and before u8g2_SendBuffer(). The overlay's own drawing
+ * time is excluded from both the render and the flush figures.
+ *
+ * @param u8g2  Pointer to the u8g2 display structure.
+ * @param tiles Tile set of a partial frame (the overlay's tiles are added), NULL for a full frame.
+ */
+void PerfHUD_Draw(u8g2_t *u8g2, VideoTiles_t *tiles);
+
+/**
+ * @brief  Publish the window averages if due and bring the overlay text up to date.
+ * @param now Current tick (ms).
+ * @return Non-zero if the overlay is shown and its text changed since it was last drawn.
+ */
+uint8_t PerfHUD_Update(uint32_t now);
+
+/**
+ * @brief  Time until the averaging window closes and the text may change.
+ * @param now Current tick (ms).
+ * @return Milliseconds, or osWaitForever while the overlay is hidden.
+ */
+uint32_t PerfHUD_NextDue(uint32_t now);
+
+/**
+ * @brief  Redraw only the overlay box (no measurement); nothing is drawn while it is hidden.
+ * @param u8g2  Pointer to the u8g2 display structure.
+ * @param tiles Tile set the box's tiles are added to, or NULL.
+ */
+void PerfHUD_DrawOverlay(u8g2_t *u8g2, VideoTiles_t *tiles);
+
+/**
+ * @brief  Mark the end of the frame (after u8g2_SendBuffer()).
+ */
+void PerfHUD_FrameEnd(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // PERF_HUD_H
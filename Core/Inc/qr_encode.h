@@ -0,0 +1,112 @@
+/**
+ * @file    qr_encode.h
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   QR code encoder for the OLED: versions 1-4, byte mode, error correction L and M.
+ *
+ * @details
+ * QR_Encode() picks the smallest version that holds the payload, appends Reed-Solomon error
+ * correction (table-driven GF(256) arithmetic from flash), places the modules and applies
+ * the mask with the lowest ISO/IEC 18004 penalty score. The symbol is a 33 x 33 bit matrix
+ * inside QrCode_t (169 bytes); the encoder itself needs about 300 bytes of stack (codeword
+ * buffers and one Reed-Solomon block) and no heap. Masking and scoring work on whole module
+ * rows as 64-bit words, so the run time depends only on the version; Host/bench/bench_qr.c
+ * measures it. No RTOS or HAL dependency: it builds on the host.
+ */
+
+#ifndef QR_ENCODE_H
+#define QR_ENCODE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+/**
+ * @def QR_VERSION_MAX
+ * @brief Largest supported symbol version.
+ */
+#define QR_VERSION_MAX          4
+
+/**
+ * @def QR_SIZE_MAX
+ * @brief Modules per side of the largest supported symbol.
+ */
+#define QR_SIZE_MAX             (17 + 4 * QR_VERSION_MAX)
+
+/**
+ * @def QR_ROW_BYTES
+ * @brief Bytes per module row of QrCode_t::modules.
+ */
+#define QR_ROW_BYTES            ((QR_SIZE_MAX + 7) / 8)
+
+/**
+ * @def QR_PAYLOAD_MAX
+ * @brief Longest payload (bytes): version 4, error correction L.
+ */
+#define QR_PAYLOAD_MAX          78
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @enum QrEcc_t
+ * @brief Error correction level.
+ */
+typedef enum {
+    QR_ECC_L = 0,   /**< About 7 % of the codewords can be restored */
+    QR_ECC_M        /**< About 15 % of the codewords can be restored */
+} QrEcc_t;
+
+/**
+ * @struct QrCode_t
+ * @brief An encoded symbol.
+ */
+typedef struct {
+    uint8_t version;                                /**< 1 .. QR_VERSION_MAX */
+    uint8_t size;                                   /**< Modules per side (17 + 4 * version) */
+    uint8_t ecc;                                    /**< QrEcc_t */
+    uint8_t mask;                                   /**< Applied mask pattern (0 .. 7) */
+    uint8_t modules[QR_SIZE_MAX][QR_ROW_BYTES];     /**< Bit x % 8 of byte x / 8 of row y: 1 = dark */
+} QrCode_t;
+
+/* Exported functions --------------------------------------------------------*/
+/**
+ * @brief  Encode a payload in byte mode in the smallest version that holds it.
+ * @param qr   Symbol to fill.
+ * @param data Payload (any bytes; URLs and text are UTF-8).
+ * @param len  Payload length.
+ * @param ecc  Error correction level.
+ * @return 0 on success, -1 if the payload does not fit in version QR_VERSION_MAX (qr is then
+ *         left unchanged).
+ */
+int QR_Encode(QrCode_t *qr, const uint8_t *data, size_t len, QrEcc_t ecc);
+
+/**
+ * @brief  Byte-mode capacity of a version.
+ * @param version 1 .. QR_VERSION_MAX.
+ * @param ecc     Error correction level.
+ * @return Largest payload in bytes, 0 for an unsupported version.
+ */
+size_t QR_Capacity(uint8_t version, QrEcc_t ecc);
+
+/**
+ * @brief  Colour of one module.
+ * @param qr Encoded symbol.
+ * @param x  Column (0 .. size - 1).
+ * @param y  Row (0 .. size - 1).
+ * @return true for a dark module.
+ */
+static inline bool QR_GetModule(const QrCode_t *qr, uint8_t x, uint8_t y)
+{
+    return ((qr->modules[y][x >> 3] >> (x & 7U)) & 1U) != 0U;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // QR_ENCODE_H
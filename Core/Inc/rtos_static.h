@@ -0,0 +1,65 @@
+/**
+ * @file    rtos_static.h
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Static-allocation build mode of the RTOS objects and RAM section placement.
+ *
+ * @details
+ * With RTOS_STATIC_ALLOC=1 (Keil: *Options for Target → C/C++ → Define*) every task, queue
+ * and semaphore of the application is created from control blocks and stacks reserved at
+ * link time, the idle and timer service tasks use buffers supplied by freertos.c, and the
+ * FreeRTOS heap shrinks to RTOS_STATIC_HEAP_SIZE. Start-up then performs no heap
+ * allocation, and an object that does not fit fails at link time instead of at boot.
+ *
+ * Independently of the mode, statically reserved RAM is placed in sections named
+ * ".bss.ram.<subsystem>" so that Tools/map_report.py can total RAM per subsystem from the
+ * linker map. The prefix keeps the sections zero-initialised (ZI) with GCC and Arm
+ * Compiler 6.
+ */
+
+#ifndef RTOS_STATIC_H
+#define RTOS_STATIC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+/**
+ * @def RTOS_STATIC_ALLOC
+ * @brief Set to 1 (e.g. -DRTOS_STATIC_ALLOC=1) to create all RTOS objects from static memory.
+ */
+#ifndef RTOS_STATIC_ALLOC
+#define RTOS_STATIC_ALLOC       0
+#endif
+
+/**
+ * @def RTOS_STATIC_HEAP_SIZE
+ * @brief FreeRTOS heap size (bytes) in the static-allocation mode; nothing allocates from it
+ *        at start-up, it only serves objects added later without static buffers.
+ */
+#define RTOS_STATIC_HEAP_SIZE   1024
+
+/* Exported macros -----------------------------------------------------------*/
+/**
+ * @def RAM_SECTION
+ * @brief Place a zero-initialised object in the RAM section of a subsystem.
+ * @param subsys Subsystem name as a string literal ("oled", "log", "kernel", ...).
+ */
+#if (defined(__GNUC__) || defined(__ARMCC_VERSION)) && !defined(__APPLE__)
+#define RAM_SECTION(subsys)     __attribute__((section(".bss.ram." subsys)))
+#else
+#define RAM_SECTION(subsys)
+#endif
+
+/**
+ * @def RTOS_STACK_ALIGN
+ * @brief Alignment of statically reserved task stacks (AAPCS requires 8 bytes).
+ */
+#define RTOS_STACK_ALIGN        __attribute__((aligned(8)))
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RTOS_STATIC_H
@@ -0,0 +1,129 @@
+/**
+ * @file    rtos_stats.h
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Per-task CPU usage, context switch and stack statistics for NUCLEO-F429ZI.
+ *
+ * @details
+ * FreeRTOS run-time stats are clocked from the DWT cycle counter, scaled to a 1 us
+ * counter so that per-task totals wrap only every ~71 minutes. Context switches are
+ * counted per task from the traceTASK_SWITCHED_IN hook. Once per RTOS_STATS_WINDOW_MS
+ * the log task samples all tasks and turns the deltas into a report (CPU share, switches
+ * and minimum free stack), which can be printed over UART3 or shown on the OLED stats page.
+ *
+ * This header is included from FreeRTOSConfig.h for the kernel hooks, so it must not
+ * include any FreeRTOS header.
+ */
+
+#ifndef RTOS_STATS_H
+#define RTOS_STATS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+/**
+ * @def RTOS_STATS_MAX_TASKS
+ * @brief Maximum number of tasks included in a report.
+ */
+#define RTOS_STATS_MAX_TASKS        8
+
+/**
+ * @def RTOS_STATS_MAX_TASK_NUMBER
+ * @brief Highest FreeRTOS task number whose context switches are counted.
+ */
+#define RTOS_STATS_MAX_TASK_NUMBER  16
+
+/**
+ * @def RTOS_STATS_WINDOW_MS
+ * @brief Sampling window (milliseconds) over which CPU shares and switch rates are computed.
+ */
+#define RTOS_STATS_WINDOW_MS        1000
+
+/**
+ * @def RTOS_STATS_NAME_LEN
+ * @brief Task name length kept in a report entry, including the terminator.
+ */
+#define RTOS_STATS_NAME_LEN         16
+
+/**
+ * @struct RtosStatsTask_t
+ * @brief Statistics of one task over the last window.
+ */
+typedef struct {
+    char     name[RTOS_STATS_NAME_LEN]; /**< Task name */
+    uint8_t  number;                    /**< FreeRTOS task number */
+    uint8_t  priority;                  /**< Current priority */
+    char     state;                     /**< 'X' running, 'R' ready, 'B' blocked, 'S' suspended, 'D' deleted */
+    uint16_t cpu_permille;              /**< Share of the window spent running (0.1 %) */
+    uint32_t switches;                  /**< Times the task was switched in during the window */
+    uint32_t stack_free_bytes;          /**< Lowest free stack ever observed (high-water mark) */
+} RtosStatsTask_t;
+
+/**
+ * @struct RtosStatsReport_t
+ * @brief Snapshot produced once per window.
+ */
+typedef struct {
+    uint32_t        window_us;                   /**< Length of the sampled window */
+    uint32_t        switches;                    /**< Context switches of all tasks in the window */
+    uint16_t        cpu_load_permille;           /**< Busy share (everything except the idle task) */
+    uint8_t         task_count;                  /**< Valid entries in tasks[] */
+    RtosStatsTask_t tasks[RTOS_STATS_MAX_TASKS]; /**< Per-task entries, in task number order */
+} RtosStatsReport_t;
+
+/* Exported functions --------------------------------------------------------*/
+/**
+ * @brief  Start the run-time stats clock (portCONFIGURE_TIMER_FOR_RUN_TIME_STATS).
+ */
+void RTOS_Stats_TimerInit(void);
+
+/**
+ * @brief  Run-time stats clock in microseconds (portGET_RUN_TIME_COUNTER_VALUE).
+ *
+ * Extends the 32-bit cycle counter in software; it must be read at least once per cycle
+ * counter wrap (~25 s), which the kernel and RTOS_Stats_Update() guarantee.
+ *
+ * @return Microseconds since the clock was started (wraps at 2^32).
+ */
+uint32_t RTOS_Stats_GetRunTimeCounter(void);
+
+/**
+ * @brief  Count a context switch (traceTASK_SWITCHED_IN hook).
+ * @param task_number FreeRTOS task number of the task switched in.
+ */
+void RTOS_Stats_TaskSwitchedIn(uint32_t task_number);
+
+/**
+ * @brief  Refresh the report if the current window has elapsed.
+ *
+ * Called periodically from the log task; cheap when the window has not elapsed.
+ */
+void RTOS_Stats_Update(void);
+
+/**
+ * @brief  Copy the latest report.
+ * @param report Destination.
+ */
+void RTOS_Stats_GetReport(RtosStatsReport_t *report);
+
+/**
+ * @brief  CPU load of the latest window (cheaper than copying the whole report).
+ * @return Busy share in 0.1 % units.
+ */
+uint16_t RTOS_Stats_GetCpuLoad(void);
+
+/**
+ * @brief  Print the latest report as a table on UART3.
+ */
+void RTOS_Stats_Print(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RTOS_STATS_H
@@ -9,8 +9,9 @@
  * @details
  * This header defines types, constants, global variables, and function prototypes for
  * managing the OLED display RTOS task using CMSIS-RTOS v2 and the u8g2 graphics library.
- * It supports switching between three display modes (welcome/info, QR code, bongo cat)
- * via a message queue triggered by SW1 (PE3) and SW2 (PE4) button interrupts.
+ * It supports switching between display modes (welcome/info, QR code, bongo cat and more) via
+ * display command messages (display_cmd.h) sent by the SW1 (PE3) and SW2 (PE4) button
+ * interrupts, the console and the command protocol.
  */
 
 #ifndef RTOS_TASKS_H
@@ -23,43 +24,40 @@ extern "C" {
 /* Includes ------------------------------------------------------------------*/
 #include "cmsis_os2.h"
 #include "u8g2.h"
+#include "screens.h"
 
 /**
  * @enum DisplayMode_t
  * @brief OLED display mode enumeration.
  *
- * Enumerates the available display modes for the OLED RTOS task.
+ * Enumerates the available display modes for the OLED RTOS task. The values are the screen ids
+ * of the command protocol; each mode has a descriptor in the screen registry (screen_registry.c).
  */
 typedef enum {
     DISPLAY_MODE_BONGO = 0,   /**< Bongo cat animation page (default/fallback) */
     DISPLAY_MODE_QRCODE = 1,  /**< QR code page */
-    DISPLAY_MODE_INFO = 2     /**< Welcome/info message page */
+    DISPLAY_MODE_INFO = 2,    /**< Welcome/info message page */
+    DISPLAY_MODE_STATS = 3,   /**< RTOS statistics page (CPU share and free stack per task) */
+    DISPLAY_MODE_VIDEO = 4,   /**< Frames streamed over USART3 (console 'v', see video_sink.h) */
+    DISPLAY_MODE_DASHBOARD = 5, /**< Labelled live values (DisplayCmd_SetValue()) */
+    DISPLAY_MODE_IMAGE = 6,   /**< One image asset (DisplayCmd_ShowImage()) */
+    DISPLAY_MODE_COUNT        /**< Number of display modes */
 } DisplayMode_t;
 
 /* Exported constants --------------------------------------------------------*/
 /**
- * @def OLED_ANIMATION_DELAY_MS
- * @brief Animation frame delay for OLED display (milliseconds).
- */
-#define OLED_ANIMATION_DELAY_MS      200
-
-/**
- * @def OLED_WELCOME_MESSAGE
- * @brief Welcome message string displayed on the OLED info page.
- */
-#define OLED_WELCOME_MESSAGE         "Hi, NUCLEO-F429ZI!"
-
-/**
- * @def OLED_INFO_NAME
- * @brief Name string displayed on the OLED info page
+ * @def OLED_REFRESH_MS
+ * @brief Default redraw period of screens with live data: statistics page (milliseconds).
+ *
+ * Animations follow their own frame durations and static screens are drawn only when they change.
  */
-#define OLED_INFO_NAME               "My name is Ted."
+#define OLED_REFRESH_MS              200
 
 /**
- * @def OLED_INFO_GREETING
- * @brief Greeting string displayed on the OLED info page
+ * @def OLED_REFRESH_FPS_MAX
+ * @brief Highest live-screen refresh rate accepted by DisplayCmd_SetRefreshRate() (frames/s).
  */
-#define OLED_INFO_GREETING           "How are you doing?"
+#define OLED_REFRESH_FPS_MAX         50
 
 /**
  * @def OLED_TASK_STACK_SIZE_BYTES
@@ -80,16 +78,16 @@ typedef enum {
 #define OLED_TASK_THREAD_PRIORITY    osPriorityNormal
 
 /**
- * @def OLED_DISPLAY_MODE_QUEUE_SIZE
- * @brief Message queue size for display mode updates.
+ * @def OLED_DISPLAY_CMD_QUEUE_SIZE
+ * @brief Message queue size for display commands (also the most applied per frame).
  */
-#define OLED_DISPLAY_MODE_QUEUE_SIZE 3
+#define OLED_DISPLAY_CMD_QUEUE_SIZE  16
 
 /* Exported variables --------------------------------------------------------*/
 /**
- * @brief Message queue handle for display mode updates (shared by ISR and OLED task).
+ * @brief Message queue of DisplayCmd_t for the OLED task (display_cmd.h; ISRs and tasks send).
  */
-extern osMessageQueueId_t display_mode_queue;
+extern osMessageQueueId_t display_cmd_queue;
 
 /**
  * @brief Current display mode (shared by ISR and OLED task).
@@ -106,6 +104,32 @@ extern DisplayMode_t current_display_mode;
  */
 void OLED_Task_Init(void);
 
+/**
+ * @brief  Print the I2C cost of the last frame of each display mode over UART3.
+ *
+ * Reports the START, control, payload and ACK counts of one frame per screen, the predicted
+ * bus time and maximum sustainable frame rate at 100 kHz, 400 kHz and 1 MHz, and the measured
+ * flush time, then the kind, refresh rate, RAM and widget count of every registered screen.
+ * Call from task context (console).
+ */
+void OLED_Task_PrintBusReport(void);
+
+/**
+ * @brief  Print the u8g2 per-primitive profile (calls, pixels, bytes, time) after the next frame.
+ *
+ * Needs a build with U8G2_PROF_ENABLE=1; otherwise a note is printed. The table is cleared
+ * after each report.
+ */
+void OLED_Task_RequestProfileReport(void);
+
+/**
+ * @brief  Wake the display task to redraw the current screen (e.g. after the HUD was toggled).
+ *
+ * Queues DISPLAY_CMD_REFRESH, which redraws without restarting the screen's animations. Safe
+ * to call from an ISR.
+ */
+void OLED_Task_Refresh(void);
+
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,137 @@
+/**
+ * @file    screen_registry.h
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Screen registry: one descriptor per display mode, dispatched by the display task.
+ *
+ * @details
+ * Every screen is a Screen_t descriptor in a file of its own (Core/Src/screen_*.c) that also holds
+ * its state; the table of the registry only lists the descriptors, indexed by DisplayMode_t. A
+ * descriptor gives callbacks to set the screen up once, enter it, draw it, leave it and take the
+ * display commands addressed to it, plus metadata the display task schedules by. A static
+ * screen (SCREEN_STATIC) is drawn only when something it shows changes and costs nothing in
+ * between. An animated one (SCREEN_ANIMATED) wakes the task at the frame durations of its
+ * animations, a live one (SCREEN_LIVE) every 1/fps seconds, and a stream (SCREEN_STREAM) writes
+ * the buffer itself from its update callback, which also says when the stream has ended and
+ * which screen follows. A screen made of widgets lists them, so the task can redraw just the
+ * invalidated ones.
+ *
+ * Adding a screen means its file, a DisplayMode_t entry (the id of the command protocol), its
+ * declaration below and its descriptor in the table (screen_registry.c); the display task needs
+ * no change. The callbacks run in the display task only.
+ */
+
+#ifndef SCREEN_REGISTRY_H
+#define SCREEN_REGISTRY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "u8g2.h"
+#include "display_cmd.h"
+#include "rtos_tasks.h"
+#include "widget.h"
+#include "video_stream.h"
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @enum ScreenKind_t
+ * @brief When a screen has to be redrawn.
+ */
+typedef enum {
+    SCREEN_STATIC = 0,          /**< Only when what it shows changes */
+    SCREEN_ANIMATED,            /**< At the next frame of its animations (anim.h) */
+    SCREEN_LIVE,                /**< Every 1/fps seconds (data sampled while drawing) */
+    SCREEN_STREAM,              /**< Never: its update callback writes the buffer */
+    SCREEN_KIND_COUNT           /**< Number of kinds */
+} ScreenKind_t;
+
+/**
+ * @enum ScreenEventResult_t
+ * @brief Answer of a screen to a display command.
+ */
+typedef enum {
+    SCREEN_EVT_IGNORED = 0,     /**< Not addressed to this screen */
+    SCREEN_EVT_DONE,            /**< Applied; changed widgets are invalidated */
+    SCREEN_EVT_REDRAW,          /**< Applied; the screen has to be redrawn if shown */
+    SCREEN_EVT_SHOW,            /**< Applied; switch to this screen */
+    SCREEN_EVT_REJECTED         /**< Addressed to this screen but unusable (e.g. wrong asset) */
+} ScreenEventResult_t;
+
+/**
+ * @struct Screen_t
+ * @brief One screen: metadata and callbacks (NULL where the screen has nothing to do).
+ */
+typedef struct {
+    const char *name;           /**< Short name (reports) */
+    uint8_t kind;               /**< ScreenKind_t */
+    uint8_t fps;                /**< SCREEN_LIVE: default refresh rate (frames/s), else 0 */
+    Widget_t *widgets;          /**< Widgets, drawn by the task before render; NULL if none */
+    uint8_t widget_count;       /**< Number of widgets */
+    void (*init)(void);                             /**< Once, when the display task starts */
+    /** Screen becomes current, coming from previous (start its animations) */
+    void (*enter)(DisplayMode_t previous, uint32_t now);
+    void (*render)(u8g2_t *u8g2);                   /**< Draw the rest of the screen (after the widgets) */
+    void (*exit)(void);                             /**< Screen stops being current */
+    ScreenEventResult_t (*on_event)(DisplayCmd_t *cmd); /**< Commands for the screen; may take cmd->text */
+    /** SCREEN_STREAM: write what arrived into the buffer and mark its tiles; returns the mode to show */
+    DisplayMode_t (*update)(u8g2_t *u8g2, VideoTiles_t *tiles, uint32_t now);
+    uint32_t (*next_due)(uint32_t now);             /**< SCREEN_STREAM: ms until update is due again */
+} Screen_t;
+
+/* Exported screens ----------------------------------------------------------*/
+extern const Screen_t screen_bongo;         /**< Bongo cat animation (screen_bongo.c) */
+extern const Screen_t screen_qrcode;        /**< QR code page (screen_qrcode.c) */
+extern const Screen_t screen_info;          /**< Welcome/info message (screen_info.c) */
+extern const Screen_t screen_stats;         /**< RTOS statistics page (screen_stats.c) */
+extern const Screen_t screen_video;         /**< Video stream (screen_video.c) */
+extern const Screen_t screen_dashboard;     /**< Labelled values (screen_dashboard.c) */
+extern const Screen_t screen_image;         /**< One image asset (screen_image.c) */
+
+/* Exported functions --------------------------------------------------------*/
+/**
+ * @brief  Set up every screen (init callbacks); call once from the display task after Asset_Init().
+ */
+void ScreenRegistry_Init(void);
+
+/**
+ * @brief  Descriptor of a display mode.
+ * @param mode Display mode (out-of-range values give the info screen).
+ * @return Screen descriptor.
+ */
+const Screen_t *ScreenRegistry_Get(DisplayMode_t mode);
+
+/**
+ * @brief  Offer a display command to every screen until one takes it.
+ * @param cmd    Command; a text payload taken over is cleared (cmd->text = NULL).
+ * @param target Screen that answered (out, DISPLAY_MODE_COUNT if none).
+ * @return Answer of that screen, SCREEN_EVT_IGNORED if none took it.
+ */
+ScreenEventResult_t ScreenRegistry_Dispatch(DisplayCmd_t *cmd, DisplayMode_t *target);
+
+/**
+ * @brief  Name of a screen kind (reports).
+ * @param kind ScreenKind_t.
+ * @return Name, "?" for an unknown kind.
+ */
+const char *ScreenRegistry_KindName(uint8_t kind);
+
+/**
+ * @brief  Keep the pool block of a SET_TEXT command as the text of a screen's field.
+ * @param cmd   SET_TEXT command with a text.
+ * @param text  Text shown by the field (in/out).
+ * @param block MEM_POOL_TEXT block behind the field, NULL while it shows its default (in/out).
+ * @return true if the text changed (block taken, cmd->text cleared), false if it is equal.
+ */
+bool ScreenRegistry_TakeText(DisplayCmd_t *cmd, const char **text, char **block);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SCREEN_REGISTRY_H
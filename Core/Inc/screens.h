@@ -0,0 +1,223 @@
+/**
+ * @file    screens.h
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Renderers of the static OLED screens (info, QR code, bongo cat, video wait, dashboard, image).
+ *
+ * @details
+ * Each function draws one screen into the u8g2 frame buffer and nothing else: no RTOS, HAL or
+ * bus access. The info, QR code and dashboard screens are widget trees (widget.h): the
+ * Screens_Init...Widgets() functions lay them out, so the display task can keep a tree, change
+ * single widgets and redraw only those, while Screens_Draw...() render a whole tree at once. The QR code is encoded on the device (qr_encode.h) from OLED_QR_PAYLOAD or the
+ * payload set with Screens_SetQRPayload(). The display task calls them between u8g2_ClearBuffer() and u8g2_SendBuffer(), and
+ * the host golden-image harness (Host/golden) renders the same functions and compares the
+ * buffer bit for bit with stored images.
+ */
+
+#ifndef SCREENS_H
+#define SCREENS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "u8g2.h"
+#include "qr_encode.h"
+#include "asset_pack.h"
+#include "widget.h"
+
+/* Exported constants --------------------------------------------------------*/
+/**
+ * @def OLED_WELCOME_MESSAGE
+ * @brief Welcome message string displayed on the OLED info page.
+ */
+#define OLED_WELCOME_MESSAGE         "Hi, NUCLEO-F429ZI!"
+
+/**
+ * @def OLED_INFO_NAME
+ * @brief Name string displayed on the OLED info page
+ */
+#define OLED_INFO_NAME               "My name is Ted."
+
+/**
+ * @def OLED_INFO_GREETING
+ * @brief Greeting string displayed on the OLED info page
+ */
+#define OLED_INFO_GREETING           "How are you doing?"
+
+/**
+ * @def OLED_QR_PAYLOAD
+ * @brief Default content of the QR code screen.
+ */
+#define OLED_QR_PAYLOAD              "https://www.youtube.com/"
+
+/**
+ * @def OLED_QR_ECC
+ * @brief Error correction level of the QR code screen.
+ */
+#define OLED_QR_ECC                  QR_ECC_L
+
+/**
+ * @def SCREENS_QR_AREA
+ * @brief Side of the square the QR code screen reserves for the symbol (pixels).
+ */
+#define SCREENS_QR_AREA              64
+
+/**
+ * @def SCREENS_INFO_LINES
+ * @brief Text lines of the info screen.
+ */
+#define SCREENS_INFO_LINES           3
+
+/**
+ * @def SCREENS_DASHBOARD_VALUES
+ * @brief Labelled values of the dashboard screen (4 rows of 2).
+ */
+#define SCREENS_DASHBOARD_VALUES     8
+
+/**
+ * @def SCREENS_INFO_WIDGETS
+ * @brief Widgets of the info screen: one label per line (widget i is line i).
+ */
+#define SCREENS_INFO_WIDGETS         SCREENS_INFO_LINES
+
+/**
+ * @def SCREENS_QR_WIDGETS
+ * @brief Widgets of the QR code screen: the symbol and four caption lines.
+ */
+#define SCREENS_QR_WIDGETS           5
+
+/**
+ * @def SCREENS_DASHBOARD_WIDGETS
+ * @brief Widgets of the dashboard: a label and a numeric readout per value.
+ */
+#define SCREENS_DASHBOARD_WIDGETS    (2 * SCREENS_DASHBOARD_VALUES)
+
+/**
+ * @def SCREENS_DASHBOARD_LABEL
+ * @brief Index of the label widget of dashboard value i.
+ */
+#define SCREENS_DASHBOARD_LABEL(i)   (i)
+
+/**
+ * @def SCREENS_DASHBOARD_VALUE
+ * @brief Index of the numeric widget of dashboard value i.
+ */
+#define SCREENS_DASHBOARD_VALUE(i)   (SCREENS_DASHBOARD_VALUES + (i))
+
+/* Exported functions --------------------------------------------------------*/
+/**
+ * @brief  Draw the welcome/info screen.
+ * @param u8g2 Pointer to the u8g2 display structure (font ncenB08 selected).
+ */
+void Screens_DrawInfo(u8g2_t *u8g2);
+
+/**
+ * @brief  Draw the info screen with other text (set over the command protocol).
+ * @param u8g2  Pointer to the u8g2 display structure (font ncenB08 selected).
+ * @param lines SCREENS_INFO_LINES NUL-terminated lines, top to bottom.
+ */
+void Screens_DrawInfoLines(u8g2_t *u8g2, const char *const lines[SCREENS_INFO_LINES]);
+
+/**
+ * @brief  Lay out the info screen.
+ * @param widgets Widgets to set up (all dirty).
+ * @param lines   SCREENS_INFO_LINES NUL-terminated lines, kept by reference.
+ */
+void Screens_InitInfoWidgets(Widget_t widgets[SCREENS_INFO_WIDGETS], const char *const lines[SCREENS_INFO_LINES]);
+
+/**
+ * @brief  Lay out the QR code screen (symbol of Screens_SetQRPayload(), caption).
+ * @param widgets Widgets to set up (all dirty).
+ */
+void Screens_InitQRWidgets(Widget_t widgets[SCREENS_QR_WIDGETS]);
+
+/**
+ * @brief  Lay out the dashboard: SCREENS_DASHBOARD_VALUES labelled values in 4 rows of 2.
+ * @param widgets Widgets to set up (all dirty).
+ * @param font    Font of all widgets (5x7 fits the cells), or NULL for the current one.
+ * @param labels  NUL-terminated labels, kept by reference.
+ * @param values  Initial values.
+ */
+void Screens_InitDashboardWidgets(Widget_t widgets[SCREENS_DASHBOARD_WIDGETS], const uint8_t *font,
+                                  const char *const labels[SCREENS_DASHBOARD_VALUES],
+                                  const int32_t values[SCREENS_DASHBOARD_VALUES]);
+
+/**
+ * @brief  Draw the QR code with its caption.
+ * @param u8g2 Pointer to the u8g2 display structure (font ncenB08 selected).
+ */
+void Screens_DrawQRCode(u8g2_t *u8g2);
+
+/**
+ * @brief  Encode a new payload for the QR code screen.
+ * @param data Payload (URL or text).
+ * @param len  Payload length (at most QR_Capacity(QR_VERSION_MAX, OLED_QR_ECC)).
+ * @return 0 on success, -1 if it does not fit (the previous symbol stays).
+ * @note   Not synchronized with the renderer: call it from the display task or before it runs.
+ */
+int Screens_SetQRPayload(const uint8_t *data, size_t len);
+
+/**
+ * @brief  Draw a QR symbol, light quiet zone and dark modules unlit, centred in a square.
+ * @param u8g2 Pointer to the u8g2 display structure (full buffer, rotation U8G2_R0).
+ * @param qr   Encoded symbol.
+ * @param x    Left edge of the square (pixels).
+ * @param y    Top edge of the square (pixels, multiple of 8).
+ * @param side Side of the square (pixels, multiple of 8); the module size is the largest of
+ *             2 and 1 that fits the symbol with a one-module quiet zone.
+ */
+void Screens_DrawQRSymbol(u8g2_t *u8g2, const QrCode_t *qr, uint8_t x, uint8_t y, uint8_t side);
+
+/**
+ * @brief  Draw one bongo cat animation frame (the "bongo_cat" animation of the asset pack).
+ * @param u8g2  Pointer to the u8g2 display structure.
+ * @param frame Frame index (wraps around).
+ * @note   The display task plays the animation with the timing of the pack (anim.h); this draws
+ *         a given frame, e.g. for the golden images.
+ */
+void Screens_DrawBongoCat(u8g2_t *u8g2, uint8_t frame);
+
+/**
+ * @brief  Draw the video screen shown until the first frame of a stream arrives.
+ * @param u8g2 Pointer to the u8g2 display structure.
+ * @param baud Line rate the host has to use.
+ */
+void Screens_DrawVideoWait(u8g2_t *u8g2, uint32_t baud);
+
+/**
+ * @brief  Draw the dashboard: SCREENS_DASHBOARD_VALUES labelled values in 4 rows of 2.
+ * @param u8g2   Pointer to the u8g2 display structure (font 5x7 selected).
+ * @param labels NUL-terminated labels (cut to the width of a cell).
+ * @param values Values, right-aligned under their labels.
+ */
+void Screens_DrawDashboard(u8g2_t *u8g2, const char *const labels[SCREENS_DASHBOARD_VALUES],
+                           const int32_t values[SCREENS_DASHBOARD_VALUES]);
+
+/**
+ * @brief  Draw an image asset centred on the screen (vertically on a page boundary).
+ * @param u8g2 Pointer to the u8g2 display structure.
+ * @param id   Asset id of an image.
+ * @return true if the asset exists, is an image and fits the screen, false otherwise.
+ */
+bool Screens_DrawImageCentered(u8g2_t *u8g2, AssetId_t id);
+
+/**
+ * @brief  Draw an image asset in place from flash.
+ * @param u8g2 Pointer to the u8g2 display structure.
+ * @param id   Asset id of an image (Image/asset_ids.h, or Asset_FindId()).
+ * @param x    Left edge (pixels).
+ * @param y    Top edge (pixels; a multiple of 8 for ASSET_ENC_PAGES images).
+ * @return true if the asset exists and is an image, false otherwise (nothing drawn).
+ */
+bool Screens_DrawImage(u8g2_t *u8g2, AssetId_t id, u8g2_uint_t x, u8g2_uint_t y);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SCREENS_H
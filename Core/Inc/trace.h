@@ -0,0 +1,141 @@
+/**
+ * @file    trace.h
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Compact binary trace of RTOS and display events, streamed over UART3.
+ *
+ * @details
+ * Events are stored as 8-byte records (DWT cycle timestamp, event id, two small arguments)
+ * in a RAM ring. The log task periodically packs pending records into binary packets and
+ * queues them on the UART3 TX engine; Tools/trace_decode.py turns a captured stream into
+ * Chrome trace JSON (chrome://tracing, ui.perfetto.dev).
+ *
+ * This header is included from FreeRTOSConfig.h to provide the kernel trace hooks, so it
+ * must not include any FreeRTOS header.
+ *
+ * Packet layout (all multi-byte fields little-endian):
+ *   - Records:  A5 5A 'T' <count> <count x TraceRecord_t> <checksum>
+ *   - Task:     A5 5A 'N' <task number> <name length> <name bytes> <checksum>
+ *   - Metadata: A5 5A 'M' <core clock Hz, u32> <record overhead cycles, u16> <dropped, u32> <checksum>
+ * The checksum is the 8-bit sum of all bytes after the sync pair.
+ */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+/**
+ * @def TRACE_ENABLE
+ * @brief Set to 1 (e.g. -DTRACE_ENABLE=1) to compile in trace hooks and streaming.
+ *
+ * Disabled by default so that the UART3 console stays plain text.
+ */
+#ifndef TRACE_ENABLE
+#define TRACE_ENABLE                0
+#endif
+
+/**
+ * @def TRACE_BUFFER_RECORDS
+ * @brief Number of records held in RAM (must be a power of two).
+ */
+#define TRACE_BUFFER_RECORDS        256
+
+/**
+ * @def TRACE_PACKET_MAX_RECORDS
+ * @brief Maximum number of records per streamed packet.
+ */
+#define TRACE_PACKET_MAX_RECORDS    16
+
+/**
+ * @def TRACE_METADATA_PERIOD_MS
+ * @brief Interval at which task names and metadata are re-sent for late-attaching decoders.
+ */
+#define TRACE_METADATA_PERIOD_MS    2000
+
+/**
+ * @enum TraceEventId_t
+ * @brief Trace event identifiers (arg8 / arg16 meaning in brackets).
+ */
+typedef enum {
+    TRACE_EVT_TASK_SWITCH_IN = 1,    /**< Task starts running [-, task number] */
+    TRACE_EVT_TASK_SWITCH_OUT,       /**< Task stops running [-, task number] */
+    TRACE_EVT_QUEUE_SEND,            /**< Queue send from task [-, queue address low bits] */
+    TRACE_EVT_QUEUE_SEND_FROM_ISR,   /**< Queue send from ISR [-, queue address low bits] */
+    TRACE_EVT_QUEUE_RECEIVE,         /**< Queue receive in task [-, queue address low bits] */
+    TRACE_EVT_QUEUE_RECEIVE_FROM_ISR,/**< Queue receive in ISR [-, queue address low bits] */
+    TRACE_EVT_RENDER_START,          /**< Screen render begins [display mode, -] */
+    TRACE_EVT_RENDER_END,            /**< Screen render ends [display mode, -] */
+    TRACE_EVT_FLUSH_START,           /**< Frame buffer flush begins [-, -] */
+    TRACE_EVT_FLUSH_END,             /**< Frame buffer flush ends [-, -] */
+    TRACE_EVT_TILES_SENT,            /**< Tiles transferred by the flush [-, tile count] */
+    TRACE_EVT_I2C_TRANSFER           /**< One I2C transaction [-, byte count] */
+} TraceEventId_t;
+
+/**
+ * @struct TraceRecord_t
+ * @brief Binary trace record (8 bytes).
+ */
+typedef struct {
+    uint32_t timestamp;   /**< DWT cycle counter */
+    uint8_t  event;       /**< TraceEventId_t */
+    uint8_t  arg8;        /**< Event-specific small argument */
+    uint16_t arg16;       /**< Event-specific argument */
+} TraceRecord_t;
+
+/* Exported macros -----------------------------------------------------------*/
+#if TRACE_ENABLE
+/** Record an event (compiled out when TRACE_ENABLE is 0) */
+#define TRACE_EVENT(event, arg8, arg16)  Trace_Record((uint8_t)(event), (uint8_t)(arg8), (uint16_t)(arg16))
+#else
+#define TRACE_EVENT(event, arg8, arg16)  ((void)0)
+#endif
+
+/* Exported functions --------------------------------------------------------*/
+/**
+ * @brief  Start the cycle counter, reset the ring and calibrate the per-event overhead.
+ *
+ * Call once before the RTOS kernel starts.
+ */
+void Trace_Init(void);
+
+/**
+ * @brief  Append one record (ISR, task and kernel-hook safe; constant time, never blocks).
+ *
+ * @param event Event id (TraceEventId_t).
+ * @param arg8  Small argument.
+ * @param arg16 Argument.
+ */
+void Trace_Record(uint8_t event, uint8_t arg8, uint16_t arg16);
+
+/**
+ * @brief  Pack pending records into packets and queue them on UART3.
+ *
+ * Called periodically from the log task; also emits task names and metadata every
+ * TRACE_METADATA_PERIOD_MS.
+ */
+void Trace_Stream(void);
+
+/**
+ * @brief  Measured cost of one Trace_Record() call.
+ * @return Worst case of the calibration runs, in core clock cycles.
+ */
+uint32_t Trace_GetOverheadCycles(void);
+
+/**
+ * @brief  Number of records dropped because the ring was full.
+ * @return Dropped record count.
+ */
+uint32_t Trace_GetDroppedCount(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TRACE_H
@@ -0,0 +1,154 @@
+/**
+ * @file    uart_rx.h
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   DMA-driven USART3 receive ring shared by the console and the video sink.
+ *
+ * @details
+ * DMA1 Stream1 writes every received byte into a ring in circular mode, so reception never
+ * has to be re-armed and no byte depends on interrupt latency. The half-transfer, transfer
+ * complete and line-idle events (HAL_UARTEx_RxEventCallback()) publish the DMA write position.
+ * One task at a time reads the ring without copying: UART_RX_Peek() returns the oldest
+ * contiguous span and UART_RX_Consume() releases it. The console reads it at 115200 baud;
+ * the video sink switches the line to a higher rate with UART_RX_SetBaudRate() and takes over.
+ */
+
+#ifndef UART_RX_H
+#define UART_RX_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @struct UartRxStats_t
+ * @brief Counters of the RX ring.
+ */
+typedef struct {
+    uint32_t received;      /**< Bytes written by DMA */
+    uint32_t events;        /**< Half/full/idle events (count) */
+    uint32_t overruns;      /**< Bytes lost because the reader fell a whole ring behind */
+    uint32_t errors;        /**< UART/DMA errors that stopped reception (count) */
+    uint32_t restarts;      /**< Receptions restarted (errors and baud rate changes) */
+    uint32_t peak_fill;     /**< Highest fill level seen by the reader */
+} UartRxStats_t;
+
+/**
+ * @struct UartRxView_t
+ * @brief Pending bytes as two spans of the ring, in order (the second is empty unless the
+ *        data wraps around the end of the ring).
+ */
+typedef struct {
+    const uint8_t *data[2]; /**< First byte of each span */
+    size_t len[2];          /**< Length of each span */
+} UartRxView_t;
+
+/**
+ * @typedef UartRxListener_t
+ * @brief Called from the RX interrupt after new bytes were published (keep it short).
+ */
+typedef void (*UartRxListener_t)(void);
+
+/* Exported constants --------------------------------------------------------*/
+/**
+ * @def UART_RX_BUFFER_SIZE
+ * @brief Size of the RX ring in bytes (power of two). 4 KiB hold 44 ms at 921600 baud.
+ */
+#define UART_RX_BUFFER_SIZE     4096
+
+/**
+ * @def UART_CONSOLE_BAUD_RATE
+ * @brief Line rate of the console (set by MX_USART3_UART_Init()).
+ */
+#define UART_CONSOLE_BAUD_RATE  115200U
+
+/**
+ * @def UART_RX_FLUSH_TIMEOUT_MS
+ * @brief Longest wait for queued TX output before the baud rate is changed.
+ */
+#define UART_RX_FLUSH_TIMEOUT_MS 200U
+
+/* Exported functions --------------------------------------------------------*/
+/**
+ * @brief  Start circular DMA reception on USART3.
+ *
+ * Call after MX_USART3_UART_Init() and MX_DMA_Init().
+ */
+void UART_RX_Init(void);
+
+/**
+ * @brief  Oldest received bytes that are contiguous in the ring.
+ *
+ * If the reader fell more than a ring behind, the lost bytes are counted as overruns and
+ * skipped first.
+ *
+ * @param data Set to the first byte (valid until UART_RX_Consume()).
+ * @return Number of bytes at *data, 0 if nothing is pending.
+ */
+size_t UART_RX_Peek(const uint8_t **data);
+
+/**
+ * @brief  All received bytes, as up to two spans of the ring, without copying.
+ *
+ * Lets a parser look at a whole frame that wraps around the end of the ring before it
+ * consumes anything.
+ *
+ * @param view Set to the spans (valid until UART_RX_Consume()).
+ * @return Total number of bytes pending.
+ */
+size_t UART_RX_PeekView(UartRxView_t *view);
+
+/**
+ * @brief  Release bytes returned by UART_RX_Peek() or UART_RX_PeekView().
+ * @param len Number of bytes, at most the length returned.
+ */
+void UART_RX_Consume(size_t len);
+
+/**
+ * @brief  Drop everything received so far.
+ */
+void UART_RX_Discard(void);
+
+/**
+ * @brief  Install the function called from the RX interrupt when bytes arrive.
+ * @param listener Listener, or NULL for none.
+ */
+void UART_RX_SetListener(UartRxListener_t listener);
+
+/**
+ * @brief  Change the USART3 line rate for both directions.
+ *
+ * Waits for queued TX output to go out at the old rate, then reprograms the USART and
+ * restarts reception; pending received bytes are discarded. Task context only.
+ *
+ * @param baud New baud rate.
+ * @return 0 on success, -1 if TX did not drain or the USART rejected the rate.
+ */
+int UART_RX_SetBaudRate(uint32_t baud);
+
+/**
+ * @brief  Copy the current RX counters.
+ * @param stats Destination for the counters.
+ */
+void UART_RX_GetStats(UartRxStats_t *stats);
+
+/**
+ * @brief  USART3 RX event hook, called from HAL_UARTEx_RxEventCallback().
+ * @param pos DMA write position in the ring (1 .. UART_RX_BUFFER_SIZE).
+ */
+void UART_RX_EventHandler(uint16_t pos);
+
+/**
+ * @brief  USART3 error hook, called from HAL_UART_ErrorCallback(); restarts reception.
+ */
+void UART_RX_ErrorHandler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // UART_RX_H
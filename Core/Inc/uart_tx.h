@@ -0,0 +1,159 @@
+/**
+ * @file    uart_tx.h
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   DMA-driven, non-blocking USART3 transmit engine with printf retargeting.
+ *
+ * @details
+ * All diagnostic output (log task, printf, fault messages) goes through a single TX ring that
+ * is drained by DMA1 Stream3. Writers only copy bytes into the ring and return; what happens
+ * when the ring is full is selected by an overflow policy. Fault handlers use UART_TX_Panic(),
+ * which bypasses the ring and DMA and polls the USART registers directly.
+ */
+
+#ifndef UART_TX_H
+#define UART_TX_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @enum UartTxPolicy_t
+ * @brief Behaviour of UART_TX_Write() when the TX ring is full.
+ */
+typedef enum {
+    UART_TX_POLICY_DROP = 0,    /**< Keep queued data, drop the bytes that do not fit */
+    UART_TX_POLICY_BLOCK,       /**< Wait for DMA to free space (task context only, else drop) */
+    UART_TX_POLICY_OVERWRITE    /**< Discard the oldest queued bytes to make room */
+} UartTxPolicy_t;
+
+/**
+ * @struct UartTxStats_t
+ * @brief Counters of the TX engine (bytes unless noted).
+ */
+typedef struct {
+    uint32_t queued;        /**< Bytes accepted into the ring */
+    uint32_t sent;          /**< Bytes completed by DMA */
+    uint32_t dropped;       /**< New bytes rejected because the ring was full */
+    uint32_t overwritten;   /**< Queued bytes discarded by the overwrite policy */
+    uint32_t transfers;     /**< DMA transfers started (count) */
+    uint32_t errors;        /**< UART/DMA errors that aborted a transfer (count) */
+    uint32_t peak_fill;     /**< Highest ring fill level observed */
+} UartTxStats_t;
+
+/* Exported constants --------------------------------------------------------*/
+/**
+ * @def UART_TX_BUFFER_SIZE
+ * @brief Size of the TX ring in bytes (must be a power of two). Holds the largest
+ *        framebuffer mirror packet (fb_mirror.h) next to log output.
+ */
+#define UART_TX_BUFFER_SIZE        2048
+
+/**
+ * @def UART_TX_DMA_CHUNK_MAX
+ * @brief Largest single DMA transfer; bounds how long ring space stays locked by DMA.
+ */
+#define UART_TX_DMA_CHUNK_MAX      128
+
+/**
+ * @def UART_TX_OVERFLOW_POLICY
+ * @brief Overflow policy used after UART_TX_Init() (see UartTxPolicy_t).
+ */
+#define UART_TX_OVERFLOW_POLICY    UART_TX_POLICY_DROP
+
+/**
+ * @def UART_TX_BLOCK_TIMEOUT_MS
+ * @brief Longest time a writer waits for space under UART_TX_POLICY_BLOCK.
+ */
+#define UART_TX_BLOCK_TIMEOUT_MS   50
+
+/**
+ * @def UART_TX_PANIC_SPIN_LIMIT
+ * @brief Polling iterations allowed per byte in UART_TX_Panic() before giving up.
+ */
+#define UART_TX_PANIC_SPIN_LIMIT   100000
+
+/* Exported functions --------------------------------------------------------*/
+/**
+ * @brief  Initialize the TX ring and its RTOS objects.
+ *
+ * Call after MX_USART3_UART_Init() and osKernelInitialize(), before the kernel starts.
+ */
+void UART_TX_Init(void);
+
+/**
+ * @brief  Queue bytes for DMA transmission on USART3.
+ *
+ * Never blocks in ISRs or before the scheduler runs. Safe from tasks and ISRs at or below
+ * configMAX_SYSCALL_INTERRUPT_PRIORITY.
+ *
+ * @param data Bytes to send.
+ * @param len  Number of bytes.
+ * @return Number of bytes accepted (the rest is counted as dropped).
+ */
+size_t UART_TX_Write(const uint8_t *data, size_t len);
+
+/**
+ * @brief  Queue a block only if all of it fits, in one piece.
+ *
+ * Never blocks and never overwrites, whatever the policy; a rejected block is not counted as
+ * dropped. Binary packets use it so they are neither truncated nor split by other output.
+ *
+ * @param data Bytes to send.
+ * @param len  Number of bytes.
+ * @return 0 if queued, -1 if the ring has no room for it now.
+ */
+int UART_TX_TryWrite(const uint8_t *data, size_t len);
+
+/**
+ * @brief  Wait until every queued byte has left the USART.
+ *
+ * Task context only (sleeps in 1 ms steps). Used before the line rate is changed.
+ *
+ * @param timeout_ms Longest wait.
+ * @return 0 when the ring is empty and DMA idle, -1 on timeout.
+ */
+int UART_TX_Flush(uint32_t timeout_ms);
+
+/**
+ * @brief  Select the overflow policy at runtime.
+ * @param policy New policy.
+ */
+void UART_TX_SetPolicy(UartTxPolicy_t policy);
+
+/**
+ * @brief  Copy the current TX counters.
+ * @param stats Destination for the counters.
+ */
+void UART_TX_GetStats(UartTxStats_t *stats);
+
+/**
+ * @brief  Synchronous panic output for fault handlers.
+ *
+ * Stops the TX DMA stream and writes @p msg by polling the USART data register, with
+ * interrupts masked. The TX engine stays stopped afterwards.
+ *
+ * @param msg NUL-terminated message.
+ */
+void UART_TX_Panic(const char *msg);
+
+/**
+ * @brief  USART3 TX-complete hook, called from HAL_UART_TxCpltCallback().
+ */
+void UART_TX_TxCpltHandler(void);
+
+/**
+ * @brief  USART3 error hook, called from HAL_UART_ErrorCallback().
+ */
+void UART_TX_ErrorHandler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // UART_TX_H
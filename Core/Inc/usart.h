@@ -34,6 +34,8 @@ extern "C" {
 
 extern UART_HandleTypeDef huart3;
 
+extern DMA_HandleTypeDef hdma_usart3_tx;
+
 /* USER CODE BEGIN Private defines */
 
 /* USER CODE END Private defines */
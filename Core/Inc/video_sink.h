@@ -0,0 +1,88 @@
+/**
+ * @file    video_sink.h
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Shows a tile-delta video stream received on USART3 (see video_stream.h).
+ *
+ * @details
+ * The console command 'v' calls VideoSink_Start(): the line switches to VIDEO_BAUD_RATE, the
+ * display task enters DISPLAY_MODE_VIDEO and reads the RX ring instead of the console. Each
+ * pass of the display task, the video screen (screen_video.c) decodes what has arrived into the
+ * u8g2 buffer and the task sends only the tiles that changed. The stream ends with an END packet, after VIDEO_IDLE_TIMEOUT_MS without
+ * data, or when another screen is selected; the console then gets the line back at
+ * UART_CONSOLE_BAUD_RATE. Log and printf output keep going out on TX at the video rate.
+ */
+
+#ifndef VIDEO_SINK_H
+#define VIDEO_SINK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "video_stream.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+/**
+ * @def VIDEO_BAUD_RATE
+ * @brief Line rate while the sink is active (0.16% error from the 36 MHz USART3 clock).
+ */
+#define VIDEO_BAUD_RATE         921600U
+
+/**
+ * @def VIDEO_IDLE_TIMEOUT_MS
+ * @brief The sink stops after this long without received bytes.
+ */
+#define VIDEO_IDLE_TIMEOUT_MS   3000U
+
+/* Exported functions --------------------------------------------------------*/
+/**
+ * @brief  Switch USART3 to the video rate and show the video screen (log task context).
+ * @return 0 on success, -1 if the line could not be switched or the display queue is full.
+ */
+int VideoSink_Start(void);
+
+/**
+ * @brief  Give the line back to the console at UART_CONSOLE_BAUD_RATE (task context).
+ */
+void VideoSink_Stop(void);
+
+/**
+ * @brief  Whether the sink owns the RX ring.
+ * @return true between VideoSink_Start() and the end of the stream.
+ */
+bool VideoSink_IsActive(void);
+
+/**
+ * @brief  Decode the received bytes into a frame buffer (display task).
+ *
+ * Stops the sink on an END packet or after VIDEO_IDLE_TIMEOUT_MS without data.
+ *
+ * @param fb    u8g2 frame buffer.
+ * @param dirty Tiles written are added.
+ * @param now   Current tick (ms).
+ * @return VideoEvent_t bits.
+ */
+uint32_t VideoSink_Poll(uint8_t *fb, VideoTiles_t *dirty, uint32_t now);
+
+/**
+ * @brief  Time until the idle timeout expires.
+ * @param now Current tick (ms).
+ * @return Milliseconds, 0 if the sink is not active.
+ */
+uint32_t VideoSink_TimeToIdle(uint32_t now);
+
+/**
+ * @brief  Copy the decoder counters of the current or last stream.
+ * @param stats Destination for the counters.
+ */
+void VideoSink_GetStats(VideoStats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // VIDEO_SINK_H
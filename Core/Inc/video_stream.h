@@ -0,0 +1,215 @@
+/**
+ * @file    video_stream.h
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Tile-delta video stream for the 128x64 panel: wire format, encoder and decoder.
+ *
+ * @details
+ * A host sends frames as packets (little-endian):
+ *
+ * @code
+ *   offset  size  field
+ *   0       2     sync 0x56 0xA5
+ *   2       1     type (VideoPacketType_t)
+ *   3       1     flags (VIDEO_FLAG_KEY, VIDEO_FLAG_STAMP)
+ *   4       2     sequence number
+ *   6       2     payload length (at most VIDEO_MAX_PAYLOAD)
+ *   8       n     payload
+ *   8+n     2     CRC-16/CCITT-FALSE of bytes 2 .. 8+n-1
+ * @endcode
+ *
+ * The payload of a frame is a list of records, each [first tile][tile count][PackBits data].
+ * A tile is 8 columns of one 8-pixel page, i.e. 8 bytes of the u8g2 buffer; tile t covers
+ * buf[8t .. 8t+7], so tile t is column t % 16 of page t / 16 and a record is one contiguous
+ * byte range of the buffer. PackBits: control byte c < 128 is followed by c + 1 literal
+ * bytes, c > 128 repeats the next byte 257 - c times. With VIDEO_FLAG_STAMP the records are
+ * preceded by a 32-bit time stamp of the sender (the framebuffer mirror, fb_mirror.h, sends
+ * the tick at which the frame reached the panel).
+ *
+ * Delta frames only carry the tiles that changed since the previous frame. A key frame
+ * carries every tile and is accepted at any time; after a CRC error or a lost packet the
+ * decoder ignores delta frames until the next key frame. An END packet stops the sink.
+ * Tools/video_stream.py is the host encoder; Host/bench/bench_video.c checks both ends.
+ * No RTOS or HAL dependency.
+ */
+
+#ifndef VIDEO_STREAM_H
+#define VIDEO_STREAM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "u8g2.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+/** First sync byte */
+#define VIDEO_SYNC0             0x56U
+/** Second sync byte */
+#define VIDEO_SYNC1             0xA5U
+/** Packet header: sync, type, flags, sequence, payload length */
+#define VIDEO_HEADER_SIZE       8U
+/** Packet trailer: CRC-16 */
+#define VIDEO_CRC_SIZE          2U
+/** Pages of the panel (tile rows) */
+#define VIDEO_PAGES             8U
+/** Tiles per page */
+#define VIDEO_TILE_COLS         16U
+/** Tiles per frame */
+#define VIDEO_TILES             (VIDEO_PAGES * VIDEO_TILE_COLS)
+/** Bytes per tile */
+#define VIDEO_TILE_BYTES        8U
+/** Bytes per frame (u8g2 full buffer) */
+#define VIDEO_FRAME_BYTES       (VIDEO_TILES * VIDEO_TILE_BYTES)
+
+/** Time stamp in front of the records of a VIDEO_FLAG_STAMP frame */
+#define VIDEO_STAMP_SIZE        4U
+
+/**
+ * @def VIDEO_MAX_PAYLOAD
+ * @brief Largest frame payload. The encoder never exceeds it: the worst case is a time stamp
+ *        and one record of all 128 tiles, 4 + 2 + 1024 + 8 PackBits control bytes.
+ */
+#define VIDEO_MAX_PAYLOAD       (VIDEO_STAMP_SIZE + VIDEO_FRAME_BYTES + 16U)
+
+/** Largest packet */
+#define VIDEO_MAX_PACKET        (VIDEO_HEADER_SIZE + VIDEO_MAX_PAYLOAD + VIDEO_CRC_SIZE)
+
+/** Frame flag: every tile is present, the decoder resynchronises on it */
+#define VIDEO_FLAG_KEY          0x01U
+/** Frame flag: the payload starts with a VIDEO_STAMP_SIZE time stamp */
+#define VIDEO_FLAG_STAMP        0x02U
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @enum VideoPacketType_t
+ * @brief Packet types.
+ */
+typedef enum {
+    VIDEO_PKT_FRAME = 1,        /**< Tile records */
+    VIDEO_PKT_END               /**< End of stream (no payload) */
+} VideoPacketType_t;
+
+/**
+ * @enum VideoEvent_t
+ * @brief Result bits of Video_Decode().
+ */
+typedef enum {
+    VIDEO_EVT_NONE = 0,         /**< Nothing complete yet */
+    VIDEO_EVT_FRAME = 1,        /**< At least one frame was applied */
+    VIDEO_EVT_END = 2           /**< An END packet was received */
+} VideoEvent_t;
+
+/**
+ * @struct VideoTiles_t
+ * @brief Set of tiles: bit x of rows[p] is tile column x of page p.
+ */
+typedef struct {
+    uint16_t rows[VIDEO_PAGES]; /**< One bit per tile */
+} VideoTiles_t;
+
+/**
+ * @struct VideoStats_t
+ * @brief Decoder counters.
+ */
+typedef struct {
+    uint32_t bytes;             /**< Bytes fed to the decoder */
+    uint32_t frames;            /**< Frames applied */
+    uint32_t key_frames;        /**< Of which key frames */
+    uint32_t tiles;             /**< Tiles written */
+    uint32_t crc_errors;        /**< Packets with a wrong CRC */
+    uint32_t format_errors;     /**< Bad header or malformed payload */
+    uint32_t skipped;           /**< Delta frames ignored while waiting for a key frame */
+} VideoStats_t;
+
+/**
+ * @struct VideoDecoder_t
+ * @brief Stream decoder: packet assembly, validation and sequence tracking.
+ */
+typedef struct {
+    uint8_t state;                      /**< Parser state */
+    bool synced;                        /**< A key frame was applied and no packet was lost since */
+    uint16_t next_seq;                  /**< Sequence number expected next */
+    uint16_t pos;                       /**< Bytes of the current packet in packet[] */
+    uint16_t need;                      /**< Length of the current packet */
+    uint32_t stamp;                     /**< Time stamp of the last frame applied, 0 without one */
+    VideoStats_t stats;                 /**< Counters */
+    uint8_t packet[VIDEO_MAX_PACKET];   /**< Packet being assembled */
+} VideoDecoder_t;
+
+/* Exported functions --------------------------------------------------------*/
+/**
+ * @brief  Reset a decoder (waits for sync and a key frame, counters cleared).
+ * @param dec Decoder.
+ */
+void Video_DecoderInit(VideoDecoder_t *dec);
+
+/**
+ * @brief  Feed received bytes; apply every complete, valid frame to a frame buffer.
+ *
+ * Bytes may arrive in any split. Each frame is checked completely (CRC, record bounds)
+ * before the first byte of the frame buffer is written.
+ *
+ * @param dec   Decoder.
+ * @param data  Received bytes.
+ * @param len   Number of bytes.
+ * @param fb    Frame buffer (VIDEO_FRAME_BYTES, u8g2 full-buffer layout).
+ * @param dirty Tiles written are added (not cleared first).
+ * @return VideoEvent_t bits.
+ */
+uint32_t Video_Decode(VideoDecoder_t *dec, const uint8_t *data, size_t len, uint8_t *fb,
+                      VideoTiles_t *dirty);
+
+/**
+ * @brief  Encode a frame as the delta to the previous one.
+ * @param prev Previous frame, or NULL for a key frame.
+ * @param cur  Frame to send.
+ * @param seq  Sequence number.
+ * @param key  Force a key frame.
+ * @param out  Packet output.
+ * @param cap  Size of out (at least VIDEO_MAX_PACKET).
+ * @return Packet length, 0 if cap is too small.
+ */
+size_t Video_EncodeFrame(const uint8_t *prev, const uint8_t *cur, uint16_t seq, bool key,
+                         uint8_t *out, size_t cap);
+
+/**
+ * @brief  Encode a frame like Video_EncodeFrame(), with a time stamp (VIDEO_FLAG_STAMP).
+ * @param prev  Previous frame, or NULL for a key frame.
+ * @param cur   Frame to send.
+ * @param seq   Sequence number.
+ * @param key   Force a key frame.
+ * @param stamp Time stamp, in units agreed with the receiver.
+ * @param out   Packet output.
+ * @param cap   Size of out (at least VIDEO_MAX_PACKET).
+ * @return Packet length, 0 if cap is too small.
+ */
+size_t Video_EncodeStampedFrame(const uint8_t *prev, const uint8_t *cur, uint16_t seq, bool key,
+                                uint32_t stamp, uint8_t *out, size_t cap);
+
+/**
+ * @brief  Encode an END packet.
+ * @param seq Sequence number.
+ * @param out Packet output.
+ * @param cap Size of out (at least VIDEO_HEADER_SIZE + VIDEO_CRC_SIZE).
+ * @return Packet length, 0 if cap is too small.
+ */
+size_t Video_EncodeEnd(uint16_t seq, uint8_t *out, size_t cap);
+
+/**
+ * @brief  Send a set of tiles of the u8g2 buffer to the panel, one transfer per run.
+ * @param u8g2  Pointer to the u8g2 display structure (full buffer).
+ * @param tiles Tiles to send.
+ * @return Number of tiles sent.
+ */
+uint32_t Video_UpdateDisplay(u8g2_t *u8g2, const VideoTiles_t *tiles);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // VIDEO_STREAM_H
@@ -0,0 +1,193 @@
+/**
+ * @file    widget.h
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Retained widgets on top of u8g2: label, numeric readout, progress bar, bitmap, graph.
+ *
+ * @details
+ * A screen is an array of Widget_t, each with a bounding box and a dirty flag. The setters
+ * mark a widget dirty only when what it shows changes. Widget_DrawAll() draws a whole screen
+ * into a cleared buffer; Widget_DrawDirty() clears and redraws only the dirty widgets (and
+ * any widget whose box overlaps one of them), each clipped to its box, and collects the 8x8
+ * tiles they cover so the caller flushes just those (Video_UpdateDisplay()). Widgets draw in
+ * array order, so a later widget may be drawn over an earlier one.
+ *
+ * No RTOS or HAL dependency: the display task, the golden images (Host/golden) and
+ * Host/bench/bench_widgets.c use the same code.
+ */
+
+#ifndef WIDGET_H
+#define WIDGET_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "u8g2.h"
+#include "asset_pack.h"
+#include "video_stream.h"
+
+/* Exported constants --------------------------------------------------------*/
+/** Widget has to be redrawn */
+#define WIDGET_F_DIRTY          0x01U
+/** Label, numeric: text right-aligned in the box */
+#define WIDGET_F_ALIGN_RIGHT    0x02U
+/** Label, numeric: text centred in the box */
+#define WIDGET_F_ALIGN_CENTER   0x04U
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @enum WidgetType_t
+ * @brief Widget types.
+ */
+typedef enum {
+    WIDGET_LABEL = 0,           /**< NUL-terminated text */
+    WIDGET_NUMERIC,             /**< Signed decimal value */
+    WIDGET_PROGRESS,            /**< Outlined bar filled in proportion to value in [min, max] */
+    WIDGET_BITMAP,              /**< Image asset at the top-left corner of the box */
+    WIDGET_GRAPH,               /**< Line graph of the latest samples, oldest on the left */
+    WIDGET_CUSTOM               /**< Drawn by a callback (e.g. the QR symbol) */
+} WidgetType_t;
+
+struct Widget;
+
+/** Draw callback of a WIDGET_CUSTOM widget; it must stay inside the box */
+typedef void (*WidgetDrawFn_t)(u8g2_t *u8g2, const struct Widget *widget);
+
+/**
+ * @struct Widget_t
+ * @brief One widget. Set up with Widget_Init(); change what it shows with the setters.
+ */
+typedef struct Widget {
+    uint8_t type;               /**< WidgetType_t */
+    uint8_t flags;              /**< WIDGET_F_... */
+    uint8_t x;                  /**< Left edge of the box (pixels) */
+    uint8_t y;                  /**< Top edge of the box (pixels) */
+    uint8_t width;              /**< Box width (pixels) */
+    uint8_t height;             /**< Box height (pixels) */
+    uint8_t baseline;           /**< Label, numeric: text baseline below the top of the box */
+    const uint8_t *font;        /**< Label, numeric: u8g2 font, NULL for the current one */
+    int32_t value;              /**< Numeric, progress: shown value */
+    int32_t min;                /**< Progress, graph: value of an empty bar / the bottom row */
+    int32_t max;                /**< Progress, graph: value of a full bar / the top row */
+    union {
+        const char *text;       /**< Label */
+        AssetId_t image;        /**< Bitmap */
+        struct {
+            int32_t *samples;   /**< Ring of samples (caller's storage) */
+            uint16_t capacity;  /**< Ring size */
+            uint16_t count;     /**< Samples held */
+            uint16_t head;      /**< Next slot to write */
+        } graph;                /**< Graph */
+        struct {
+            WidgetDrawFn_t draw;    /**< Draw callback */
+            const void *arg;        /**< Callback argument */
+        } custom;               /**< Custom */
+    } u;
+} Widget_t;
+
+/* Exported functions --------------------------------------------------------*/
+/**
+ * @brief  Set up a widget: type, box, no content, dirty; the baseline is the bottom of the box.
+ * @param widget Widget.
+ * @param type   WidgetType_t.
+ * @param x      Left edge (pixels).
+ * @param y      Top edge (pixels).
+ * @param width  Width (pixels).
+ * @param height Height (pixels).
+ */
+void Widget_Init(Widget_t *widget, WidgetType_t type, uint8_t x, uint8_t y, uint8_t width, uint8_t height);
+
+/**
+ * @brief  Show a text (label); dirty unless it is the same text at the same address.
+ * @param widget Label.
+ * @param text   NUL-terminated text, kept by reference.
+ */
+void Widget_SetText(Widget_t *widget, const char *text);
+
+/**
+ * @brief  Show a value (numeric, progress); dirty if it changed.
+ * @param widget Numeric or progress widget.
+ * @param value  New value.
+ */
+void Widget_SetValue(Widget_t *widget, int32_t value);
+
+/**
+ * @brief  Set the value range of a progress bar or graph.
+ * @param widget Progress or graph widget.
+ * @param min    Value of an empty bar / bottom row.
+ * @param max    Value of a full bar / top row (greater than min).
+ */
+void Widget_SetRange(Widget_t *widget, int32_t min, int32_t max);
+
+/**
+ * @brief  Show an image asset (bitmap); dirty if it changed.
+ * @param widget Bitmap widget.
+ * @param id     Asset id of an image.
+ */
+void Widget_SetImage(Widget_t *widget, AssetId_t id);
+
+/**
+ * @brief  Give a graph its sample storage (emptied).
+ * @param widget   Graph widget.
+ * @param samples  Storage for capacity samples (one per column is enough).
+ * @param capacity Number of samples.
+ */
+void Widget_SetGraphBuffer(Widget_t *widget, int32_t *samples, uint16_t capacity);
+
+/**
+ * @brief  Append a sample to a graph, dropping the oldest when full; always dirty.
+ * @param widget Graph widget.
+ * @param value  Sample.
+ */
+void Widget_GraphPush(Widget_t *widget, int32_t value);
+
+/**
+ * @brief  Draw a custom widget with a callback.
+ * @param widget Custom widget.
+ * @param draw   Draw callback.
+ * @param arg    Callback argument (widget->u.custom.arg).
+ */
+void Widget_SetCustom(Widget_t *widget, WidgetDrawFn_t draw, const void *arg);
+
+/**
+ * @brief  Mark a widget dirty (its content changed outside the setters).
+ * @param widget Widget.
+ */
+void Widget_Invalidate(Widget_t *widget);
+
+/**
+ * @brief  Whether any widget of a screen is dirty.
+ * @param widgets Widgets.
+ * @param count   Number of widgets.
+ * @return true if at least one is dirty.
+ */
+bool Widget_AnyDirty(const Widget_t *widgets, size_t count);
+
+/**
+ * @brief  Draw every widget into a cleared buffer and mark them clean.
+ * @param u8g2    Pointer to the u8g2 display structure (full buffer).
+ * @param widgets Widgets, drawn in order.
+ * @param count   Number of widgets.
+ */
+void Widget_DrawAll(u8g2_t *u8g2, Widget_t *widgets, size_t count);
+
+/**
+ * @brief  Clear and redraw the dirty widgets and the widgets overlapping them; mark them clean.
+ * @param u8g2    Pointer to the u8g2 display structure (full buffer holding the last frame).
+ * @param widgets Widgets, drawn in order.
+ * @param count   Number of widgets.
+ * @param tiles   Tiles covered by the redrawn boxes are added (not cleared first).
+ * @return Number of widgets redrawn.
+ */
+uint32_t Widget_DrawDirty(u8g2_t *u8g2, Widget_t *widgets, size_t count, VideoTiles_t *tiles);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // WIDGET_H
@@ -0,0 +1,325 @@
+/**
+ * @file    anim.c
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Time-driven animation player.
+ *
+ * @details
+ * Each player keeps the tick at which its current frame started. Anim_Update() moves that tick
+ * forward by whole frame durations, so playback depends only on elapsed time. After a long gap
+ * whole repeat periods are skipped first, which bounds the catch-up work to one period. Frames
+ * are drawn with Screens_DrawImage(). No HAL or RTOS dependency: the tick is a parameter.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "anim.h"
+#include "screens.h"
+#include <string.h>
+
+/**
+ * @enum AnimState_t
+ * @brief State of a player.
+ */
+typedef enum {
+    ANIM_STATE_FREE = 0,        /**< Slot unused */
+    ANIM_STATE_RUNNING,         /**< Changing frames */
+    ANIM_STATE_HOLD             /**< Showing its final frame ("once" finished, or a single frame) */
+} AnimState_t;
+
+/**
+ * @struct AnimPlayer_t
+ * @brief One playing animation.
+ */
+typedef struct {
+    AnimDesc_t desc;            /**< Copy of the descriptor */
+    uint32_t frame_start;       /**< Tick at which the current frame started */
+    uint32_t period;            /**< Ticks until loop/ping-pong playback repeats itself */
+    uint16_t frame;             /**< Current frame index */
+    int8_t step;                /**< +1 forwards, -1 backwards (ping-pong) */
+    uint8_t state;              /**< AnimState_t */
+} AnimPlayer_t;
+
+/**
+ * @defgroup ANIM_Private_Variables Animation Private Variables
+ * @{
+ */
+/** Player slots */
+static AnimPlayer_t anim_players[ANIM_MAX_PLAYERS];
+/** @} */
+
+/**
+ * @defgroup ANIM_Private_Functions Animation Private Functions
+ * @{
+ */
+/**
+ * @brief Duration of one frame
+ * @param desc  Descriptor
+ * @param frame Frame index
+ * @return Milliseconds, at least 1
+ */
+static uint32_t Anim_Duration(const AnimDesc_t *desc, uint16_t frame);
+/**
+ * @brief Ticks after which loop or ping-pong playback is back on the same frame and phase
+ * @param desc Descriptor
+ * @return Period in ms
+ */
+static uint32_t Anim_Period(const AnimDesc_t *desc);
+/**
+ * @brief Move a player to its next frame
+ * @param player Running player
+ */
+static void Anim_Advance(AnimPlayer_t *player);
+/** @} */
+
+
+/**
+ * @brief  Fill a descriptor from an animation entry of the asset pack.
+ * @param desc Descriptor to fill.
+ * @param id   Asset id of an animation.
+ * @param x    Left edge (pixels).
+ * @param y    Top edge (pixels).
+ * @return 0 on success, -1 if the asset is not an animation.
+ */
+int Anim_FromAsset(AnimDesc_t *desc, AssetId_t id, u8g2_uint_t x, u8g2_uint_t y)
+{
+    const AssetEntry_t *entry = Asset_Get(id);
+    uint16_t count;
+    const AssetFrame_t *frames = Asset_Frames(entry, &count);
+
+    if (count == 0U)
+    {
+        return -1;
+    }
+    desc->frames = frames;
+    desc->count = count;
+    desc->mode = (uint8_t)entry->flags;
+    desc->x = x;
+    desc->y = y;
+    return 0;
+}
+
+/**
+ * @brief  Start an animation on its first frame.
+ * @param desc Descriptor.
+ * @param now  Current tick (ms).
+ * @return Player handle, or ANIM_HANDLE_NONE.
+ */
+AnimHandle_t Anim_Start(const AnimDesc_t *desc, uint32_t now)
+{
+    if ((desc->frames == NULL) || (desc->count == 0U))
+    {
+        return ANIM_HANDLE_NONE;
+    }
+    for (AnimHandle_t handle = 0; handle < ANIM_MAX_PLAYERS; handle++)
+    {
+        AnimPlayer_t *player = &anim_players[handle];
+        if (player->state == ANIM_STATE_FREE)
+        {
+            player->desc = *desc;
+            player->frame_start = now;
+            player->period = Anim_Period(desc);
+            player->frame = 0;
+            player->step = 1;
+            player->state = (desc->count > 1U) ? ANIM_STATE_RUNNING : ANIM_STATE_HOLD;
+            return handle;
+        }
+    }
+    return ANIM_HANDLE_NONE;
+}
+
+/**
+ * @brief  Stop an animation and free its player.
+ * @param handle Handle from Anim_Start().
+ * @return None
+ */
+void Anim_Stop(AnimHandle_t handle)
+{
+    if (handle < ANIM_MAX_PLAYERS)
+    {
+        memset(&anim_players[handle], 0, sizeof(anim_players[handle]));
+    }
+}
+
+/**
+ * @brief  Stop every animation.
+ * @return None
+ */
+void Anim_StopAll(void)
+{
+    memset(anim_players, 0, sizeof(anim_players));
+}
+
+/**
+ * @brief  Advance every running animation to the frame due at a tick.
+ * @param now Current tick (ms).
+ * @return true if any animation changed frame.
+ */
+bool Anim_Update(uint32_t now)
+{
+    bool changed = false;
+
+    for (AnimHandle_t handle = 0; handle < ANIM_MAX_PLAYERS; handle++)
+    {
+        AnimPlayer_t *player = &anim_players[handle];
+        uint16_t shown = player->frame;
+
+        if (player->state != ANIM_STATE_RUNNING)
+        {
+            continue;
+        }
+        /* Whole periods end on the same frame and phase; skip them instead of stepping */
+        uint32_t elapsed = now - player->frame_start;
+        if ((player->desc.mode != ASSET_ANIM_ONCE) && (elapsed >= player->period))
+        {
+            player->frame_start += elapsed - (elapsed % player->period);
+        }
+        while (player->state == ANIM_STATE_RUNNING)
+        {
+            uint32_t duration = Anim_Duration(&player->desc, player->frame);
+            if ((now - player->frame_start) < duration)
+            {
+                break;
+            }
+            player->frame_start += duration;
+            Anim_Advance(player);
+        }
+        if (player->frame != shown)
+        {
+            changed = true;
+        }
+    }
+    return changed;
+}
+
+/**
+ * @brief  Time until the next frame change of any animation.
+ * @param now Current tick (ms).
+ * @return Milliseconds, or ANIM_NO_DEADLINE.
+ */
+uint32_t Anim_NextDue(uint32_t now)
+{
+    uint32_t due = ANIM_NO_DEADLINE;
+
+    for (AnimHandle_t handle = 0; handle < ANIM_MAX_PLAYERS; handle++)
+    {
+        const AnimPlayer_t *player = &anim_players[handle];
+        if (player->state != ANIM_STATE_RUNNING)
+        {
+            continue;
+        }
+        uint32_t duration = Anim_Duration(&player->desc, player->frame);
+        uint32_t elapsed = now - player->frame_start;
+        uint32_t left = (elapsed < duration) ? (duration - elapsed) : 0U;
+        if (left < due)
+        {
+            due = left;
+        }
+    }
+    return due;
+}
+
+/**
+ * @brief  Draw the current frame of every started animation.
+ * @param u8g2 Pointer to the u8g2 display structure.
+ * @return None
+ */
+void Anim_Draw(u8g2_t *u8g2)
+{
+    for (AnimHandle_t handle = 0; handle < ANIM_MAX_PLAYERS; handle++)
+    {
+        const AnimPlayer_t *player = &anim_players[handle];
+        if (player->state != ANIM_STATE_FREE)
+        {
+            (void)Screens_DrawImage(u8g2, player->desc.frames[player->frame].image,
+                                    player->desc.x, player->desc.y);
+        }
+    }
+}
+
+/**
+ * @brief  Current frame of an animation.
+ * @param handle Handle from Anim_Start().
+ * @return Frame index.
+ */
+uint16_t Anim_GetFrame(AnimHandle_t handle)
+{
+    return (handle < ANIM_MAX_PLAYERS) ? anim_players[handle].frame : 0U;
+}
+
+/**
+ * @brief  Whether an animation still changes frames.
+ * @param handle Handle from Anim_Start().
+ * @return true while it is running.
+ */
+bool Anim_IsRunning(AnimHandle_t handle)
+{
+    return (handle < ANIM_MAX_PLAYERS) && (anim_players[handle].state == ANIM_STATE_RUNNING);
+}
+
+/**
+ * @brief Duration of one frame.
+ * @param desc  Descriptor.
+ * @param frame Frame index.
+ * @return Milliseconds, at least 1.
+ */
+static uint32_t Anim_Duration(const AnimDesc_t *desc, uint16_t frame)
+{
+    uint32_t duration = desc->frames[frame].duration_ms;
+    return (duration > 0U) ? duration : 1U;
+}
+
+/**
+ * @brief Ticks after which loop or ping-pong playback is back on the same frame and phase.
+ *
+ * A loop plays every frame once. Ping-pong plays 0 .. n-1 .. 1, so the end frames are shown
+ * once and the others twice.
+ *
+ * @param desc Descriptor.
+ * @return Period in ms.
+ */
+static uint32_t Anim_Period(const AnimDesc_t *desc)
+{
+    uint32_t period = 0;
+
+    for (uint16_t frame = 0; frame < desc->count; frame++)
+    {
+        period += Anim_Duration(desc, frame);
+    }
+    if ((desc->mode == ASSET_ANIM_PINGPONG) && (desc->count > 2U))
+    {
+        period = 2U * period - Anim_Duration(desc, 0) - Anim_Duration(desc, (uint16_t)(desc->count - 1U));
+    }
+    return period;
+}
+
+/**
+ * @brief Move a player to its next frame.
+ * @param player Running player with at least two frames.
+ * @return None
+ */
+static void Anim_Advance(AnimPlayer_t *player)
+{
+    uint16_t last = (uint16_t)(player->desc.count - 1U);
+
+    switch (player->desc.mode)
+    {
+        case ASSET_ANIM_PINGPONG:
+            if (((player->step > 0) && (player->frame == last)) || ((player->step < 0) && (player->frame == 0U)))
+            {
+                player->step = (int8_t)-player->step;
+            }
+            player->frame = (uint16_t)(player->frame + player->step);
+            break;
+        case ASSET_ANIM_ONCE:
+            player->frame++;
+            if (player->frame == last)
+            {
+                player->state = ANIM_STATE_HOLD;
+            }
+            break;
+        case ASSET_ANIM_LOOP:
+        default:
+            player->frame = (player->frame == last) ? 0U : (uint16_t)(player->frame + 1U);
+            break;
+    }
+}
@@ -0,0 +1,221 @@
+/**
+ * @file    asset_pack.c
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Flash-resident asset pack: validation and in-place lookup.
+ *
+ * @details
+ * The pack is checked once (Asset_Init(), also run by the first lookup); every later access is
+ * a bounds check and a pointer into flash. Lookup by id indexes the entry table directly, lookup
+ * by name scans it (a few dozen entries at most). No HAL or RTOS dependency.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "asset_pack.h"
+#include <string.h>
+
+#if ASSET_PACK_EMBED
+#include "../Image/asset_pack_data.h"
+#endif
+
+/**
+ * @defgroup ASSET_Private_Defines Asset Pack Private Defines
+ * @{
+ */
+/** First byte of the pack */
+#if ASSET_PACK_EMBED
+#define ASSET_PACK_BASE         (gAssetPack)
+#else
+#define ASSET_PACK_BASE         ((const uint8_t *)ASSET_PACK_ADDRESS)
+#endif
+/** @} */
+
+/**
+ * @enum AssetState_t
+ * @brief Result of the pack validation.
+ */
+typedef enum {
+    ASSET_STATE_UNCHECKED = 0,  /**< Asset_Init() has not run */
+    ASSET_STATE_VALID,          /**< Header, index and CRC are correct */
+    ASSET_STATE_INVALID         /**< No usable pack (erased sector, old format, corrupt) */
+} AssetState_t;
+
+/**
+ * @defgroup ASSET_Private_Variables Asset Pack Private Variables
+ * @{
+ */
+/** Validation result */
+static AssetState_t asset_state;
+/** CRC-32 (zlib, reflected polynomial 0xEDB88320) of one nibble */
+static const uint32_t asset_crc_nibble[16] = {
+    0x00000000UL, 0x1DB71064UL, 0x3B6E20C8UL, 0x26D930ACUL,
+    0x76DC4190UL, 0x6B6B51F4UL, 0x4DB26158UL, 0x5005713CUL,
+    0xEDB88320UL, 0xF00F9344UL, 0xD6D6A3E8UL, 0xCB61B38CUL,
+    0x9B64C2B0UL, 0x86D3D2D4UL, 0xA00AE278UL, 0xBDBDF21CUL
+};
+/** @} */
+
+/**
+ * @defgroup ASSET_Private_Functions Asset Pack Private Functions
+ * @{
+ */
+/**
+ * @brief CRC-32 (zlib) of a block
+ * @param data Data
+ * @param len  Length in bytes
+ * @return CRC
+ */
+static uint32_t Asset_Crc32(const uint8_t *data, uint32_t len);
+/**
+ * @brief Header of the pack
+ * @return Header in flash
+ */
+static const AssetPackHeader_t *Asset_Header(void);
+/** @} */
+
+
+/**
+ * @brief  Validate the pack (magic, format, size, index bounds, CRC).
+ * @return 0 if the pack is usable, -1 otherwise.
+ */
+int Asset_Init(void)
+{
+    if (asset_state != ASSET_STATE_UNCHECKED)
+    {
+        return (asset_state == ASSET_STATE_VALID) ? 0 : -1;
+    }
+
+    const AssetPackHeader_t *header = Asset_Header();
+    const AssetEntry_t *entries = (const AssetEntry_t *)(header + 1);
+    uint32_t index_end = (uint32_t)sizeof(*header) + (uint32_t)header->count * sizeof(AssetEntry_t);
+
+    asset_state = ASSET_STATE_INVALID;
+    if ((header->magic != ASSET_PACK_MAGIC) || (header->format != ASSET_PACK_FORMAT) ||
+        (header->size > ASSET_PACK_MAX_SIZE) || (header->size < index_end))
+    {
+        return -1;
+    }
+    for (uint16_t i = 0; i < header->count; i++)
+    {
+        const AssetEntry_t *entry = &entries[i];
+        if ((entry->offset < index_end) || (entry->offset > header->size) ||
+            (entry->length > header->size - entry->offset) || (entry->name[ASSET_NAME_LEN - 1U] != '\0'))
+        {
+            return -1;
+        }
+    }
+    if (Asset_Crc32((const uint8_t *)entries, header->size - (uint32_t)sizeof(*header)) != header->crc)
+    {
+        return -1;
+    }
+    asset_state = ASSET_STATE_VALID;
+    return 0;
+}
+
+/**
+ * @brief  Number of assets of a valid pack.
+ * @return Entry count, 0 if the pack is invalid.
+ */
+uint16_t Asset_Count(void)
+{
+    return (Asset_Init() == 0) ? Asset_Header()->count : 0U;
+}
+
+/**
+ * @brief  Index entry of an asset.
+ * @param id Asset id.
+ * @return Entry in flash, or NULL for an unknown id or invalid pack.
+ */
+const AssetEntry_t *Asset_Get(AssetId_t id)
+{
+    if (id >= Asset_Count())
+    {
+        return NULL;
+    }
+    return &((const AssetEntry_t *)(Asset_Header() + 1))[id];
+}
+
+/**
+ * @brief  Index entry of an asset by name.
+ * @param name Asset name.
+ * @return Entry in flash, or NULL if there is none.
+ */
+const AssetEntry_t *Asset_Find(const char *name)
+{
+    return Asset_Get(Asset_FindId(name));
+}
+
+/**
+ * @brief  Asset id of a name.
+ * @param name Asset name.
+ * @return Id, or ASSET_ID_NONE.
+ */
+AssetId_t Asset_FindId(const char *name)
+{
+    uint16_t count = Asset_Count();
+    const AssetEntry_t *entries = (const AssetEntry_t *)(Asset_Header() + 1);
+
+    for (uint16_t id = 0; id < count; id++)
+    {
+        if (strncmp(entries[id].name, name, ASSET_NAME_LEN) == 0)
+        {
+            return id;
+        }
+    }
+    return ASSET_ID_NONE;
+}
+
+/**
+ * @brief  Data of an asset, in place in flash.
+ * @param entry Entry from Asset_Get() or Asset_Find().
+ * @return First data byte.
+ */
+const uint8_t *Asset_Data(const AssetEntry_t *entry)
+{
+    return ASSET_PACK_BASE + entry->offset;
+}
+
+/**
+ * @brief  Frames of an animation.
+ * @param entry Entry of type ASSET_TYPE_ANIMATION.
+ * @param count Output, number of frames.
+ * @return First frame, or NULL (count 0) if the entry is not an animation.
+ */
+const AssetFrame_t *Asset_Frames(const AssetEntry_t *entry, uint16_t *count)
+{
+    if ((entry == NULL) || (entry->type != ASSET_TYPE_ANIMATION) || (entry->encoding != ASSET_ENC_FRAMES))
+    {
+        *count = 0;
+        return NULL;
+    }
+    *count = (uint16_t)(entry->length / sizeof(AssetFrame_t));
+    return (const AssetFrame_t *)Asset_Data(entry);
+}
+
+/**
+ * @brief CRC-32 (zlib) of a block.
+ * @param data Data.
+ * @param len  Length in bytes.
+ * @return CRC.
+ */
+static uint32_t Asset_Crc32(const uint8_t *data, uint32_t len)
+{
+    uint32_t crc = 0xFFFFFFFFUL;
+
+    while (len-- > 0U)
+    {
+        crc ^= *data++;
+        crc = (crc >> 4) ^ asset_crc_nibble[crc & 0x0FU];
+        crc = (crc >> 4) ^ asset_crc_nibble[crc & 0x0FU];
+    }
+    return ~crc;
+}
+
+/**
+ * @brief Header of the pack.
+ * @return Header in flash.
+ */
+static const AssetPackHeader_t *Asset_Header(void)
+{
+    return (const AssetPackHeader_t *)(const void *)ASSET_PACK_BASE;
+}
@@ -0,0 +1,318 @@
+/**
+ * @file    cmd_handler.c
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Executes command frames (cmd_proto.h) received on USART3.
+ *
+ * @details
+ * Runs in the log task, called from Console_Poll(). A frame is parsed where it lies in the RX
+ * ring and consumed only once it has been executed; an incomplete frame is left in the ring
+ * until the rest arrives or CMD_FRAME_TIMEOUT_MS passes, so a truncated frame cannot swallow
+ * console keys or the next frame for longer than that.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "cmd_handler.h"
+#include "FreeRTOS.h"
+#include "cmsis_os2.h"
+#include "display_cmd.h"
+#include "rtos_stats.h"
+#include "rtos_tasks.h"
+#include "uart_tx.h"
+#include "stdbool.h"
+
+/**
+ * @defgroup CMD_HANDLER_Private_Variables Command Handler Private Variables
+ * @{
+ */
+/** Copy of a payload split by the end of the RX ring */
+static uint8_t cmd_scratch[CMD_MAX_PAYLOAD];
+/** Response being sent */
+static uint8_t cmd_response[CMD_MAX_FRAME];
+/** Set while an incomplete frame waits for its remaining bytes */
+static bool cmd_waiting;
+/** Tick at which the incomplete frame was first seen */
+static uint32_t cmd_wait_since;
+/** Counters */
+static CmdHandlerStats_t cmd_stats;
+/** @} */
+
+/**
+ * @defgroup CMD_HANDLER_Private_Functions Command Handler Private Functions
+ * @{
+ */
+/**
+ * @brief Execute a valid frame and send the answer
+ * @param frame Parsed frame
+ */
+static void CmdHandler_Execute(const CmdFrame_t *frame);
+/**
+ * @brief Check and apply a CMD_TEXT payload
+ * @param frame Parsed frame
+ * @return CmdStatus_t
+ */
+static CmdStatus_t CmdHandler_SetText(const CmdFrame_t *frame);
+/**
+ * @brief Answer of a DisplayCmd_...() result
+ * @param status Result
+ * @return CmdStatus_t
+ */
+static CmdStatus_t CmdHandler_Status(osStatus_t status);
+/**
+ * @brief Send CMD_RSP_STATS
+ */
+static void CmdHandler_SendStats(void);
+/**
+ * @brief Queue a response frame without waiting
+ * @param type    Response type
+ * @param payload Payload
+ * @param len     Payload length
+ */
+static void CmdHandler_Send(uint8_t type, const uint8_t *payload, size_t len);
+/** @} */
+
+
+/**
+ * @brief  Parse and execute the frame at the start of the received bytes (log task).
+ * @param view Received bytes; the first one is CMD_SYNC0.
+ * @param now  Current tick (ms).
+ * @return Bytes to consume; 0 while the rest of the frame has not arrived.
+ */
+size_t CmdHandler_Process(const UartRxView_t *view, uint32_t now)
+{
+    CmdFrame_t frame;
+    size_t consumed;
+
+    CmdParseResult_t result = Cmd_Parse(view, cmd_scratch, &frame, &consumed);
+    if (result == CMD_PARSE_MORE)
+    {
+        if (!cmd_waiting)
+        {
+            cmd_waiting = true;
+            cmd_wait_since = now;
+            return 0;
+        }
+        if ((now - cmd_wait_since) < CMD_FRAME_TIMEOUT_MS)
+        {
+            return 0;
+        }
+        /* Give up on this start and look for the next one */
+        cmd_stats.timeouts++;
+        cmd_waiting = false;
+        return 1;
+    }
+
+    cmd_waiting = false;
+    switch (result)
+    {
+        case CMD_PARSE_FRAME:
+            cmd_stats.frames++;
+            CmdHandler_Execute(&frame);
+            break;
+        case CMD_PARSE_BAD_SYNC:
+            cmd_stats.sync_errors++;
+            break;
+        case CMD_PARSE_BAD_LENGTH:
+            cmd_stats.length_errors++;
+            break;
+        case CMD_PARSE_BAD_CRC:
+        default:
+            cmd_stats.crc_errors++;
+            break;
+    }
+    return consumed;
+}
+
+/**
+ * @brief  Copy the command counters.
+ * @param stats Destination for the counters.
+ * @return None
+ */
+void CmdHandler_GetStats(CmdHandlerStats_t *stats)
+{
+    *stats = cmd_stats;
+}
+
+/**
+ * @brief Execute a valid frame and send the answer.
+ *
+ * Display commands take the same non-blocking queue path as a button press; the video mode is
+ * refused because it needs the line rate switch of the console command 'v'. Multi-byte fields
+ * are little-endian.
+ *
+ * @param frame Parsed frame.
+ * @return None
+ */
+static void CmdHandler_Execute(const CmdFrame_t *frame)
+{
+    CmdStatus_t status = CMD_STATUS_OK;
+
+    switch (frame->type)
+    {
+        case CMD_MODE:
+            if ((frame->len != 1U) || (frame->payload[0] == (uint8_t)DISPLAY_MODE_VIDEO))
+            {
+                status = CMD_STATUS_BAD_ARG;
+                break;
+            }
+            status = CmdHandler_Status(DisplayCmd_Show((DisplayMode_t)frame->payload[0]));
+            break;
+        case CMD_TEXT:
+            status = CmdHandler_SetText(frame);
+            break;
+        case CMD_FPS:
+            if (frame->len != 1U)
+            {
+                status = CMD_STATUS_BAD_ARG;
+                break;
+            }
+            status = CmdHandler_Status(DisplayCmd_SetRefreshRate(frame->payload[0]));
+            break;
+        case CMD_CONTRAST:
+            if (frame->len != 1U)
+            {
+                status = CMD_STATUS_BAD_ARG;
+                break;
+            }
+            status = CmdHandler_Status(DisplayCmd_SetContrast(frame->payload[0]));
+            break;
+        case CMD_VALUE:
+        {
+            if (frame->len != 5U)
+            {
+                status = CMD_STATUS_BAD_ARG;
+                break;
+            }
+            const uint8_t *p = &frame->payload[1];
+            uint32_t value = (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+            status = CmdHandler_Status(DisplayCmd_SetValue(frame->payload[0], (int32_t)value));
+            break;
+        }
+        case CMD_IMAGE:
+            if (frame->len != 2U)
+            {
+                status = CMD_STATUS_BAD_ARG;
+                break;
+            }
+            status = CmdHandler_Status(DisplayCmd_ShowImage(
+                (AssetId_t)((uint32_t)frame->payload[0] | ((uint32_t)frame->payload[1] << 8))));
+            break;
+        case CMD_ANIM:
+            if (frame->len != 4U)
+            {
+                status = CMD_STATUS_BAD_ARG;
+                break;
+            }
+            status = CmdHandler_Status(DisplayCmd_StartAnim(
+                (AssetId_t)((uint32_t)frame->payload[0] | ((uint32_t)frame->payload[1] << 8)), frame->payload[2], frame->payload[3]));
+            break;
+        case CMD_QR:
+            status = CmdHandler_Status(DisplayCmd_SetQRPayload(frame->payload, frame->len));
+            break;
+        case CMD_STATS:
+            if (frame->len == 0U)
+            {
+                CmdHandler_SendStats();
+                return;
+            }
+            status = CMD_STATUS_BAD_ARG;
+            break;
+        default:
+            status = CMD_STATUS_UNKNOWN;
+            break;
+    }
+
+    if (status != CMD_STATUS_OK)
+    {
+        cmd_stats.rejected++;
+    }
+    uint8_t ack[2] = { frame->type, (uint8_t)status };
+    CmdHandler_Send(CMD_RSP_ACK, ack, sizeof(ack));
+}
+
+/**
+ * @brief Check and apply a CMD_TEXT payload: field index, then printable ASCII only.
+ * @param frame Parsed frame.
+ * @return CmdStatus_t.
+ */
+static CmdStatus_t CmdHandler_SetText(const CmdFrame_t *frame)
+{
+    if ((frame->len < 1U) || ((frame->len - 1U) > CMD_TEXT_MAX))
+    {
+        return CMD_STATUS_BAD_ARG;
+    }
+    for (uint32_t i = 1; i < frame->len; i++)
+    {
+        if ((frame->payload[i] < 0x20U) || (frame->payload[i] > 0x7EU))
+        {
+            return CMD_STATUS_BAD_ARG;
+        }
+    }
+    return CmdHandler_Status(DisplayCmd_SetText(frame->payload[0], (const char *)&frame->payload[1],
+                                                frame->len - 1U));
+}
+
+/**
+ * @brief Answer of a DisplayCmd_...() result.
+ *
+ * Image and animation ids and QR payloads are checked by the display task, so an unknown id
+ * or a payload that does not fit is acknowledged and only logged there.
+ *
+ * @param status Result.
+ * @return CmdStatus_t.
+ */
+static CmdStatus_t CmdHandler_Status(osStatus_t status)
+{
+    if (status == osOK)
+    {
+        return CMD_STATUS_OK;
+    }
+    return (status == osErrorParameter) ? CMD_STATUS_BAD_ARG : CMD_STATUS_BUSY;
+}
+
+/**
+ * @brief Send CMD_RSP_STATS (CMD_STATS_FIELDS little-endian uint32 values).
+ * @return None
+ */
+static void CmdHandler_SendStats(void)
+{
+    uint32_t fields[CMD_STATS_FIELDS];
+    uint8_t payload[CMD_STATS_FIELDS * 4U];
+    UartRxStats_t rx;
+
+    UART_RX_GetStats(&rx);
+    fields[CMD_STAT_UPTIME_MS] = osKernelGetTickCount();
+    fields[CMD_STAT_MODE] = (uint32_t)current_display_mode;
+    fields[CMD_STAT_CPU_PERMILLE] = RTOS_Stats_GetCpuLoad();
+    fields[CMD_STAT_HEAP_FREE] = (uint32_t)xPortGetFreeHeapSize();
+    fields[CMD_STAT_RX_BYTES] = rx.received;
+    fields[CMD_STAT_RX_OVERRUNS] = rx.overruns;
+    fields[CMD_STAT_FRAMES] = cmd_stats.frames;
+    fields[CMD_STAT_ERRORS] = cmd_stats.sync_errors + cmd_stats.length_errors + cmd_stats.crc_errors +
+                              cmd_stats.timeouts;
+    for (uint32_t i = 0; i < CMD_STATS_FIELDS; i++)
+    {
+        payload[i * 4U] = (uint8_t)fields[i];
+        payload[(i * 4U) + 1U] = (uint8_t)(fields[i] >> 8);
+        payload[(i * 4U) + 2U] = (uint8_t)(fields[i] >> 16);
+        payload[(i * 4U) + 3U] = (uint8_t)(fields[i] >> 24);
+    }
+    CmdHandler_Send(CMD_RSP_STATS, payload, sizeof(payload));
+}
+
+/**
+ * @brief Queue a response frame without waiting.
+ * @param type    Response type.
+ * @param payload Payload.
+ * @param len     Payload length.
+ * @return None
+ */
+static void CmdHandler_Send(uint8_t type, const uint8_t *payload, size_t len)
+{
+    size_t size = Cmd_Encode(type, payload, len, cmd_response, sizeof(cmd_response));
+
+    if ((size == 0U) || (UART_TX_TryWrite(cmd_response, size) != 0))
+    {
+        cmd_stats.dropped++;
+    }
+}
@@ -0,0 +1,178 @@
+/**
+ * @file    cmd_proto.c
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Framed binary command protocol on USART3: wire format, parser and encoder.
+ *
+ * @details
+ * The parser reads the frame where it lies in the RX ring. The header and CRC bytes are read
+ * through the two spans of the view; the payload is handed out as a pointer into the ring
+ * unless it is split by the end of the ring, the only case that copies (at most
+ * CMD_MAX_PAYLOAD bytes). A frame costs one pass of CRC16_Update() over its bytes.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "cmd_proto.h"
+#include "crc16.h"
+#include "string.h"
+
+/**
+ * @defgroup CMD_PROTO_Private_Functions Command Protocol Private Functions
+ * @{
+ */
+/**
+ * @brief Byte at an offset of the view
+ * @param view   Received bytes
+ * @param offset Offset, less than the total length
+ * @return The byte
+ */
+static uint8_t Cmd_ByteAt(const UartRxView_t *view, size_t offset);
+/**
+ * @brief CRC-16 over a range of the view
+ * @param view   Received bytes
+ * @param offset First byte
+ * @param len    Number of bytes
+ * @return CRC
+ */
+static uint16_t Cmd_CrcRange(const UartRxView_t *view, size_t offset, size_t len);
+/** @} */
+
+
+/**
+ * @brief  Parse the frame at the start of the received bytes.
+ *
+ * Nothing is consumed until the whole frame has arrived. On an error *consumed is 1, so the
+ * caller skips the byte that looked like a frame start and tries again at the next one.
+ *
+ * @param view     Received bytes (one or two spans of the RX ring).
+ * @param scratch  CMD_MAX_PAYLOAD bytes, used only if the payload wraps.
+ * @param frame    Set on CMD_PARSE_FRAME (valid until the bytes are consumed).
+ * @param consumed Set to the bytes to consume: the frame, 1 after an error, 0 for MORE.
+ * @return CmdParseResult_t.
+ */
+CmdParseResult_t Cmd_Parse(const UartRxView_t *view, uint8_t *scratch, CmdFrame_t *frame,
+                           size_t *consumed)
+{
+    size_t total = view->len[0] + view->len[1];
+
+    *consumed = 0;
+    if (total == 0U)
+    {
+        return CMD_PARSE_MORE;
+    }
+    if ((Cmd_ByteAt(view, 0) != CMD_SYNC0) || ((total > 1U) && (Cmd_ByteAt(view, 1) != CMD_SYNC1)))
+    {
+        *consumed = 1;
+        return CMD_PARSE_BAD_SYNC;
+    }
+    if (total < 3U)
+    {
+        return CMD_PARSE_MORE;
+    }
+    size_t len = Cmd_ByteAt(view, 2);
+    if (len > CMD_MAX_PAYLOAD)
+    {
+        *consumed = 1;
+        return CMD_PARSE_BAD_LENGTH;
+    }
+    size_t size = CMD_HEADER_SIZE + len + CMD_CRC_SIZE;
+    if (total < size)
+    {
+        return CMD_PARSE_MORE;
+    }
+
+    uint16_t crc = (uint16_t)(Cmd_ByteAt(view, size - 2U) | ((uint16_t)Cmd_ByteAt(view, size - 1U) << 8));
+    if (Cmd_CrcRange(view, 2, len + 2U) != crc)
+    {
+        *consumed = 1;
+        return CMD_PARSE_BAD_CRC;
+    }
+
+    frame->type = Cmd_ByteAt(view, 3);
+    frame->len = (uint8_t)len;
+    if ((CMD_HEADER_SIZE + len) <= view->len[0])
+    {
+        frame->payload = view->data[0] + CMD_HEADER_SIZE;
+    }
+    else if (CMD_HEADER_SIZE >= view->len[0])
+    {
+        frame->payload = view->data[1] + (CMD_HEADER_SIZE - view->len[0]);
+    }
+    else
+    {
+        /* The end of the ring splits the payload */
+        size_t head = view->len[0] - CMD_HEADER_SIZE;
+        memcpy(scratch, view->data[0] + CMD_HEADER_SIZE, head);
+        memcpy(scratch + head, view->data[1], len - head);
+        frame->payload = scratch;
+    }
+    *consumed = size;
+    return CMD_PARSE_FRAME;
+}
+
+/**
+ * @brief  Build a frame.
+ * @param type    CmdType_t.
+ * @param payload Payload (may be NULL if len is 0).
+ * @param len     Payload length (at most CMD_MAX_PAYLOAD).
+ * @param out     Frame output.
+ * @param cap     Size of out.
+ * @return Frame length, 0 if len or cap is out of range.
+ */
+size_t Cmd_Encode(uint8_t type, const uint8_t *payload, size_t len, uint8_t *out, size_t cap)
+{
+    size_t size = CMD_HEADER_SIZE + len + CMD_CRC_SIZE;
+
+    if ((len > CMD_MAX_PAYLOAD) || (cap < size))
+    {
+        return 0;
+    }
+    out[0] = CMD_SYNC0;
+    out[1] = CMD_SYNC1;
+    out[2] = (uint8_t)len;
+    out[3] = type;
+    if (len > 0U)
+    {
+        memcpy(&out[CMD_HEADER_SIZE], payload, len);
+    }
+    uint16_t crc = CRC16_Compute(&out[2], len + 2U);
+    out[size - 2U] = (uint8_t)crc;
+    out[size - 1U] = (uint8_t)(crc >> 8);
+    return size;
+}
+
+/**
+ * @brief Byte at an offset of the view.
+ * @param view   Received bytes.
+ * @param offset Offset, less than the total length.
+ * @return The byte.
+ */
+static uint8_t Cmd_ByteAt(const UartRxView_t *view, size_t offset)
+{
+    return (offset < view->len[0]) ? view->data[0][offset] : view->data[1][offset - view->len[0]];
+}
+
+/**
+ * @brief CRC-16 over a range of the view, across the end of the ring if needed.
+ * @param view   Received bytes.
+ * @param offset First byte.
+ * @param len    Number of bytes.
+ * @return CRC.
+ */
+static uint16_t Cmd_CrcRange(const UartRxView_t *view, size_t offset, size_t len)
+{
+    uint16_t crc = CRC16_INIT;
+
+    if (offset < view->len[0])
+    {
+        size_t first = view->len[0] - offset;
+        if (first > len)
+        {
+            first = len;
+        }
+        crc = CRC16_Update(crc, view->data[0] + offset, first);
+        len -= first;
+        offset = view->len[0];
+    }
+    return CRC16_Update(crc, view->data[1] + (offset - view->len[0]), len);
+}
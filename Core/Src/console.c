@@ -0,0 +1,135 @@
+/**
+ * @file    console.c
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Single-key command console on USART3 RX.
+ *
+ * @details
+ * The log task reads the USART3 RX ring (uart_rx.h) directly. After 'v' the video sink owns
+ * the ring until the stream ends, so the console stops reading at that character. Bytes from
+ * CMD_SYNC0 on belong to a command frame (cmd_proto.h) and go to the command handler, which
+ * leaves an incomplete frame in the ring until the rest has arrived.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "console.h"
+#include "cmd_handler.h"
+#include "display_cmd.h"
+#include "fb_mirror.h"
+#include "main.h"
+#include "mem_layout.h"
+#include "mem_pool.h"
+#include "rtos_stats.h"
+#include "rtos_tasks.h"
+#include "uart_rx.h"
+#include "uart_tx.h"
+#include "video_sink.h"
+
+/**
+ * @defgroup CONSOLE_Private_Variables Console Private Variables
+ * @{
+ */
+/** Command help text */
+static const char console_help[] =
+    "Commands: s = RTOS stats, p = stats page on OLED, i = I2C bus cost, g = u8g2 profile, m = memory pools, c = CCM bench, v = video sink, f = framebuffer mirror on/off, h = help\r\n";
+/** @} */
+
+/**
+ * @defgroup CONSOLE_Private_Functions Console Private Functions
+ * @{
+ */
+/**
+ * @brief Execute one command character
+ * @param c Received character
+ */
+static void Console_Execute(uint8_t c);
+/** @} */
+
+
+/**
+ * @brief  Execute the commands received since the last call (log task context).
+ * @return None
+ */
+void Console_Poll(void)
+{
+    UartRxView_t view;
+
+    while (!VideoSink_IsActive() && (UART_RX_PeekView(&view) > 0U))
+    {
+        if (view.data[0][0] == CMD_SYNC0)
+        {
+            /* Frames received back to back run with the scheduler locked, so the display task
+               wakes once and applies them in one frame (at most a queue's worth at a time) */
+            size_t used;
+            uint32_t frames = 0;
+            int32_t lock = osKernelLock();
+            do
+            {
+                used = CmdHandler_Process(&view, osKernelGetTickCount());
+                UART_RX_Consume(used);
+                frames++;
+            } while ((used > 0U) && (frames < OLED_DISPLAY_CMD_QUEUE_SIZE) &&
+                     (UART_RX_PeekView(&view) > 0U) && (view.data[0][0] == CMD_SYNC0));
+            (void)osKernelRestoreLock(lock);
+            if (used == 0U)
+            {
+                /* Rest of the frame not received yet */
+                return;
+            }
+            continue;
+        }
+        for (size_t i = 0; (i < view.len[0]) && (view.data[0][i] != CMD_SYNC0); i++)
+        {
+            UART_RX_Consume(1);
+            Console_Execute(view.data[0][i]);
+            if (VideoSink_IsActive())
+            {
+                return;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Execute one command character.
+ *
+ * @param c Received character.
+ * @return None
+ */
+static void Console_Execute(uint8_t c)
+{
+    switch (c)
+    {
+        case 's':
+            RTOS_Stats_Print();
+            break;
+        case 'p':
+            (void)DisplayCmd_Show(DISPLAY_MODE_STATS);
+            break;
+        case 'i':
+            OLED_Task_PrintBusReport();
+            break;
+        case 'g':
+            OLED_Task_RequestProfileReport();
+            break;
+        case 'm':
+            MemPool_Print();
+            break;
+        case 'c':
+            MemLayout_RunBench();
+            break;
+        case 'v':
+            (void)VideoSink_Start();
+            break;
+        case 'f':
+            FbMirror_SetEnabled(!FbMirror_IsEnabled());
+            break;
+        case 'h':
+        case '?':
+            UART_TX_Write((const uint8_t *)console_help, sizeof(console_help) - 1U);
+            break;
+        default:
+            /* Line endings and unknown keys are ignored */
+            break;
+    }
+}
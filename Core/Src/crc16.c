@@ -0,0 +1,50 @@
+/**
+ * @file    crc16.c
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   CRC-16/CCITT-FALSE shared by the serial protocols (video stream, command frames).
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "crc16.h"
+
+/**
+ * @defgroup CRC16_Private_Variables CRC16 Private Variables
+ * @{
+ */
+/** CRC-16/CCITT (polynomial 0x1021) of one nibble */
+static const uint16_t crc16_nibble[16] = {
+    0x0000U, 0x1021U, 0x2042U, 0x3063U, 0x4084U, 0x50A5U, 0x60C6U, 0x70E7U,
+    0x8108U, 0x9129U, 0xA14AU, 0xB16BU, 0xC18CU, 0xD1ADU, 0xE1CEU, 0xF1EFU
+};
+/** @} */
+
+
+/**
+ * @brief  Continue a CRC over another block.
+ * @param crc  CRC so far (CRC16_INIT for the first block).
+ * @param data Data.
+ * @param len  Length in bytes.
+ * @return Updated CRC.
+ */
+uint16_t CRC16_Update(uint16_t crc, const uint8_t *data, size_t len)
+{
+    while (len-- > 0U)
+    {
+        uint8_t byte = *data++;
+        crc = (uint16_t)((crc << 4) ^ crc16_nibble[(crc >> 12) ^ (byte >> 4)]);
+        crc = (uint16_t)((crc << 4) ^ crc16_nibble[(crc >> 12) ^ (byte & 0x0FU)]);
+    }
+    return crc;
+}
+
+/**
+ * @brief  CRC of one block.
+ * @param data Data.
+ * @param len  Length in bytes.
+ * @return CRC.
+ */
+uint16_t CRC16_Compute(const uint8_t *data, size_t len)
+{
+    return CRC16_Update(CRC16_INIT, data, len);
+}
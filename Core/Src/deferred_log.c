@@ -0,0 +1,196 @@
+/**
+ * @file    deferred_log.c
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Deferred, non-blocking logger for ISRs and tasks on NUCLEO-F429ZI.
+ *
+ * @details
+ * Producers push binary records into a lock-free ring; a low-priority RTOS task wakes every
+ * LOG_DRAIN_PERIOD_MS, formats the pending records and queues them on the DMA-driven UART3 TX
+ * engine (uart_tx.h). Formatting therefore runs in the background instead of inside interrupt
+ * context, and no context ever waits for the wire.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "deferred_log.h"
+#include "log_ring.h"
+#include "uart_tx.h"
+#include "trace.h"
+#include "rtos_stats.h"
+#include "console.h"
+#include "main.h"
+#include "rtos_static.h"
+#include "mem_layout.h"
+#include "FreeRTOS.h"
+#include "stdio.h"
+
+/**
+ * @defgroup LOG_Private_Variables Log Private Variables
+ * @brief Private variables for the deferred logger
+ * @{
+ */
+/** Record ring shared by all producers */
+static LogRing_t log_ring CCM_SECTION("log");
+/** Log task handle */
+static osThreadId_t log_task_handle;
+#if RTOS_STATIC_ALLOC
+/** Log task control block */
+static StaticTask_t log_task_cb CCM_SECTION("log");
+/** Log task stack */
+static StackType_t log_task_stack[LOG_TASK_STACK_SIZE_BYTES / sizeof(StackType_t)] CCM_SECTION("log") RTOS_STACK_ALIGN;
+#endif
+
+/** Format strings, indexed by LogFormatId_t */
+static const char *const log_formats[LOG_FMT_COUNT] = {
+    [LOG_FMT_SW1_SHOW_BONGO]     = "SW1: Show bongo cat screen",
+    [LOG_FMT_SW2_SHOW_QRCODE]    = "SW2: Show QR code page",
+    [LOG_FMT_SW_QUEUE_FULL]      = "SW%lu: Failed to send mode to queue",
+    [LOG_FMT_UNKNOWN_GPIO]       = "Unknown GPIO interrupt (pin=%lu), ignored!",
+    [LOG_FMT_SW_TOGGLE_HUD]      = "SW%lu: Perf HUD on=%lu",
+    [LOG_FMT_BOOT_SPLASH]        = "Boot: splash %lu us after reset, display task at tick %lu",
+    [LOG_FMT_ASSET_PACK_INVALID] = "Assets: no valid pack at 0x%08lx, %lu expected",
+    [LOG_FMT_VIDEO_START]        = "Video: sink at %lu baud, idle timeout %lu ms",
+    [LOG_FMT_VIDEO_STOP]         = "Video: stopped after %lu frames, %lu errors",
+    [LOG_FMT_MIRROR_ON]          = "Mirror: on, one frame per %lu ms at most, key frame every %lu ms",
+    [LOG_FMT_MIRROR_OFF]         = "Mirror: off after %lu frames, %lu bytes",
+    [LOG_FMT_DISPLAY_CMD_REJECTED] = "Display: command %lu rejected, id %lu",
+};
+/** @} */
+
+/**
+ * @defgroup LOG_Private_Functions Log Private Functions
+ * @brief Private function prototypes for the deferred logger
+ * @{
+ */
+/**
+ * @brief Log task function (RTOS thread entry)
+ * @param argument Unused task parameter (required by CMSIS-RTOS API)
+ */
+static void Log_Task(void *argument);
+/**
+ * @brief Format and transmit one record
+ * @param record Record to print
+ */
+static void Log_PrintRecord(const LogRecord_t *record);
+/** @} */
+
+
+/**
+ * @brief  Initialize the log ring and create the log task.
+ *
+ * @note If task creation fails, the function outputs an error message via the UART3 panic path and calls Error_Handler().
+ */
+void Log_Init(void)
+{
+    LogRing_Init(&log_ring);
+
+    const osThreadAttr_t log_task_attributes = {
+        .name = LOG_TASK_THREAD_NAME,
+        .priority = LOG_TASK_THREAD_PRIORITY,
+#if RTOS_STATIC_ALLOC
+        .cb_mem = &log_task_cb,
+        .cb_size = sizeof(log_task_cb),
+        .stack_mem = log_task_stack,
+#endif
+        .stack_size = LOG_TASK_STACK_SIZE_BYTES
+    };
+    log_task_handle = osThreadNew(Log_Task, NULL, &log_task_attributes);
+    if (log_task_handle == NULL)
+    {
+        UART_TX_Panic("Failed to create log task\r\n");
+        Error_Handler();
+    }
+}
+
+/**
+ * @brief  Record a log message without formatting or blocking.
+ *
+ * @param fmt_id Message format id.
+ * @param arg0   First integer argument.
+ * @param arg1   Second integer argument.
+ * @return None
+ */
+void Log_Write(LogFormatId_t fmt_id, uint32_t arg0, uint32_t arg1)
+{
+    (void)LogRing_Push(&log_ring, HAL_GetTick(), (uint16_t)fmt_id, LOG_RECORD_MAX_ARGS, arg0, arg1);
+}
+
+/**
+ * @brief  Number of log records dropped because the ring was full.
+ * @return Dropped record count.
+ */
+uint32_t Log_GetDroppedCount(void)
+{
+    return LogRing_GetDropped(&log_ring);
+}
+
+/**
+ * @brief  RTOS log task (drains and prints the record ring).
+ *
+ * Runs at low priority so that formatting and UART output never delay the display task or
+ * interrupt handlers. Dropped records are reported once per drain cycle. The task also
+ * streams pending trace records (see trace.h), refreshes the RTOS statistics (rtos_stats.h)
+ * and executes console commands (console.h).
+ *
+ * @param argument [in] Unused task parameter (required by CMSIS-RTOS API)
+ * @return None
+ * @note This function runs as an RTOS thread and must not return.
+ */
+static void Log_Task(void *argument)
+{
+    uint32_t reported_drops = 0;
+    LogRecord_t record;
+
+    while (1)
+    {
+        while (LogRing_Pop(&log_ring, &record))
+        {
+            Log_PrintRecord(&record);
+        }
+
+        uint32_t drops = LogRing_GetDropped(&log_ring);
+        if (drops != reported_drops)
+        {
+            char msg[LOG_LINE_MAX_LEN];
+            int len = snprintf(msg, sizeof(msg), "Log: %lu record(s) dropped\r\n",
+                               (unsigned long)(drops - reported_drops));
+            UART_TX_Write((const uint8_t *)msg, (size_t)len);
+            reported_drops = drops;
+        }
+
+        Trace_Stream();
+        RTOS_Stats_Update();
+        Console_Poll();
+        osDelay(LOG_DRAIN_PERIOD_MS);
+    }
+}
+
+/**
+ * @brief Format one record as "[tick] message\r\n" and queue it for UART3.
+ *
+ * @param record Record to print.
+ * @return None
+ */
+static void Log_PrintRecord(const LogRecord_t *record)
+{
+    char msg[LOG_LINE_MAX_LEN];
+    int len = snprintf(msg, sizeof(msg), "[%lu] ", (unsigned long)record->timestamp);
+
+    if (record->fmt_id < LOG_FMT_COUNT)
+    {
+        len += snprintf(msg + len, sizeof(msg) - len, log_formats[record->fmt_id],
+                        (unsigned long)record->args[0], (unsigned long)record->args[1]);
+    }
+    else
+    {
+        len += snprintf(msg + len, sizeof(msg) - len, "Unknown log id %u", record->fmt_id);
+    }
+
+    if (len > (int)sizeof(msg) - 3)
+    {
+        len = (int)sizeof(msg) - 3;
+    }
+    msg[len++] = '\r';
+    msg[len++] = '\n';
+    UART_TX_Write((const uint8_t *)msg, (size_t)len);
+}
@@ -0,0 +1,211 @@
+/**
+ * @file    display_cmd.c
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Display command messages: senders (the display task applies them, rtos_tasks.c).
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "display_cmd.h"
+#include "string.h"
+
+/**
+ * @defgroup DISPLAY_CMD_Private_Functions Display Command Private Functions
+ * @{
+ */
+/**
+ * @brief Queue a message without waiting; frees its payload if the queue is full
+ * @param cmd Message
+ * @return osOK or osErrorResource
+ */
+static osStatus_t DisplayCmd_Post(DisplayCmd_t *cmd);
+/** @} */
+
+
+/**
+ * @brief  Show a screen.
+ * @param mode Display mode.
+ * @return osOK, osErrorParameter or osErrorResource (queue full).
+ */
+osStatus_t DisplayCmd_Show(DisplayMode_t mode)
+{
+    DisplayCmd_t cmd = { .type = DISPLAY_CMD_SHOW, .id = (uint16_t)mode };
+
+    if ((uint32_t)mode >= (uint32_t)DISPLAY_MODE_COUNT)
+    {
+        return osErrorParameter;
+    }
+    return DisplayCmd_Post(&cmd);
+}
+
+/**
+ * @brief  Redraw the current screen.
+ * @return osOK or osErrorResource (queue full).
+ */
+osStatus_t DisplayCmd_Refresh(void)
+{
+    DisplayCmd_t cmd = { .type = DISPLAY_CMD_REFRESH };
+
+    return DisplayCmd_Post(&cmd);
+}
+
+/**
+ * @brief  Replace the text of a field.
+ *
+ * The text is copied into a MEM_POOL_TEXT block; the display task keeps the block as the
+ * field's text and frees the one it replaces.
+ *
+ * @param field DisplayTextField_t.
+ * @param text  Text, not NUL-terminated (truncated to DISPLAY_TEXT_MAX bytes).
+ * @param len   Text length.
+ * @return osOK, osErrorParameter or osErrorResource (queue or text pool full).
+ */
+osStatus_t DisplayCmd_SetText(uint32_t field, const char *text, size_t len)
+{
+    DisplayCmd_t cmd = { .type = DISPLAY_CMD_SET_TEXT, .field = (uint8_t)field };
+
+    if (field >= (uint32_t)DISPLAY_TEXT_COUNT)
+    {
+        return osErrorParameter;
+    }
+    cmd.text = MemPool_Alloc(MEM_POOL_TEXT, 0);
+    if (cmd.text == NULL)
+    {
+        return osErrorResource;
+    }
+    if (len > (size_t)DISPLAY_TEXT_MAX)
+    {
+        len = DISPLAY_TEXT_MAX;
+    }
+    memcpy(cmd.text, text, len);
+    cmd.text[len] = '\0';
+    return DisplayCmd_Post(&cmd);
+}
+
+/**
+ * @brief  Set a value field.
+ * @param field Field (0 .. DISPLAY_VALUE_COUNT - 1).
+ * @param value New value.
+ * @return osOK, osErrorParameter or osErrorResource (queue full).
+ */
+osStatus_t DisplayCmd_SetValue(uint32_t field, int32_t value)
+{
+    DisplayCmd_t cmd = { .type = DISPLAY_CMD_SET_VALUE, .field = (uint8_t)field, .value = value };
+
+    if (field >= DISPLAY_VALUE_COUNT)
+    {
+        return osErrorParameter;
+    }
+    return DisplayCmd_Post(&cmd);
+}
+
+/**
+ * @brief  Show an image asset on the image screen and switch to it.
+ * @param id Asset id of an image (checked by the display task).
+ * @return osOK or osErrorResource (queue full).
+ */
+osStatus_t DisplayCmd_ShowImage(AssetId_t id)
+{
+    DisplayCmd_t cmd = { .type = DISPLAY_CMD_SHOW_IMAGE, .id = id };
+
+    return DisplayCmd_Post(&cmd);
+}
+
+/**
+ * @brief  Start an animation asset on the current screen.
+ * @param id Asset id of an animation (checked by the display task).
+ * @param x  Left edge (pixels).
+ * @param y  Top edge (pixels).
+ * @return osOK or osErrorResource (queue full).
+ */
+osStatus_t DisplayCmd_StartAnim(AssetId_t id, uint8_t x, uint8_t y)
+{
+    DisplayCmd_t cmd = { .type = DISPLAY_CMD_START_ANIM, .id = id, .x = x, .y = y };
+
+    return DisplayCmd_Post(&cmd);
+}
+
+/**
+ * @brief  Set the refresh rate of screens with live data.
+ * @param fps Frames per second (1 .. OLED_REFRESH_FPS_MAX).
+ * @return osOK, osErrorParameter or osErrorResource (queue full).
+ */
+osStatus_t DisplayCmd_SetRefreshRate(uint32_t fps)
+{
+    DisplayCmd_t cmd = { .type = DISPLAY_CMD_SET_FPS, .value = (int32_t)fps };
+
+    if ((fps == 0U) || (fps > OLED_REFRESH_FPS_MAX))
+    {
+        return osErrorParameter;
+    }
+    return DisplayCmd_Post(&cmd);
+}
+
+/**
+ * @brief  Set the panel contrast.
+ * @param level Contrast (0 .. 255).
+ * @return osOK or osErrorResource (queue full).
+ */
+osStatus_t DisplayCmd_SetContrast(uint8_t level)
+{
+    DisplayCmd_t cmd = { .type = DISPLAY_CMD_SET_CONTRAST, .value = level };
+
+    return DisplayCmd_Post(&cmd);
+}
+
+/**
+ * @brief  Encode a new payload for the QR code screen.
+ *
+ * The payload travels in a text pool block like a SET_TEXT command; its length is carried in
+ * `value`, so it may hold any byte. The display task encodes it.
+ *
+ * @param data Payload, any bytes (1 .. DISPLAY_TEXT_MAX).
+ * @param len  Payload length.
+ * @return osOK, osErrorParameter or osErrorResource (queue or text pool full).
+ */
+osStatus_t DisplayCmd_SetQRPayload(const uint8_t *data, size_t len)
+{
+    DisplayCmd_t cmd = { .type = DISPLAY_CMD_SET_QR, .value = (int32_t)len };
+
+    if ((len == 0U) || (len > (size_t)DISPLAY_TEXT_MAX))
+    {
+        return osErrorParameter;
+    }
+    cmd.text = MemPool_Alloc(MEM_POOL_TEXT, 0);
+    if (cmd.text == NULL)
+    {
+        return osErrorResource;
+    }
+    memcpy(cmd.text, data, len);
+    cmd.text[len] = '\0';
+    return DisplayCmd_Post(&cmd);
+}
+
+/**
+ * @brief  Free the payload of a message that was not kept.
+ * @param cmd Message.
+ * @return None
+ */
+void DisplayCmd_Release(DisplayCmd_t *cmd)
+{
+    if (cmd->text != NULL)
+    {
+        (void)MemPool_Free(MEM_POOL_TEXT, cmd->text);
+        cmd->text = NULL;
+    }
+}
+
+/**
+ * @brief Queue a message without waiting; frees its payload if the queue is full.
+ * @param cmd Message.
+ * @return osOK or osErrorResource.
+ */
+static osStatus_t DisplayCmd_Post(DisplayCmd_t *cmd)
+{
+    if (osMessageQueuePut(display_cmd_queue, cmd, 0, 0) != osOK)
+    {
+        DisplayCmd_Release(cmd);
+        return osErrorResource;
+    }
+    return osOK;
+}
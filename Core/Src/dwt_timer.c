@@ -0,0 +1,68 @@
+/**
+ * @file    dwt_timer.c
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Cortex-M4 DWT cycle counter access for timestamps and profiling.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "dwt_timer.h"
+
+/**
+ * @brief  Enable the trace unit and start the DWT cycle counter.
+ * @return None
+ */
+void DWT_Timer_Init(void)
+{
+    if ((DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk) != 0U)
+    {
+        return;
+    }
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/**
+ * @brief  Convert a cycle count to microseconds at the current core clock.
+ * @param  cycles Cycle count.
+ * @return Microseconds (rounded down).
+ */
+uint32_t DWT_Timer_CyclesToUs(uint32_t cycles)
+{
+    return (uint32_t)(((uint64_t)cycles * 1000000U) / SystemCoreClock);
+}
+
+/**
+ * @brief  Busy-wait for at least the given number of core clock cycles.
+ * @param  cycles Cycles to wait (below 2^31).
+ * @return None
+ */
+void DWT_Timer_DelayCycles(uint32_t cycles)
+{
+    uint32_t start = DWT_Timer_GetCycles();
+
+    while ((DWT_Timer_GetCycles() - start) < cycles)
+    {
+    }
+}
+
+/**
+ * @brief  Busy-wait for at least the given number of microseconds.
+ * @param  us Microseconds.
+ * @return None
+ */
+void DWT_Timer_DelayUs(uint32_t us)
+{
+    DWT_Timer_DelayCycles(us * (SystemCoreClock / 1000000U));
+}
+
+/**
+ * @brief  Busy-wait for at least the given number of nanoseconds.
+ * @param  ns Nanoseconds.
+ * @return None
+ */
+void DWT_Timer_DelayNs(uint32_t ns)
+{
+    DWT_Timer_DelayCycles((uint32_t)(((uint64_t)ns * SystemCoreClock + 999999999U) / 1000000000U));
+}
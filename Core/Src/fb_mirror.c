@@ -0,0 +1,236 @@
+/**
+ * @file    fb_mirror.c
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Framebuffer mirror: streams what the panel shows to the host over USART3.
+ *
+ * @details
+ * The mirror keeps a copy of the last frame it queued, so a delta is always relative to what
+ * the viewer has (or will have once the TX ring drains). A packet that does not fit leaves
+ * that copy untouched and is encoded again from the newest buffer on the next attempt, so
+ * skipped frames never need a key frame to recover. The copy is the MEM_POOL_FRAME block, held
+ * only while the mirror is on (without it every packet is a key frame). The packet buffer is
+ * CPU-only and lives in CCM; UART_TX_TryWrite() copies the packet into the DMA ring.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "fb_mirror.h"
+#include "cmsis_os2.h"
+#include "deferred_log.h"
+#include "dwt_timer.h"
+#include "mem_layout.h"
+#include "mem_pool.h"
+#include "rtos_tasks.h"
+#include "uart_rx.h"
+#include "uart_tx.h"
+#include "video_sink.h"
+#include "video_stream.h"
+#include "string.h"
+
+/**
+ * @defgroup FB_MIRROR_Private_Variables Framebuffer Mirror Private Variables
+ * @{
+ */
+/** Last frame queued: MEM_POOL_FRAME block while the mirror is on, else NULL */
+static uint8_t *mirror_prev;
+/** Packet being encoded */
+static uint8_t mirror_packet[VIDEO_MAX_PACKET] CCM_SECTION("mirror");
+/** Set while frames are streamed */
+static volatile bool mirror_enabled;
+/** Set by FbMirror_SetEnabled(true); the display task restarts the stream */
+static volatile bool mirror_restart;
+/** mirror_prev holds a frame the viewer has */
+static bool mirror_have_prev;
+/** A changed frame waits for the rate limit or for TX ring space */
+static bool mirror_pending;
+/** Sequence number of the next packet */
+static uint16_t mirror_seq;
+/** Earliest tick for the next packet */
+static uint32_t mirror_next_tick;
+/** Tick of the last key frame */
+static uint32_t mirror_last_key;
+/** Counters */
+static FbMirrorStats_t mirror_stats;
+/** @} */
+
+/**
+ * @defgroup FB_MIRROR_Private_Functions Framebuffer Mirror Private Functions
+ * @{
+ */
+/**
+ * @brief Time a packet occupies the console line
+ * @param len Packet length in bytes
+ * @return Milliseconds, rounded up
+ */
+static uint32_t FbMirror_WireMs(size_t len);
+/** @} */
+
+
+/**
+ * @brief  Switch the mirror on or off; switching on starts with a key frame.
+ * @param enable true to stream frames.
+ * @return None
+ */
+void FbMirror_SetEnabled(bool enable)
+{
+    if (enable == mirror_enabled)
+    {
+        return;
+    }
+    if (enable)
+    {
+        mirror_restart = true;
+        mirror_enabled = true;
+        Log_Write(LOG_FMT_MIRROR_ON, FB_MIRROR_INTERVAL_MS, FB_MIRROR_KEY_INTERVAL_MS);
+        /* Wake the display task so the key frame goes out now */
+        OLED_Task_Refresh();
+    }
+    else
+    {
+        mirror_enabled = false;
+        Log_Write(LOG_FMT_MIRROR_OFF, mirror_stats.frames, mirror_stats.bytes);
+        /* Wake the display task so the frame block goes back to the pool */
+        OLED_Task_Refresh();
+    }
+}
+
+/**
+ * @brief  Whether the mirror is on.
+ * @return true if enabled.
+ */
+bool FbMirror_IsEnabled(void)
+{
+    return mirror_enabled;
+}
+
+/**
+ * @brief  Mirror the frame on the panel if it changed and the rate limit allows.
+ *
+ * After a packet of n bytes the next one waits FB_MIRROR_INTERVAL_MS or the wire time of
+ * n bytes scaled by 100 / FB_MIRROR_LINE_SHARE, whichever is longer.
+ *
+ * @param fb         u8g2 frame buffer, equal to what the panel shows.
+ * @param flushed_at Tick at which the last flush of @p fb ended.
+ * @param now        Current tick (ms).
+ * @return None
+ */
+void FbMirror_Update(const uint8_t *fb, uint32_t flushed_at, uint32_t now)
+{
+    if (!mirror_enabled && (mirror_prev != NULL))
+    {
+        (void)MemPool_Free(MEM_POOL_FRAME, mirror_prev);
+        mirror_prev = NULL;
+    }
+    if (!mirror_enabled || VideoSink_IsActive())
+    {
+        mirror_pending = false;
+        return;
+    }
+    if (mirror_restart)
+    {
+        mirror_restart = false;
+        mirror_have_prev = false;
+        mirror_next_tick = now;
+        memset(&mirror_stats, 0, sizeof(mirror_stats));
+    }
+    if (mirror_prev == NULL)
+    {
+        /* Taken by the 'c' bench for a moment at most; tried again on the next update */
+        mirror_prev = MemPool_Alloc(MEM_POOL_FRAME, 0);
+        mirror_have_prev = false;
+    }
+    if ((int32_t)(now - mirror_next_tick) < 0)
+    {
+        if (!mirror_pending)
+        {
+            mirror_stats.deferred++;
+        }
+        mirror_pending = true;
+        return;
+    }
+
+    bool key = !mirror_have_prev || ((now - mirror_last_key) >= FB_MIRROR_KEY_INTERVAL_MS);
+    if (!key && (memcmp(mirror_prev, fb, VIDEO_FRAME_BYTES) == 0))
+    {
+        mirror_pending = false;
+        return;
+    }
+
+    uint32_t start = DWT_Timer_GetCycles();
+    size_t len = Video_EncodeStampedFrame(mirror_have_prev ? mirror_prev : NULL, fb, mirror_seq, key,
+                                          flushed_at, mirror_packet, sizeof(mirror_packet));
+    mirror_stats.encode_us = DWT_Timer_CyclesToUs(DWT_Timer_GetCycles() - start);
+    if (UART_TX_TryWrite(mirror_packet, len) != 0)
+    {
+        /* Try again once the ring has had time to drain that much */
+        mirror_stats.busy++;
+        mirror_pending = true;
+        mirror_next_tick = now + FbMirror_WireMs(len);
+        return;
+    }
+
+    if (mirror_prev != NULL)
+    {
+        memcpy(mirror_prev, fb, VIDEO_FRAME_BYTES);
+        mirror_have_prev = true;
+    }
+    mirror_seq++;
+    if ((mirror_packet[3] & VIDEO_FLAG_KEY) != 0U)
+    {
+        mirror_last_key = now;
+        mirror_stats.key_frames++;
+    }
+    mirror_stats.frames++;
+    mirror_stats.bytes += (uint32_t)len;
+
+    uint32_t budget = FbMirror_WireMs(len) * 100U / FB_MIRROR_LINE_SHARE;
+    mirror_next_tick = now + ((budget > FB_MIRROR_INTERVAL_MS) ? budget : FB_MIRROR_INTERVAL_MS);
+    mirror_pending = false;
+}
+
+/**
+ * @brief  Time until a postponed frame or the next key frame may be sent.
+ * @param now Current tick (ms).
+ * @return Milliseconds, or osWaitForever if nothing is pending.
+ */
+uint32_t FbMirror_NextWait(uint32_t now)
+{
+    uint32_t wait = osWaitForever;
+
+    if (!mirror_enabled || VideoSink_IsActive())
+    {
+        return wait;
+    }
+    if (mirror_restart)
+    {
+        return 0;
+    }
+    if (mirror_pending)
+    {
+        int32_t left = (int32_t)(mirror_next_tick - now);
+        wait = (left > 0) ? (uint32_t)left : 0U;
+    }
+    uint32_t since_key = now - mirror_last_key;
+    uint32_t to_key = (since_key < FB_MIRROR_KEY_INTERVAL_MS) ? (FB_MIRROR_KEY_INTERVAL_MS - since_key) : 0U;
+    return (to_key < wait) ? to_key : wait;
+}
+
+/**
+ * @brief  Copy the mirror counters.
+ * @param stats Destination for the counters.
+ * @return None
+ */
+void FbMirror_GetStats(FbMirrorStats_t *stats)
+{
+    *stats = mirror_stats;
+}
+
+/**
+ * @brief Time a packet occupies the console line (10 bits per byte).
+ * @param len Packet length in bytes.
+ * @return Milliseconds, rounded up.
+ */
+static uint32_t FbMirror_WireMs(size_t len)
+{
+    return (((uint32_t)len * 10U * 1000U) + UART_CONSOLE_BAUD_RATE - 1U) / UART_CONSOLE_BAUD_RATE;
+}
@@ -25,6 +25,8 @@
 
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "rtos_stats.h"
+#include "mem_layout.h"
 
 /* USER CODE END Includes */
 
@@ -64,6 +66,50 @@ void StartDefaultTask(void *argument);
 
 void MX_FREERTOS_Init(void); /* (MISRA C 2004 rule 8.1) */
 
+/* Hook prototypes */
+void configureTimerForRunTimeStats(void);
+unsigned long getRunTimeCounterValue(void);
+
+/* USER CODE BEGIN 1 */
+/* Functions needed when configGENERATE_RUN_TIME_STATS is on */
+void configureTimerForRunTimeStats(void)
+{
+  RTOS_Stats_TimerInit();
+}
+
+unsigned long getRunTimeCounterValue(void)
+{
+  return RTOS_Stats_GetRunTimeCounter();
+}
+
+/* FreeRTOS heap (configAPPLICATION_ALLOCATED_HEAP): task stacks and kernel objects are
+   CPU-only, so the heap lives in CCM */
+uint8_t ucHeap[configTOTAL_HEAP_SIZE] CCM_SECTION("heap");
+
+#if RTOS_STATIC_ALLOC
+/* Idle and timer service task memory, in CCM (overrides the weak definitions in
+   cmsis_os2.c) */
+static StaticTask_t idle_task_cb CCM_SECTION("kernel");
+static StackType_t idle_task_stack[configMINIMAL_STACK_SIZE] CCM_SECTION("kernel") RTOS_STACK_ALIGN;
+static StaticTask_t timer_task_cb CCM_SECTION("kernel");
+static StackType_t timer_task_stack[configTIMER_TASK_STACK_DEPTH] CCM_SECTION("kernel") RTOS_STACK_ALIGN;
+
+void vApplicationGetIdleTaskMemory(StaticTask_t **ppxIdleTaskTCBBuffer, StackType_t **ppxIdleTaskStackBuffer, uint32_t *pulIdleTaskStackSize)
+{
+  *ppxIdleTaskTCBBuffer = &idle_task_cb;
+  *ppxIdleTaskStackBuffer = idle_task_stack;
+  *pulIdleTaskStackSize = configMINIMAL_STACK_SIZE;
+}
+
+void vApplicationGetTimerTaskMemory(StaticTask_t **ppxTimerTaskTCBBuffer, StackType_t **ppxTimerTaskStackBuffer, uint32_t *pulTimerTaskStackSize)
+{
+  *ppxTimerTaskTCBBuffer = &timer_task_cb;
+  *ppxTimerTaskStackBuffer = timer_task_stack;
+  *pulTimerTaskStackSize = configTIMER_TASK_STACK_DEPTH;
+}
+#endif /* RTOS_STATIC_ALLOC */
+/* USER CODE END 1 */
+
 /**
   * @brief  FreeRTOS initialization
   * @param  None
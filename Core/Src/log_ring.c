@@ -0,0 +1,115 @@
+/**
+ * @file    log_ring.c
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Lock-free multi-producer ring of compact binary log records.
+ *
+ * @details
+ * Slots are reserved by a compare-and-swap on the head index (LDREX/STREX on Cortex-M4),
+ * filled, and then published through the per-slot commit flag. The single consumer only
+ * advances the tail after it has copied a committed slot, so a producer preempted between
+ * reservation and commit simply delays draining; it can never corrupt another record.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "log_ring.h"
+
+/** Index mask derived from the power-of-two capacity */
+#define LOG_RING_MASK (LOG_RING_CAPACITY - 1U)
+
+#if (LOG_RING_CAPACITY & (LOG_RING_CAPACITY - 1)) != 0
+#error "LOG_RING_CAPACITY must be a power of two"
+#endif
+
+/**
+ * @brief Reset a ring to the empty state.
+ * @param ring Pointer to the ring.
+ * @return None
+ */
+void LogRing_Init(LogRing_t *ring)
+{
+    for (uint32_t i = 0; i < LOG_RING_CAPACITY; i++)
+    {
+        ring->records[i].committed = 0;
+    }
+    ring->head = 0;
+    ring->tail = 0;
+    ring->dropped = 0;
+}
+
+/**
+ * @brief Append a record to the ring (ISR and task safe, never blocks).
+ *
+ * The only loop is the compare-and-swap retry, which repeats only if another producer
+ * (a higher-priority ISR) reserved a slot in between.
+ *
+ * @param ring      Pointer to the ring.
+ * @param timestamp Timestamp stored with the record.
+ * @param fmt_id    Format identifier.
+ * @param nargs     Number of arguments used (0..LOG_RECORD_MAX_ARGS).
+ * @param arg0      First argument.
+ * @param arg1      Second argument.
+ * @retval true  Record stored.
+ * @retval false Ring full, record dropped and counted.
+ */
+bool LogRing_Push(LogRing_t *ring, uint32_t timestamp, uint16_t fmt_id, uint8_t nargs,
+                  uint32_t arg0, uint32_t arg1)
+{
+    uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_RELAXED);
+    do
+    {
+        if ((head - __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE)) >= LOG_RING_CAPACITY)
+        {
+            __atomic_fetch_add(&ring->dropped, 1U, __ATOMIC_RELAXED);
+            return false;
+        }
+    } while (!__atomic_compare_exchange_n(&ring->head, &head, head + 1U, true,
+                                          __ATOMIC_ACQUIRE, __ATOMIC_RELAXED));
+
+    LogRecord_t *record = &ring->records[head & LOG_RING_MASK];
+    record->timestamp = timestamp;
+    record->fmt_id = fmt_id;
+    record->nargs = nargs;
+    record->args[0] = arg0;
+    record->args[1] = arg1;
+    __atomic_store_n(&record->committed, 1U, __ATOMIC_RELEASE);
+    return true;
+}
+
+/**
+ * @brief Remove the oldest published record (single consumer only).
+ *
+ * @param ring Pointer to the ring.
+ * @param out  Destination for the record.
+ * @retval true  A record was copied to @p out.
+ * @retval false Ring empty, or the oldest slot is still being written.
+ */
+bool LogRing_Pop(LogRing_t *ring, LogRecord_t *out)
+{
+    uint32_t tail = ring->tail;
+    if (tail == __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE))
+    {
+        return false;
+    }
+
+    LogRecord_t *record = &ring->records[tail & LOG_RING_MASK];
+    if (__atomic_load_n(&record->committed, __ATOMIC_ACQUIRE) == 0U)
+    {
+        return false;
+    }
+
+    *out = *record;
+    record->committed = 0;
+    __atomic_store_n(&ring->tail, tail + 1U, __ATOMIC_RELEASE);
+    return true;
+}
+
+/**
+ * @brief Number of records dropped since initialization.
+ * @param ring Pointer to the ring.
+ * @return Dropped record count.
+ */
+uint32_t LogRing_GetDropped(const LogRing_t *ring)
+{
+    return ring->dropped;
+}
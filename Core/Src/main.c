@@ -19,6 +19,7 @@
 /* Includes ------------------------------------------------------------------*/
 #include "main.h"
 #include "cmsis_os.h"
+#include "dma.h"
 #include "i2c.h"
 #include "usart.h"
 #include "gpio.h"
@@ -27,6 +28,13 @@
 /* USER CODE BEGIN Includes */
 #include "oled_driver.h"
 #include "rtos_tasks.h"
+#include "deferred_log.h"
+#include "uart_tx.h"
+#include "trace.h"
+#include "uart_rx.h"
+#include "mem_pool.h"
+#include "mem_layout.h"
+#include "oled_splash.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -70,7 +78,7 @@ int main(void)
 {
 
   /* USER CODE BEGIN 1 */
-
+  MemLayout_Init();
   /* USER CODE END 1 */
 
   /* MCU Configuration--------------------------------------------------------*/
@@ -86,15 +94,16 @@ int main(void)
   SystemClock_Config();
 
   /* USER CODE BEGIN SysInit */
-
+  OLED_Splash_MarkClockSwitch();
   /* USER CODE END SysInit */
 
   /* Initialize all configured peripherals */
   MX_GPIO_Init();
+  MX_DMA_Init();
   MX_I2C1_Init();
   MX_USART3_UART_Init();
   /* USER CODE BEGIN 2 */
-
+  OLED_Splash_Show();
   /* USER CODE END 2 */
 
   /* Init scheduler */
@@ -102,6 +111,11 @@ int main(void)
 
   /* Call init function for freertos objects (in cmsis_os2.c) */
   //MX_FREERTOS_Init();
+  Trace_Init();
+  UART_TX_Init();
+  MemPool_Init();
+  UART_RX_Init();
+  Log_Init();
   OLED_Task_Init();
 
   /* Start scheduler */
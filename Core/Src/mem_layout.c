@@ -0,0 +1,251 @@
+/**
+ * @file    mem_layout.c
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   CCM start-up, DMA buffer checks and the SRAM/CCM contention benchmark.
+ *
+ * @details
+ * The benchmark runs a read-modify-write pass over 1 KB in SRAM1 (the frame buffer block of the
+ * memory pool, free while the mirror is off) and over 1 KB in CCM, first with the buses idle and
+ * then while DMA2 Stream0 streams words from flash into one SRAM1 word (memory-to-memory, the stand-in for a display flush by
+ * DMA). Each pass runs with interrupts masked and is timed with the DWT cycle counter.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "mem_layout.h"
+#include "main.h"
+#include "uart_tx.h"
+#include "mem_pool.h"
+#include "dwt_timer.h"
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * @defgroup MEM_LAYOUT_Private_Defines Memory Layout Private Defines
+ * @{
+ */
+/** Words per benchmark pass (1 KB) */
+#define BENCH_WORDS             256U
+/** Timed passes per case */
+#define BENCH_PASSES            32U
+/** Words per DMA run (re-armed whenever it completes) */
+#define BENCH_DMA_WORDS         0xFFFFU
+/** Stream 0 bits of DMA2->LIFCR (FEIF, DMEIF, TEIF, HTIF, TCIF) */
+#define BENCH_DMA_FLAGS         0x3DU
+/** Length of one report line */
+#define MEM_LAYOUT_LINE_LEN     80
+/** @} */
+
+/**
+ * @defgroup MEM_LAYOUT_Private_Variables Memory Layout Private Variables
+ * @{
+ */
+/** CCM scratch of the benchmark */
+static uint32_t bench_ccm[BENCH_WORDS] CCM_SECTION("bench");
+/** SRAM1 destination word of the benchmark DMA stream */
+static uint32_t bench_dma_word DMA_SECTION("bench");
+/** @} */
+
+#if defined(__arm__) || defined(__ARMCC_VERSION)
+/**
+ * @defgroup MEM_LAYOUT_Private_Functions Memory Layout Private Functions
+ * @{
+ */
+/**
+ * @brief Time one read-modify-write pass
+ * @param buf Words to update
+ * @return DWT cycles
+ */
+static uint32_t MemLayout_Pass(volatile uint32_t *buf);
+/**
+ * @brief Start DMA2 Stream0 (flash to one SRAM word) unless it is still running
+ * @param dst Destination word
+ */
+static void MemLayout_DmaArm(volatile uint32_t *dst);
+/**
+ * @brief Stop DMA2 Stream0
+ */
+static void MemLayout_DmaStop(void);
+/**
+ * @brief Run and print one benchmark case
+ * @param region Region label
+ * @param buf    Words to update
+ * @param dma    Destination of the concurrent DMA stream, or NULL for none
+ */
+static void MemLayout_BenchCase(const char *region, volatile uint32_t *buf, volatile uint32_t *dma);
+/** @} */
+#endif
+
+
+/**
+ * @brief  Zero the CCM sections where the C library start-up does not (GNU ld builds).
+ *
+ * The GNU ld script collects .bss.ccm.* between _sccmbss and _eccmbss; the CubeIDE start-up
+ * code only clears .bss. Arm Compiler scatter loading clears every ZI region itself.
+ *
+ * @return None
+ */
+void MemLayout_Init(void)
+{
+#if defined(__arm__) && defined(__GNUC__) && !defined(__ARMCC_VERSION)
+    extern uint32_t _sccmbss;
+    extern uint32_t _eccmbss;
+    memset(&_sccmbss, 0, (size_t)((uintptr_t)&_eccmbss - (uintptr_t)&_sccmbss));
+#endif
+}
+
+/**
+ * @brief  Stop with an error if a buffer meant for DMA overlaps CCM RAM.
+ *
+ * @note On failure an error is reported through the UART3 panic path and Error_Handler() is called.
+ * @param buf  Buffer.
+ * @param len  Length in bytes.
+ * @param name Buffer name for the panic message.
+ * @return None
+ */
+void MemLayout_CheckDma(const void *buf, size_t len, const char *name)
+{
+    if (MEM_IN_CCM(buf) || ((len > 0U) && MEM_IN_CCM((const uint8_t *)buf + len - 1U)))
+    {
+        UART_TX_Panic("DMA buffer in CCM: ");
+        UART_TX_Panic(name);
+        UART_TX_Panic("\r\n");
+        Error_Handler();
+    }
+}
+
+/**
+ * @brief  Measure CPU load/store cost in SRAM1 and CCM, with and without a concurrent
+ *         DMA2 memory-to-memory stream into SRAM1, and print the result over UART3.
+ * @return None
+ */
+void MemLayout_RunBench(void)
+{
+#if defined(__arm__) || defined(__ARMCC_VERSION)
+    char line[MEM_LAYOUT_LINE_LEN];
+    uint32_t *sram = MemPool_Alloc(MEM_POOL_FRAME, 0U);
+    volatile uint32_t *dma_dst = &bench_dma_word;
+    int len;
+
+    if (sram == NULL)
+    {
+        UART_TX_Write((const uint8_t *)"Bench needs the frame block; switch the mirror off\r\n", 52U);
+    }
+    else
+    {
+        __HAL_RCC_DMA2_CLK_ENABLE();
+        len = snprintf(line, sizeof(line), "DMA2 S0 flash -> 0x%08lx, %u passes of %u words\r\n",
+                       (unsigned long)(uintptr_t)dma_dst, (unsigned)BENCH_PASSES, (unsigned)BENCH_WORDS);
+        UART_TX_Write((const uint8_t *)line, (size_t)len);
+        len = snprintf(line, sizeof(line), "Region  Address     DMA  avg cyc  min cyc\r\n");
+        UART_TX_Write((const uint8_t *)line, (size_t)len);
+
+        MemLayout_BenchCase("SRAM1", sram, NULL);
+        MemLayout_BenchCase("SRAM1", sram, dma_dst);
+        MemLayout_BenchCase(MEM_IN_CCM(bench_ccm) ? "CCM" : "SRAM", bench_ccm, NULL);
+        MemLayout_BenchCase(MEM_IN_CCM(bench_ccm) ? "CCM" : "SRAM", bench_ccm, dma_dst);
+    }
+
+    if (sram != NULL)
+    {
+        (void)MemPool_Free(MEM_POOL_FRAME, sram);
+    }
+#else
+    (void)bench_ccm;
+    (void)bench_dma_word;
+    UART_TX_Write((const uint8_t *)"CCM bench needs the target\r\n", 28U);
+#endif
+}
+
+#if defined(__arm__) || defined(__ARMCC_VERSION)
+/**
+ * @brief Time one read-modify-write pass.
+ * @param buf Words to update.
+ * @return DWT cycles.
+ */
+static uint32_t MemLayout_Pass(volatile uint32_t *buf)
+{
+    uint32_t sum = 0;
+    uint32_t start = DWT_Timer_GetCycles();
+
+    for (uint32_t i = 0; i < BENCH_WORDS; i++)
+    {
+        sum += buf[i];
+        buf[i] = sum;
+    }
+    return DWT_Timer_GetCycles() - start;
+}
+
+/**
+ * @brief Start DMA2 Stream0 (flash to one SRAM word) unless it is still running.
+ * @param dst Destination word.
+ * @return None
+ */
+static void MemLayout_DmaArm(volatile uint32_t *dst)
+{
+    DMA_Stream_TypeDef *stream = DMA2_Stream0;
+
+    if ((stream->CR & DMA_SxCR_EN) != 0U)
+    {
+        return;
+    }
+    DMA2->LIFCR = BENCH_DMA_FLAGS;
+    stream->PAR = FLASH_BASE;
+    stream->M0AR = (uint32_t)(uintptr_t)dst;
+    stream->NDTR = BENCH_DMA_WORDS;
+    stream->FCR = DMA_SxFCR_DMDIS | DMA_SxFCR_FTH;
+    stream->CR = DMA_SxCR_DIR_1 | DMA_SxCR_PINC | DMA_SxCR_PSIZE_1 | DMA_SxCR_MSIZE_1 |
+                 DMA_SxCR_PL | DMA_SxCR_EN;
+}
+
+/**
+ * @brief Stop DMA2 Stream0.
+ * @return None
+ */
+static void MemLayout_DmaStop(void)
+{
+    DMA2_Stream0->CR &= ~DMA_SxCR_EN;
+    while ((DMA2_Stream0->CR & DMA_SxCR_EN) != 0U)
+    {
+    }
+    DMA2->LIFCR = BENCH_DMA_FLAGS;
+}
+
+/**
+ * @brief Run and print one benchmark case.
+ * @param region Region label.
+ * @param buf    Words to update.
+ * @param dma    Destination of the concurrent DMA stream, or NULL for none.
+ * @return None
+ */
+static void MemLayout_BenchCase(const char *region, volatile uint32_t *buf, volatile uint32_t *dma)
+{
+    char line[MEM_LAYOUT_LINE_LEN];
+    uint32_t total = 0;
+    uint32_t best = UINT32_MAX;
+
+    for (uint32_t pass = 0; pass < BENCH_PASSES; pass++)
+    {
+        if (dma != NULL)
+        {
+            MemLayout_DmaArm(dma);
+        }
+        uint32_t primask = __get_PRIMASK();
+        __disable_irq();
+        uint32_t cycles = MemLayout_Pass(buf);
+        __set_PRIMASK(primask);
+
+        total += cycles;
+        best = (cycles < best) ? cycles : best;
+    }
+    if (dma != NULL)
+    {
+        MemLayout_DmaStop();
+    }
+
+    int len = snprintf(line, sizeof(line), "%-7s 0x%08lx  %-3s %8lu %8lu\r\n", region,
+                       (unsigned long)(uintptr_t)buf, (dma != NULL) ? "on" : "off",
+                       (unsigned long)(total / BENCH_PASSES), (unsigned long)best);
+    UART_TX_Write((const uint8_t *)line, (size_t)len);
+}
+#endif
@@ -0,0 +1,195 @@
+/**
+ * @file    mem_pool.c
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Fixed-block memory pools on top of the CMSIS-RTOS2 osMemoryPool.
+ *
+ * @details
+ * The pool arrays are declared as uint64_t so every block starts 8-byte aligned; block
+ * sizes are rounded up to a multiple of 8 for the same reason (the CMSIS wrapper places
+ * blocks back to back at the requested size). Counters are updated with interrupts masked,
+ * which keeps them consistent when a block is allocated in an ISR and freed in a task.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "mem_pool.h"
+#include "main.h"
+#include "uart_tx.h"
+#include "FreeRTOS.h"
+#include "freertos_mpool.h"
+#include "rtos_static.h"
+#include <stdio.h>
+
+/**
+ * @defgroup MEM_POOL_Private_Defines Memory Pool Private Defines
+ * @{
+ */
+/** Block alignment and size granularity (bytes) */
+#define MEM_POOL_ALIGN          8U
+/** Block size rounded up to MEM_POOL_ALIGN */
+#define MEM_POOL_BLOCK(size)    ((((size) + MEM_POOL_ALIGN - 1U) / MEM_POOL_ALIGN) * MEM_POOL_ALIGN)
+/** Storage of a pool in 64-bit words */
+#define MEM_POOL_WORDS(size, count) ((MEM_POOL_BLOCK(size) * (count)) / sizeof(uint64_t))
+/** Length of one report line */
+#define MEM_POOL_LINE_LEN       80
+/** @} */
+
+/**
+ * @struct MemPoolDesc_t
+ * @brief Static description and state of one pool.
+ */
+typedef struct {
+    const char *name;           /**< Pool name */
+    uint64_t *storage;          /**< Block array */
+    uint32_t block_size;        /**< Block size (multiple of MEM_POOL_ALIGN) */
+    uint32_t count;             /**< Number of blocks */
+} MemPoolDesc_t;
+
+/**
+ * @defgroup MEM_POOL_Private_Variables Memory Pool Private Variables
+ * @{
+ */
+/* Block storage stays in main SRAM (not CCM_SECTION) so that blocks can be handed to DMA */
+/** Text payload blocks */
+static uint64_t pool_mem_text[MEM_POOL_WORDS(MEM_POOL_TEXT_SIZE, MEM_POOL_TEXT_COUNT)] RAM_SECTION("pool");
+/** Frame buffer blocks */
+static uint64_t pool_mem_frame[MEM_POOL_WORDS(MEM_POOL_FRAME_SIZE, MEM_POOL_FRAME_COUNT)] RAM_SECTION("pool");
+
+/** Pool layout, indexed by MemPoolId_t */
+static const MemPoolDesc_t pool_desc[MEM_POOL_COUNT] = {
+    { "Text",       pool_mem_text,  MEM_POOL_BLOCK(MEM_POOL_TEXT_SIZE),  MEM_POOL_TEXT_COUNT },
+    { "Frame",      pool_mem_frame, MEM_POOL_BLOCK(MEM_POOL_FRAME_SIZE), MEM_POOL_FRAME_COUNT },
+};
+
+/** Control blocks of the osMemoryPool objects */
+static StaticMemPool_t pool_cb[MEM_POOL_COUNT] RAM_SECTION("pool");
+/** Pool handles */
+static osMemoryPoolId_t pool_id[MEM_POOL_COUNT];
+/** Usage counters */
+static MemPoolStats_t pool_stats[MEM_POOL_COUNT];
+/** @} */
+
+
+/**
+ * @brief  Create all pools from static memory.
+ *
+ * @note On failure an error is reported through the UART3 panic path and Error_Handler() is called.
+ * @return None
+ */
+void MemPool_Init(void)
+{
+    for (uint32_t i = 0; i < MEM_POOL_COUNT; i++)
+    {
+        const MemPoolDesc_t *desc = &pool_desc[i];
+        const osMemoryPoolAttr_t attr = {
+            .name = desc->name,
+            .cb_mem = &pool_cb[i],
+            .cb_size = sizeof(pool_cb[i]),
+            .mp_mem = desc->storage,
+            .mp_size = desc->block_size * desc->count
+        };
+
+        pool_id[i] = osMemoryPoolNew(desc->count, desc->block_size, &attr);
+        if (pool_id[i] == NULL)
+        {
+            UART_TX_Panic("Failed to create memory pool\r\n");
+            Error_Handler();
+        }
+
+        pool_stats[i].name = desc->name;
+        pool_stats[i].block_size = desc->block_size;
+        pool_stats[i].capacity = desc->count;
+    }
+}
+
+/**
+ * @brief  Take one block from a pool.
+ * @param pool    Pool.
+ * @param timeout Ticks to wait for a free block (must be 0 in interrupt context).
+ * @return Block, or NULL if none became free in time.
+ */
+void *MemPool_Alloc(MemPoolId_t pool, uint32_t timeout)
+{
+    void *block = osMemoryPoolAlloc(pool_id[pool], timeout);
+    MemPoolStats_t *stats = &pool_stats[pool];
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    if (block != NULL)
+    {
+        stats->allocs++;
+        stats->in_use++;
+        if (stats->in_use > stats->peak)
+        {
+            stats->peak = stats->in_use;
+        }
+    }
+    else
+    {
+        stats->failures++;
+    }
+    __set_PRIMASK(primask);
+
+    return block;
+}
+
+/**
+ * @brief  Return a block to its pool.
+ * @param pool  Pool the block came from.
+ * @param block Block returned by MemPool_Alloc().
+ * @return osOK, or the error of osMemoryPoolFree().
+ */
+osStatus_t MemPool_Free(MemPoolId_t pool, void *block)
+{
+    osStatus_t status = osMemoryPoolFree(pool_id[pool], block);
+
+    if (status == osOK)
+    {
+        uint32_t primask = __get_PRIMASK();
+        __disable_irq();
+        pool_stats[pool].in_use--;
+        __set_PRIMASK(primask);
+    }
+    return status;
+}
+
+/**
+ * @brief  Copy the usage counters of a pool.
+ * @param pool  Pool.
+ * @param stats Destination.
+ * @return None
+ */
+void MemPool_GetStats(MemPoolId_t pool, MemPoolStats_t *stats)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    *stats = pool_stats[pool];
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @brief  Print the usage of every pool and of the FreeRTOS heap over UART3.
+ * @return None
+ */
+void MemPool_Print(void)
+{
+    char line[MEM_POOL_LINE_LEN];
+    MemPoolStats_t stats;
+    int len;
+
+    len = snprintf(line, sizeof(line), "Pool         Block  Used  Peak   Cap     Allocs  Fail\r\n");
+    UART_TX_Write((const uint8_t *)line, (size_t)len);
+    for (uint32_t i = 0; i < MEM_POOL_COUNT; i++)
+    {
+        MemPool_GetStats((MemPoolId_t)i, &stats);
+        len = snprintf(line, sizeof(line), "%-12s %5lu %5lu %5lu %5lu %10lu %5lu\r\n", stats.name,
+                       (unsigned long)stats.block_size, (unsigned long)stats.in_use,
+                       (unsigned long)stats.peak, (unsigned long)stats.capacity,
+                       (unsigned long)stats.allocs, (unsigned long)stats.failures);
+        UART_TX_Write((const uint8_t *)line, (size_t)len);
+    }
+    len = snprintf(line, sizeof(line), "Heap %u of %u bytes free, lowest %u\r\n",
+                   (unsigned)xPortGetFreeHeapSize(), (unsigned)configTOTAL_HEAP_SIZE,
+                   (unsigned)xPortGetMinimumEverFreeHeapSize());
+    UART_TX_Write((const uint8_t *)line, (size_t)len);
+}
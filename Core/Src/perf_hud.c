@@ -0,0 +1,322 @@
+/**
+ * @file    perf_hud.c
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   On-screen performance overlay for the OLED display task.
+ *
+ * @details
+ * Measurements run on every frame whether or not the overlay is shown, so values are ready as
+ * soon as it is toggled on. A window without frames publishes 0 fps and keeps the last times.
+ * Only the display task calls the frame and drawing functions; PerfHUD_Toggle() just flips a
+ * flag and may be called from the button interrupt.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "perf_hud.h"
+#include "dwt_timer.h"
+#include "oled_driver.h"
+#include "rtos_stats.h"
+#include "cmsis_os2.h"
+#include "stdio.h"
+
+/**
+ * @defgroup PERF_HUD_Private_Defines Perf HUD Private Defines
+ * @{
+ */
+/** Number of text lines in the overlay */
+#define HUD_LINES          5
+/** Characters per line, including the terminator */
+#define HUD_LINE_LEN       10
+/** Glyph width of the overlay font (pixels) */
+#define HUD_CHAR_WIDTH     4
+/** Line height of the overlay font (pixels) */
+#define HUD_LINE_HEIGHT    6
+/** Overlay width: 9 glyphs plus a 1-pixel margin on each side */
+#define HUD_WIDTH          ((HUD_LINE_LEN - 1) * HUD_CHAR_WIDTH + 2)
+/** Overlay height: all lines plus a 1-pixel margin on each side */
+#define HUD_HEIGHT         (HUD_LINES * HUD_LINE_HEIGHT + 2)
+/** Tile size of the frame buffer (pixels) */
+#define HUD_TILE           8U
+/** @} */
+
+/**
+ * @struct PerfHudValues_t
+ * @brief Values shown by the overlay (averages over one window).
+ */
+typedef struct {
+    uint32_t fps_x10;          /**< Frames per second, x10 */
+    uint32_t render_us;        /**< Average render time */
+    uint32_t flush_us;         /**< Average flush time */
+    uint32_t bus_bytes;        /**< Average I2C bytes per frame */
+    uint32_t cpu_permille;     /**< CPU load from rtos_stats */
+} PerfHudValues_t;
+
+/**
+ * @defgroup PERF_HUD_Private_Variables Perf HUD Private Variables
+ * @{
+ */
+/** Overlay visibility (written from the button ISR) */
+static volatile uint8_t hud_enabled = PERF_HUD_ENABLED_AT_BOOT;
+/** Cycle counter at PerfHUD_FrameStart() */
+static uint32_t hud_frame_start;
+/** Cycle counter when the flush started */
+static uint32_t hud_flush_start;
+/** Bus byte counter when the flush started */
+static uint32_t hud_bus_start;
+/** Render time of the current frame (cycles) */
+static uint32_t hud_render_cycles;
+/** Window accumulators */
+static uint32_t hud_frames;
+static uint32_t hud_render_sum;
+static uint32_t hud_flush_sum;
+static uint32_t hud_bus_sum;
+/** Tick at which the current window started */
+static uint32_t hud_window_start;
+/** Latest published values */
+static PerfHudValues_t hud_values;
+/** Values the cached text was formatted from */
+static PerfHudValues_t hud_shown;
+/** Set once the cached text is valid */
+static uint8_t hud_text_valid;
+/** Cached overlay text */
+static char hud_text[HUD_LINES][HUD_LINE_LEN];
+/** @} */
+
+/**
+ * @defgroup PERF_HUD_Private_Functions Perf HUD Private Functions
+ * @{
+ */
+/**
+ * @brief Re-format the overlay text if a displayed value changed
+ * @return Non-zero if a line changed
+ */
+static uint8_t PerfHUD_UpdateText(void);
+/**
+ * @brief Publish the window averages once PERF_HUD_UPDATE_MS have elapsed
+ * @param now Current tick (ms)
+ */
+static void PerfHUD_CloseWindow(uint32_t now);
+/** @} */
+
+
+/**
+ * @brief  Show or hide the HUD (ISR safe).
+ * @return None
+ */
+void PerfHUD_Toggle(void)
+{
+    hud_enabled = !hud_enabled;
+}
+
+/**
+ * @brief  Whether the HUD is currently shown.
+ * @return Non-zero if shown.
+ */
+uint8_t PerfHUD_IsEnabled(void)
+{
+    return hud_enabled;
+}
+
+/**
+ * @brief  Mark the start of a frame (before the screen renderer runs).
+ * @return None
+ */
+void PerfHUD_FrameStart(void)
+{
+    hud_frame_start = DWT_Timer_GetCycles();
+}
+
+/**
+ * @brief  Close the render measurement and draw the overlay into the frame buffer.
+ *
+ * The flush measurement starts after the overlay, so PerfHUD_FrameEnd() counts only this
+ * frame's flush time and I2C bytes.
+ *
+ * @param u8g2  Pointer to the u8g2 display structure.
+ * @param tiles Tile set of a partial frame (the overlay's tiles are added), NULL for a full frame.
+ * @return None
+ */
+void PerfHUD_Draw(u8g2_t *u8g2, VideoTiles_t *tiles)
+{
+    hud_render_cycles = DWT_Timer_GetCycles() - hud_frame_start;
+
+    if (hud_enabled)
+    {
+        (void)PerfHUD_UpdateText();
+        PerfHUD_DrawOverlay(u8g2, tiles);
+    }
+
+    hud_bus_start = OLED_GetBusBytes();
+    hud_flush_start = DWT_Timer_GetCycles();
+}
+
+/**
+ * @brief  Publish the window averages if due and bring the overlay text up to date.
+ *
+ * Lets the display task redraw the overlay when its text changes even while nothing else is
+ * drawn (static screens).
+ *
+ * @param now Current tick (ms).
+ * @return Non-zero if the overlay is shown and its text changed since it was last drawn.
+ */
+uint8_t PerfHUD_Update(uint32_t now)
+{
+    PerfHUD_CloseWindow(now);
+    if (!hud_enabled)
+    {
+        return 0;
+    }
+    return PerfHUD_UpdateText();
+}
+
+/**
+ * @brief  Time until the averaging window closes and the text may change.
+ * @param now Current tick (ms).
+ * @return Milliseconds, or osWaitForever while the overlay is hidden.
+ */
+uint32_t PerfHUD_NextDue(uint32_t now)
+{
+    uint32_t elapsed = now - hud_window_start;
+
+    if (!hud_enabled)
+    {
+        return osWaitForever;
+    }
+    return (elapsed < PERF_HUD_UPDATE_MS) ? (PERF_HUD_UPDATE_MS - elapsed) : 0U;
+}
+
+/**
+ * @brief  Redraw only the overlay box (no measurement); nothing is drawn while it is hidden.
+ *
+ * The box is opaque, so it can be redrawn over whatever the buffer holds. Its tiles are the
+ * top-right corner: the tile columns from its left edge and the pages down to its bottom edge.
+ *
+ * @param u8g2  Pointer to the u8g2 display structure.
+ * @param tiles Tile set the box's tiles are added to, or NULL.
+ * @return None
+ */
+void PerfHUD_DrawOverlay(u8g2_t *u8g2, VideoTiles_t *tiles)
+{
+    if (!hud_enabled)
+    {
+        return;
+    }
+
+    const uint8_t *font = u8g2->font;
+    u8g2_uint_t x = (u8g2_uint_t)(u8g2_GetDisplayWidth(u8g2) - HUD_WIDTH);
+
+    u8g2_SetDrawColor(u8g2, 0);
+    u8g2_DrawBox(u8g2, x, 0, HUD_WIDTH, HUD_HEIGHT);
+    u8g2_SetDrawColor(u8g2, 1);
+    u8g2_SetFont(u8g2, u8g2_font_4x6_tr);
+    u8g2_SetFontPosTop(u8g2);
+    for (uint32_t i = 0; i < HUD_LINES; i++)
+    {
+        u8g2_DrawStr(u8g2, x + 1U, (u8g2_uint_t)(1U + i * HUD_LINE_HEIGHT), hud_text[i]);
+    }
+    u8g2_SetFontPosBaseline(u8g2);
+    u8g2_SetFont(u8g2, font);
+
+    if (tiles != NULL)
+    {
+        uint16_t mask = (uint16_t)(((1UL << VIDEO_TILE_COLS) - 1U) & ~((1UL << (x / HUD_TILE)) - 1U));
+        for (uint32_t page = 0; page <= ((HUD_HEIGHT - 1U) / HUD_TILE); page++)
+        {
+            tiles->rows[page] |= mask;
+        }
+    }
+}
+
+/**
+ * @brief  Mark the end of the frame (after u8g2_SendBuffer()).
+ *
+ * Accumulates the frame and publishes window averages every PERF_HUD_UPDATE_MS.
+ *
+ * @return None
+ */
+void PerfHUD_FrameEnd(void)
+{
+    hud_flush_sum += DWT_Timer_GetCycles() - hud_flush_start;
+    hud_bus_sum += OLED_GetBusBytes() - hud_bus_start;
+    hud_render_sum += hud_render_cycles;
+    hud_frames++;
+
+    PerfHUD_CloseWindow(osKernelGetTickCount());
+}
+
+/**
+ * @brief Re-format the overlay text if a displayed value changed.
+ *
+ * Times are shown in milliseconds with one decimal, so sub-100 us jitter does not cause a
+ * re-format.
+ *
+ * @return Non-zero if a line changed.
+ */
+static uint8_t PerfHUD_UpdateText(void)
+{
+    const PerfHudValues_t *v = &hud_values;
+    PerfHudValues_t *s = &hud_shown;
+    uint8_t changed = !hud_text_valid;
+
+    if (!hud_text_valid || (v->fps_x10 != s->fps_x10))
+    {
+        snprintf(hud_text[0], HUD_LINE_LEN, "FPS%3lu.%lu",
+                 (unsigned long)(v->fps_x10 / 10U), (unsigned long)(v->fps_x10 % 10U));
+        changed = 1;
+    }
+    if (!hud_text_valid || ((v->render_us / 100U) != (s->render_us / 100U)))
+    {
+        snprintf(hud_text[1], HUD_LINE_LEN, "R%3lu.%lums",
+                 (unsigned long)(v->render_us / 1000U), (unsigned long)((v->render_us / 100U) % 10U));
+        changed = 1;
+    }
+    if (!hud_text_valid || ((v->flush_us / 100U) != (s->flush_us / 100U)))
+    {
+        snprintf(hud_text[2], HUD_LINE_LEN, "F%3lu.%lums",
+                 (unsigned long)(v->flush_us / 1000U), (unsigned long)((v->flush_us / 100U) % 10U));
+        changed = 1;
+    }
+    if (!hud_text_valid || (v->bus_bytes != s->bus_bytes))
+    {
+        snprintf(hud_text[3], HUD_LINE_LEN, "B%6luB", (unsigned long)v->bus_bytes);
+        changed = 1;
+    }
+    if (!hud_text_valid || ((v->cpu_permille / 10U) != (s->cpu_permille / 10U)))
+    {
+        snprintf(hud_text[4], HUD_LINE_LEN, "CPU%4lu%%", (unsigned long)(v->cpu_permille / 10U));
+        changed = 1;
+    }
+
+    *s = *v;
+    hud_text_valid = 1;
+    return changed;
+}
+
+/**
+ * @brief Publish the window averages once PERF_HUD_UPDATE_MS have elapsed.
+ * @param now Current tick (ms).
+ * @return None
+ */
+static void PerfHUD_CloseWindow(uint32_t now)
+{
+    uint32_t elapsed = now - hud_window_start;
+
+    if (elapsed < PERF_HUD_UPDATE_MS)
+    {
+        return;
+    }
+    hud_values.fps_x10 = (hud_frames * 10000U) / elapsed;
+    if (hud_frames != 0U)
+    {
+        hud_values.render_us = DWT_Timer_CyclesToUs(hud_render_sum / hud_frames);
+        hud_values.flush_us = DWT_Timer_CyclesToUs(hud_flush_sum / hud_frames);
+        hud_values.bus_bytes = hud_bus_sum / hud_frames;
+    }
+    hud_values.cpu_permille = RTOS_Stats_GetCpuLoad();
+
+    hud_frames = 0;
+    hud_render_sum = 0;
+    hud_flush_sum = 0;
+    hud_bus_sum = 0;
+    hud_window_start = now;
+}
@@ -0,0 +1,759 @@
+/**
+ * @file    qr_encode.c
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   QR code encoder for the OLED: versions 1-4, byte mode, error correction L and M.
+ *
+ * @details
+ * Follows ISO/IEC 18004: data bits (mode 0100, 8-bit count, payload, terminator, 0xEC/0x11
+ * padding), one or two Reed-Solomon blocks per version with the codewords interleaved,
+ * function patterns (finders, separators, timing, one alignment pattern from version 2),
+ * zig-zag data placement and the mask with the lowest penalty (rules N1-N4, scored as in
+ * the reference implementation so the chosen mask matches common generators).
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "qr_encode.h"
+#include <string.h>
+
+/**
+ * @defgroup QR_Private_Defines QR Private Defines
+ * @{
+ */
+/** Largest number of codewords (version 4) */
+#define QR_CODEWORDS_MAX        100
+/** Largest number of data codewords (version 4, L) */
+#define QR_DATA_CODEWORDS_MAX   80
+/** Largest number of error correction codewords per block (version 3, M) */
+#define QR_ECC_PER_BLOCK_MAX    26
+/** Mode indicator of byte mode */
+#define QR_MODE_BYTE            0x4U
+/** Number of mask patterns */
+#define QR_MASKS                8U
+/** Penalty of rule N1 (run of five same-colour modules) */
+#define QR_PENALTY_N1           3
+/** Penalty of rule N2 (2 x 2 block of one colour) */
+#define QR_PENALTY_N2           3
+/** Penalty of rule N3 (finder-like pattern) */
+#define QR_PENALTY_N3           40
+/** Penalty of rule N4 (per 5 % of dark/light imbalance) */
+#define QR_PENALTY_N4           10
+/** @} */
+
+/**
+ * @struct QrVersionInfo_t
+ * @brief Codeword layout of one version.
+ */
+typedef struct {
+    uint8_t codewords;          /**< Total codewords */
+    uint8_t ecc_per_block[2];   /**< Error correction codewords per block, by QrEcc_t */
+    uint8_t blocks[2];          /**< Reed-Solomon blocks, by QrEcc_t */
+} QrVersionInfo_t;
+
+/**
+ * @defgroup QR_Private_Variables QR Private Variables
+ * @{
+ */
+/** ISO/IEC 18004 table 9, versions 1-4 */
+static const QrVersionInfo_t qr_versions[QR_VERSION_MAX] = {
+    {  26U, {  7U, 10U }, { 1U, 1U } },
+    {  44U, { 10U, 16U }, { 1U, 1U } },
+    {  70U, { 15U, 26U }, { 1U, 1U } },
+    { 100U, { 20U, 18U }, { 1U, 2U } },
+};
+/** Error correction level bits of the format information, by QrEcc_t */
+static const uint8_t qr_format_ecc[2] = { 1U, 0U };
+/** GF(256) powers of 2 (primitive polynomial 0x11D) */
+static const uint8_t qr_gf_exp[255] = {
+    0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1D, 0x3A, 0x74, 0xE8, 0xCD, 0x87, 0x13, 0x26,
+    0x4C, 0x98, 0x2D, 0x5A, 0xB4, 0x75, 0xEA, 0xC9, 0x8F, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC0,
+    0x9D, 0x27, 0x4E, 0x9C, 0x25, 0x4A, 0x94, 0x35, 0x6A, 0xD4, 0xB5, 0x77, 0xEE, 0xC1, 0x9F, 0x23,
+    0x46, 0x8C, 0x05, 0x0A, 0x14, 0x28, 0x50, 0xA0, 0x5D, 0xBA, 0x69, 0xD2, 0xB9, 0x6F, 0xDE, 0xA1,
+    0x5F, 0xBE, 0x61, 0xC2, 0x99, 0x2F, 0x5E, 0xBC, 0x65, 0xCA, 0x89, 0x0F, 0x1E, 0x3C, 0x78, 0xF0,
+    0xFD, 0xE7, 0xD3, 0xBB, 0x6B, 0xD6, 0xB1, 0x7F, 0xFE, 0xE1, 0xDF, 0xA3, 0x5B, 0xB6, 0x71, 0xE2,
+    0xD9, 0xAF, 0x43, 0x86, 0x11, 0x22, 0x44, 0x88, 0x0D, 0x1A, 0x34, 0x68, 0xD0, 0xBD, 0x67, 0xCE,
+    0x81, 0x1F, 0x3E, 0x7C, 0xF8, 0xED, 0xC7, 0x93, 0x3B, 0x76, 0xEC, 0xC5, 0x97, 0x33, 0x66, 0xCC,
+    0x85, 0x17, 0x2E, 0x5C, 0xB8, 0x6D, 0xDA, 0xA9, 0x4F, 0x9E, 0x21, 0x42, 0x84, 0x15, 0x2A, 0x54,
+    0xA8, 0x4D, 0x9A, 0x29, 0x52, 0xA4, 0x55, 0xAA, 0x49, 0x92, 0x39, 0x72, 0xE4, 0xD5, 0xB7, 0x73,
+    0xE6, 0xD1, 0xBF, 0x63, 0xC6, 0x91, 0x3F, 0x7E, 0xFC, 0xE5, 0xD7, 0xB3, 0x7B, 0xF6, 0xF1, 0xFF,
+    0xE3, 0xDB, 0xAB, 0x4B, 0x96, 0x31, 0x62, 0xC4, 0x95, 0x37, 0x6E, 0xDC, 0xA5, 0x57, 0xAE, 0x41,
+    0x82, 0x19, 0x32, 0x64, 0xC8, 0x8D, 0x07, 0x0E, 0x1C, 0x38, 0x70, 0xE0, 0xDD, 0xA7, 0x53, 0xA6,
+    0x51, 0xA2, 0x59, 0xB2, 0x79, 0xF2, 0xF9, 0xEF, 0xC3, 0x9B, 0x2B, 0x56, 0xAC, 0x45, 0x8A, 0x09,
+    0x12, 0x24, 0x48, 0x90, 0x3D, 0x7A, 0xF4, 0xF5, 0xF7, 0xF3, 0xFB, 0xEB, 0xCB, 0x8B, 0x0B, 0x16,
+    0x2C, 0x58, 0xB0, 0x7D, 0xFA, 0xE9, 0xCF, 0x83, 0x1B, 0x36, 0x6C, 0xD8, 0xAD, 0x47, 0x8E
+};
+/** GF(256) discrete logarithms to base 2 (entry 0 unused) */
+static const uint8_t qr_gf_log[256] = {
+    0x00, 0x00, 0x01, 0x19, 0x02, 0x32, 0x1A, 0xC6, 0x03, 0xDF, 0x33, 0xEE, 0x1B, 0x68, 0xC7, 0x4B,
+    0x04, 0x64, 0xE0, 0x0E, 0x34, 0x8D, 0xEF, 0x81, 0x1C, 0xC1, 0x69, 0xF8, 0xC8, 0x08, 0x4C, 0x71,
+    0x05, 0x8A, 0x65, 0x2F, 0xE1, 0x24, 0x0F, 0x21, 0x35, 0x93, 0x8E, 0xDA, 0xF0, 0x12, 0x82, 0x45,
+    0x1D, 0xB5, 0xC2, 0x7D, 0x6A, 0x27, 0xF9, 0xB9, 0xC9, 0x9A, 0x09, 0x78, 0x4D, 0xE4, 0x72, 0xA6,
+    0x06, 0xBF, 0x8B, 0x62, 0x66, 0xDD, 0x30, 0xFD, 0xE2, 0x98, 0x25, 0xB3, 0x10, 0x91, 0x22, 0x88,
+    0x36, 0xD0, 0x94, 0xCE, 0x8F, 0x96, 0xDB, 0xBD, 0xF1, 0xD2, 0x13, 0x5C, 0x83, 0x38, 0x46, 0x40,
+    0x1E, 0x42, 0xB6, 0xA3, 0xC3, 0x48, 0x7E, 0x6E, 0x6B, 0x3A, 0x28, 0x54, 0xFA, 0x85, 0xBA, 0x3D,
+    0xCA, 0x5E, 0x9B, 0x9F, 0x0A, 0x15, 0x79, 0x2B, 0x4E, 0xD4, 0xE5, 0xAC, 0x73, 0xF3, 0xA7, 0x57,
+    0x07, 0x70, 0xC0, 0xF7, 0x8C, 0x80, 0x63, 0x0D, 0x67, 0x4A, 0xDE, 0xED, 0x31, 0xC5, 0xFE, 0x18,
+    0xE3, 0xA5, 0x99, 0x77, 0x26, 0xB8, 0xB4, 0x7C, 0x11, 0x44, 0x92, 0xD9, 0x23, 0x20, 0x89, 0x2E,
+    0x37, 0x3F, 0xD1, 0x5B, 0x95, 0xBC, 0xCF, 0xCD, 0x90, 0x87, 0x97, 0xB2, 0xDC, 0xFC, 0xBE, 0x61,
+    0xF2, 0x56, 0xD3, 0xAB, 0x14, 0x2A, 0x5D, 0x9E, 0x84, 0x3C, 0x39, 0x53, 0x47, 0x6D, 0x41, 0xA2,
+    0x1F, 0x2D, 0x43, 0xD8, 0xB7, 0x7B, 0xA4, 0x76, 0xC4, 0x17, 0x49, 0xEC, 0x7F, 0x0C, 0x6F, 0xF6,
+    0x6C, 0xA1, 0x3B, 0x52, 0x29, 0x9D, 0x55, 0xAA, 0xFB, 0x60, 0x86, 0xB1, 0xBB, 0xCC, 0x3E, 0x5A,
+    0xCB, 0x59, 0x5F, 0xB0, 0x9C, 0xA9, 0xA0, 0x51, 0x0B, 0xF5, 0x16, 0xEB, 0x7A, 0x75, 0x2C, 0xD7,
+    0x4F, 0xAE, 0xD5, 0xE9, 0xE6, 0xE7, 0xAD, 0xE8, 0x74, 0xD6, 0xF4, 0xEA, 0xA8, 0x50, 0x58, 0xAF
+};
+/** @} */
+
+/**
+ * @defgroup QR_Private_Functions QR Private Functions
+ * @{
+ */
+/**
+ * @brief GF(256) product
+ * @param a Factor
+ * @param b Factor
+ * @return a * b
+ */
+static uint8_t QR_GfMul(uint8_t a, uint8_t b);
+/**
+ * @brief Reed-Solomon error correction codewords of one block
+ * @param data  Data codewords
+ * @param len   Number of data codewords
+ * @param ecc   Output, degree codewords
+ * @param degree Number of error correction codewords
+ */
+static void QR_ReedSolomon(const uint8_t *data, uint8_t len, uint8_t *ecc, uint8_t degree);
+/**
+ * @brief Set one module
+ * @param qr   Symbol
+ * @param x    Column
+ * @param y    Row
+ * @param dark Colour
+ */
+static void QR_SetModule(QrCode_t *qr, int x, int y, bool dark);
+/**
+ * @brief One module row as bits (bit x = column x)
+ * @param qr Symbol
+ * @param y  Row
+ * @return Row bits
+ */
+static uint64_t QR_LoadRow(const QrCode_t *qr, int y);
+/**
+ * @brief Modules of a row that belong to a function pattern or the format information
+ * @param qr Symbol (version and size set)
+ * @param y  Row
+ * @return Row bits, 1 = function module
+ */
+static uint64_t QR_FunctionRow(const QrCode_t *qr, int y);
+/**
+ * @brief Number of set bits
+ * @param bits Value
+ * @return Bit count
+ */
+static int32_t QR_BitCount(uint64_t bits);
+/**
+ * @brief Draw finders, separators, timing and alignment patterns
+ * @param qr Symbol (version and size set, modules cleared)
+ */
+static void QR_DrawFunctionPatterns(QrCode_t *qr);
+/**
+ * @brief Draw both copies of the format information and the dark module
+ * @param qr   Symbol
+ * @param mask Mask pattern
+ */
+static void QR_DrawFormat(QrCode_t *qr, uint8_t mask);
+/**
+ * @brief Place the codewords in the zig-zag order
+ * @param qr        Symbol
+ * @param codewords Interleaved codewords
+ * @param count     Number of codewords
+ */
+static void QR_PlaceCodewords(QrCode_t *qr, const uint8_t *codewords, uint8_t count);
+/**
+ * @brief Invert the data modules selected by a mask pattern (its own inverse)
+ * @param qr   Symbol
+ * @param mask Mask pattern
+ */
+static void QR_ApplyMask(QrCode_t *qr, uint8_t mask);
+/**
+ * @brief Add a run length to the finder pattern history
+ * @param history Last seven run lengths, newest first
+ * @param run     Run that just ended
+ * @param size    Symbol size
+ */
+static void QR_FinderHistoryAdd(int16_t *history, int16_t run, int16_t size);
+/**
+ * @brief Count finder-like patterns ending at the newest run
+ * @param history Last seven run lengths, newest first
+ * @return 0, 1 or 2
+ */
+static int32_t QR_FinderHistoryCount(const int16_t *history);
+/**
+ * @brief Penalty of one row or column (rules N1 and N3)
+ * @param line Modules of the line as bits (bit i = module i)
+ * @param size Symbol size
+ * @return Score
+ */
+static int32_t QR_PenaltyLine(uint64_t line, int size);
+/**
+ * @brief Penalty score of the symbol
+ * @param qr Symbol
+ * @return Score (lower is better)
+ */
+static int32_t QR_Penalty(const QrCode_t *qr);
+/** @} */
+
+
+/**
+ * @brief  Byte-mode capacity of a version.
+ * @param version 1 .. QR_VERSION_MAX.
+ * @param ecc     Error correction level.
+ * @return Largest payload in bytes, 0 for an unsupported version.
+ */
+size_t QR_Capacity(uint8_t version, QrEcc_t ecc)
+{
+    if ((version < 1U) || (version > QR_VERSION_MAX) || ((unsigned)ecc > (unsigned)QR_ECC_M))
+    {
+        return 0;
+    }
+    const QrVersionInfo_t *info = &qr_versions[version - 1U];
+    size_t data_codewords = info->codewords - (size_t)info->ecc_per_block[ecc] * info->blocks[ecc];
+
+    /* Mode indicator (4 bits) and character count (8 bits) come first */
+    return ((data_codewords * 8U) - 12U) / 8U;
+}
+
+/**
+ * @brief  Encode a payload in byte mode in the smallest version that holds it.
+ * @param qr   Symbol to fill.
+ * @param data Payload.
+ * @param len  Payload length.
+ * @param ecc  Error correction level.
+ * @return 0 on success, -1 if the payload does not fit.
+ */
+int QR_Encode(QrCode_t *qr, const uint8_t *data, size_t len, QrEcc_t ecc)
+{
+    uint8_t bits[QR_DATA_CODEWORDS_MAX];
+    uint8_t codewords[QR_CODEWORDS_MAX];
+    uint8_t version = 1;
+
+    while ((version <= QR_VERSION_MAX) && (QR_Capacity(version, ecc) < len))
+    {
+        version++;
+    }
+    if (version > QR_VERSION_MAX)
+    {
+        return -1;
+    }
+
+    const QrVersionInfo_t *info = &qr_versions[version - 1U];
+    uint8_t blocks = info->blocks[ecc];
+    uint8_t ecc_len = info->ecc_per_block[ecc];
+    uint8_t data_len = (uint8_t)(info->codewords - ecc_len * blocks);
+    uint8_t block_len = (uint8_t)(data_len / blocks);
+
+    /* Data codewords: mode, count, payload, terminator (at most 4 bits), then pad bytes */
+    memset(bits, 0, sizeof(bits));
+    bits[0] = (uint8_t)((QR_MODE_BYTE << 4) | ((uint8_t)len >> 4));
+    bits[1] = (uint8_t)((uint8_t)len << 4);
+    for (size_t i = 0; i < len; i++)
+    {
+        bits[1U + i] |= (uint8_t)(data[i] >> 4);
+        bits[2U + i] = (uint8_t)(data[i] << 4);
+    }
+    for (size_t i = len + 2U, pad = 0; i < data_len; i++, pad ^= 1U)
+    {
+        bits[i] = (pad == 0U) ? 0xECU : 0x11U;
+    }
+
+    /* Blocks have equal length up to version 4: interleave data, then error correction */
+    for (uint8_t b = 0; b < blocks; b++)
+    {
+        uint8_t ecc_cw[QR_ECC_PER_BLOCK_MAX];
+        const uint8_t *block = &bits[b * block_len];
+
+        QR_ReedSolomon(block, block_len, ecc_cw, ecc_len);
+        for (uint8_t i = 0; i < block_len; i++)
+        {
+            codewords[i * blocks + b] = block[i];
+        }
+        for (uint8_t i = 0; i < ecc_len; i++)
+        {
+            codewords[data_len + i * blocks + b] = ecc_cw[i];
+        }
+    }
+
+    memset(qr->modules, 0, sizeof(qr->modules));
+    qr->version = version;
+    qr->size = (uint8_t)(17U + 4U * version);
+    qr->ecc = (uint8_t)ecc;
+    QR_DrawFunctionPatterns(qr);
+    QR_PlaceCodewords(qr, codewords, info->codewords);
+
+    /* Try every mask; each is undone by applying it again */
+    int32_t best_score = INT32_MAX;
+    uint8_t best_mask = 0;
+    for (uint8_t mask = 0; mask < QR_MASKS; mask++)
+    {
+        QR_ApplyMask(qr, mask);
+        QR_DrawFormat(qr, mask);
+        int32_t score = QR_Penalty(qr);
+        if (score < best_score)
+        {
+            best_score = score;
+            best_mask = mask;
+        }
+        QR_ApplyMask(qr, mask);
+    }
+    QR_ApplyMask(qr, best_mask);
+    QR_DrawFormat(qr, best_mask);
+    qr->mask = best_mask;
+    return 0;
+}
+
+/**
+ * @brief GF(256) product.
+ * @param a Factor.
+ * @param b Factor.
+ * @return a * b.
+ */
+static uint8_t QR_GfMul(uint8_t a, uint8_t b)
+{
+    if ((a == 0U) || (b == 0U))
+    {
+        return 0;
+    }
+    return qr_gf_exp[((uint16_t)qr_gf_log[a] + qr_gf_log[b]) % 255U];
+}
+
+/**
+ * @brief Reed-Solomon error correction codewords of one block.
+ *
+ * The generator polynomial (x - 2^0)(x - 2^1)...(x - 2^(degree-1)) is built on the stack,
+ * then the data is divided by it; the remainder is the error correction.
+ *
+ * @param data   Data codewords.
+ * @param len    Number of data codewords.
+ * @param ecc    Output, degree codewords.
+ * @param degree Number of error correction codewords.
+ * @return None
+ */
+static void QR_ReedSolomon(const uint8_t *data, uint8_t len, uint8_t *ecc, uint8_t degree)
+{
+    uint8_t divisor[QR_ECC_PER_BLOCK_MAX];
+    uint8_t root = 1;
+
+    /* Coefficients from the highest power down, leading 1 omitted */
+    memset(divisor, 0, degree);
+    divisor[degree - 1U] = 1;
+    for (uint8_t i = 0; i < degree; i++)
+    {
+        for (uint8_t j = 0; j < degree; j++)
+        {
+            divisor[j] = QR_GfMul(divisor[j], root);
+            if ((j + 1U) < degree)
+            {
+                divisor[j] ^= divisor[j + 1U];
+            }
+        }
+        root = QR_GfMul(root, 2U);
+    }
+
+    memset(ecc, 0, degree);
+    for (uint8_t i = 0; i < len; i++)
+    {
+        uint8_t factor = data[i] ^ ecc[0];
+        memmove(ecc, ecc + 1, degree - 1U);
+        ecc[degree - 1U] = 0;
+        for (uint8_t j = 0; j < degree; j++)
+        {
+            ecc[j] ^= QR_GfMul(divisor[j], factor);
+        }
+    }
+}
+
+/**
+ * @brief Set one module (ignored outside the symbol).
+ * @param qr   Symbol.
+ * @param x    Column.
+ * @param y    Row.
+ * @param dark Colour.
+ * @return None
+ */
+static void QR_SetModule(QrCode_t *qr, int x, int y, bool dark)
+{
+    if ((x < 0) || (y < 0) || (x >= qr->size) || (y >= qr->size))
+    {
+        return;
+    }
+    uint8_t bit = (uint8_t)(1U << ((unsigned)x & 7U));
+    if (dark)
+    {
+        qr->modules[y][x >> 3] |= bit;
+    }
+    else
+    {
+        qr->modules[y][x >> 3] &= (uint8_t)~bit;
+    }
+}
+
+/**
+ * @brief One module row as bits.
+ * @param qr Symbol.
+ * @param y  Row.
+ * @return Row bits (bit x = column x).
+ */
+static uint64_t QR_LoadRow(const QrCode_t *qr, int y)
+{
+    uint64_t bits = 0;
+
+    for (int i = QR_ROW_BYTES - 1; i >= 0; i--)
+    {
+        bits = (bits << 8) | qr->modules[y][i];
+    }
+    return bits;
+}
+
+/**
+ * @brief Modules of a row that belong to a function pattern or the format information.
+ * @param qr Symbol.
+ * @param y  Row.
+ * @return Row bits, 1 = function module.
+ */
+static uint64_t QR_FunctionRow(const QrCode_t *qr, int y)
+{
+    int size = qr->size;
+    int align = size - 7;
+    uint64_t bits;
+
+    /* Horizontal and vertical timing patterns */
+    if (y == 6)
+    {
+        return (1ULL << size) - 1U;
+    }
+    bits = 1ULL << 6;
+    /* Finders with separators and format information (plus the dark module) */
+    if (y < 9)
+    {
+        bits |= 0x1FFULL | (0xFFULL << (size - 8));
+    }
+    else if (y >= size - 8)
+    {
+        bits |= 0x1FFULL;
+    }
+    /* The single alignment pattern of versions 2-6 */
+    if ((qr->version >= 2U) && (y >= align - 2) && (y <= align + 2))
+    {
+        bits |= 0x1FULL << (align - 2);
+    }
+    return bits;
+}
+
+/**
+ * @brief Number of set bits.
+ * @param bits Value.
+ * @return Bit count.
+ */
+static int32_t QR_BitCount(uint64_t bits)
+{
+    int32_t count = 0;
+
+    while (bits != 0U)
+    {
+        bits &= bits - 1U;
+        count++;
+    }
+    return count;
+}
+
+/**
+ * @brief Draw finders, separators, timing and alignment patterns.
+ * @param qr Symbol.
+ * @return None
+ */
+static void QR_DrawFunctionPatterns(QrCode_t *qr)
+{
+    int size = qr->size;
+    const int finders[3][2] = { { 3, 3 }, { size - 4, 3 }, { 3, size - 4 } };
+
+    for (int i = 0; i < size; i++)
+    {
+        QR_SetModule(qr, 6, i, (i % 2) == 0);
+        QR_SetModule(qr, i, 6, (i % 2) == 0);
+    }
+    for (int f = 0; f < 3; f++)
+    {
+        for (int dy = -4; dy <= 4; dy++)
+        {
+            for (int dx = -4; dx <= 4; dx++)
+            {
+                int dist = (dx < 0 ? -dx : dx) > (dy < 0 ? -dy : dy) ? (dx < 0 ? -dx : dx) : (dy < 0 ? -dy : dy);
+                QR_SetModule(qr, finders[f][0] + dx, finders[f][1] + dy, (dist != 2) && (dist != 4));
+            }
+        }
+    }
+    if (qr->version >= 2U)
+    {
+        int align = size - 7;
+        for (int dy = -2; dy <= 2; dy++)
+        {
+            for (int dx = -2; dx <= 2; dx++)
+            {
+                QR_SetModule(qr, align + dx, align + dy, (dx == -2) || (dx == 2) || (dy == -2) || (dy == 2) ||
+                                                         ((dx == 0) && (dy == 0)));
+            }
+        }
+    }
+}
+
+/**
+ * @brief Draw both copies of the format information and the dark module.
+ * @param qr   Symbol.
+ * @param mask Mask pattern.
+ * @return None
+ */
+static void QR_DrawFormat(QrCode_t *qr, uint8_t mask)
+{
+    int size = qr->size;
+    uint32_t data = ((uint32_t)qr_format_ecc[qr->ecc] << 3) | mask;
+    uint32_t rem = data;
+
+    /* BCH(15,5) code, generator 0x537, then the fixed XOR mask */
+    for (int i = 0; i < 10; i++)
+    {
+        rem = (rem << 1) ^ ((rem >> 9) * 0x537U);
+    }
+    uint32_t bits = ((data << 10) | (rem & 0x3FFU)) ^ 0x5412U;
+
+    for (int i = 0; i <= 5; i++)
+    {
+        QR_SetModule(qr, 8, i, ((bits >> i) & 1U) != 0U);
+    }
+    QR_SetModule(qr, 8, 7, ((bits >> 6) & 1U) != 0U);
+    QR_SetModule(qr, 8, 8, ((bits >> 7) & 1U) != 0U);
+    QR_SetModule(qr, 7, 8, ((bits >> 8) & 1U) != 0U);
+    for (int i = 9; i < 15; i++)
+    {
+        QR_SetModule(qr, 14 - i, 8, ((bits >> i) & 1U) != 0U);
+    }
+    for (int i = 0; i < 8; i++)
+    {
+        QR_SetModule(qr, size - 1 - i, 8, ((bits >> i) & 1U) != 0U);
+    }
+    for (int i = 8; i < 15; i++)
+    {
+        QR_SetModule(qr, 8, size - 15 + i, ((bits >> i) & 1U) != 0U);
+    }
+    QR_SetModule(qr, 8, size - 8, true);
+}
+
+/**
+ * @brief Place the codewords in the zig-zag order.
+ *
+ * Column pairs are walked from the right edge, alternately upwards and downwards, skipping
+ * the vertical timing pattern; bits beyond the last codeword (remainder bits) stay light.
+ *
+ * @param qr        Symbol.
+ * @param codewords Interleaved codewords.
+ * @param count     Number of codewords.
+ * @return None
+ */
+static void QR_PlaceCodewords(QrCode_t *qr, const uint8_t *codewords, uint8_t count)
+{
+    int size = qr->size;
+    uint32_t bit = 0;
+
+    for (int right = size - 1; right >= 1; right -= 2)
+    {
+        if (right == 6)
+        {
+            right = 5;
+        }
+        bool upward = ((right + 1) & 2) == 0;
+        for (int vert = 0; vert < size; vert++)
+        {
+            int y = upward ? (size - 1 - vert) : vert;
+            uint64_t function = QR_FunctionRow(qr, y);
+            for (int j = 0; j < 2; j++)
+            {
+                int x = right - j;
+                if (((function >> x) & 1U) != 0U)
+                {
+                    continue;
+                }
+                if (bit < (uint32_t)count * 8U)
+                {
+                    QR_SetModule(qr, x, y, ((codewords[bit >> 3] >> (7U - (bit & 7U))) & 1U) != 0U);
+                }
+                bit++;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Invert the data modules selected by a mask pattern.
+ *
+ * Every pattern repeats after six columns, so one row of it is built from six modules and
+ * replicated, then applied to the data modules with a byte-wise XOR.
+ *
+ * @param qr   Symbol.
+ * @param mask Mask pattern.
+ * @return None
+ */
+static void QR_ApplyMask(QrCode_t *qr, uint8_t mask)
+{
+    int size = qr->size;
+
+    for (int y = 0; y < size; y++)
+    {
+        uint64_t period = 0;
+        for (int x = 0; x < 6; x++)
+        {
+            bool invert;
+            switch (mask)
+            {
+                case 0:  invert = ((x + y) % 2) == 0; break;
+                case 1:  invert = (y % 2) == 0; break;
+                case 2:  invert = (x % 3) == 0; break;
+                case 3:  invert = ((x + y) % 3) == 0; break;
+                case 4:  invert = ((x / 3 + y / 2) % 2) == 0; break;
+                case 5:  invert = ((x * y) % 2 + (x * y) % 3) == 0; break;
+                case 6:  invert = (((x * y) % 2 + (x * y) % 3) % 2) == 0; break;
+                default: invert = (((x + y) % 2 + (x * y) % 3) % 2) == 0; break;
+            }
+            period |= invert ? (1ULL << x) : 0U;
+        }
+        uint64_t pattern = 0;
+        for (int x = 0; x < size; x += 6)
+        {
+            pattern |= period << x;
+        }
+        pattern &= ~QR_FunctionRow(qr, y) & ((1ULL << size) - 1U);
+        for (int i = 0; i < QR_ROW_BYTES; i++)
+        {
+            qr->modules[y][i] ^= (uint8_t)(pattern >> (8 * i));
+        }
+    }
+}
+
+/**
+ * @brief Add a run length to the finder pattern history (light border counted before the first run).
+ * @param history Last seven run lengths, newest first.
+ * @param run     Run that just ended.
+ * @param size    Symbol size.
+ * @return None
+ */
+static void QR_FinderHistoryAdd(int16_t *history, int16_t run, int16_t size)
+{
+    if (history[0] == 0)
+    {
+        run = (int16_t)(run + size);
+    }
+    for (int i = 6; i > 0; i--)
+    {
+        history[i] = history[i - 1];
+    }
+    history[0] = run;
+}
+
+/**
+ * @brief Count finder-like patterns (dark 1:1:3:1:1 with four light modules on one side).
+ * @param history Last seven run lengths, newest first (history[1] is dark).
+ * @return 0, 1 or 2.
+ */
+static int32_t QR_FinderHistoryCount(const int16_t *history)
+{
+    int16_t n = history[1];
+    bool core = (n > 0) && (history[2] == n) && (history[3] == n * 3) && (history[4] == n) && (history[5] == n);
+
+    return ((core && (history[0] >= n * 4) && (history[6] >= n)) ? 1 : 0) +
+           ((core && (history[6] >= n * 4) && (history[0] >= n)) ? 1 : 0);
+}
+
+/**
+ * @brief Penalty of one row or column (rules N1 and N3).
+ * @param line Modules of the line as bits (bit i = module i).
+ * @param size Symbol size.
+ * @return Score.
+ */
+static int32_t QR_PenaltyLine(uint64_t line, int size)
+{
+    int16_t history[7] = { 0 };
+    bool run_color = false;
+    int16_t run = 0;
+    int32_t score = 0;
+
+    for (int i = 0; i < size; i++, line >>= 1)
+    {
+        bool dark = (line & 1U) != 0U;
+        if (dark == run_color)
+        {
+            run++;
+            if (run == 5)
+            {
+                score += QR_PENALTY_N1;
+            }
+            else if (run > 5)
+            {
+                score++;
+            }
+        }
+        else
+        {
+            QR_FinderHistoryAdd(history, run, (int16_t)size);
+            if (!run_color)
+            {
+                score += QR_FinderHistoryCount(history) * QR_PENALTY_N3;
+            }
+            run_color = dark;
+            run = 1;
+        }
+    }
+    /* Close the line with the light border */
+    if (run_color)
+    {
+        QR_FinderHistoryAdd(history, run, (int16_t)size);
+        run = 0;
+    }
+    QR_FinderHistoryAdd(history, (int16_t)(run + size), (int16_t)size);
+    return score + QR_FinderHistoryCount(history) * QR_PENALTY_N3;
+}
+
+/**
+ * @brief Penalty score of the symbol.
+ * @param qr Symbol.
+ * @return Score (lower is better).
+ */
+static int32_t QR_Penalty(const QrCode_t *qr)
+{
+    int size = qr->size;
+    uint64_t inner = (1ULL << (size - 1)) - 1U;
+    uint64_t prev = 0;
+    int32_t score = 0;
+    int32_t dark = 0;
+
+    for (int y = 0; y < size; y++)
+    {
+        uint64_t row = QR_LoadRow(qr, y);
+        uint64_t column = 0;
+
+        for (int x = size - 1; x >= 0; x--)
+        {
+            column = (column << 1) | ((qr->modules[x][y >> 3] >> (y & 7)) & 1U);
+        }
+        score += QR_PenaltyLine(row, size) + QR_PenaltyLine(column, size);
+        dark += QR_BitCount(row);
+        /* 2 x 2 blocks whose top-left module is in the previous row */
+        if (y > 0)
+        {
+            uint64_t same = ~(prev ^ row) & ~(row ^ (row >> 1)) & ~(prev ^ (prev >> 1)) & inner;
+            score += QR_BitCount(same) * QR_PENALTY_N2;
+        }
+        prev = row;
+    }
+    /* Smallest k with the dark share within (45 - 5k) % .. (55 + 5k) % */
+    int32_t total = size * size;
+    int32_t diff = dark * 20 - total * 10;
+    int32_t k = ((diff < 0 ? -diff : diff) + total - 1) / total - 1;
+    return score + k * QR_PENALTY_N4;
+}
@@ -0,0 +1,307 @@
+/**
+ * @file    rtos_stats.c
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Per-task CPU usage, context switch and stack statistics for NUCLEO-F429ZI.
+ *
+ * @details
+ * The run-time clock is derived from the DWT cycle counter: the elapsed cycles since the last
+ * read are accumulated and converted to whole microseconds, keeping the remainder, so the
+ * conversion needs only 32-bit arithmetic in the context switch path. CPU shares are computed
+ * from the difference of two consecutive uxTaskGetSystemState() samples, which keeps them
+ * meaningful after the counters wrap.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "rtos_stats.h"
+#include "dwt_timer.h"
+#include "mem_layout.h"
+#include "uart_tx.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "cmsis_os2.h"
+#include "stdio.h"
+#include "string.h"
+
+/**
+ * @defgroup RTOS_STATS_Private_Defines RTOS Stats Private Defines
+ * @{
+ */
+/** Length of one printed report line, including CR/LF */
+#define RTOS_STATS_LINE_LEN   80
+#ifndef configIDLE_TASK_NAME
+/** Name of the idle task (same default as tasks.c) */
+#define configIDLE_TASK_NAME  "IDLE"
+#endif
+/** @} */
+
+/**
+ * @defgroup RTOS_STATS_Private_Variables RTOS Stats Private Variables
+ * @{
+ */
+/** Core clock cycles per microsecond */
+static uint32_t stats_cycles_per_us = 1;
+/** Cycle counter value at the last run-time clock read */
+static uint32_t stats_last_cycles;
+/** Cycles not yet converted to microseconds */
+static uint32_t stats_cycle_remainder;
+/** Run-time clock (microseconds) */
+static uint32_t stats_runtime_us;
+/** Context switches per task number (free-running) */
+static volatile uint32_t stats_switches[RTOS_STATS_MAX_TASK_NUMBER + 1] CCM_SECTION("trace");
+/** Run-time counters per task number at the previous sample */
+static uint32_t stats_prev_runtime[RTOS_STATS_MAX_TASK_NUMBER + 1] CCM_SECTION("trace");
+/** Switch counters per task number at the previous sample */
+static uint32_t stats_prev_switches[RTOS_STATS_MAX_TASK_NUMBER + 1] CCM_SECTION("trace");
+/** Total run time at the previous sample */
+static uint32_t stats_prev_total;
+/** Tick of the previous sample */
+static uint32_t stats_last_sample_tick;
+/** Set once the first sample has been taken */
+static uint8_t stats_sampled;
+/** Latest report */
+static RtosStatsReport_t stats_report CCM_SECTION("trace");
+/** @} */
+
+/**
+ * @defgroup RTOS_STATS_Private_Functions RTOS Stats Private Functions
+ * @{
+ */
+/**
+ * @brief Sample all tasks and rebuild the report
+ */
+static void RTOS_Stats_Sample(void);
+/**
+ * @brief One-letter name of a task state
+ * @param state Task state
+ * @return State letter
+ */
+static char RTOS_Stats_StateLetter(eTaskState state);
+/** @} */
+
+
+/**
+ * @brief  Start the run-time stats clock (portCONFIGURE_TIMER_FOR_RUN_TIME_STATS).
+ * @return None
+ */
+void RTOS_Stats_TimerInit(void)
+{
+    DWT_Timer_Init();
+    stats_cycles_per_us = SystemCoreClock / 1000000U;
+    if (stats_cycles_per_us == 0U)
+    {
+        stats_cycles_per_us = 1;
+    }
+    stats_last_cycles = DWT_Timer_GetCycles();
+    stats_cycle_remainder = 0;
+    stats_runtime_us = 0;
+}
+
+/**
+ * @brief  Run-time stats clock in microseconds (portGET_RUN_TIME_COUNTER_VALUE).
+ * @return Microseconds since the clock was started (wraps at 2^32).
+ */
+uint32_t RTOS_Stats_GetRunTimeCounter(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    uint32_t now = DWT_Timer_GetCycles();
+    stats_cycle_remainder += now - stats_last_cycles;
+    stats_last_cycles = now;
+    uint32_t us = stats_cycle_remainder / stats_cycles_per_us;
+    stats_cycle_remainder -= us * stats_cycles_per_us;
+    stats_runtime_us += us;
+    uint32_t runtime = stats_runtime_us;
+
+    __set_PRIMASK(primask);
+    return runtime;
+}
+
+/**
+ * @brief  Count a context switch (traceTASK_SWITCHED_IN hook, runs inside the kernel).
+ * @param task_number FreeRTOS task number of the task switched in.
+ * @return None
+ */
+void RTOS_Stats_TaskSwitchedIn(uint32_t task_number)
+{
+    if (task_number <= RTOS_STATS_MAX_TASK_NUMBER)
+    {
+        stats_switches[task_number]++;
+    }
+}
+
+/**
+ * @brief  Refresh the report if the current window has elapsed.
+ * @return None
+ */
+void RTOS_Stats_Update(void)
+{
+    uint32_t now = osKernelGetTickCount();
+    if (!stats_sampled || ((now - stats_last_sample_tick) >= RTOS_STATS_WINDOW_MS))
+    {
+        RTOS_Stats_Sample();
+        stats_last_sample_tick = now;
+        stats_sampled = 1;
+    }
+    else
+    {
+        /* Keep the software-extended clock ahead of cycle counter wraps */
+        (void)RTOS_Stats_GetRunTimeCounter();
+    }
+}
+
+/**
+ * @brief  Copy the latest report.
+ * @param report Destination.
+ * @return None
+ */
+void RTOS_Stats_GetReport(RtosStatsReport_t *report)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    *report = stats_report;
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @brief  CPU load of the latest window.
+ * @return Busy share in 0.1 % units.
+ */
+uint16_t RTOS_Stats_GetCpuLoad(void)
+{
+    return stats_report.cpu_load_permille;
+}
+
+/**
+ * @brief  Print the latest report as a table on UART3.
+ * @return None
+ */
+void RTOS_Stats_Print(void)
+{
+    static RtosStatsReport_t report;
+    char line[RTOS_STATS_LINE_LEN];
+    int len;
+
+    RTOS_Stats_GetReport(&report);
+
+    len = snprintf(line, sizeof(line), "Task             St Pri   CPU%%   Sw/win  StackFree\r\n");
+    UART_TX_Write((const uint8_t *)line, (size_t)len);
+    for (uint32_t i = 0; i < report.task_count; i++)
+    {
+        const RtosStatsTask_t *task = &report.tasks[i];
+        len = snprintf(line, sizeof(line), "%-16s %c  %3u  %3u.%u%%  %6lu  %6lu B\r\n",
+                       task->name, task->state, task->priority,
+                       task->cpu_permille / 10U, task->cpu_permille % 10U,
+                       (unsigned long)task->switches, (unsigned long)task->stack_free_bytes);
+        UART_TX_Write((const uint8_t *)line, (size_t)len);
+    }
+    len = snprintf(line, sizeof(line), "CPU load %u.%u%%, %lu switches in %lu ms\r\n",
+                   report.cpu_load_permille / 10U, report.cpu_load_permille % 10U,
+                   (unsigned long)report.switches, (unsigned long)(report.window_us / 1000U));
+    UART_TX_Write((const uint8_t *)line, (size_t)len);
+}
+
+/**
+ * @brief Sample all tasks and rebuild the report.
+ *
+ * Tasks beyond RTOS_STATS_MAX_TASKS are not reported (uxTaskGetSystemState() returns 0 if
+ * the array is too small, so it is sized with a margin).
+ *
+ * @return None
+ */
+static void RTOS_Stats_Sample(void)
+{
+    static TaskStatus_t status[RTOS_STATS_MAX_TASKS + 4];
+    static RtosStatsReport_t next;
+    uint32_t total = 0;
+
+    UBaseType_t count = uxTaskGetSystemState(status, RTOS_STATS_MAX_TASKS + 4, &total);
+    uint32_t window = total - stats_prev_total;
+    stats_prev_total = total;
+
+    memset(&next, 0, sizeof(next));
+    next.window_us = window;
+    uint32_t idle_permille = 0;
+
+    for (UBaseType_t i = 0; i < count; i++)
+    {
+        const TaskStatus_t *task = &status[i];
+        uint32_t number = (uint32_t)task->xTaskNumber;
+        uint32_t runtime = 0;
+        uint32_t switches = 0;
+
+        if (number <= RTOS_STATS_MAX_TASK_NUMBER)
+        {
+            uint32_t total_switches = stats_switches[number];
+            runtime = task->ulRunTimeCounter - stats_prev_runtime[number];
+            switches = total_switches - stats_prev_switches[number];
+            stats_prev_runtime[number] = task->ulRunTimeCounter;
+            stats_prev_switches[number] = total_switches;
+        }
+
+        uint32_t permille = (window != 0U) ? (uint32_t)(((uint64_t)runtime * 1000U) / window) : 0U;
+        if (permille > 1000U)
+        {
+            permille = 1000U;
+        }
+        if (strcmp(task->pcTaskName, configIDLE_TASK_NAME) == 0)
+        {
+            idle_permille = permille;
+        }
+        next.switches += switches;
+
+        if (next.task_count >= RTOS_STATS_MAX_TASKS)
+        {
+            continue;
+        }
+
+        /* Insert in task number order */
+        uint32_t pos = next.task_count;
+        while ((pos > 0U) && (next.tasks[pos - 1U].number > number))
+        {
+            next.tasks[pos] = next.tasks[pos - 1U];
+            pos--;
+        }
+        RtosStatsTask_t *entry = &next.tasks[pos];
+        strncpy(entry->name, task->pcTaskName, RTOS_STATS_NAME_LEN - 1U);
+        entry->name[RTOS_STATS_NAME_LEN - 1U] = '\0';
+        entry->number = (uint8_t)number;
+        entry->priority = (uint8_t)task->uxCurrentPriority;
+        entry->state = RTOS_Stats_StateLetter(task->eCurrentState);
+        entry->cpu_permille = (uint16_t)permille;
+        entry->switches = switches;
+        entry->stack_free_bytes = (uint32_t)task->usStackHighWaterMark * sizeof(StackType_t);
+        next.task_count++;
+    }
+    next.cpu_load_permille = (uint16_t)(1000U - idle_permille);
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    stats_report = next;
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @brief One-letter name of a task state.
+ * @param state Task state.
+ * @return State letter.
+ */
+static char RTOS_Stats_StateLetter(eTaskState state)
+{
+    switch (state)
+    {
+        case eRunning:
+            return 'X';
+        case eReady:
+            return 'R';
+        case eBlocked:
+            return 'B';
+        case eSuspended:
+            return 'S';
+        case eDeleted:
+            return 'D';
+        default:
+            return '?';
+    }
+}
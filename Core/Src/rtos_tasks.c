@@ -8,38 +8,53 @@
  *
  * @details
  * This file implements the OLED display RTOS task using CMSIS-RTOS v2 and the u8g2 graphics library.
- * The task initializes the OLED (SSD1306, 128x64, I2C1) and updates the display based on three modes:
+ * The task initializes the OLED (SSD1306, 128x64, I2C1) and updates the display based on these modes:
  *   - Welcome/info message
  *   - QR code
  *   - Bongo cat animation
- * Display mode is controlled via a message queue triggered by SW1 (PE3) and SW2 (PE4) button interrupts.
- * The bongo cat animation toggles between two frames every 200ms. All code is modularized for clarity and maintainability.
+ *   - RTOS statistics (selected from the UART console)
+ *   - Video stream received on USART3 (selected from the UART console, video_sink.h)
+ *   - Dashboard of labelled values and a single image (command protocol, cmd_handler.h)
+ * Everything the panel shows is changed through display command messages (display_cmd.h) sent by
+ * the SW1 (PE3) and SW2 (PE4) button interrupts, the console and the command protocol. The screens
+ * are descriptors of the screen registry (screen_registry.h), which the task dispatches to; their
+ * texts and values are touched only by the task, so they need no locking. The task applies every
+ * queued command before it draws once. The bongo cat plays through the animation player (anim.h);
+ * the task sleeps until the next animation frame, refresh of a live screen or queue message is due.
+ * After each wake-up the panel contents can be mirrored to the host (fb_mirror.h). All code is
+ * modularized for clarity and maintainability.
  */
 
 /* Includes ------------------------------------------------------------------*/
 #include "rtos_tasks.h"
+#include "display_cmd.h"
 #include "main.h"
 #include "oled_driver.h"
+#include "oled_splash.h"
+#include "deferred_log.h"
+#include "uart_tx.h"
+#include "trace.h"
+#include "perf_hud.h"
+#include "dwt_timer.h"
+#include "screen_registry.h"
+#include "anim.h"
+#include "fb_mirror.h"
+#include "asset_pack.h"
+#include "../Image/asset_ids.h"
+#include "rtos_static.h"
+#include "mem_layout.h"
+#include "FreeRTOS.h"
 #include "stdio.h"
 #include "stdbool.h"
 #include "string.h"
-#include "../Image/img_qrcode.h"
-#include "../Image/bongo_cat_1.h"
-#include "../Image/bongo_cat_2.h"
 
 /**
  * @defgroup OLED_Private_Defines OLED Private Defines
  * @brief Private macro definitions for OLED display task
  * @{
  */
-/** Width of QR code and bongo cat images (pixels) */
-#define IMAGE_WIDTH   64
-/** Height of QR code and bongo cat images (pixels) */
-#define IMAGE_HEIGHT  64
-/** Width of bongo cat image (pixels) */
-#define BONGO_WIDTH   101
-/** Vertical offset for text lines in QR code mode (pixels) */
-#define TEXT_OFFSET_Y 15
+/** Length of one bus report line */
+#define BUS_REPORT_LINE_LEN 112
 /** @} */
 
 /**
@@ -49,12 +64,33 @@
  */
 /** OLED task handle */
 static osThreadId_t oled_task_handle;
-/** Queue for display mode updates */
-osMessageQueueId_t display_mode_queue;
+/** Queue of display commands */
+osMessageQueueId_t display_cmd_queue;
 /** Current display mode */
 DisplayMode_t current_display_mode = DISPLAY_MODE_INFO;
-/** UART3 handle for debug/error output */
-extern UART_HandleTypeDef huart3;
+/** Bus activity of the last frame flushed in each display mode */
+static I2cBusCost_t oled_frame_cost[DISPLAY_MODE_COUNT];
+/** Measured flush time of the last frame in each display mode (us) */
+static uint32_t oled_frame_flush_us[DISPLAY_MODE_COUNT];
+/** Tick at which the last flush ended (time stamp of the mirrored frame) */
+static uint32_t oled_last_flush_tick;
+/** Set by the console; the display task prints the u8g2 profile after the next frame */
+static volatile uint8_t oled_prof_report_pending;
+/** An animation started by a command is drawn over the current screen */
+static bool oled_anim_shown;
+/** Redraw period of each SCREEN_LIVE screen (ms), from its fps until DisplayCmd_SetRefreshRate() */
+static uint32_t oled_screen_period_ms[DISPLAY_MODE_COUNT];
+#if RTOS_STATIC_ALLOC
+/** OLED task control block */
+static StaticTask_t oled_task_cb CCM_SECTION("oled");
+/** OLED task stack */
+static StackType_t oled_task_stack[OLED_TASK_STACK_SIZE_BYTES / sizeof(StackType_t)]
+    CCM_SECTION("oled") RTOS_STACK_ALIGN;
+/** Display command queue control block */
+static StaticQueue_t display_cmd_queue_cb CCM_SECTION("oled");
+/** Display command queue storage */
+static DisplayCmd_t display_cmd_queue_storage[OLED_DISPLAY_CMD_QUEUE_SIZE] CCM_SECTION("oled");
+#endif
 /** @} */
 
 /**
@@ -68,51 +104,114 @@ extern UART_HandleTypeDef huart3;
  */
 static void OLED_Display_Task(void *argument);
 /**
- * @brief Draw bongo cat animation frame
- * @param u8g2 Pointer to the u8g2 display structure
+ * @brief Stop the animations of the previous screen and enter a new one
+ * @param mode     Display mode being entered
+ * @param previous Display mode left
+ * @param now      Current tick (ms)
  */
-static void DrawBongoCat(u8g2_t *u8g2);
+static void OLED_EnterMode(DisplayMode_t mode, DisplayMode_t previous, uint32_t now);
 /**
- * @brief Draw QR code screen
- * @param u8g2 Pointer to the u8g2 display structure
+ * @brief Draw the whole current screen: its widgets, then its render callback
+ * @param u8g2   Pointer to the u8g2 display structure
+ * @param screen Current screen
  */
-static void DrawQRCode(u8g2_t *u8g2);
+static void OLED_RenderScreen(u8g2_t *u8g2, const Screen_t *screen);
 /**
- * @brief Draw info/welcome screen
- * @param u8g2 Pointer to the u8g2 display structure
+ * @brief Redraw the invalidated widgets and/or the HUD box and send only their tiles
+ * @param u8g2    Pointer to the u8g2 display structure
+ * @param widgets Widgets of the current screen, or NULL to redraw only the HUD
+ * @param count   Number of widgets
+ * @return Number of tiles sent
  */
-static void DrawInfoScreen(u8g2_t *u8g2);
+static uint32_t OLED_DrawDirty(u8g2_t *u8g2, Widget_t *widgets, size_t count);
+/**
+ * @brief Show a display mode (entering it if it is not the current one)
+ * @param mode Display mode
+ * @param now  Current tick (ms)
+ * @return true if the screen has to be redrawn
+ */
+static bool OLED_ShowMode(DisplayMode_t mode, uint32_t now);
+/**
+ * @brief Apply one display command to the screen state
+ * @param cmd Command; a text payload is taken over (cmd->text cleared)
+ * @param now Current tick (ms)
+ * @return true if the current screen has to be redrawn
+ */
+static bool OLED_ApplyCommand(DisplayCmd_t *cmd, uint32_t now);
+/**
+ * @brief Time the display task may sleep before the next redraw is due
+ * @param now         Current tick (ms)
+ * @param last_update Tick of the last redraw
+ * @return Queue timeout (ms or osWaitForever)
+ */
+static uint32_t OLED_NextWait(uint32_t now, uint32_t last_update);
+/**
+ * @brief Let a stream screen update the buffer and send the tiles it changed
+ * @param u8g2   Pointer to the u8g2 display structure
+ * @param screen Current screen (SCREEN_STREAM)
+ * @param now    Current tick (ms)
+ * @return Display mode to show: the current one while the stream runs
+ */
+static DisplayMode_t OLED_StreamStep(u8g2_t *u8g2, const Screen_t *screen, uint32_t now);
+/**
+ * @brief Flush the buffer (or some of its tiles) and record the bus cost of the frame
+ * @param u8g2  Pointer to the u8g2 display structure
+ * @param mode  Display mode the frame belongs to
+ * @param tiles Tiles to send, or NULL for the whole buffer
+ * @return Number of tiles sent
+ */
+static uint32_t OLED_FlushFrame(u8g2_t *u8g2, DisplayMode_t mode, const VideoTiles_t *tiles);
+/**
+ * @brief Output function of the u8g2 profile report
+ * @param s NUL-terminated text
+ */
+static void OLED_ProfOut(const char *s);
 /** @} */
 
 
 /**
  * @brief  Initialize the OLED display RTOS task and message queue.
  *
- * This function creates the message queue for display mode updates and starts the OLED display task.
+ * This function creates the display command queue and starts the OLED display task.
  * It must be called once during system initialization (typically in main.c) before the RTOS kernel starts.
  *
- * @note If queue or task creation fails, the function will output an error message via UART3 and call Error_Handler().
+ * @note If queue or task creation fails, the function will output an error message via the UART3 panic path
+ *       (synchronous, since Error_Handler() masks interrupts) and call Error_Handler().
  */
 void OLED_Task_Init(void)
 {
-    display_mode_queue = osMessageQueueNew(OLED_DISPLAY_MODE_QUEUE_SIZE, sizeof(DisplayMode_t), NULL);
-    if (display_mode_queue == NULL)
+#if RTOS_STATIC_ALLOC
+    const osMessageQueueAttr_t display_cmd_queue_attributes = {
+        .cb_mem = &display_cmd_queue_cb,
+        .cb_size = sizeof(display_cmd_queue_cb),
+        .mq_mem = display_cmd_queue_storage,
+        .mq_size = sizeof(display_cmd_queue_storage)
+    };
+    display_cmd_queue = osMessageQueueNew(OLED_DISPLAY_CMD_QUEUE_SIZE, sizeof(DisplayCmd_t),
+                                          &display_cmd_queue_attributes);
+#else
+    display_cmd_queue = osMessageQueueNew(OLED_DISPLAY_CMD_QUEUE_SIZE, sizeof(DisplayCmd_t), NULL);
+#endif
+    if (display_cmd_queue == NULL)
     {
-        char msg[] = "Failed to create display mode queue\r\n";
-        HAL_UART_Transmit(&huart3, (uint8_t *)msg, strlen(msg), 100);
+        UART_TX_Panic("Failed to create display command queue\r\n");
         Error_Handler();
     }
 
     const osThreadAttr_t oled_task_attributes = {
         .name = OLED_TASK_THREAD_NAME,
         .priority = OLED_TASK_THREAD_PRIORITY,
+#if RTOS_STATIC_ALLOC
+        .cb_mem = &oled_task_cb,
+        .cb_size = sizeof(oled_task_cb),
+        .stack_mem = oled_task_stack,
+#endif
         .stack_size = OLED_TASK_STACK_SIZE_BYTES
     };
     oled_task_handle = osThreadNew(OLED_Display_Task, NULL, &oled_task_attributes);
     if (oled_task_handle == NULL)
     {
-        char msg[] = "Failed to create OLED display task\r\n";
-        HAL_UART_Transmit(&huart3, (uint8_t *)msg, strlen(msg), 100);
+        UART_TX_Panic("Failed to create OLED display task\r\n");
         Error_Handler();
     }
 }
@@ -123,13 +222,32 @@ void OLED_Task_Init(void)
  * @brief  RTOS OLED display task (main display loop).
  *
  * This RTOS task initializes the OLED hardware and continuously updates the display
- * according to the current display mode received from the message queue. Supported modes:
+ * according to the display commands received from the message queue. After a boot splash
+ * the panel is neither reset nor cleared; the splash remains until the first frame is drawn.
+ * Supported modes:
  *   - DISPLAY_MODE_INFO: Shows the welcome/info message
  *   - DISPLAY_MODE_QRCODE: Shows the QR code page
  *   - DISPLAY_MODE_BONGO: Shows the bongo cat animation (default/fallback)
+ *   - DISPLAY_MODE_STATS: Shows per-task CPU share and free stack
+ *   - DISPLAY_MODE_VIDEO: Shows frames received from the video sink
+ *   - DISPLAY_MODE_DASHBOARD: Shows the labelled values set with DisplayCmd_SetValue()
+ *   - DISPLAY_MODE_IMAGE: Shows the asset chosen with DisplayCmd_ShowImage()
  *
- * If an invalid mode is received, the display will default to the info screen.
- * The bongo cat animation toggles frames every 200ms.
+ * The screen of the current mode comes from the screen registry: the task calls its enter and
+ * exit callbacks on a change, draws its widgets and render callback, and passes it the texts,
+ * values and images addressed to it. A frame is drawn when a command changes what the current
+ * screen shows (or asks for a refresh), when an animation reaches its next frame, and at the rate
+ * of a live screen (its fps, or the rate set with DisplayCmd_SetRefreshRate()). A static screen
+ * costs nothing until it changes. In between,
+ * the task blocks on the queue until the earliest of these deadlines. A woken task applies every
+ * queued command (up to OLED_DISPLAY_CMD_QUEUE_SIZE) before it draws, so a burst of updates costs one frame.
+ * The info, QR and dashboard screens are widget trees (widget.h): a changed text or value only
+ * invalidates its widget, and unless an animation is drawn over the screen, the task redraws
+ * just the invalidated widgets and sends their tiles instead of the whole frame. The HUD is a
+ * region of its own: its box is redrawn and sent only when its text changes.
+ * On a stream screen (video) the screen is drawn once on entry; afterwards its update callback
+ * writes the received frames into the buffer, only their changed tiles are sent, and the task
+ * shows the screen the update asks for when the stream ends.
  *
  * @param argument [in] Unused task parameter (required by CMSIS-RTOS API)
  * @return None
@@ -141,95 +259,536 @@ static void OLED_Display_Task(void *argument)
     u8g2_t *u8g2 = OLED_GetDisplay();
     if (u8g2 == NULL)
     {
-        char msg[] = "Failed to initialize OLED display\r\n";
-        HAL_UART_Transmit(&huart3, (uint8_t *)msg, strlen(msg), 100);
+        UART_TX_Panic("Failed to initialize OLED display\r\n");
         Error_Handler();
     }
 
-    u8g2_ClearBuffer(u8g2);
-    u8g2_ClearDisplay(u8g2);
-    u8g2_SendBuffer(u8g2);
+    if (OLED_Splash_IsShown())
+    {
+        /* The splash stays on the panel until the first redraw replaces it */
+        Log_Write(LOG_FMT_BOOT_SPLASH, OLED_Splash_GetBootUs(), osKernelGetTickCount());
+    }
+    else
+    {
+        u8g2_ClearBuffer(u8g2);
+        u8g2_ClearDisplay(u8g2);
+        u8g2_SendBuffer(u8g2);
+    }
     u8g2_SetFont(u8g2, u8g2_font_ncenB08_tr);
+    /* Checked once here; without a valid pack the image screens stay blank */
+    if (Asset_Init() != 0)
+    {
+        Log_Write(LOG_FMT_ASSET_PACK_INVALID, ASSET_PACK_ADDRESS, ASSET_COUNT);
+    }
+    ScreenRegistry_Init();
+    for (uint32_t mode = 0; mode < DISPLAY_MODE_COUNT; mode++)
+    {
+        const Screen_t *screen = ScreenRegistry_Get((DisplayMode_t)mode);
+        oled_screen_period_ms[mode] = (screen->fps != 0U) ? (1000U / screen->fps) : 0U;
+    }
 
-    static uint32_t last_update = 0;
+    uint32_t last_update = 0;
+    bool redraw = true;
+    OLED_EnterMode(current_display_mode, current_display_mode, osKernelGetTickCount());
     while (1)
     {
-        DisplayMode_t new_mode;
-        osStatus_t status = osMessageQueueGet(display_mode_queue, &new_mode, NULL, OLED_ANIMATION_DELAY_MS);
+        uint32_t current_time = osKernelGetTickCount();
+        if (Anim_Update(current_time))
+        {
+            redraw = true;
+        }
+        const Screen_t *screen = ScreenRegistry_Get(current_display_mode);
+        /* A stream deadline only means "call its update", which happens below */
+        if ((screen->kind != SCREEN_STREAM) && (OLED_NextWait(current_time, last_update) == 0U))
+        {
+            redraw = true;
+        }
 
-        if (status == osOK)
+        /* The HUD is a region of its own; a stream owns the whole buffer */
+        bool hud_changed = (PerfHUD_Update(current_time) != 0U) && (screen->kind != SCREEN_STREAM);
+        if (!redraw && (screen->widgets != NULL) && Widget_AnyDirty(screen->widgets, screen->widget_count))
         {
-            current_display_mode = new_mode;
-            u8g2_ClearBuffer(u8g2);
+            if (oled_anim_shown)
+            {
+                /* Drawn over the widgets: redrawing a box would erase it */
+                redraw = true;
+            }
+            else
+            {
+                (void)OLED_DrawDirty(u8g2, screen->widgets, screen->widget_count);
+                last_update = current_time;
+                hud_changed = false;
+            }
+        }
+        if (!redraw && hud_changed)
+        {
+            (void)OLED_DrawDirty(u8g2, NULL, 0);
         }
 
-        uint32_t current_time = osKernelGetTickCount();
-        if (current_time - last_update >= OLED_ANIMATION_DELAY_MS)
+        if (redraw)
         {
-            u8g2_ClearBuffer(u8g2);  
-            switch (current_display_mode)
+            u8g2_ClearBuffer(u8g2);
+            PerfHUD_FrameStart();
+            TRACE_EVENT(TRACE_EVT_RENDER_START, current_display_mode, 0);
+            OLED_RenderScreen(u8g2, screen);
+            Anim_Draw(u8g2);
+            TRACE_EVENT(TRACE_EVT_RENDER_END, current_display_mode, 0);
+            PerfHUD_Draw(u8g2, NULL);
+            TRACE_EVENT(TRACE_EVT_FLUSH_START, 0, 0);
+            (void)OLED_FlushFrame(u8g2, current_display_mode, NULL);
+            TRACE_EVENT(TRACE_EVT_FLUSH_END, 0, 0);
+            PerfHUD_FrameEnd();
+            TRACE_EVENT(TRACE_EVT_TILES_SENT, 0,
+                        u8g2_GetBufferTileWidth(u8g2) * u8g2_GetBufferTileHeight(u8g2));
+            if (oled_prof_report_pending)
             {
-                case DISPLAY_MODE_BONGO:
-                    DrawBongoCat(u8g2);
-                    break;
-                case DISPLAY_MODE_QRCODE:
-                    DrawQRCode(u8g2);
-                    break;
-                case DISPLAY_MODE_INFO:
-                default:
-                    DrawInfoScreen(u8g2);
-                    break;
+                oled_prof_report_pending = 0;
+                U8G2_Prof_Report(OLED_ProfOut);
             }
-            u8g2_SendBuffer(u8g2);
             last_update = current_time;
+            redraw = false;
+        }
+
+        if (screen->kind == SCREEN_STREAM)
+        {
+            DisplayMode_t next = OLED_StreamStep(u8g2, screen, osKernelGetTickCount());
+            if (next != current_display_mode)
+            {
+                /* The stream ended: show the screen it asks for */
+                redraw = OLED_ShowMode(next, osKernelGetTickCount());
+                continue;
+            }
+        }
+
+        /* The buffer now equals the panel */
+        FbMirror_Update(u8g2_GetBufferPtr(u8g2), oled_last_flush_tick, osKernelGetTickCount());
+
+        /* Sleep until the next frame, mirror packet or HUD update is due; a message wakes the task early */
+        DisplayCmd_t cmd;
+        uint32_t wait = OLED_NextWait(osKernelGetTickCount(), last_update);
+        uint32_t mirror_wait = FbMirror_NextWait(osKernelGetTickCount());
+        uint32_t hud_wait = PerfHUD_NextDue(osKernelGetTickCount());
+        if (mirror_wait < wait)
+        {
+            wait = mirror_wait;
+        }
+        if (hud_wait < wait)
+        {
+            wait = hud_wait;
+        }
+        if (osMessageQueueGet(display_cmd_queue, &cmd, NULL, wait) == osOK)
+        {
+            /* Apply the whole burst before drawing; bounded so a flooding sender cannot starve the panel */
+            uint32_t applied = 0;
+            do
+            {
+                if (OLED_ApplyCommand(&cmd, osKernelGetTickCount()))
+                {
+                    redraw = true;
+                }
+                applied++;
+            } while ((applied < OLED_DISPLAY_CMD_QUEUE_SIZE) &&
+                     (osMessageQueueGet(display_cmd_queue, &cmd, NULL, 0) == osOK));
+        }
+    }
+}
+
+/**
+ * @brief  Print the I2C cost of the last frame of each display mode over UART3.
+ *
+ * For every mode that has been shown, prints the START/address/control/payload/ACK counts of
+ * its last frame, the predicted wire time and bus-bound frame rate at 100 kHz, 400 kHz and
+ * 1 MHz, and the measured flush time at the configured bus speed. The counters are written by
+ * the display task, so a row can mix two frames if it flushes while the report runs. Then
+ * lists the registered screens: kind, live refresh rate and widget count. The RAM of each
+ * screen's state is in the map file, per object (Tools/map_report.py --by object).
+ *
+ * @return None
+ */
+void OLED_Task_PrintBusReport(void)
+{
+    static const uint32_t bus_hz[] = { I2C_COST_STANDARD_HZ, I2C_COST_FAST_HZ, I2C_COST_FAST_PLUS_HZ };
+    char line[BUS_REPORT_LINE_LEN];
+    int len;
+
+    len = snprintf(line, sizeof(line),
+                   "Screen   Starts  Ctrl  Payload   ACK |  100k us  fps |  400k us  fps |"
+                   "    1M us  fps | meas us\r\n");
+    UART_TX_Write((const uint8_t *)line, (size_t)len);
+
+    for (uint32_t mode = 0; mode < DISPLAY_MODE_COUNT; mode++)
+    {
+        I2cBusCost_t frame = oled_frame_cost[mode];
+        if (frame.starts == 0U)
+        {
+            continue;
+        }
+
+        len = snprintf(line, sizeof(line), "%-7s %7lu %5lu %8lu %5lu",
+                       ScreenRegistry_Get((DisplayMode_t)mode)->name, (unsigned long)frame.starts,
+                       (unsigned long)frame.control_bytes, (unsigned long)frame.payload_bytes,
+                       (unsigned long)frame.ack_bits);
+        for (uint32_t i = 0; i < (sizeof(bus_hz) / sizeof(bus_hz[0])); i++)
+        {
+            uint32_t fps_x10 = I2C_Cost_MaxFpsX10(&frame, bus_hz[i]);
+            len += snprintf(line + len, sizeof(line) - (size_t)len, " | %8lu %3lu.%lu",
+                            (unsigned long)I2C_Cost_BusTimeUs(&frame, bus_hz[i]),
+                            (unsigned long)(fps_x10 / 10U), (unsigned long)(fps_x10 % 10U));
         }
+        len += snprintf(line + len, sizeof(line) - (size_t)len, " | %7lu\r\n",
+                        (unsigned long)oled_frame_flush_us[mode]);
+        UART_TX_Write((const uint8_t *)line, (size_t)len);
+    }
+
+    len = snprintf(line, sizeof(line), "Screen  Kind      FPS  Widgets\r\n");
+    UART_TX_Write((const uint8_t *)line, (size_t)len);
+    for (uint32_t mode = 0; mode < DISPLAY_MODE_COUNT; mode++)
+    {
+        const Screen_t *screen = ScreenRegistry_Get((DisplayMode_t)mode);
+        uint32_t period = oled_screen_period_ms[mode];
+        len = snprintf(line, sizeof(line), "%-7s %-8s %4lu %8u\r\n", screen->name,
+                       ScreenRegistry_KindName(screen->kind),
+                       (unsigned long)((period != 0U) ? (1000U / period) : 0U),
+                       (unsigned int)screen->widget_count);
+        UART_TX_Write((const uint8_t *)line, (size_t)len);
     }
 }
 
 /**
- * @brief Draw the bongo cat animation frame on the OLED.
+ * @brief  Print the u8g2 per-primitive profile after the current frame.
  *
- * This function toggles between two bongo cat frames to create a simple animation effect.
- * It should be called every 200ms from the display task loop.
+ * The display task writes the table (U8G2_Prof_Report()) between two frames, so every row
+ * covers whole frames since the previous report, and then clears it.
  *
- * @param u8g2 Pointer to the u8g2 display structure.
  * @return None
  */
-static void DrawBongoCat(u8g2_t *u8g2)
+void OLED_Task_RequestProfileReport(void)
 {
-    static bool frame = false;
-    u8g2_DrawXBMP(u8g2, 13, 0, BONGO_WIDTH, IMAGE_HEIGHT, frame ? gImage_bongo_cat_1 : gImage_bongo_cat_2);
-    frame = !frame;
+    oled_prof_report_pending = 1;
+    OLED_Task_Refresh();
 }
 
 /**
- * @brief Draw the QR code screen on the OLED.
+ * @brief  Wake the display task to redraw the current screen.
  *
- * This function draws a QR code image and several descriptive text lines at calculated positions.
+ * Sleeping screens are only redrawn on demand, so anything that changes what the next frame
+ * shows outside the display task (HUD toggle, profile request) calls this.
  *
- * @param u8g2 Pointer to the u8g2 display structure.
  * @return None
  */
-static void DrawQRCode(u8g2_t *u8g2)
+void OLED_Task_Refresh(void)
+{
+    (void)DisplayCmd_Refresh();
+}
+
+/**
+ * @brief Output function of the u8g2 profile report.
+ * @param s NUL-terminated text.
+ * @return None
+ */
+static void OLED_ProfOut(const char *s)
+{
+    UART_TX_Write((const uint8_t *)s, strlen(s));
+}
+
+/**
+ * @brief Let a stream screen update the buffer and send the tiles it changed.
+ *
+ * The buffer holds the last frame sent; the update callback writes into it and marks the tiles
+ * it changed, which are sent if there are any.
+ *
+ * @param u8g2   Pointer to the u8g2 display structure.
+ * @param screen Current screen (SCREEN_STREAM).
+ * @param now    Current tick (ms).
+ * @return Display mode to show: the current one while the stream runs.
+ */
+static DisplayMode_t OLED_StreamStep(u8g2_t *u8g2, const Screen_t *screen, uint32_t now)
+{
+    VideoTiles_t dirty;
+    uint32_t changed = 0;
+
+    if (screen->update == NULL)
+    {
+        return current_display_mode;
+    }
+    memset(&dirty, 0, sizeof(dirty));
+    DisplayMode_t next = screen->update(u8g2, &dirty, now);
+    for (uint32_t page = 0; page < VIDEO_PAGES; page++)
+    {
+        changed |= dirty.rows[page];
+    }
+    if (changed != 0U)
+    {
+        TRACE_EVENT(TRACE_EVT_FLUSH_START, 0, 0);
+        uint32_t tiles = OLED_FlushFrame(u8g2, current_display_mode, &dirty);
+        TRACE_EVENT(TRACE_EVT_FLUSH_END, 0, 0);
+        TRACE_EVENT(TRACE_EVT_TILES_SENT, 0, tiles);
+        (void)tiles;
+    }
+    return next;
+}
+
+/**
+ * @brief Flush the buffer (or some of its tiles) and record the bus cost of the frame.
+ *
+ * The difference of the driver counters around the transfer is the cost of exactly one
+ * frame, kept per display mode for OLED_Task_PrintBusReport(). The end of the transfer is
+ * the time stamp of the frame for the framebuffer mirror.
+ *
+ * @param u8g2  Pointer to the u8g2 display structure.
+ * @param mode  Display mode the frame belongs to.
+ * @param tiles Tiles to send (Video_UpdateDisplay()), or NULL for the whole buffer.
+ * @return Number of tiles sent.
+ */
+static uint32_t OLED_FlushFrame(u8g2_t *u8g2, DisplayMode_t mode, const VideoTiles_t *tiles)
+{
+    I2cBusCost_t before;
+    I2cBusCost_t after;
+    uint32_t sent;
+
+    OLED_GetBusCost(&before);
+    uint32_t start = DWT_Timer_GetCycles();
+    if (tiles == NULL)
+    {
+        u8g2_SendBuffer(u8g2);
+        sent = (uint32_t)u8g2_GetBufferTileWidth(u8g2) * u8g2_GetBufferTileHeight(u8g2);
+    }
+    else
+    {
+        sent = Video_UpdateDisplay(u8g2, tiles);
+    }
+    uint32_t cycles = DWT_Timer_GetCycles() - start;
+    OLED_GetBusCost(&after);
+    oled_last_flush_tick = osKernelGetTickCount();
+
+    if ((uint32_t)mode < DISPLAY_MODE_COUNT)
+    {
+        I2C_Cost_Diff(&after, &before, &oled_frame_cost[mode]);
+        oled_frame_flush_us[mode] = DWT_Timer_CyclesToUs(cycles);
+    }
+    return sent;
+}
+
+/**
+ * @brief Show a display mode (entering it if it is not the current one).
+ *
+ * The screen being left gets its exit callback, the new one learns which screen it follows.
+ * Showing the current mode again redraws it without restarting its animations, except for a
+ * stream, where the buffer holds the video and the message only wakes the task.
+ *
+ * @param mode Display mode.
+ * @param now  Current tick (ms).
+ * @return true if the screen has to be redrawn.
+ */
+static bool OLED_ShowMode(DisplayMode_t mode, uint32_t now)
 {
-    u8g2_DrawXBMP(u8g2, 0, 0, IMAGE_WIDTH, IMAGE_HEIGHT, gImage_img_qrcode);
-    u8g2_DrawStr(u8g2, 70, TEXT_OFFSET_Y, "QRcode");
-    u8g2_DrawStr(u8g2, 70, TEXT_OFFSET_Y + TEXT_OFFSET_Y, "scan can");
-    u8g2_DrawStr(u8g2, 70, TEXT_OFFSET_Y + 2 * TEXT_OFFSET_Y, "link to");
-    u8g2_DrawStr(u8g2, 70, TEXT_OFFSET_Y + 3 * TEXT_OFFSET_Y, "Youtube");
+    const Screen_t *screen = ScreenRegistry_Get(mode);
+    bool redraw = (mode != current_display_mode) || (screen->kind != SCREEN_STREAM);
+
+    if (mode != current_display_mode)
+    {
+        DisplayMode_t previous = current_display_mode;
+        const Screen_t *left = ScreenRegistry_Get(previous);
+        if (left->exit != NULL)
+        {
+            left->exit();
+        }
+        current_display_mode = mode;
+        OLED_EnterMode(mode, previous, now);
+    }
+    return redraw;
 }
 
 /**
- * @brief Draw the info/welcome screen on the OLED.
+ * @brief Apply one display command to the screen state.
  *
- * This function draws a welcome message and additional info text on the OLED display.
+ * Screen changes, refreshes, animations, the refresh rate and the contrast are handled here;
+ * texts, values and images go to the screen they belong to (ScreenRegistry_Dispatch()). A
+ * screen invalidates the widgets showing a changed text or value, and the task redraws just
+ * those widgets when the screen is shown. Commands with an unusable id are logged and dropped.
  *
- * @param u8g2 Pointer to the u8g2 display structure.
+ * @param cmd Command; a text payload may be taken over (cmd->text cleared).
+ * @param now Current tick (ms).
+ * @return true if the current screen has to be redrawn.
+ */
+static bool OLED_ApplyCommand(DisplayCmd_t *cmd, uint32_t now)
+{
+    bool redraw = false;
+
+    switch (cmd->type)
+    {
+        case DISPLAY_CMD_SHOW:
+            if (cmd->id < (uint16_t)DISPLAY_MODE_COUNT)
+            {
+                redraw = OLED_ShowMode((DisplayMode_t)cmd->id, now);
+            }
+            break;
+        case DISPLAY_CMD_REFRESH:
+            redraw = (ScreenRegistry_Get(current_display_mode)->kind != SCREEN_STREAM);
+            break;
+        case DISPLAY_CMD_START_ANIM:
+        {
+            /* A stream owns the buffer; animations stop with the screen they run on */
+            AnimDesc_t anim;
+            if ((ScreenRegistry_Get(current_display_mode)->kind == SCREEN_STREAM) ||
+                (Anim_FromAsset(&anim, cmd->id, cmd->x, cmd->y) != 0) ||
+                (Anim_Start(&anim, now) == ANIM_HANDLE_NONE))
+            {
+                Log_Write(LOG_FMT_DISPLAY_CMD_REJECTED, cmd->type, cmd->id);
+                break;
+            }
+            oled_anim_shown = true;
+            redraw = true;
+            break;
+        }
+        case DISPLAY_CMD_SET_FPS:
+            /* The next wait is computed from the new period */
+            if ((cmd->value > 0) && (cmd->value <= OLED_REFRESH_FPS_MAX))
+            {
+                for (uint32_t mode = 0; mode < DISPLAY_MODE_COUNT; mode++)
+                {
+                    if (ScreenRegistry_Get((DisplayMode_t)mode)->kind == SCREEN_LIVE)
+                    {
+                        oled_screen_period_ms[mode] = 1000U / (uint32_t)cmd->value;
+                    }
+                }
+            }
+            break;
+        case DISPLAY_CMD_SET_CONTRAST:
+            u8g2_SetContrast(OLED_GetDisplay(), (uint8_t)cmd->value);
+            break;
+        default:
+        {
+            DisplayMode_t target;
+            switch (ScreenRegistry_Dispatch(cmd, &target))
+            {
+                case SCREEN_EVT_REDRAW:
+                    redraw = (target == current_display_mode);
+                    break;
+                case SCREEN_EVT_SHOW:
+                    redraw = OLED_ShowMode(target, now);
+                    break;
+                case SCREEN_EVT_REJECTED:
+                    Log_Write(LOG_FMT_DISPLAY_CMD_REJECTED, cmd->type, cmd->id);
+                    break;
+                default:
+                    break;
+            }
+            break;
+        }
+    }
+    DisplayCmd_Release(cmd);
+    return redraw;
+}
+
+/**
+ * @brief Stop the animations of the previous screen and enter a new one (enter callback).
+ * @param mode     Display mode being entered.
+ * @param previous Display mode left (mode itself at start-up).
+ * @param now      Current tick (ms).
  * @return None
  */
-static void DrawInfoScreen(u8g2_t *u8g2)
+static void OLED_EnterMode(DisplayMode_t mode, DisplayMode_t previous, uint32_t now)
+{
+    const Screen_t *screen = ScreenRegistry_Get(mode);
+
+    Anim_StopAll();
+    oled_anim_shown = false;
+    if (screen->enter != NULL)
+    {
+        screen->enter(previous, now);
+    }
+}
+
+/**
+ * @brief Draw the whole current screen into the cleared buffer: its widgets, then its render callback.
+ * @param u8g2   Pointer to the u8g2 display structure.
+ * @param screen Current screen.
+ * @return None
+ */
+static void OLED_RenderScreen(u8g2_t *u8g2, const Screen_t *screen)
+{
+    if (screen->widgets != NULL)
+    {
+        Widget_DrawAll(u8g2, screen->widgets, screen->widget_count);
+    }
+    if (screen->render != NULL)
+    {
+        screen->render(u8g2);
+    }
+}
+
+/**
+ * @brief Redraw the invalidated widgets and/or the HUD box and send only their tiles.
+ *
+ * The buffer still holds the last frame of the screen; each redrawn widget clears its own box
+ * first (Widget_DrawDirty()). A dashboard value costs the 8 tiles of its line instead of 128.
+ * The HUD box is opaque and drawn last, so it is redrawn over the widgets and its tiles are
+ * added. The HUD counts redrawn widgets as a frame; a HUD-only update is not a frame of the
+ * screen, so it is neither measured nor recorded as the screen's bus cost.
+ *
+ * @param u8g2    Pointer to the u8g2 display structure.
+ * @param widgets Widgets of the current screen, or NULL to redraw only the HUD.
+ * @param count   Number of widgets.
+ * @return Number of tiles sent.
+ */
+static uint32_t OLED_DrawDirty(u8g2_t *u8g2, Widget_t *widgets, size_t count)
 {
-    u8g2_DrawStr(u8g2, 0, TEXT_OFFSET_Y, OLED_WELCOME_MESSAGE);
-    u8g2_DrawStr(u8g2, 0, TEXT_OFFSET_Y + TEXT_OFFSET_Y, "My name is Ted.");
-    u8g2_DrawStr(u8g2, 0, TEXT_OFFSET_Y + 2 * TEXT_OFFSET_Y, "How are you doing?");
+    VideoTiles_t tiles;
+
+    memset(&tiles, 0, sizeof(tiles));
+    if (widgets == NULL)
+    {
+        PerfHUD_DrawOverlay(u8g2, &tiles);
+        return OLED_FlushFrame(u8g2, DISPLAY_MODE_COUNT, &tiles);
+    }
+    PerfHUD_FrameStart();
+    TRACE_EVENT(TRACE_EVT_RENDER_START, current_display_mode, 0);
+    (void)Widget_DrawDirty(u8g2, widgets, count, &tiles);
+    TRACE_EVENT(TRACE_EVT_RENDER_END, current_display_mode, 0);
+    PerfHUD_Draw(u8g2, &tiles);
+    TRACE_EVENT(TRACE_EVT_FLUSH_START, 0, 0);
+    uint32_t sent = OLED_FlushFrame(u8g2, current_display_mode, &tiles);
+    TRACE_EVENT(TRACE_EVT_FLUSH_END, 0, 0);
+    PerfHUD_FrameEnd();
+    TRACE_EVENT(TRACE_EVT_TILES_SENT, 0, sent);
+    return sent;
+}
+
+/**
+ * @brief Time the display task may sleep before the next redraw is due.
+ *
+ * The earlier of the next animation frame and, for a live screen, the next refresh (its
+ * period). Static screens wait for the queue only; the HUD adds its own deadline in the task
+ * loop, which redraws only the HUD box. A stream is woken through the queue by whatever feeds it
+ * (the RX interrupt for the video sink); its deadline comes from its next_due callback.
+ *
+ * @param now         Current tick (ms).
+ * @param last_update Tick of the last redraw.
+ * @return Queue timeout (ms or osWaitForever).
+ */
+static uint32_t OLED_NextWait(uint32_t now, uint32_t last_update)
+{
+    const Screen_t *screen = ScreenRegistry_Get(current_display_mode);
+    uint32_t wait = Anim_NextDue(now);
+    uint32_t period = 0;
+
+    if (screen->kind == SCREEN_STREAM)
+    {
+        return (screen->next_due != NULL) ? screen->next_due(now) : osWaitForever;
+    }
+    if (screen->kind == SCREEN_LIVE)
+    {
+        period = oled_screen_period_ms[current_display_mode];
+    }
+    if (period != 0U)
+    {
+        uint32_t elapsed = now - last_update;
+        uint32_t refresh = (elapsed < period) ? (period - elapsed) : 0U;
+        if (refresh < wait)
+        {
+            wait = refresh;
+        }
+    }
+    return (wait == ANIM_NO_DEADLINE) ? osWaitForever : wait;
 }
@@ -0,0 +1,56 @@
+/**
+ * @file    screen_bongo.c
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Bongo cat screen: the "bongo_cat" animation of the asset pack.
+ *
+ * @details
+ * The screen has no state of its own; the animation player (anim.h) keeps the running
+ * animation and wakes the display task at its frame durations.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "screen_registry.h"
+#include "anim.h"
+#include "oled_driver.h"
+#include "asset_pack.h"
+#include "../Image/asset_ids.h"
+
+/**
+ * @defgroup SCREEN_BONGO_Private_Functions Bongo Cat Screen Private Functions
+ * @{
+ */
+/**
+ * @brief Start the bongo cat animation, centred horizontally
+ * @param previous Screen shown before (unused)
+ * @param now      Current tick (ms)
+ */
+static void Bongo_Enter(DisplayMode_t previous, uint32_t now);
+/** @} */
+
+/** Bongo cat screen */
+const Screen_t screen_bongo = {
+    .name = "bongo", .kind = SCREEN_ANIMATED,
+    .enter = Bongo_Enter
+};
+
+
+/**
+ * @brief Start the bongo cat animation: the "bongo_cat" asset, centred horizontally, from its first frame.
+ * @param previous Screen shown before (unused).
+ * @param now      Current tick (ms).
+ * @return None
+ */
+static void Bongo_Enter(DisplayMode_t previous, uint32_t now)
+{
+    const AssetEntry_t *entry = Asset_Get(ASSET_ID_BONGO_CAT);
+    u8g2_uint_t width = u8g2_GetDisplayWidth(OLED_GetDisplay());
+    AnimDesc_t bongo;
+
+    (void)previous;
+    if ((entry != NULL) && (entry->width <= width) &&
+        (Anim_FromAsset(&bongo, ASSET_ID_BONGO_CAT, (u8g2_uint_t)((width - entry->width) / 2U), 0) == 0))
+    {
+        (void)Anim_Start(&bongo, now);
+    }
+}
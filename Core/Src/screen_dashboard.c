@@ -0,0 +1,88 @@
+/**
+ * @file    screen_dashboard.c
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Dashboard screen: 8 labelled values in 4 rows of 2.
+ *
+ * @details
+ * The screen owns the label fields (DISPLAY_TEXT_LABEL_0 on) and the values set with
+ * DisplayCmd_SetValue(). Each label and value is a widget, so a new value redraws just its box.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "screen_registry.h"
+#include "screens.h"
+
+/**
+ * @defgroup SCREEN_DASH_Private_Variables Dashboard Screen Private Variables
+ * @{
+ */
+/** Texts of the label fields */
+static const char *dash_label[SCREENS_DASHBOARD_VALUES] = {
+    "CH1", "CH2", "CH3", "CH4", "CH5", "CH6", "CH7", "CH8"
+};
+/** MEM_POOL_TEXT block behind each label, NULL while it shows its default */
+static char *dash_label_block[SCREENS_DASHBOARD_VALUES];
+/** Widgets of the dashboard (label fields and values) */
+static Widget_t dash_widgets[SCREENS_DASHBOARD_WIDGETS];
+/** @} */
+
+/**
+ * @defgroup SCREEN_DASH_Private_Functions Dashboard Screen Private Functions
+ * @{
+ */
+/**
+ * @brief Set up the dashboard widgets
+ */
+static void Dashboard_Init(void);
+/**
+ * @brief Take the dashboard labels and values
+ * @param cmd Command
+ * @return Answer of the screen
+ */
+static ScreenEventResult_t Dashboard_OnEvent(DisplayCmd_t *cmd);
+/** @} */
+
+/** Dashboard screen */
+const Screen_t screen_dashboard = {
+    .name = "dash", .kind = SCREEN_STATIC,
+    .widgets = dash_widgets, .widget_count = SCREENS_DASHBOARD_WIDGETS,
+    .init = Dashboard_Init, .on_event = Dashboard_OnEvent
+};
+
+
+/**
+ * @brief Set up the dashboard widgets: the 5x7 font, label fields, values 0.
+ * @return None
+ */
+static void Dashboard_Init(void)
+{
+    static const int32_t zero_values[SCREENS_DASHBOARD_VALUES];
+
+    Screens_InitDashboardWidgets(dash_widgets, u8g2_font_5x7_tr, dash_label, zero_values);
+}
+
+/**
+ * @brief Take the dashboard labels and values.
+ * @param cmd Command.
+ * @return SCREEN_EVT_DONE for a label text or a value, else SCREEN_EVT_IGNORED.
+ */
+static ScreenEventResult_t Dashboard_OnEvent(DisplayCmd_t *cmd)
+{
+    if ((cmd->type == DISPLAY_CMD_SET_TEXT) && (cmd->field >= (uint8_t)DISPLAY_TEXT_LABEL_0) &&
+        (cmd->field < (uint8_t)DISPLAY_TEXT_COUNT))
+    {
+        uint32_t index = cmd->field - (uint32_t)DISPLAY_TEXT_LABEL_0;
+        if (ScreenRegistry_TakeText(cmd, &dash_label[index], &dash_label_block[index]))
+        {
+            Widget_SetText(&dash_widgets[SCREENS_DASHBOARD_LABEL(index)], dash_label[index]);
+        }
+        return SCREEN_EVT_DONE;
+    }
+    if ((cmd->type == DISPLAY_CMD_SET_VALUE) && (cmd->field < DISPLAY_VALUE_COUNT))
+    {
+        Widget_SetValue(&dash_widgets[SCREENS_DASHBOARD_VALUE(cmd->field)], cmd->value);
+        return SCREEN_EVT_DONE;
+    }
+    return SCREEN_EVT_IGNORED;
+}
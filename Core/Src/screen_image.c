@@ -0,0 +1,78 @@
+/**
+ * @file    screen_image.c
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Image screen: one image asset of the pack, centred.
+ *
+ * @details
+ * DisplayCmd_ShowImage() chooses the asset and switches to the screen; without a valid asset
+ * pack the screen stays blank.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "screen_registry.h"
+#include "screens.h"
+#include "asset_pack.h"
+#include "../Image/asset_ids.h"
+
+/**
+ * @defgroup SCREEN_IMAGE_Private_Variables Image Screen Private Variables
+ * @{
+ */
+/** Asset shown by the image screen */
+static AssetId_t image_id = ASSET_ID_QR_STATIC;
+/** @} */
+
+/**
+ * @defgroup SCREEN_IMAGE_Private_Functions Image Screen Private Functions
+ * @{
+ */
+/**
+ * @brief Draw the chosen image, centred
+ * @param u8g2 Pointer to the u8g2 display structure
+ */
+static void Image_Render(u8g2_t *u8g2);
+/**
+ * @brief Take the image to show
+ * @param cmd Command
+ * @return Answer of the screen
+ */
+static ScreenEventResult_t Image_OnEvent(DisplayCmd_t *cmd);
+/** @} */
+
+/** Image screen */
+const Screen_t screen_image = {
+    .name = "image", .kind = SCREEN_STATIC,
+    .render = Image_Render, .on_event = Image_OnEvent
+};
+
+
+/**
+ * @brief Draw the chosen image, centred (blank without a valid asset pack).
+ * @param u8g2 Pointer to the u8g2 display structure.
+ * @return None
+ */
+static void Image_Render(u8g2_t *u8g2)
+{
+    (void)Screens_DrawImageCentered(u8g2, image_id);
+}
+
+/**
+ * @brief Take the image to show and ask to be shown.
+ * @param cmd Command.
+ * @return SCREEN_EVT_SHOW, SCREEN_EVT_REJECTED for an id that is not an image, or SCREEN_EVT_IGNORED.
+ */
+static ScreenEventResult_t Image_OnEvent(DisplayCmd_t *cmd)
+{
+    if (cmd->type != DISPLAY_CMD_SHOW_IMAGE)
+    {
+        return SCREEN_EVT_IGNORED;
+    }
+    const AssetEntry_t *entry = Asset_Get(cmd->id);
+    if ((entry == NULL) || (entry->type != ASSET_TYPE_IMAGE))
+    {
+        return SCREEN_EVT_REJECTED;
+    }
+    image_id = cmd->id;
+    return SCREEN_EVT_SHOW;
+}
@@ -0,0 +1,81 @@
+/**
+ * @file    screen_info.c
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Info screen: the welcome message and two more lines of text.
+ *
+ * @details
+ * The screen owns the info text fields (DISPLAY_TEXT_INFO_0 up to DISPLAY_TEXT_LABEL_0). A field
+ * shows its default until a SET_TEXT command replaces it; the new text stays in the pool block
+ * of the command until the next one.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "screen_registry.h"
+#include "screens.h"
+
+/**
+ * @defgroup SCREEN_INFO_Private_Variables Info Screen Private Variables
+ * @{
+ */
+/** Texts of the info fields */
+static const char *info_text[SCREENS_INFO_LINES] = {
+    OLED_WELCOME_MESSAGE, OLED_INFO_NAME, OLED_INFO_GREETING
+};
+/** MEM_POOL_TEXT block behind each info field, NULL while it shows its default */
+static char *info_text_block[SCREENS_INFO_LINES];
+/** Widgets of the info screen (texts of the info fields) */
+static Widget_t info_widgets[SCREENS_INFO_WIDGETS];
+/** @} */
+
+/**
+ * @defgroup SCREEN_INFO_Private_Functions Info Screen Private Functions
+ * @{
+ */
+/**
+ * @brief Set up the info screen widgets
+ */
+static void Info_Init(void);
+/**
+ * @brief Take the texts of the info fields
+ * @param cmd Command
+ * @return Answer of the screen
+ */
+static ScreenEventResult_t Info_OnEvent(DisplayCmd_t *cmd);
+/** @} */
+
+/** Info screen */
+const Screen_t screen_info = {
+    .name = "info", .kind = SCREEN_STATIC,
+    .widgets = info_widgets, .widget_count = SCREENS_INFO_WIDGETS,
+    .init = Info_Init, .on_event = Info_OnEvent
+};
+
+
+/**
+ * @brief Set up the info screen widgets.
+ * @return None
+ */
+static void Info_Init(void)
+{
+    Screens_InitInfoWidgets(info_widgets, info_text);
+}
+
+/**
+ * @brief Take the texts of the info fields.
+ * @param cmd Command.
+ * @return SCREEN_EVT_DONE for a text of an info field, else SCREEN_EVT_IGNORED.
+ */
+static ScreenEventResult_t Info_OnEvent(DisplayCmd_t *cmd)
+{
+    if ((cmd->type != DISPLAY_CMD_SET_TEXT) || (cmd->field >= (uint8_t)DISPLAY_TEXT_LABEL_0))
+    {
+        return SCREEN_EVT_IGNORED;
+    }
+    uint32_t line = cmd->field - (uint32_t)DISPLAY_TEXT_INFO_0;
+    if (ScreenRegistry_TakeText(cmd, &info_text[line], &info_text_block[line]))
+    {
+        Widget_SetText(&info_widgets[line], info_text[line]);
+    }
+    return SCREEN_EVT_DONE;
+}
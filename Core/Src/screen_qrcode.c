@@ -0,0 +1,78 @@
+/**
+ * @file    screen_qrcode.c
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   QR code screen: the symbol of OLED_QR_PAYLOAD or of the last SET_QR command.
+ *
+ * @details
+ * The page is a widget tree (Screens_InitQRWidgets()); a new payload is encoded at once and
+ * only the symbol widget is invalidated.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "screen_registry.h"
+#include "screens.h"
+
+/**
+ * @defgroup SCREEN_QR_Private_Variables QR Code Screen Private Variables
+ * @{
+ */
+/** Widgets of the QR page */
+static Widget_t qr_widgets[SCREENS_QR_WIDGETS];
+/** @} */
+
+/**
+ * @defgroup SCREEN_QR_Private_Functions QR Code Screen Private Functions
+ * @{
+ */
+/**
+ * @brief Set up the QR page widgets
+ */
+static void QR_Init(void);
+/**
+ * @brief Encode a new QR code payload
+ * @param cmd Command
+ * @return Answer of the screen
+ */
+static ScreenEventResult_t QR_OnEvent(DisplayCmd_t *cmd);
+/** @} */
+
+/** QR code screen */
+const Screen_t screen_qrcode = {
+    .name = "qrcode", .kind = SCREEN_STATIC,
+    .widgets = qr_widgets, .widget_count = SCREENS_QR_WIDGETS,
+    .init = QR_Init, .on_event = QR_OnEvent
+};
+
+
+/**
+ * @brief Set up the QR page widgets.
+ * @return None
+ */
+static void QR_Init(void)
+{
+    Screens_InitQRWidgets(qr_widgets);
+}
+
+/**
+ * @brief Encode a new QR code payload and invalidate the symbol widget.
+ *
+ * The payload block stays with the command (freed with it): the symbol keeps its own copy.
+ *
+ * @param cmd Command.
+ * @return SCREEN_EVT_DONE, SCREEN_EVT_REJECTED for a payload that does not fit, or SCREEN_EVT_IGNORED.
+ */
+static ScreenEventResult_t QR_OnEvent(DisplayCmd_t *cmd)
+{
+    if (cmd->type != DISPLAY_CMD_SET_QR)
+    {
+        return SCREEN_EVT_IGNORED;
+    }
+    if ((cmd->text == NULL) ||
+        (Screens_SetQRPayload((const uint8_t *)cmd->text, (size_t)cmd->value) != 0))
+    {
+        return SCREEN_EVT_REJECTED;
+    }
+    Widget_Invalidate(&qr_widgets[0]);
+    return SCREEN_EVT_DONE;
+}
@@ -0,0 +1,135 @@
+/**
+ * @file    screen_registry.c
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Screen registry: the table of screen descriptors dispatched by the display task.
+ *
+ * @details
+ * Each screen keeps its state in its own file (Core/Src/screen_*.c) and is reached only through
+ * its descriptor in screen_table, from the display task. The registry also holds the helper the
+ * screens with text fields share.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "screen_registry.h"
+#include "mem_pool.h"
+#include "string.h"
+
+/**
+ * @defgroup SCREEN_Private_Variables Screen Registry Private Variables
+ * @{
+ */
+/** The screens, indexed by DisplayMode_t */
+static const Screen_t *const screen_table[DISPLAY_MODE_COUNT] = {
+    [DISPLAY_MODE_BONGO] = &screen_bongo,
+    [DISPLAY_MODE_QRCODE] = &screen_qrcode,
+    [DISPLAY_MODE_INFO] = &screen_info,
+    [DISPLAY_MODE_STATS] = &screen_stats,
+    [DISPLAY_MODE_VIDEO] = &screen_video,
+    [DISPLAY_MODE_DASHBOARD] = &screen_dashboard,
+    [DISPLAY_MODE_IMAGE] = &screen_image
+};
+/** ScreenKind_t names used by the screen report */
+static const char *const screen_kind_names[SCREEN_KIND_COUNT] = {
+    [SCREEN_STATIC] = "static",
+    [SCREEN_ANIMATED] = "animated",
+    [SCREEN_LIVE] = "live",
+    [SCREEN_STREAM] = "stream"
+};
+/** @} */
+
+
+/**
+ * @brief  Set up every screen (init callbacks).
+ * @return None
+ */
+void ScreenRegistry_Init(void)
+{
+    for (uint32_t mode = 0; mode < DISPLAY_MODE_COUNT; mode++)
+    {
+        if (screen_table[mode]->init != NULL)
+        {
+            screen_table[mode]->init();
+        }
+    }
+}
+
+/**
+ * @brief  Descriptor of a display mode.
+ * @param mode Display mode (out-of-range values give the info screen).
+ * @return Screen descriptor.
+ */
+const Screen_t *ScreenRegistry_Get(DisplayMode_t mode)
+{
+    if ((uint32_t)mode >= (uint32_t)DISPLAY_MODE_COUNT)
+    {
+        mode = DISPLAY_MODE_INFO;
+    }
+    return screen_table[mode];
+}
+
+/**
+ * @brief  Offer a display command to every screen until one takes it.
+ *
+ * Every text field, value and image belongs to exactly one screen, which takes the command
+ * whether it is shown or not, so a screen is up to date when it is entered.
+ *
+ * @param cmd    Command; a text payload taken over is cleared (cmd->text = NULL).
+ * @param target Screen that answered (out, DISPLAY_MODE_COUNT if none).
+ * @return Answer of that screen, SCREEN_EVT_IGNORED if none took it.
+ */
+ScreenEventResult_t ScreenRegistry_Dispatch(DisplayCmd_t *cmd, DisplayMode_t *target)
+{
+    for (uint32_t mode = 0; mode < DISPLAY_MODE_COUNT; mode++)
+    {
+        if (screen_table[mode]->on_event == NULL)
+        {
+            continue;
+        }
+        ScreenEventResult_t result = screen_table[mode]->on_event(cmd);
+        if (result != SCREEN_EVT_IGNORED)
+        {
+            *target = (DisplayMode_t)mode;
+            return result;
+        }
+    }
+    *target = DISPLAY_MODE_COUNT;
+    return SCREEN_EVT_IGNORED;
+}
+
+/**
+ * @brief  Name of a screen kind (reports).
+ * @param kind ScreenKind_t.
+ * @return Name, "?" for an unknown kind.
+ */
+const char *ScreenRegistry_KindName(uint8_t kind)
+{
+    return (kind < (uint8_t)SCREEN_KIND_COUNT) ? screen_kind_names[kind] : "?";
+}
+
+/**
+ * @brief  Keep the pool block of a SET_TEXT command as the text of a screen's field.
+ *
+ * The block replaces (and frees) the previous one of the field. An equal text is left in the
+ * command, to be freed with it.
+ *
+ * @param cmd   SET_TEXT command with a text.
+ * @param text  Text shown by the field (in/out).
+ * @param block MEM_POOL_TEXT block behind the field, NULL while it shows its default (in/out).
+ * @return true if the text changed (block taken, cmd->text cleared), false if it is equal.
+ */
+bool ScreenRegistry_TakeText(DisplayCmd_t *cmd, const char **text, char **block)
+{
+    if ((cmd->text == NULL) || (strcmp(*text, cmd->text) == 0))
+    {
+        return false;
+    }
+    if (*block != NULL)
+    {
+        (void)MemPool_Free(MEM_POOL_TEXT, *block);
+    }
+    *block = cmd->text;
+    *text = cmd->text;
+    cmd->text = NULL;
+    return true;
+}
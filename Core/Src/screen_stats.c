@@ -0,0 +1,88 @@
+/**
+ * @file    screen_stats.c
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   RTOS statistics screen: CPU load, context switches and per-task CPU share and free stack.
+ *
+ * @details
+ * A live screen: the display task redraws it every 1/fps seconds (OLED_REFRESH_MS, or the rate
+ * set with DisplayCmd_SetRefreshRate()) and each redraw samples rtos_stats.h.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "screen_registry.h"
+#include "rtos_stats.h"
+#include "stdio.h"
+
+/**
+ * @defgroup SCREEN_STATS_Private_Defines Statistics Screen Private Defines
+ * @{
+ */
+/** Line height of the statistics page (pixels) */
+#define STATS_LINE_HEIGHT 9
+/** Task rows that fit below the statistics page header */
+#define STATS_MAX_ROWS    6
+/** Default refresh rate of the statistics page (frames/s) */
+#define STATS_FPS         (1000 / OLED_REFRESH_MS)
+/** @} */
+
+/**
+ * @defgroup SCREEN_STATS_Private_Variables Statistics Screen Private Variables
+ * @{
+ */
+/** Last sample of the statistics page */
+static RtosStatsReport_t stats_report;
+/** @} */
+
+/**
+ * @defgroup SCREEN_STATS_Private_Functions Statistics Screen Private Functions
+ * @{
+ */
+/**
+ * @brief Draw the RTOS statistics page
+ * @param u8g2 Pointer to the u8g2 display structure
+ */
+static void Stats_Render(u8g2_t *u8g2);
+/** @} */
+
+/** RTOS statistics screen */
+const Screen_t screen_stats = {
+    .name = "stats", .kind = SCREEN_LIVE, .fps = STATS_FPS,
+    .render = Stats_Render
+};
+
+
+/**
+ * @brief Draw the RTOS statistics page.
+ *
+ * Shows the CPU load and switch count of the last sampling window, then one row per task
+ * with its CPU share and lowest free stack, using a small fixed-width font.
+ *
+ * @param u8g2 Pointer to the u8g2 display structure.
+ * @return None
+ */
+static void Stats_Render(u8g2_t *u8g2)
+{
+    RtosStatsReport_t *report = &stats_report;
+    char line[32];
+
+    RTOS_Stats_GetReport(report);
+    u8g2_SetFont(u8g2, u8g2_font_5x7_tr);
+
+    snprintf(line, sizeof(line), "CPU %u.%u%%  sw %lu/s",
+             report->cpu_load_permille / 10U, report->cpu_load_permille % 10U,
+             (unsigned long)report->switches);
+    u8g2_DrawStr(u8g2, 0, STATS_LINE_HEIGHT - 2, line);
+    u8g2_DrawHLine(u8g2, 0, STATS_LINE_HEIGHT, u8g2_GetDisplayWidth(u8g2));
+
+    for (uint32_t i = 0; (i < report->task_count) && (i < STATS_MAX_ROWS); i++)
+    {
+        const RtosStatsTask_t *task = &report->tasks[i];
+        snprintf(line, sizeof(line), "%-9.9s%3u.%u%% %5luB", task->name,
+                 task->cpu_permille / 10U, task->cpu_permille % 10U,
+                 (unsigned long)task->stack_free_bytes);
+        u8g2_DrawStr(u8g2, 0, (u8g2_uint_t)((i + 2U) * STATS_LINE_HEIGHT), line);
+    }
+
+    u8g2_SetFont(u8g2, u8g2_font_ncenB08_tr);
+}
@@ -0,0 +1,116 @@
+/**
+ * @file    screen_video.c
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Video screen: the tile-delta stream received by the video sink (video_sink.h).
+ *
+ * @details
+ * A stream screen. On entry it shows a wait screen; afterwards the display task calls its update
+ * callback on every wake-up, which decodes what has arrived into the buffer and marks the tiles
+ * it changed. When the stream ends (END packet or idle timeout) the update asks for the screen
+ * shown before the stream, and leaving the screen in any other way stops the sink.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "screen_registry.h"
+#include "screens.h"
+#include "video_sink.h"
+
+/**
+ * @defgroup SCREEN_VIDEO_Private_Variables Video Screen Private Variables
+ * @{
+ */
+/** Screen to return to when the stream ends */
+static DisplayMode_t video_return_mode = DISPLAY_MODE_INFO;
+/** @} */
+
+/**
+ * @defgroup SCREEN_VIDEO_Private_Functions Video Screen Private Functions
+ * @{
+ */
+/**
+ * @brief Remember the screen to return to when the stream ends
+ * @param previous Screen shown before
+ * @param now      Current tick (ms)
+ */
+static void Video_Enter(DisplayMode_t previous, uint32_t now);
+/**
+ * @brief Draw the wait screen shown until the first video frame arrives
+ * @param u8g2 Pointer to the u8g2 display structure
+ */
+static void Video_Render(u8g2_t *u8g2);
+/**
+ * @brief End the video stream
+ */
+static void Video_Exit(void);
+/**
+ * @brief Decode received video into the buffer
+ * @param u8g2  Pointer to the u8g2 display structure
+ * @param tiles Tiles written are added
+ * @param now   Current tick (ms)
+ * @return Display mode to show
+ */
+static DisplayMode_t Video_Update(u8g2_t *u8g2, VideoTiles_t *tiles, uint32_t now);
+/** @} */
+
+/** Video stream screen */
+const Screen_t screen_video = {
+    .name = "video", .kind = SCREEN_STREAM,
+    .enter = Video_Enter, .render = Video_Render, .exit = Video_Exit,
+    .update = Video_Update, .next_due = VideoSink_TimeToIdle
+};
+
+
+/**
+ * @brief Remember the screen to return to when the stream ends.
+ *
+ * At start-up (the video screen entered from itself) the info screen is kept.
+ *
+ * @param previous Screen shown before.
+ * @param now      Current tick (ms).
+ * @return None
+ */
+static void Video_Enter(DisplayMode_t previous, uint32_t now)
+{
+    (void)now;
+    if (previous != DISPLAY_MODE_VIDEO)
+    {
+        video_return_mode = previous;
+    }
+}
+
+/**
+ * @brief Draw the wait screen shown until the first video frame arrives.
+ * @param u8g2 Pointer to the u8g2 display structure.
+ * @return None
+ */
+static void Video_Render(u8g2_t *u8g2)
+{
+    Screens_DrawVideoWait(u8g2, VIDEO_BAUD_RATE);
+}
+
+/**
+ * @brief End the video stream (the console gets the line back).
+ * @return None
+ */
+static void Video_Exit(void)
+{
+    VideoSink_Stop();
+}
+
+/**
+ * @brief Decode received video into the buffer.
+ *
+ * Frames that arrived while the previous flush was running are merged: the buffer holds the
+ * newest one and the tile set covers every tile any of them changed.
+ *
+ * @param u8g2  Pointer to the u8g2 display structure.
+ * @param tiles Tiles written are added.
+ * @param now   Current tick (ms).
+ * @return DISPLAY_MODE_VIDEO while the sink is active, else the screen shown before the stream.
+ */
+static DisplayMode_t Video_Update(u8g2_t *u8g2, VideoTiles_t *tiles, uint32_t now)
+{
+    (void)VideoSink_Poll(u8g2_GetBufferPtr(u8g2), tiles, now);
+    return VideoSink_IsActive() ? DISPLAY_MODE_VIDEO : video_return_mode;
+}
@@ -0,0 +1,398 @@
+/**
+ * @file    screens.c
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Renderers of the static OLED screens (info, QR code, bongo cat, video wait, dashboard, image).
+ *
+ * @details
+ * The info, QR code and dashboard screens are laid out as widget trees (widget.h); the text
+ * boxes sit around the same baselines as the former direct DrawStr() calls, so the screens
+ * look the same.
+ * The bitmaps come from the asset pack (asset_pack.h) and are drawn in place from flash, so a
+ * new image needs only an entry in Image/assets.txt. The QR code is encoded on first use (or
+ * by Screens_SetQRPayload()) into a static symbol and written straight into the page bytes of
+ * the frame buffer. Output must stay bit-exact with the golden images in Host/golden.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "screens.h"
+#include "asset_pack.h"
+#include "../Image/asset_ids.h"
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * @defgroup SCREENS_Private_Defines Screens Private Defines
+ * @{
+ */
+/** Left edge of the QR code caption (pixels) */
+#define QR_TEXT_X     70
+/** Vertical offset for text lines (pixels) */
+#define TEXT_OFFSET_Y 15
+/** Room above the baseline in the box of a text line (pixels) */
+#define TEXT_ASCENT   11
+/** Width of the u8g2 frame buffer (pixels) */
+#define BUFFER_WIDTH  128
+/** Height of the u8g2 frame buffer (pixels) */
+#define BUFFER_HEIGHT 64
+/** Quiet zone around the QR symbol (modules) */
+#define QR_QUIET      1
+/** Width of one dashboard cell (pixels) */
+#define DASH_CELL_W   64
+/** Height of one dashboard cell: label line and value line (pixels) */
+#define DASH_CELL_H   16
+/** Baseline of the 5x7 font below the top of a dashboard line (pixels) */
+#define DASH_BASELINE 7
+/** Gap left of the next column (pixels) */
+#define DASH_GAP      2
+/** @} */
+
+/**
+ * @defgroup SCREENS_Private_Variables Screens Private Variables
+ * @{
+ */
+/** Symbol of the QR code screen */
+static QrCode_t screens_qr;
+/** Set once screens_qr holds a symbol */
+static bool screens_qr_valid;
+/** Caption of the QR code screen */
+static const char *const screens_qr_caption[SCREENS_QR_WIDGETS - 1] = { "QRcode", "scan can", "link to", "Youtube" };
+/** @} */
+
+/**
+ * @defgroup SCREENS_Private_Functions Screens Private Functions
+ * @{
+ */
+/**
+ * @brief Set up a text line widget around a baseline of the ncenB08 layout
+ * @param widget   Label widget
+ * @param x        Left edge (pixels)
+ * @param baseline Baseline (pixels)
+ * @param width    Width (pixels)
+ * @param text     NUL-terminated text
+ */
+static void Screens_InitTextLine(Widget_t *widget, uint8_t x, uint8_t baseline, uint8_t width, const char *text);
+/**
+ * @brief Draw callback of the QR symbol widget
+ * @param u8g2   Pointer to the u8g2 display structure
+ * @param widget Widget
+ */
+static void Screens_DrawQRWidget(u8g2_t *u8g2, const Widget_t *widget);
+/** @} */
+
+
+/**
+ * @brief  Draw the welcome/info screen.
+ * @param u8g2 Pointer to the u8g2 display structure.
+ * @return None
+ */
+void Screens_DrawInfo(u8g2_t *u8g2)
+{
+    static const char *const lines[SCREENS_INFO_LINES] = {
+        OLED_WELCOME_MESSAGE, OLED_INFO_NAME, OLED_INFO_GREETING
+    };
+
+    Screens_DrawInfoLines(u8g2, lines);
+}
+
+/**
+ * @brief  Draw the info screen with other text.
+ * @param u8g2  Pointer to the u8g2 display structure.
+ * @param lines SCREENS_INFO_LINES NUL-terminated lines, top to bottom.
+ * @return None
+ */
+void Screens_DrawInfoLines(u8g2_t *u8g2, const char *const lines[SCREENS_INFO_LINES])
+{
+    Widget_t widgets[SCREENS_INFO_WIDGETS];
+
+    Screens_InitInfoWidgets(widgets, lines);
+    Widget_DrawAll(u8g2, widgets, SCREENS_INFO_WIDGETS);
+}
+
+/**
+ * @brief  Lay out the info screen: one full-width line every TEXT_OFFSET_Y pixels.
+ * @param widgets Widgets to set up (all dirty).
+ * @param lines   SCREENS_INFO_LINES NUL-terminated lines, kept by reference.
+ * @return None
+ */
+void Screens_InitInfoWidgets(Widget_t widgets[SCREENS_INFO_WIDGETS], const char *const lines[SCREENS_INFO_LINES])
+{
+    for (uint32_t i = 0; i < SCREENS_INFO_LINES; i++)
+    {
+        Screens_InitTextLine(&widgets[i], 0, (uint8_t)(TEXT_OFFSET_Y + i * TEXT_OFFSET_Y), BUFFER_WIDTH, lines[i]);
+    }
+}
+
+/**
+ * @brief  Lay out the QR code screen: the symbol in the left square, the caption beside it.
+ * @param widgets Widgets to set up (all dirty).
+ * @return None
+ */
+void Screens_InitQRWidgets(Widget_t widgets[SCREENS_QR_WIDGETS])
+{
+    Widget_Init(&widgets[0], WIDGET_CUSTOM, 0, 0, SCREENS_QR_AREA, SCREENS_QR_AREA);
+    Widget_SetCustom(&widgets[0], Screens_DrawQRWidget, NULL);
+    for (uint32_t i = 0; i < (SCREENS_QR_WIDGETS - 1U); i++)
+    {
+        Screens_InitTextLine(&widgets[i + 1U], QR_TEXT_X, (uint8_t)(TEXT_OFFSET_Y + i * TEXT_OFFSET_Y),
+                             BUFFER_WIDTH - QR_TEXT_X, screens_qr_caption[i]);
+    }
+}
+
+/**
+ * @brief  Lay out the dashboard: SCREENS_DASHBOARD_VALUES labelled values in 4 rows of 2.
+ *
+ * Each 64x16 cell holds its label on the first page and the value, right-aligned, on the
+ * second, so every widget covers exactly one row of tiles.
+ *
+ * @param widgets Widgets to set up (all dirty).
+ * @param font    Font of all widgets, or NULL for the current one.
+ * @param labels  NUL-terminated labels, kept by reference.
+ * @param values  Initial values.
+ * @return None
+ */
+void Screens_InitDashboardWidgets(Widget_t widgets[SCREENS_DASHBOARD_WIDGETS], const uint8_t *font,
+                                  const char *const labels[SCREENS_DASHBOARD_VALUES],
+                                  const int32_t values[SCREENS_DASHBOARD_VALUES])
+{
+    for (uint32_t i = 0; i < SCREENS_DASHBOARD_VALUES; i++)
+    {
+        uint8_t x = (uint8_t)((i % 2U) * DASH_CELL_W);
+        uint8_t y = (uint8_t)((i / 2U) * DASH_CELL_H);
+        Widget_t *label = &widgets[SCREENS_DASHBOARD_LABEL(i)];
+        Widget_t *value = &widgets[SCREENS_DASHBOARD_VALUE(i)];
+
+        Widget_Init(label, WIDGET_LABEL, x, y, DASH_CELL_W - DASH_GAP, DASH_CELL_H / 2U);
+        label->baseline = DASH_BASELINE;
+        label->font = font;
+        Widget_SetText(label, labels[i]);
+
+        Widget_Init(value, WIDGET_NUMERIC, x, (uint8_t)(y + DASH_CELL_H / 2U), DASH_CELL_W - DASH_GAP, DASH_CELL_H / 2U);
+        value->baseline = DASH_BASELINE;
+        value->font = font;
+        value->flags |= WIDGET_F_ALIGN_RIGHT;
+        Widget_SetValue(value, values[i]);
+    }
+}
+
+/**
+ * @brief  Draw the QR code with its caption.
+ * @param u8g2 Pointer to the u8g2 display structure.
+ * @return None
+ */
+void Screens_DrawQRCode(u8g2_t *u8g2)
+{
+    Widget_t widgets[SCREENS_QR_WIDGETS];
+
+    Screens_InitQRWidgets(widgets);
+    Widget_DrawAll(u8g2, widgets, SCREENS_QR_WIDGETS);
+}
+
+/**
+ * @brief  Encode a new payload for the QR code screen.
+ * @param data Payload.
+ * @param len  Payload length.
+ * @return 0 on success, -1 if it does not fit.
+ */
+int Screens_SetQRPayload(const uint8_t *data, size_t len)
+{
+    /* QR_Encode() leaves the symbol untouched when the payload does not fit */
+    if (QR_Encode(&screens_qr, data, len, OLED_QR_ECC) != 0)
+    {
+        return -1;
+    }
+    screens_qr_valid = true;
+    return 0;
+}
+
+/**
+ * @brief  Draw a QR symbol centred in a square of the frame buffer.
+ *
+ * Each buffer byte is one column of a page (bit 0 on top), so every byte of the square is
+ * computed once and stored, with no per-pixel u8g2 call.
+ *
+ * @param u8g2 Pointer to the u8g2 display structure.
+ * @param qr   Encoded symbol.
+ * @param x    Left edge of the square.
+ * @param y    Top edge of the square (multiple of 8).
+ * @param side Side of the square (multiple of 8).
+ * @return None
+ */
+void Screens_DrawQRSymbol(u8g2_t *u8g2, const QrCode_t *qr, uint8_t x, uint8_t y, uint8_t side)
+{
+    uint8_t *buf = u8g2_GetBufferPtr(u8g2);
+    int scale = ((qr->size + 2 * QR_QUIET) * 2 <= side) ? 2 : 1;
+    int origin = (side - qr->size * scale) / 2;
+
+    for (int col = 0; (col < side) && (x + col < BUFFER_WIDTH); col++)
+    {
+        int mx = (col - origin) / scale;
+        bool in_x = (col >= origin) && (mx < qr->size);
+        uint8_t *dst = &buf[(y / 8) * BUFFER_WIDTH + x + col];
+
+        for (int page = 0; page < side / 8; page++, dst += BUFFER_WIDTH)
+        {
+            uint8_t bits = 0xFF;
+            for (int bit = 0; (bit < 8) && in_x; bit++)
+            {
+                int row = page * 8 + bit;
+                int my = (row - origin) / scale;
+                if ((row >= origin) && (my < qr->size) && QR_GetModule(qr, (uint8_t)mx, (uint8_t)my))
+                {
+                    bits &= (uint8_t)~(1U << bit);
+                }
+            }
+            *dst = bits;
+        }
+    }
+}
+
+/**
+ * @brief  Draw one bongo cat animation frame.
+ * @param u8g2  Pointer to the u8g2 display structure.
+ * @param frame Frame index of the "bongo_cat" animation (wraps around).
+ * @return None
+ */
+void Screens_DrawBongoCat(u8g2_t *u8g2, uint8_t frame)
+{
+    uint16_t count;
+    const AssetFrame_t *frames = Asset_Frames(Asset_Get(ASSET_ID_BONGO_CAT), &count);
+
+    if (count > 0U)
+    {
+        const AssetEntry_t *image = Asset_Get(frames[frame % count].image);
+        if (image != NULL)
+        {
+            (void)Screens_DrawImage(u8g2, frames[frame % count].image,
+                                    (u8g2_uint_t)((BUFFER_WIDTH - image->width) / 2), 0);
+        }
+    }
+}
+
+/**
+ * @brief  Draw the video screen shown until the first frame of a stream arrives.
+ * @param u8g2 Pointer to the u8g2 display structure.
+ * @param baud Line rate the host has to use.
+ * @return None
+ */
+void Screens_DrawVideoWait(u8g2_t *u8g2, uint32_t baud)
+{
+    char line[24];
+
+    snprintf(line, sizeof(line), "%lu baud", (unsigned long)baud);
+    u8g2_DrawStr(u8g2, 0, TEXT_OFFSET_Y, "Video sink");
+    u8g2_DrawStr(u8g2, 0, TEXT_OFFSET_Y + TEXT_OFFSET_Y, line);
+    u8g2_DrawStr(u8g2, 0, TEXT_OFFSET_Y + 2 * TEXT_OFFSET_Y, "waiting for frames");
+}
+
+/**
+ * @brief  Draw the dashboard: SCREENS_DASHBOARD_VALUES labelled values in 4 rows of 2.
+ * @param u8g2   Pointer to the u8g2 display structure (font 5x7 selected).
+ * @param labels NUL-terminated labels (cut to the width of a cell).
+ * @param values Values, right-aligned under their labels.
+ * @return None
+ */
+void Screens_DrawDashboard(u8g2_t *u8g2, const char *const labels[SCREENS_DASHBOARD_VALUES],
+                           const int32_t values[SCREENS_DASHBOARD_VALUES])
+{
+    Widget_t widgets[SCREENS_DASHBOARD_WIDGETS];
+
+    Screens_InitDashboardWidgets(widgets, NULL, labels, values);
+    Widget_DrawAll(u8g2, widgets, SCREENS_DASHBOARD_WIDGETS);
+}
+
+/**
+ * @brief  Draw an image asset centred on the screen (vertically on a page boundary).
+ * @param u8g2 Pointer to the u8g2 display structure.
+ * @param id   Asset id of an image.
+ * @return true if the asset exists, is an image and fits the screen, false otherwise.
+ */
+bool Screens_DrawImageCentered(u8g2_t *u8g2, AssetId_t id)
+{
+    const AssetEntry_t *image = Asset_Get(id);
+
+    if ((image == NULL) || (image->width > BUFFER_WIDTH) || (image->height > BUFFER_HEIGHT))
+    {
+        return false;
+    }
+    return Screens_DrawImage(u8g2, id, (u8g2_uint_t)((BUFFER_WIDTH - image->width) / 2U),
+                             (u8g2_uint_t)(((BUFFER_HEIGHT - image->height) / 2U) & ~7U));
+}
+
+/**
+ * @brief  Draw an image asset.
+ *
+ * XBM images go through u8g2_DrawXBMP(). Page images are copied into the frame buffer a page
+ * at a time and need a y that is a multiple of 8.
+ *
+ * @param u8g2 Pointer to the u8g2 display structure.
+ * @param id   Asset id of an image.
+ * @param x    Left edge (pixels).
+ * @param y    Top edge (pixels).
+ * @return true if the asset exists and is an image.
+ */
+bool Screens_DrawImage(u8g2_t *u8g2, AssetId_t id, u8g2_uint_t x, u8g2_uint_t y)
+{
+    const AssetEntry_t *image = Asset_Get(id);
+
+    if ((image == NULL) || (image->type != ASSET_TYPE_IMAGE))
+    {
+        return false;
+    }
+    if (image->encoding == ASSET_ENC_XBM)
+    {
+        u8g2_DrawXBMP(u8g2, x, y, image->width, image->height, Asset_Data(image));
+        return true;
+    }
+    if ((image->encoding != ASSET_ENC_PAGES) || ((y % 8U) != 0U) || (x >= BUFFER_WIDTH))
+    {
+        return false;
+    }
+
+    uint8_t *buf = u8g2_GetBufferPtr(u8g2);
+    const uint8_t *src = Asset_Data(image);
+    size_t width = ((size_t)x + image->width <= BUFFER_WIDTH) ? image->width : (size_t)(BUFFER_WIDTH - x);
+    for (uint16_t page = 0; (page < image->height / 8U) && (y / 8U + page < BUFFER_HEIGHT / 8U); page++)
+    {
+        memcpy(&buf[(y / 8U + page) * BUFFER_WIDTH + x], &src[page * image->width], width);
+    }
+    return true;
+}
+
+/**
+ * @brief Set up a text line widget around a baseline of the ncenB08 layout.
+ *
+ * The box spans TEXT_OFFSET_Y rows, TEXT_ASCENT of them above the baseline, so consecutive
+ * lines tile the screen without overlapping.
+ *
+ * @param widget   Label widget.
+ * @param x        Left edge (pixels).
+ * @param baseline Baseline (pixels).
+ * @param width    Width (pixels).
+ * @param text     NUL-terminated text.
+ * @return None
+ */
+static void Screens_InitTextLine(Widget_t *widget, uint8_t x, uint8_t baseline, uint8_t width, const char *text)
+{
+    Widget_Init(widget, WIDGET_LABEL, x, (uint8_t)(baseline - TEXT_ASCENT), width, TEXT_OFFSET_Y);
+    widget->baseline = TEXT_ASCENT;
+    Widget_SetText(widget, text);
+}
+
+/**
+ * @brief Draw callback of the QR symbol widget: encodes the default payload on first use.
+ * @param u8g2   Pointer to the u8g2 display structure.
+ * @param widget Widget.
+ * @return None
+ */
+static void Screens_DrawQRWidget(u8g2_t *u8g2, const Widget_t *widget)
+{
+    if (!screens_qr_valid)
+    {
+        (void)Screens_SetQRPayload((const uint8_t *)OLED_QR_PAYLOAD, sizeof(OLED_QR_PAYLOAD) - 1U);
+    }
+    if (screens_qr_valid)
+    {
+        Screens_DrawQRSymbol(u8g2, &screens_qr, widget->x, widget->y, widget->width);
+    }
+}
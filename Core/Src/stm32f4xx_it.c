@@ -24,17 +24,29 @@
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
 #include "rtos_tasks.h"
-#include "stdio.h"
+#include "display_cmd.h"
+#include "deferred_log.h"
+#include "uart_tx.h"
+#include "perf_hud.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
 /* USER CODE BEGIN TD */
+/**
+ * @brief Debounce and press-duration state of one user button.
+ */
+typedef struct {
+    uint32_t last_edge;   /**< Tick of the last accepted edge */
+    uint32_t press_time;  /**< Tick at which the button was pressed */
+    uint8_t  pressed;     /**< Non-zero while the button is held */
+} ButtonState_t;
 
 /* USER CODE END TD */
 
 /* Private define ------------------------------------------------------------*/
 /* USER CODE BEGIN PD */
 #define DEBOUNCE_MS 50 // Debounce time in milliseconds
+#define LONG_PRESS_MS 800 // Hold time that turns a press into a long press (milliseconds)
 /* USER CODE END PD */
 
 /* Private macro -------------------------------------------------------------*/
@@ -44,12 +56,14 @@
 
 /* Private variables ---------------------------------------------------------*/
 /* USER CODE BEGIN PV */
-static uint32_t last_sw1_time = 0;
-static uint32_t last_sw2_time = 0;
+static ButtonState_t sw1_state;
+static ButtonState_t sw2_state;
 /* USER CODE END PV */
 
 /* Private function prototypes -----------------------------------------------*/
 /* USER CODE BEGIN PFP */
+static void Button_HandleEdge(ButtonState_t *button, GPIO_PinState level, uint32_t now,
+                              uint32_t sw_number, DisplayMode_t mode, LogFormatId_t log_id);
 
 /* USER CODE END PFP */
 
@@ -59,6 +73,8 @@ static uint32_t last_sw2_time = 0;
 /* USER CODE END 0 */
 
 /* External variables --------------------------------------------------------*/
+extern DMA_HandleTypeDef hdma_usart3_rx;
+extern DMA_HandleTypeDef hdma_usart3_tx;
 extern TIM_HandleTypeDef htim1;
 extern UART_HandleTypeDef huart3;
 /* USER CODE BEGIN EV */
@@ -74,8 +90,7 @@ extern UART_HandleTypeDef huart3;
 void NMI_Handler(void)
 {
   /* USER CODE BEGIN NonMaskableInt_IRQn 0 */
-  char msg[] = "NMI occurred\r\n";
-  HAL_UART_Transmit(&huart3, (uint8_t *)msg, strlen(msg), 100);
+  UART_TX_Panic("NMI occurred\r\n");
   /* USER CODE END NonMaskableInt_IRQn 0 */
   /* USER CODE BEGIN NonMaskableInt_IRQn 1 */
    while (1)
@@ -90,8 +105,7 @@ void NMI_Handler(void)
 void HardFault_Handler(void)
 {
   /* USER CODE BEGIN HardFault_IRQn 0 */
-  char msg[] = "Hard Fault occurred\r\n";
-  HAL_UART_Transmit(&huart3, (uint8_t *)msg, strlen(msg), 100);
+  UART_TX_Panic("Hard Fault occurred\r\n");
   /* USER CODE END HardFault_IRQn 0 */
   while (1)
   {
@@ -106,8 +120,7 @@ void HardFault_Handler(void)
 void MemManage_Handler(void)
 {
   /* USER CODE BEGIN MemoryManagement_IRQn 0 */
-  char msg[] = "Memory Management Fault occurred\r\n";
-  HAL_UART_Transmit(&huart3, (uint8_t *)msg, strlen(msg), 100);
+  UART_TX_Panic("Memory Management Fault occurred\r\n");
   /* USER CODE END MemoryManagement_IRQn 0 */
   while (1)
   {
@@ -122,8 +135,7 @@ void MemManage_Handler(void)
 void BusFault_Handler(void)
 {
   /* USER CODE BEGIN BusFault_IRQn 0 */
-  char msg[] = "Bus Fault occurred\r\n";
-  HAL_UART_Transmit(&huart3, (uint8_t *)msg, strlen(msg), 100);
+  UART_TX_Panic("Bus Fault occurred\r\n");
   /* USER CODE END BusFault_IRQn 0 */
   while (1)
   {
@@ -138,8 +150,7 @@ void BusFault_Handler(void)
 void UsageFault_Handler(void)
 {
   /* USER CODE BEGIN UsageFault_IRQn 0 */
-  char msg[] = "Usage Fault occurred\r\n";
-  HAL_UART_Transmit(&huart3, (uint8_t *)msg, strlen(msg), 100);
+  UART_TX_Panic("Usage Fault occurred\r\n");
   /* USER CODE END UsageFault_IRQn 0 */
   while (1)
   {
@@ -155,7 +166,7 @@ void DebugMon_Handler(void)
 {
   /* USER CODE BEGIN DebugMonitor_IRQn 0 */
   char msg[] = "Debug Monitor Fault occurred\r\n";
-  HAL_UART_Transmit(&huart3, (uint8_t *)msg, strlen(msg), 100);
+  UART_TX_Write((const uint8_t *)msg, strlen(msg));
   /* USER CODE END DebugMonitor_IRQn 0 */
   /* USER CODE BEGIN DebugMonitor_IRQn 1 */
 
@@ -197,6 +208,34 @@ void EXTI4_IRQHandler(void)
   /* USER CODE END EXTI4_IRQn 1 */
 }
 
+/**
+  * @brief This function handles DMA1 stream1 global interrupt.
+  */
+void DMA1_Stream1_IRQHandler(void)
+{
+  /* USER CODE BEGIN DMA1_Stream1_IRQn 0 */
+
+  /* USER CODE END DMA1_Stream1_IRQn 0 */
+  HAL_DMA_IRQHandler(&hdma_usart3_rx);
+  /* USER CODE BEGIN DMA1_Stream1_IRQn 1 */
+
+  /* USER CODE END DMA1_Stream1_IRQn 1 */
+}
+
+/**
+  * @brief This function handles DMA1 stream3 global interrupt.
+  */
+void DMA1_Stream3_IRQHandler(void)
+{
+  /* USER CODE BEGIN DMA1_Stream3_IRQn 0 */
+
+  /* USER CODE END DMA1_Stream3_IRQn 0 */
+  HAL_DMA_IRQHandler(&hdma_usart3_tx);
+  /* USER CODE BEGIN DMA1_Stream3_IRQn 1 */
+
+  /* USER CODE END DMA1_Stream3_IRQn 1 */
+}
+
 /**
   * @brief This function handles TIM1 update interrupt and TIM10 global interrupt.
   */
@@ -211,76 +250,119 @@ void TIM1_UP_TIM10_IRQHandler(void)
   /* USER CODE END TIM1_UP_TIM10_IRQn 1 */
 }
 
+/**
+  * @brief This function handles USART3 global interrupt.
+  */
+void USART3_IRQHandler(void)
+{
+  /* USER CODE BEGIN USART3_IRQn 0 */
+
+  /* USER CODE END USART3_IRQn 0 */
+  HAL_UART_IRQHandler(&huart3);
+  /* USER CODE BEGIN USART3_IRQn 1 */
+
+  /* USER CODE END USART3_IRQn 1 */
+}
+
 /* USER CODE BEGIN 1 */
 
 
 /**
  * @brief EXTI GPIO interrupt callback for user button events (SW1/SW2).
  *
- * This callback is invoked by the HAL when an external interrupt occurs on a GPIO pin.
- * Implements 50ms software debouncing for SW1 (PE3) and SW2 (PE4):
- *   - SW1 triggers the OLED to display the bongo cat screen.
- *   - SW2 triggers the OLED to display the QR code screen.
+ * This callback is invoked by the HAL on both edges of SW1 (PE3) and SW2 (PE4), with 50ms
+ * software debouncing. The action is taken when the button is released:
+ *   - Short press on SW1 triggers the OLED to display the bongo cat screen.
+ *   - Short press on SW2 triggers the OLED to display the QR code screen.
+ *   - A press held for LONG_PRESS_MS or longer on either button toggles the performance HUD.
  * Only SW1/SW2 will send display mode to the OLED RTOS task via message queue.
- * All other GPIO interrupts will only print an error message via UART3.
+ * All other GPIO interrupts are only logged.
  *
  * @param gpio_pin The GPIO pin number that triggered the interrupt (e.g., SW1_Pin, SW2_Pin).
  * @return None
  *
- * @note This function is RTOS-safe and non-blocking. Debug messages are sent over UART3.
+ * @note This function is RTOS-safe and non-blocking. Messages are recorded with Log_Write()
+ *       and printed over UART3 later by the low-priority log task.
  *
  * @par Example
  * @code
- * // Press SW1 (PE3): OLED shows bongo cat screen, UART prints "SW1: Show bongo cat screen"
- * // Press SW2 (PE4): OLED shows QR code, UART prints "SW2: Show QR code screen"
+ * // Press SW1 (PE3): OLED shows bongo cat screen, UART prints "[tick] SW1: Show bongo cat screen"
+ * // Press SW2 (PE4): OLED shows QR code, UART prints "[tick] SW2: Show QR code page"
+ * // Hold SW1 or SW2: HUD toggles, UART prints "[tick] SW1: Perf HUD on=1"
  * // Other pins: UART prints error message only
  * @endcode
  */
 void HAL_GPIO_EXTI_Callback(uint16_t gpio_pin)
 {
     uint32_t current_time = HAL_GetTick();
-    char msg[64];
 
     if (gpio_pin == SW1_Pin)
     {
-        // SW1: Show bongo cat screen
-        if ((HAL_GPIO_ReadPin(SW1_GPIO_Port, SW1_Pin) == GPIO_PIN_SET) &&
-            ((current_time - last_sw1_time) > DEBOUNCE_MS))
-        {
-            uint8_t mode = DISPLAY_MODE_BONGO;
-            snprintf(msg, sizeof(msg), "SW1: Show bongo cat screen\r\n");
-            HAL_UART_Transmit(&huart3, (uint8_t *)msg, strlen(msg), 100);
-            if (osMessageQueuePut(display_mode_queue, &mode, 0, 0) != osOK)
-            {
-                snprintf(msg, sizeof(msg), "SW1: Failed to send mode to queue\r\n");
-                HAL_UART_Transmit(&huart3, (uint8_t *)msg, strlen(msg), 100);
-            }
-            last_sw1_time = current_time;
-        }
+        // SW1: bongo cat screen on short press
+        Button_HandleEdge(&sw1_state, HAL_GPIO_ReadPin(SW1_GPIO_Port, SW1_Pin), current_time,
+                          1, DISPLAY_MODE_BONGO, LOG_FMT_SW1_SHOW_BONGO);
     }
     else if (gpio_pin == SW2_Pin)
     {
-        // SW2: Show QR code screen
-        if ((HAL_GPIO_ReadPin(SW2_GPIO_Port, SW2_Pin) == GPIO_PIN_SET) &&
-            ((current_time - last_sw2_time) > DEBOUNCE_MS))
+        // SW2: QR code screen on short press
+        Button_HandleEdge(&sw2_state, HAL_GPIO_ReadPin(SW2_GPIO_Port, SW2_Pin), current_time,
+                          2, DISPLAY_MODE_QRCODE, LOG_FMT_SW2_SHOW_QRCODE);
+    }
+    else
+    {
+        // Other GPIO interrupts: log only
+        Log_Write(LOG_FMT_UNKNOWN_GPIO, gpio_pin, 0);
+    }
+}
+
+/**
+ * @brief Debounce one button edge and act on release.
+ *
+ * Edges within DEBOUNCE_MS of the last accepted one are ignored, which can also drop the
+ * release of a very short tap. The first edge after the window therefore re-syncs the state to
+ * the pin level: a press always restarts the press timing, and a release without a recorded
+ * press only updates the window.
+ *
+ * @param button    Button state.
+ * @param level     Pin level after the edge (GPIO_PIN_SET = pressed).
+ * @param now       Current tick (milliseconds).
+ * @param sw_number Button number used in log messages.
+ * @param mode      Display mode requested by a short press.
+ * @param log_id    Log message for a short press.
+ * @return None
+ */
+static void Button_HandleEdge(ButtonState_t *button, GPIO_PinState level, uint32_t now,
+                              uint32_t sw_number, DisplayMode_t mode, LogFormatId_t log_id)
+{
+    if ((now - button->last_edge) <= DEBOUNCE_MS)
+    {
+        return;
+    }
+
+    button->last_edge = now;
+    if (level == GPIO_PIN_SET)
+    {
+        button->pressed = 1;
+        button->press_time = now;
+    }
+    else if (button->pressed)
+    {
+        button->pressed = 0;
+        if ((now - button->press_time) >= LONG_PRESS_MS)
+        {
+            PerfHUD_Toggle();
+            OLED_Task_Refresh();
+            Log_Write(LOG_FMT_SW_TOGGLE_HUD, sw_number, PerfHUD_IsEnabled());
+        }
+        else
         {
-            uint8_t mode = DISPLAY_MODE_QRCODE;
-            snprintf(msg, sizeof(msg), "SW2: Show QR code page\r\n");
-            HAL_UART_Transmit(&huart3, (uint8_t *)msg, strlen(msg), 100);
-            if (osMessageQueuePut(display_mode_queue, &mode, 0, 0) != osOK)
+            Log_Write(log_id, 0, 0);
+            if (DisplayCmd_Show(mode) != osOK)
             {
-                snprintf(msg, sizeof(msg), "SW2: Failed to send mode to queue\r\n");
-                HAL_UART_Transmit(&huart3, (uint8_t *)msg, strlen(msg), 100);
+                Log_Write(LOG_FMT_SW_QUEUE_FULL, sw_number, 0);
             }
-            last_sw2_time = current_time;
         }
     }
-    else
-    {
-        // Other GPIO interrupts: print error message only
-        snprintf(msg, sizeof(msg), "Unknown GPIO interrupt (pin=%u), ignored!\r\n", gpio_pin);
-        HAL_UART_Transmit(&huart3, (uint8_t *)msg, strlen(msg), 100);
-    }
 }
 
 /* USER CODE END 1 */
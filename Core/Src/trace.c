@@ -0,0 +1,257 @@
+/**
+ * @file    trace.c
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Compact binary trace of RTOS and display events, streamed over UART3.
+ *
+ * @details
+ * Trace_Record() is the only function on the hot path: it masks interrupts for a handful of
+ * stores (timestamp, ids, head index) and never loops, so its cost is constant. It is measured
+ * with the DWT cycle counter at start-up and reported to the host in the metadata packet.
+ * When the ring is full new records are dropped and counted rather than overwriting, so the
+ * streamed timeline never contains silently missing spans.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "trace.h"
+#include "dwt_timer.h"
+#include "mem_layout.h"
+#include "uart_tx.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "cmsis_os2.h"
+#include "string.h"
+
+/**
+ * @defgroup TRACE_Private_Defines Trace Private Defines
+ * @{
+ */
+/** Index mask derived from the power-of-two ring size */
+#define TRACE_MASK               (TRACE_BUFFER_RECORDS - 1U)
+/** First packet sync byte */
+#define TRACE_SYNC0              0xA5U
+/** Second packet sync byte */
+#define TRACE_SYNC1              0x5AU
+/** Packet type: event records */
+#define TRACE_PKT_RECORDS        'T'
+/** Packet type: task number to name mapping */
+#define TRACE_PKT_TASK_NAME      'N'
+/** Packet type: clock and overhead metadata */
+#define TRACE_PKT_METADATA       'M'
+/** Number of Trace_Record() calls timed by the calibration */
+#define TRACE_CALIBRATION_RUNS   32U
+/** Maximum number of tasks whose names are streamed */
+#define TRACE_MAX_TASKS          8U
+/** @} */
+
+#if (TRACE_BUFFER_RECORDS & (TRACE_BUFFER_RECORDS - 1)) != 0
+#error "TRACE_BUFFER_RECORDS must be a power of two"
+#endif
+
+/** Compile-time check that records stream as exactly 8 bytes */
+typedef char trace_record_size_check[(sizeof(TraceRecord_t) == 8U) ? 1 : -1];
+
+/**
+ * @defgroup TRACE_Private_Variables Trace Private Variables
+ * @{
+ */
+/** Record ring */
+static TraceRecord_t trace_buffer[TRACE_BUFFER_RECORDS] CCM_SECTION("trace");
+/** Next slot to write (free-running) */
+static volatile uint32_t trace_head;
+/** Next slot to stream (free-running) */
+static volatile uint32_t trace_tail;
+/** Records dropped because the ring was full */
+static volatile uint32_t trace_dropped;
+/** Worst-case Trace_Record() cost measured by Trace_Init() */
+static uint32_t trace_overhead_cycles;
+/** @} */
+
+#if TRACE_ENABLE
+/**
+ * @defgroup TRACE_Private_Functions Trace Private Functions
+ * @{
+ */
+/**
+ * @brief Finish a packet (checksum) and queue it on UART3
+ * @param packet Packet buffer starting with the sync bytes
+ * @param len    Packet length without the checksum byte
+ */
+static void Trace_SendPacket(uint8_t *packet, uint32_t len);
+/**
+ * @brief Send the metadata packet and one name packet per task
+ */
+static void Trace_SendMetadata(void);
+/** @} */
+#endif
+
+
+/**
+ * @brief  Start the cycle counter, reset the ring and calibrate the per-event overhead.
+ * @return None
+ */
+void Trace_Init(void)
+{
+    DWT_Timer_Init();
+
+    uint32_t worst = 0;
+    for (uint32_t i = 0; i < TRACE_CALIBRATION_RUNS; i++)
+    {
+        uint32_t start = DWT_Timer_GetCycles();
+        Trace_Record(0, 0, 0);
+        uint32_t elapsed = DWT_Timer_GetCycles() - start;
+        if (elapsed > worst)
+        {
+            worst = elapsed;
+        }
+    }
+    trace_overhead_cycles = worst;
+
+    trace_head = 0;
+    trace_tail = 0;
+    trace_dropped = 0;
+}
+
+/**
+ * @brief  Append one record (ISR, task and kernel-hook safe; constant time, never blocks).
+ *
+ * @param event Event id (TraceEventId_t).
+ * @param arg8  Small argument.
+ * @param arg16 Argument.
+ * @return None
+ */
+void Trace_Record(uint8_t event, uint8_t arg8, uint16_t arg16)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    uint32_t head = trace_head;
+    if ((head - trace_tail) < TRACE_BUFFER_RECORDS)
+    {
+        TraceRecord_t *record = &trace_buffer[head & TRACE_MASK];
+        record->timestamp = DWT_Timer_GetCycles();
+        record->event = event;
+        record->arg8 = arg8;
+        record->arg16 = arg16;
+        trace_head = head + 1U;
+    }
+    else
+    {
+        trace_dropped++;
+    }
+
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @brief  Pack pending records into packets and queue them on UART3.
+ * @return None
+ */
+void Trace_Stream(void)
+{
+#if TRACE_ENABLE
+    static uint32_t last_metadata_tick;
+    static uint8_t metadata_sent;
+    uint8_t packet[4U + TRACE_PACKET_MAX_RECORDS * sizeof(TraceRecord_t) + 1U];
+
+    uint32_t now = osKernelGetTickCount();
+    if (!metadata_sent || ((now - last_metadata_tick) >= TRACE_METADATA_PERIOD_MS))
+    {
+        Trace_SendMetadata();
+        last_metadata_tick = now;
+        metadata_sent = 1;
+    }
+
+    uint32_t pending = trace_head - trace_tail;
+    while (pending > 0U)
+    {
+        uint32_t count = (pending < TRACE_PACKET_MAX_RECORDS) ? pending : TRACE_PACKET_MAX_RECORDS;
+        packet[0] = TRACE_SYNC0;
+        packet[1] = TRACE_SYNC1;
+        packet[2] = TRACE_PKT_RECORDS;
+        packet[3] = (uint8_t)count;
+        for (uint32_t i = 0; i < count; i++)
+        {
+            memcpy(&packet[4U + i * sizeof(TraceRecord_t)], &trace_buffer[(trace_tail + i) & TRACE_MASK],
+                   sizeof(TraceRecord_t));
+        }
+        trace_tail += count;
+        pending -= count;
+        Trace_SendPacket(packet, 4U + count * sizeof(TraceRecord_t));
+    }
+#endif
+}
+
+/**
+ * @brief  Measured cost of one Trace_Record() call.
+ * @return Worst case of the calibration runs, in core clock cycles.
+ */
+uint32_t Trace_GetOverheadCycles(void)
+{
+    return trace_overhead_cycles;
+}
+
+/**
+ * @brief  Number of records dropped because the ring was full.
+ * @return Dropped record count.
+ */
+uint32_t Trace_GetDroppedCount(void)
+{
+    return trace_dropped;
+}
+
+#if TRACE_ENABLE
+/**
+ * @brief Finish a packet (checksum) and queue it on UART3.
+ *
+ * @param packet Packet buffer starting with the sync bytes (one spare byte at the end).
+ * @param len    Packet length without the checksum byte.
+ * @return None
+ */
+static void Trace_SendPacket(uint8_t *packet, uint32_t len)
+{
+    uint8_t sum = 0;
+    for (uint32_t i = 2; i < len; i++)
+    {
+        sum += packet[i];
+    }
+    packet[len] = sum;
+    UART_TX_Write(packet, len + 1U);
+}
+
+/**
+ * @brief Send the metadata packet and one name packet per task.
+ * @return None
+ */
+static void Trace_SendMetadata(void)
+{
+    static TaskStatus_t tasks[TRACE_MAX_TASKS];
+    uint8_t packet[5U + configMAX_TASK_NAME_LEN + 1U];
+    uint32_t clock_hz = SystemCoreClock;
+    uint16_t overhead = (uint16_t)trace_overhead_cycles;
+    uint32_t dropped = trace_dropped;
+
+    packet[0] = TRACE_SYNC0;
+    packet[1] = TRACE_SYNC1;
+    packet[2] = TRACE_PKT_METADATA;
+    memcpy(&packet[3], &clock_hz, sizeof(clock_hz));
+    memcpy(&packet[7], &overhead, sizeof(overhead));
+    memcpy(&packet[9], &dropped, sizeof(dropped));
+    Trace_SendPacket(packet, 13U);
+
+    UBaseType_t count = uxTaskGetSystemState(tasks, TRACE_MAX_TASKS, NULL);
+    for (UBaseType_t i = 0; i < count; i++)
+    {
+        uint32_t name_len = 0;
+        while ((name_len < configMAX_TASK_NAME_LEN) && (tasks[i].pcTaskName[name_len] != '\0'))
+        {
+            name_len++;
+        }
+        packet[2] = TRACE_PKT_TASK_NAME;
+        packet[3] = (uint8_t)tasks[i].xTaskNumber;
+        packet[4] = (uint8_t)name_len;
+        memcpy(&packet[5], tasks[i].pcTaskName, name_len);
+        Trace_SendPacket(packet, 5U + name_len);
+    }
+}
+#endif
@@ -0,0 +1,319 @@
+/**
+ * @file    uart_rx.c
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   DMA-driven USART3 receive ring shared by the console and the video sink.
+ *
+ * @details
+ * The ring is described by two free-running indices:
+ *   - rx_head: one past the last byte published by an RX event (interrupt only)
+ *   - rx_tail: first byte not yet consumed (reader only)
+ * Ring index i & UART_RX_MASK is DMA position i % UART_RX_BUFFER_SIZE, so a restarted DMA
+ * transfer (which begins at position 0) moves rx_head up to the next multiple of the ring
+ * size and the reader jumps there. DMA does not wait for the reader: a reader that falls a
+ * whole ring behind loses what it has not read yet.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "uart_rx.h"
+#include "uart_tx.h"
+#include "main.h"
+#include "mem_layout.h"
+#include "string.h"
+
+/**
+ * @defgroup UART_RX_Private_Defines UART RX Private Defines
+ * @{
+ */
+/** Index mask derived from the power-of-two ring size */
+#define UART_RX_MASK (UART_RX_BUFFER_SIZE - 1U)
+/** @} */
+
+#if (UART_RX_BUFFER_SIZE & (UART_RX_BUFFER_SIZE - 1)) != 0
+#error "UART_RX_BUFFER_SIZE must be a power of two"
+#endif
+
+/**
+ * @defgroup UART_RX_Private_Variables UART RX Private Variables
+ * @{
+ */
+/** RX ring storage (written by DMA, so it must stay in DMA-accessible SRAM) */
+static uint8_t rx_buffer[UART_RX_BUFFER_SIZE] DMA_SECTION("uart");
+/** One past the last published byte (free-running) */
+static volatile uint32_t rx_head;
+/** First byte not yet consumed (free-running) */
+static uint32_t rx_tail;
+/** DMA position at the last RX event */
+static volatile uint32_t rx_last_pos;
+/** Value of rx_head when reception was last (re)started */
+static volatile uint32_t rx_base;
+/** Incremented on every (re)start */
+static volatile uint32_t rx_epoch;
+/** Epoch the reader has caught up with */
+static uint32_t rx_reader_epoch;
+/** Called after each RX event that published bytes */
+static volatile UartRxListener_t rx_listener;
+/** Ring counters */
+static UartRxStats_t rx_stats;
+/** UART3 handle */
+extern UART_HandleTypeDef huart3;
+/** @} */
+
+/**
+ * @defgroup UART_RX_Private_Functions UART RX Private Functions
+ * @{
+ */
+/**
+ * @brief Mask interrupts and return the previous PRIMASK
+ * @return Previous PRIMASK value
+ */
+static inline uint32_t UART_RX_Lock(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    return primask;
+}
+
+/**
+ * @brief Restore the PRIMASK saved by UART_RX_Lock()
+ * @param primask Saved PRIMASK value
+ */
+static inline void UART_RX_Unlock(uint32_t primask)
+{
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @brief (Re)start circular DMA reception at ring position 0 (interrupts masked)
+ */
+static void UART_RX_Start(void);
+/**
+ * @brief Catch up with restarts and overruns, return the number of bytes pending
+ * @return Bytes between rx_tail and rx_head
+ */
+static uint32_t UART_RX_Pending(void);
+/** @} */
+
+
+/**
+ * @brief  Start circular DMA reception on USART3.
+ * @return None
+ */
+void UART_RX_Init(void)
+{
+    rx_head = 0;
+    rx_tail = 0;
+    rx_epoch = 0;
+    rx_reader_epoch = 0;
+    rx_listener = NULL;
+    memset(&rx_stats, 0, sizeof(rx_stats));
+    MemLayout_CheckDma(rx_buffer, sizeof(rx_buffer), "UART3 RX ring");
+
+    uint32_t primask = UART_RX_Lock();
+    UART_RX_Start();
+    rx_reader_epoch = rx_epoch;
+    rx_stats.restarts = 0;
+    UART_RX_Unlock(primask);
+}
+
+/**
+ * @brief  Oldest received bytes that are contiguous in the ring.
+ * @param data Set to the first byte.
+ * @return Number of bytes at *data, 0 if nothing is pending.
+ */
+size_t UART_RX_Peek(const uint8_t **data)
+{
+    uint32_t fill = UART_RX_Pending();
+    uint32_t start = rx_tail & UART_RX_MASK;
+
+    if (fill > (UART_RX_BUFFER_SIZE - start))
+    {
+        fill = UART_RX_BUFFER_SIZE - start;
+    }
+    *data = &rx_buffer[start];
+    return fill;
+}
+
+/**
+ * @brief  All received bytes, as up to two spans of the ring.
+ * @param view Set to the spans (the second is empty unless the data wraps).
+ * @return Total number of bytes pending.
+ */
+size_t UART_RX_PeekView(UartRxView_t *view)
+{
+    uint32_t fill = UART_RX_Pending();
+    uint32_t start = rx_tail & UART_RX_MASK;
+    uint32_t first = UART_RX_BUFFER_SIZE - start;
+
+    if (first > fill)
+    {
+        first = fill;
+    }
+    view->data[0] = &rx_buffer[start];
+    view->len[0] = first;
+    view->data[1] = rx_buffer;
+    view->len[1] = fill - first;
+    return fill;
+}
+
+/**
+ * @brief  Release bytes returned by UART_RX_Peek() or UART_RX_PeekView().
+ * @param len Number of bytes.
+ * @return None
+ */
+void UART_RX_Consume(size_t len)
+{
+    rx_tail += (uint32_t)len;
+}
+
+/**
+ * @brief  Drop everything received so far.
+ * @return None
+ */
+void UART_RX_Discard(void)
+{
+    uint32_t primask = UART_RX_Lock();
+    rx_reader_epoch = rx_epoch;
+    rx_tail = rx_head;
+    UART_RX_Unlock(primask);
+}
+
+/**
+ * @brief  Install the function called from the RX interrupt when bytes arrive.
+ * @param listener Listener, or NULL for none.
+ * @return None
+ */
+void UART_RX_SetListener(UartRxListener_t listener)
+{
+    rx_listener = listener;
+}
+
+/**
+ * @brief  Change the USART3 line rate for both directions.
+ *
+ * HAL_UART_Init() on an initialised handle only rewrites the USART registers; the DMA links
+ * and the pin setup stay as they are.
+ *
+ * @param baud New baud rate.
+ * @return 0 on success, -1 on failure.
+ */
+int UART_RX_SetBaudRate(uint32_t baud)
+{
+    if (UART_TX_Flush(UART_RX_FLUSH_TIMEOUT_MS) != 0)
+    {
+        return -1;
+    }
+
+    (void)HAL_UART_AbortReceive(&huart3);
+    huart3.Init.BaudRate = baud;
+    HAL_StatusTypeDef status = HAL_UART_Init(&huart3);
+
+    uint32_t primask = UART_RX_Lock();
+    UART_RX_Start();
+    UART_RX_Unlock(primask);
+    return (status == HAL_OK) ? 0 : -1;
+}
+
+/**
+ * @brief  Copy the current RX counters.
+ * @param stats Destination for the counters.
+ * @return None
+ */
+void UART_RX_GetStats(UartRxStats_t *stats)
+{
+    uint32_t primask = UART_RX_Lock();
+    *stats = rx_stats;
+    UART_RX_Unlock(primask);
+}
+
+/**
+ * @brief  USART3 RX event hook: publish the bytes DMA wrote since the last event.
+ *
+ * The position is UART_RX_BUFFER_SIZE at transfer complete and restarts from the beginning
+ * afterwards, so a position below the previous one means the DMA wrapped.
+ *
+ * @param pos DMA write position in the ring.
+ * @return None
+ */
+void UART_RX_EventHandler(uint16_t pos)
+{
+    uint32_t last = rx_last_pos;
+    uint32_t count = (pos >= last) ? (pos - last) : (UART_RX_BUFFER_SIZE - last + pos);
+
+    rx_last_pos = pos;
+    if (count == 0U)
+    {
+        return;
+    }
+    rx_head += count;
+    rx_stats.received += count;
+    rx_stats.events++;
+
+    UartRxListener_t listener = rx_listener;
+    if (listener != NULL)
+    {
+        listener();
+    }
+}
+
+/**
+ * @brief  USART3 error hook: restart reception if the HAL stopped it (overrun, framing, DMA).
+ * @return None
+ */
+void UART_RX_ErrorHandler(void)
+{
+    if (huart3.RxState == HAL_UART_STATE_READY)
+    {
+        rx_stats.errors++;
+        UART_RX_Start();
+    }
+}
+
+/**
+ * @brief (Re)start circular DMA reception at ring position 0 (interrupts masked).
+ * @return None
+ */
+static void UART_RX_Start(void)
+{
+    rx_last_pos = 0;
+    rx_base = (rx_head + UART_RX_MASK) & ~(uint32_t)UART_RX_MASK;
+    rx_head = rx_base;
+    rx_epoch++;
+    rx_stats.restarts++;
+    (void)HAL_UARTEx_ReceiveToIdle_DMA(&huart3, rx_buffer, UART_RX_BUFFER_SIZE);
+}
+
+/**
+ * @brief Catch up with restarts and overruns, return the number of bytes pending.
+ *
+ * If the reader fell more than a ring behind, the lost bytes are counted as overruns and
+ * skipped.
+ *
+ * @return Bytes between rx_tail and rx_head.
+ */
+static uint32_t UART_RX_Pending(void)
+{
+    uint32_t primask = UART_RX_Lock();
+    if (rx_reader_epoch != rx_epoch)
+    {
+        /* Reception restarted: whatever was pending is gone */
+        rx_reader_epoch = rx_epoch;
+        rx_tail = rx_base;
+    }
+    uint32_t head = rx_head;
+    UART_RX_Unlock(primask);
+
+    uint32_t fill = head - rx_tail;
+    if (fill > UART_RX_BUFFER_SIZE)
+    {
+        /* DMA lapped the reader; even the newest ring contents may be torn */
+        rx_stats.overruns += fill;
+        rx_tail = head;
+        fill = 0;
+    }
+    if (fill > rx_stats.peak_fill)
+    {
+        rx_stats.peak_fill = fill;
+    }
+    return fill;
+}
@@ -0,0 +1,449 @@
+/**
+ * @file    uart_tx.c
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   DMA-driven, non-blocking USART3 transmit engine with printf retargeting.
+ *
+ * @details
+ * The ring is described by three free-running indices:
+ *   - tx_tail: first byte not yet confirmed sent (start of the DMA transfer in flight)
+ *   - tx_tail + tx_dma_len: first byte not yet handed to DMA
+ *   - tx_head: next free byte
+ * Writers copy into the ring with interrupts masked and start DMA if it is idle; the
+ * TX-complete interrupt retires the finished chunk and starts the next one. Each DMA chunk is
+ * contiguous in memory and at most UART_TX_DMA_CHUNK_MAX bytes long.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "uart_tx.h"
+#include "main.h"
+#include "cmsis_os2.h"
+#include "rtos_static.h"
+#include "mem_layout.h"
+#include "FreeRTOS.h"
+#include "stdio.h"
+#include "string.h"
+
+/**
+ * @defgroup UART_TX_Private_Defines UART TX Private Defines
+ * @{
+ */
+/** Index mask derived from the power-of-two ring size */
+#define UART_TX_MASK (UART_TX_BUFFER_SIZE - 1U)
+/** @} */
+
+#if (UART_TX_BUFFER_SIZE & (UART_TX_BUFFER_SIZE - 1)) != 0
+#error "UART_TX_BUFFER_SIZE must be a power of two"
+#endif
+
+/**
+ * @defgroup UART_TX_Private_Variables UART TX Private Variables
+ * @{
+ */
+/** TX ring storage (read by DMA, so it must stay in DMA-accessible SRAM) */
+static uint8_t tx_buffer[UART_TX_BUFFER_SIZE] DMA_SECTION("uart");
+/** Next free byte (free-running) */
+static volatile uint32_t tx_head;
+/** First byte not yet confirmed sent (free-running) */
+static volatile uint32_t tx_tail;
+/** Length of the DMA transfer in flight, 0 when idle */
+static volatile uint32_t tx_dma_len;
+/** Active overflow policy */
+static volatile UartTxPolicy_t tx_policy = UART_TX_OVERFLOW_POLICY;
+/** Set once UART_TX_Panic() has taken over the USART */
+static volatile uint8_t tx_panicked;
+/** Writers waiting for space under UART_TX_POLICY_BLOCK */
+static volatile uint32_t tx_waiters;
+/** Released from the TX-complete interrupt when writers are waiting */
+static osSemaphoreId_t tx_space_sem;
+#if RTOS_STATIC_ALLOC
+/** Control block of tx_space_sem */
+static StaticSemaphore_t tx_space_sem_cb CCM_SECTION("uart");
+#endif
+/** Engine counters */
+static UartTxStats_t tx_stats;
+/** UART3 handle */
+extern UART_HandleTypeDef huart3;
+/** @} */
+
+/**
+ * @defgroup UART_TX_Private_Functions UART TX Private Functions
+ * @{
+ */
+/**
+ * @brief Mask interrupts and return the previous PRIMASK
+ * @return Previous PRIMASK value
+ */
+static inline uint32_t UART_TX_Lock(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    return primask;
+}
+
+/**
+ * @brief Restore the PRIMASK saved by UART_TX_Lock()
+ * @param primask Saved PRIMASK value
+ */
+static inline void UART_TX_Unlock(uint32_t primask)
+{
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @brief Start a DMA transfer if DMA is idle and data is pending (interrupts masked)
+ */
+static void UART_TX_Kick(void);
+/**
+ * @brief Discard up to @p count of the oldest queued bytes (interrupts masked)
+ * @param count Bytes to discard
+ * @return Bytes actually discarded
+ */
+static uint32_t UART_TX_DiscardOldest(uint32_t count);
+/**
+ * @brief Whether the caller may block waiting for ring space
+ * @return Non-zero in task context with the scheduler running
+ */
+static int UART_TX_CanBlock(void);
+/** @} */
+
+
+/**
+ * @brief  Initialize the TX ring and its RTOS objects.
+ *
+ * @note If the semaphore cannot be created, UART_TX_POLICY_BLOCK degrades to dropping.
+ */
+void UART_TX_Init(void)
+{
+    tx_head = 0;
+    tx_tail = 0;
+    tx_dma_len = 0;
+    tx_waiters = 0;
+    memset(&tx_stats, 0, sizeof(tx_stats));
+    MemLayout_CheckDma(tx_buffer, sizeof(tx_buffer), "UART3 TX ring");
+#if RTOS_STATIC_ALLOC
+    const osSemaphoreAttr_t tx_space_sem_attributes = {
+        .cb_mem = &tx_space_sem_cb,
+        .cb_size = sizeof(tx_space_sem_cb)
+    };
+    tx_space_sem = osSemaphoreNew(1, 0, &tx_space_sem_attributes);
+#else
+    tx_space_sem = osSemaphoreNew(1, 0, NULL);
+#endif
+}
+
+/**
+ * @brief  Queue bytes for DMA transmission on USART3.
+ *
+ * @param data Bytes to send.
+ * @param len  Number of bytes.
+ * @return Number of bytes accepted.
+ */
+size_t UART_TX_Write(const uint8_t *data, size_t len)
+{
+    size_t written = 0;
+
+    while (written < len)
+    {
+        uint32_t primask = UART_TX_Lock();
+        uint32_t wanted = (uint32_t)(len - written);
+        uint32_t space = UART_TX_BUFFER_SIZE - (tx_head - tx_tail);
+
+        if ((wanted > space) && (tx_policy == UART_TX_POLICY_OVERWRITE))
+        {
+            space += UART_TX_DiscardOldest(wanted - space);
+        }
+
+        uint32_t count = (wanted < space) ? wanted : space;
+        for (uint32_t i = 0; i < count; i++)
+        {
+            tx_buffer[(tx_head + i) & UART_TX_MASK] = data[written + i];
+        }
+        tx_head += count;
+        tx_stats.queued += count;
+        if ((tx_head - tx_tail) > tx_stats.peak_fill)
+        {
+            tx_stats.peak_fill = tx_head - tx_tail;
+        }
+        written += count;
+        UART_TX_Kick();
+
+        int wait = (written < len) && (tx_policy == UART_TX_POLICY_BLOCK) && UART_TX_CanBlock();
+        if (wait)
+        {
+            tx_waiters++;
+        }
+        UART_TX_Unlock(primask);
+
+        if (!wait)
+        {
+            break;
+        }
+        osStatus_t status = osSemaphoreAcquire(tx_space_sem, UART_TX_BLOCK_TIMEOUT_MS);
+        primask = UART_TX_Lock();
+        tx_waiters--;
+        UART_TX_Unlock(primask);
+        if (status != osOK)
+        {
+            break;
+        }
+    }
+
+    if (written < len)
+    {
+        uint32_t primask = UART_TX_Lock();
+        tx_stats.dropped += (uint32_t)(len - written);
+        UART_TX_Unlock(primask);
+    }
+    return written;
+}
+
+/**
+ * @brief  Queue a block only if all of it fits, in one piece.
+ * @param data Bytes to send.
+ * @param len  Number of bytes.
+ * @return 0 if queued, -1 if the ring has no room for it now.
+ */
+int UART_TX_TryWrite(const uint8_t *data, size_t len)
+{
+    uint32_t primask = UART_TX_Lock();
+    if (len > (UART_TX_BUFFER_SIZE - (tx_head - tx_tail)))
+    {
+        UART_TX_Unlock(primask);
+        return -1;
+    }
+    for (uint32_t i = 0; i < (uint32_t)len; i++)
+    {
+        tx_buffer[(tx_head + i) & UART_TX_MASK] = data[i];
+    }
+    tx_head += (uint32_t)len;
+    tx_stats.queued += (uint32_t)len;
+    if ((tx_head - tx_tail) > tx_stats.peak_fill)
+    {
+        tx_stats.peak_fill = tx_head - tx_tail;
+    }
+    UART_TX_Kick();
+    UART_TX_Unlock(primask);
+    return 0;
+}
+
+/**
+ * @brief  Wait until every queued byte has left the USART.
+ *
+ * The TX-complete callback runs on the USART TC flag, so once the ring is empty the last
+ * stop bit has been shifted out.
+ *
+ * @param timeout_ms Longest wait.
+ * @return 0 when the ring is empty and DMA idle, -1 on timeout.
+ */
+int UART_TX_Flush(uint32_t timeout_ms)
+{
+    uint32_t start = osKernelGetTickCount();
+
+    while ((tx_head != tx_tail) && !tx_panicked)
+    {
+        if ((osKernelGetTickCount() - start) >= timeout_ms)
+        {
+            return -1;
+        }
+        osDelay(1);
+    }
+    return 0;
+}
+
+/**
+ * @brief  Select the overflow policy at runtime.
+ * @param policy New policy.
+ * @return None
+ */
+void UART_TX_SetPolicy(UartTxPolicy_t policy)
+{
+    tx_policy = policy;
+}
+
+/**
+ * @brief  Copy the current TX counters.
+ * @param stats Destination for the counters.
+ * @return None
+ */
+void UART_TX_GetStats(UartTxStats_t *stats)
+{
+    uint32_t primask = UART_TX_Lock();
+    *stats = tx_stats;
+    UART_TX_Unlock(primask);
+}
+
+/**
+ * @brief  Synchronous panic output for fault handlers.
+ *
+ * Does not use the HAL handle (it may be locked or mid-transfer when the fault hits).
+ *
+ * @param msg NUL-terminated message.
+ * @return None
+ */
+void UART_TX_Panic(const char *msg)
+{
+    uint32_t primask = UART_TX_Lock();
+    USART_TypeDef *usart = huart3.Instance;
+    uint32_t spin;
+
+    tx_panicked = 1;
+    CLEAR_BIT(usart->CR3, USART_CR3_DMAT);
+    if (huart3.hdmatx != NULL)
+    {
+        __HAL_DMA_DISABLE(huart3.hdmatx);
+    }
+
+    while (*msg != '\0')
+    {
+        spin = UART_TX_PANIC_SPIN_LIMIT;
+        while (((usart->SR & USART_SR_TXE) == 0U) && (--spin != 0U))
+        {
+        }
+        usart->DR = (uint8_t)*msg++;
+    }
+    spin = UART_TX_PANIC_SPIN_LIMIT;
+    while (((usart->SR & USART_SR_TC) == 0U) && (--spin != 0U))
+    {
+    }
+    UART_TX_Unlock(primask);
+}
+
+/**
+ * @brief  USART3 TX-complete hook: retire the finished chunk and start the next one.
+ * @return None
+ */
+void UART_TX_TxCpltHandler(void)
+{
+    uint32_t primask = UART_TX_Lock();
+    tx_tail += tx_dma_len;
+    tx_stats.sent += tx_dma_len;
+    tx_dma_len = 0;
+    UART_TX_Kick();
+    uint32_t waiters = tx_waiters;
+    UART_TX_Unlock(primask);
+
+    if (waiters != 0U)
+    {
+        osSemaphoreRelease(tx_space_sem);
+    }
+}
+
+/**
+ * @brief  USART3 error hook: drop the aborted chunk so the engine keeps running.
+ * @return None
+ */
+void UART_TX_ErrorHandler(void)
+{
+    uint32_t primask = UART_TX_Lock();
+    if ((tx_dma_len != 0U) && (huart3.gState == HAL_UART_STATE_READY))
+    {
+        tx_tail += tx_dma_len;
+        tx_dma_len = 0;
+        tx_stats.errors++;
+        UART_TX_Kick();
+    }
+    UART_TX_Unlock(primask);
+}
+
+/**
+ * @brief Start a DMA transfer if DMA is idle and data is pending (interrupts masked).
+ * @return None
+ */
+static void UART_TX_Kick(void)
+{
+    if ((tx_dma_len != 0U) || (tx_head == tx_tail) || tx_panicked)
+    {
+        return;
+    }
+
+    uint32_t start = tx_tail & UART_TX_MASK;
+    uint32_t count = tx_head - tx_tail;
+    if (count > UART_TX_BUFFER_SIZE - start)
+    {
+        count = UART_TX_BUFFER_SIZE - start;
+    }
+    if (count > UART_TX_DMA_CHUNK_MAX)
+    {
+        count = UART_TX_DMA_CHUNK_MAX;
+    }
+
+    if (HAL_UART_Transmit_DMA(&huart3, &tx_buffer[start], (uint16_t)count) == HAL_OK)
+    {
+        tx_dma_len = count;
+        tx_stats.transfers++;
+    }
+}
+
+/**
+ * @brief Discard up to @p count of the oldest queued bytes (interrupts masked).
+ *
+ * Bytes already handed to DMA cannot be reclaimed, so the queued bytes behind them are
+ * shifted down over the discarded ones. The copy is bounded by the ring size and only
+ * runs on overflow.
+ *
+ * @param count Bytes to discard.
+ * @return Bytes actually discarded.
+ */
+static uint32_t UART_TX_DiscardOldest(uint32_t count)
+{
+    uint32_t pending_start = tx_tail + tx_dma_len;
+    uint32_t pending = tx_head - pending_start;
+    if (count > pending)
+    {
+        count = pending;
+    }
+
+    for (uint32_t i = 0; i < pending - count; i++)
+    {
+        tx_buffer[(pending_start + i) & UART_TX_MASK] = tx_buffer[(pending_start + count + i) & UART_TX_MASK];
+    }
+    tx_head -= count;
+    tx_stats.overwritten += count;
+    return count;
+}
+
+/**
+ * @brief Whether the caller may block waiting for ring space.
+ * @return Non-zero in task context with the scheduler running.
+ */
+static int UART_TX_CanBlock(void)
+{
+    return (__get_IPSR() == 0U) && (tx_space_sem != NULL) && (osKernelGetState() == osKernelRunning);
+}
+
+/**
+ * @defgroup UART_TX_Retarget printf Retargeting
+ * @brief Route C library stdout through the TX ring.
+ * @{
+ */
+#if defined(__ARMCC_VERSION)
+/**
+ * @brief Arm Compiler (MicroLIB) character output hook used by printf.
+ * @param ch Character to write
+ * @param f  Stream (ignored, all streams go to USART3)
+ * @return The character written
+ */
+int fputc(int ch, FILE *f)
+{
+    uint8_t c = (uint8_t)ch;
+    (void)f;
+    UART_TX_Write(&c, 1);
+    return ch;
+}
+#elif defined(__GNUC__)
+/**
+ * @brief newlib low-level write hook used by printf.
+ * @param file File descriptor (ignored, all output goes to USART3)
+ * @param ptr  Bytes to write
+ * @param len  Number of bytes
+ * @return Number of bytes consumed (dropped bytes are counted, not reported)
+ */
+int _write(int file, char *ptr, int len)
+{
+    (void)file;
+    UART_TX_Write((const uint8_t *)ptr, (size_t)len);
+    return len;
+}
+#endif
+/** @} */
@@ -0,0 +1,193 @@
+/**
+ * @file    video_sink.c
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Shows a tile-delta video stream received on USART3.
+ *
+ * @details
+ * The sink only owns the decoder and the hand-over of the RX ring; the video screen
+ * (screen_video.c) calls VideoSink_Poll() and the display task flushes the tiles it reports. While the sink is active the RX
+ * interrupt wakes the display task through OLED_Task_Refresh(), so a frame is shown as soon
+ * as its last byte has arrived instead of at the next timeout.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "video_sink.h"
+#include "cmsis_os2.h"
+#include "deferred_log.h"
+#include "display_cmd.h"
+#include "mem_layout.h"
+#include "rtos_tasks.h"
+#include "uart_rx.h"
+#include "uart_tx.h"
+#include "stdio.h"
+
+/**
+ * @defgroup VIDEO_SINK_Private_Variables Video Sink Private Variables
+ * @{
+ */
+/** Stream decoder (CPU access only) */
+static VideoDecoder_t video_decoder CCM_SECTION("video");
+/** Set while the sink owns the RX ring */
+static volatile bool video_active;
+/** Tick of the last received byte */
+static uint32_t video_last_rx;
+/** @} */
+
+/**
+ * @defgroup VIDEO_SINK_Private_Functions Video Sink Private Functions
+ * @{
+ */
+/**
+ * @brief RX listener: wake the display task
+ */
+static void VideoSink_OnReceive(void);
+/** @} */
+
+
+/**
+ * @brief  Switch USART3 to the video rate and show the video screen.
+ *
+ * The announcement is flushed at the console rate before the switch, so a terminal still
+ * shows it.
+ *
+ * @return 0 on success, -1 on failure.
+ */
+int VideoSink_Start(void)
+{
+    char msg[80];
+
+    if (video_active)
+    {
+        return 0;
+    }
+    int len = snprintf(msg, sizeof(msg), "Video: switching to %lu baud, send frames or END\r\n",
+                       (unsigned long)VIDEO_BAUD_RATE);
+    UART_TX_Write((const uint8_t *)msg, (size_t)len);
+
+    Video_DecoderInit(&video_decoder);
+    if (UART_RX_SetBaudRate(VIDEO_BAUD_RATE) != 0)
+    {
+        (void)UART_RX_SetBaudRate(UART_CONSOLE_BAUD_RATE);
+        return -1;
+    }
+    video_last_rx = osKernelGetTickCount();
+    video_active = true;
+    UART_RX_SetListener(VideoSink_OnReceive);
+
+    if (DisplayCmd_Show(DISPLAY_MODE_VIDEO) != osOK)
+    {
+        VideoSink_Stop();
+        return -1;
+    }
+    Log_Write(LOG_FMT_VIDEO_START, VIDEO_BAUD_RATE, VIDEO_IDLE_TIMEOUT_MS);
+    return 0;
+}
+
+/**
+ * @brief  Give the line back to the console.
+ * @return None
+ */
+void VideoSink_Stop(void)
+{
+    if (!video_active)
+    {
+        return;
+    }
+    UART_RX_SetListener(NULL);
+    (void)UART_RX_SetBaudRate(UART_CONSOLE_BAUD_RATE);
+    video_active = false;
+
+    const VideoStats_t *stats = &video_decoder.stats;
+    Log_Write(LOG_FMT_VIDEO_STOP, stats->frames, stats->crc_errors + stats->format_errors + stats->skipped);
+}
+
+/**
+ * @brief  Whether the sink owns the RX ring.
+ * @return true while active.
+ */
+bool VideoSink_IsActive(void)
+{
+    return video_active;
+}
+
+/**
+ * @brief  Decode the received bytes into a frame buffer.
+ *
+ * At most one ring of data is decoded per call, so a fast sender cannot keep the display task
+ * from flushing. Several frames may be applied in one call; only the tiles are reported, so
+ * frames the panel had no time to show are skipped.
+ *
+ * @param fb    u8g2 frame buffer.
+ * @param dirty Tiles written are added.
+ * @param now   Current tick (ms).
+ * @return VideoEvent_t bits.
+ */
+uint32_t VideoSink_Poll(uint8_t *fb, VideoTiles_t *dirty, uint32_t now)
+{
+    uint32_t events = VIDEO_EVT_NONE;
+    size_t budget = UART_RX_BUFFER_SIZE;
+    const uint8_t *data;
+    size_t len;
+
+    if (!video_active)
+    {
+        return events;
+    }
+    while ((budget > 0U) && ((len = UART_RX_Peek(&data)) > 0U))
+    {
+        if (len > budget)
+        {
+            len = budget;
+        }
+        events |= Video_Decode(&video_decoder, data, len, fb, dirty);
+        UART_RX_Consume(len);
+        budget -= len;
+        video_last_rx = now;
+        if ((events & VIDEO_EVT_END) != 0U)
+        {
+            break;
+        }
+    }
+
+    if (((events & VIDEO_EVT_END) != 0U) || ((now - video_last_rx) >= VIDEO_IDLE_TIMEOUT_MS))
+    {
+        VideoSink_Stop();
+    }
+    return events;
+}
+
+/**
+ * @brief  Time until the idle timeout expires.
+ * @param now Current tick (ms).
+ * @return Milliseconds, 0 if the sink is not active.
+ */
+uint32_t VideoSink_TimeToIdle(uint32_t now)
+{
+    uint32_t idle = now - video_last_rx;
+
+    if (!video_active || (idle >= VIDEO_IDLE_TIMEOUT_MS))
+    {
+        return 0;
+    }
+    return VIDEO_IDLE_TIMEOUT_MS - idle;
+}
+
+/**
+ * @brief  Copy the decoder counters of the current or last stream.
+ * @param stats Destination for the counters.
+ * @return None
+ */
+void VideoSink_GetStats(VideoStats_t *stats)
+{
+    *stats = video_decoder.stats;
+}
+
+/**
+ * @brief RX listener: wake the display task (RX interrupt context).
+ * @return None
+ */
+static void VideoSink_OnReceive(void)
+{
+    OLED_Task_Refresh();
+}
@@ -0,0 +1,575 @@
+/**
+ * @file    video_stream.c
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Tile-delta video stream: packet parser, frame decoder, encoder and tile flush.
+ *
+ * @details
+ * The parser hunts for the two sync bytes, collects the header, then copies the payload and
+ * CRC in blocks. A frame is validated by a dry run of its records before it is applied, so
+ * a malformed packet never leaves a half-written frame.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "video_stream.h"
+#include "crc16.h"
+#include <string.h>
+
+/**
+ * @enum VideoParseState_t
+ * @brief Parser states.
+ */
+typedef enum {
+    VIDEO_PARSE_SYNC0 = 0,      /**< Waiting for VIDEO_SYNC0 */
+    VIDEO_PARSE_SYNC1,          /**< Waiting for VIDEO_SYNC1 */
+    VIDEO_PARSE_HEADER,         /**< Collecting the rest of the header */
+    VIDEO_PARSE_BODY            /**< Collecting payload and CRC */
+} VideoParseState_t;
+
+/**
+ * @defgroup VIDEO_Private_Functions Video Stream Private Functions
+ * @{
+ */
+/**
+ * @brief Validate a complete packet and apply it
+ * @param dec   Decoder holding the packet
+ * @param fb    Frame buffer
+ * @param dirty Tiles written are added
+ * @return VideoEvent_t bits
+ */
+static uint32_t Video_HandlePacket(VideoDecoder_t *dec, uint8_t *fb, VideoTiles_t *dirty);
+/**
+ * @brief Walk the records of a frame payload, optionally writing them
+ * @param payload Payload
+ * @param len     Payload length
+ * @param fb      Frame buffer, or NULL to only check the records
+ * @param dirty   Tiles written are added (ignored when fb is NULL)
+ * @return Tiles covered, or -1 if the payload is malformed
+ */
+static int32_t Video_ApplyRecords(const uint8_t *payload, size_t len, uint8_t *fb, VideoTiles_t *dirty);
+/**
+ * @brief PackBits-compress a block
+ * @param src Data
+ * @param len Length in bytes
+ * @param dst Output (at least len + len / 128 + 1 bytes)
+ * @return Compressed length
+ */
+static size_t Video_PackBits(const uint8_t *src, size_t len, uint8_t *dst);
+/**
+ * @brief Write the header and CRC around a payload already at out + VIDEO_HEADER_SIZE
+ * @param out         Packet
+ * @param type        VideoPacketType_t
+ * @param flags       Flags
+ * @param seq         Sequence number
+ * @param payload_len Payload length
+ * @return Packet length
+ */
+static size_t Video_Seal(uint8_t *out, uint8_t type, uint8_t flags, uint16_t seq, size_t payload_len);
+/**
+ * @brief Encode a frame packet, with a time stamp if one is given
+ * @param prev  Previous frame, or NULL
+ * @param cur   Frame to send
+ * @param seq   Sequence number
+ * @param key   Force a key frame
+ * @param stamp Time stamp, or NULL for none
+ * @param out   Packet output (at least VIDEO_MAX_PACKET bytes)
+ * @return Packet length
+ */
+static size_t Video_EncodePacket(const uint8_t *prev, const uint8_t *cur, uint16_t seq, bool key,
+                                 const uint32_t *stamp, uint8_t *out);
+/** @} */
+
+
+/**
+ * @brief  Reset a decoder.
+ * @param dec Decoder.
+ * @return None
+ */
+void Video_DecoderInit(VideoDecoder_t *dec)
+{
+    memset(dec, 0, offsetof(VideoDecoder_t, packet));
+    dec->state = VIDEO_PARSE_SYNC0;
+}
+
+/**
+ * @brief  Feed received bytes; apply every complete, valid frame to a frame buffer.
+ * @param dec   Decoder.
+ * @param data  Received bytes.
+ * @param len   Number of bytes.
+ * @param fb    Frame buffer.
+ * @param dirty Tiles written are added.
+ * @return VideoEvent_t bits.
+ */
+uint32_t Video_Decode(VideoDecoder_t *dec, const uint8_t *data, size_t len, uint8_t *fb,
+                      VideoTiles_t *dirty)
+{
+    uint32_t events = VIDEO_EVT_NONE;
+
+    dec->stats.bytes += (uint32_t)len;
+    while (len > 0U)
+    {
+        switch (dec->state)
+        {
+            case VIDEO_PARSE_SYNC0:
+                if (*data == VIDEO_SYNC0)
+                {
+                    dec->state = VIDEO_PARSE_SYNC1;
+                }
+                data++;
+                len--;
+                break;
+            case VIDEO_PARSE_SYNC1:
+                if (*data == VIDEO_SYNC1)
+                {
+                    dec->packet[0] = VIDEO_SYNC0;
+                    dec->packet[1] = VIDEO_SYNC1;
+                    dec->pos = 2U;
+                    dec->state = VIDEO_PARSE_HEADER;
+                }
+                else if (*data != VIDEO_SYNC0)
+                {
+                    dec->state = VIDEO_PARSE_SYNC0;
+                }
+                data++;
+                len--;
+                break;
+            case VIDEO_PARSE_HEADER:
+            {
+                dec->packet[dec->pos++] = *data++;
+                len--;
+                if (dec->pos < VIDEO_HEADER_SIZE)
+                {
+                    break;
+                }
+                uint16_t payload_len = (uint16_t)(dec->packet[6] | (dec->packet[7] << 8));
+                uint8_t type = dec->packet[2];
+                if (((type != VIDEO_PKT_FRAME) && (type != VIDEO_PKT_END)) || (payload_len > VIDEO_MAX_PAYLOAD))
+                {
+                    dec->stats.format_errors++;
+                    dec->state = VIDEO_PARSE_SYNC0;
+                    break;
+                }
+                dec->need = (uint16_t)(VIDEO_HEADER_SIZE + payload_len + VIDEO_CRC_SIZE);
+                dec->state = VIDEO_PARSE_BODY;
+                break;
+            }
+            case VIDEO_PARSE_BODY:
+            default:
+            {
+                size_t chunk = (size_t)(dec->need - dec->pos);
+                if (chunk > len)
+                {
+                    chunk = len;
+                }
+                memcpy(&dec->packet[dec->pos], data, chunk);
+                dec->pos = (uint16_t)(dec->pos + chunk);
+                data += chunk;
+                len -= chunk;
+                if (dec->pos == dec->need)
+                {
+                    events |= Video_HandlePacket(dec, fb, dirty);
+                    dec->state = VIDEO_PARSE_SYNC0;
+                }
+                break;
+            }
+        }
+    }
+    return events;
+}
+
+/**
+ * @brief  Encode a frame as the delta to the previous one.
+ *
+ * Runs of consecutive changed tiles become one record each. Without a previous frame, or if
+ * every tile changed, the frame is sent as a key frame.
+ *
+ * @param prev Previous frame, or NULL.
+ * @param cur  Frame to send.
+ * @param seq  Sequence number.
+ * @param key  Force a key frame.
+ * @param out  Packet output.
+ * @param cap  Size of out.
+ * @return Packet length, 0 if cap is too small.
+ */
+size_t Video_EncodeFrame(const uint8_t *prev, const uint8_t *cur, uint16_t seq, bool key,
+                         uint8_t *out, size_t cap)
+{
+    if (cap < VIDEO_MAX_PACKET)
+    {
+        return 0;
+    }
+    return Video_EncodePacket(prev, cur, seq, key, NULL, out);
+}
+
+/**
+ * @brief  Encode a frame like Video_EncodeFrame(), with a time stamp (VIDEO_FLAG_STAMP).
+ * @param prev  Previous frame, or NULL.
+ * @param cur   Frame to send.
+ * @param seq   Sequence number.
+ * @param key   Force a key frame.
+ * @param stamp Time stamp.
+ * @param out   Packet output.
+ * @param cap   Size of out.
+ * @return Packet length, 0 if cap is too small.
+ */
+size_t Video_EncodeStampedFrame(const uint8_t *prev, const uint8_t *cur, uint16_t seq, bool key,
+                                uint32_t stamp, uint8_t *out, size_t cap)
+{
+    if (cap < VIDEO_MAX_PACKET)
+    {
+        return 0;
+    }
+    return Video_EncodePacket(prev, cur, seq, key, &stamp, out);
+}
+
+/**
+ * @brief  Encode an END packet.
+ * @param seq Sequence number.
+ * @param out Packet output.
+ * @param cap Size of out.
+ * @return Packet length, 0 if cap is too small.
+ */
+size_t Video_EncodeEnd(uint16_t seq, uint8_t *out, size_t cap)
+{
+    if (cap < (VIDEO_HEADER_SIZE + VIDEO_CRC_SIZE))
+    {
+        return 0;
+    }
+    return Video_Seal(out, VIDEO_PKT_END, 0U, seq, 0U);
+}
+
+/**
+ * @brief  Send a set of tiles of the u8g2 buffer to the panel, one transfer per run.
+ *
+ * Adjacent tiles of a page are merged into one u8g2_UpdateDisplayArea() call, which sets the
+ * page and column address once and writes the run.
+ *
+ * @param u8g2  Pointer to the u8g2 display structure.
+ * @param tiles Tiles to send.
+ * @return Number of tiles sent.
+ */
+uint32_t Video_UpdateDisplay(u8g2_t *u8g2, const VideoTiles_t *tiles)
+{
+    uint32_t sent = 0;
+
+    for (uint8_t page = 0; page < VIDEO_PAGES; page++)
+    {
+        uint32_t mask = tiles->rows[page];
+        uint8_t x = 0;
+        while (mask != 0U)
+        {
+            if ((mask & 1U) == 0U)
+            {
+                mask >>= 1;
+                x++;
+                continue;
+            }
+            uint8_t width = 0;
+            while ((mask & 1U) != 0U)
+            {
+                mask >>= 1;
+                width++;
+            }
+            u8g2_UpdateDisplayArea(u8g2, x, page, width, 1);
+            sent += width;
+            x = (uint8_t)(x + width);
+        }
+    }
+    return sent;
+}
+
+/**
+ * @brief Validate a complete packet and apply it.
+ *
+ * Delta frames are applied only in sequence after a key frame; anything else waits for the
+ * next key frame.
+ *
+ * @param dec   Decoder holding the packet.
+ * @param fb    Frame buffer.
+ * @param dirty Tiles written are added.
+ * @return VideoEvent_t bits.
+ */
+static uint32_t Video_HandlePacket(VideoDecoder_t *dec, uint8_t *fb, VideoTiles_t *dirty)
+{
+    const uint8_t *packet = dec->packet;
+    size_t payload_len = (size_t)dec->need - VIDEO_HEADER_SIZE - VIDEO_CRC_SIZE;
+    uint16_t crc = (uint16_t)(packet[dec->need - 2U] | (packet[dec->need - 1U] << 8));
+    uint16_t seq = (uint16_t)(packet[4] | (packet[5] << 8));
+    bool key = (packet[3] & VIDEO_FLAG_KEY) != 0U;
+
+    if (CRC16_Compute(&packet[2], (size_t)dec->need - 2U - VIDEO_CRC_SIZE) != crc)
+    {
+        dec->stats.crc_errors++;
+        dec->synced = false;
+        return VIDEO_EVT_NONE;
+    }
+    if (packet[2] == VIDEO_PKT_END)
+    {
+        return VIDEO_EVT_END;
+    }
+    if (!key && (!dec->synced || (seq != dec->next_seq)))
+    {
+        dec->stats.skipped++;
+        dec->synced = false;
+        return VIDEO_EVT_NONE;
+    }
+    const uint8_t *records = &packet[VIDEO_HEADER_SIZE];
+    uint32_t stamp = 0;
+    if ((packet[3] & VIDEO_FLAG_STAMP) != 0U)
+    {
+        if (payload_len < VIDEO_STAMP_SIZE)
+        {
+            dec->stats.format_errors++;
+            dec->synced = false;
+            return VIDEO_EVT_NONE;
+        }
+        stamp = (uint32_t)records[0] | ((uint32_t)records[1] << 8) | ((uint32_t)records[2] << 16) |
+                ((uint32_t)records[3] << 24);
+        records += VIDEO_STAMP_SIZE;
+        payload_len -= VIDEO_STAMP_SIZE;
+    }
+    if (Video_ApplyRecords(records, payload_len, NULL, NULL) < 0)
+    {
+        dec->stats.format_errors++;
+        dec->synced = false;
+        return VIDEO_EVT_NONE;
+    }
+    dec->stats.tiles += (uint32_t)Video_ApplyRecords(records, payload_len, fb, dirty);
+    dec->stamp = stamp;
+    dec->stats.frames++;
+    if (key)
+    {
+        dec->stats.key_frames++;
+    }
+    dec->synced = true;
+    dec->next_seq = (uint16_t)(seq + 1U);
+    return VIDEO_EVT_FRAME;
+}
+
+/**
+ * @brief Walk the records of a frame payload, optionally writing them.
+ * @param payload Payload.
+ * @param len     Payload length.
+ * @param fb      Frame buffer, or NULL to only check the records.
+ * @param dirty   Tiles written are added (ignored when fb is NULL).
+ * @return Tiles covered, or -1 if the payload is malformed.
+ */
+static int32_t Video_ApplyRecords(const uint8_t *payload, size_t len, uint8_t *fb, VideoTiles_t *dirty)
+{
+    size_t in = 0;
+    int32_t tiles = 0;
+
+    while (in < len)
+    {
+        if ((len - in) < 2U)
+        {
+            return -1;
+        }
+        uint32_t first = payload[in];
+        uint32_t count = payload[in + 1U];
+        in += 2U;
+        if ((count == 0U) || ((first + count) > VIDEO_TILES))
+        {
+            return -1;
+        }
+
+        size_t out = first * VIDEO_TILE_BYTES;
+        size_t end = (first + count) * VIDEO_TILE_BYTES;
+        while (out < end)
+        {
+            if (in >= len)
+            {
+                return -1;
+            }
+            uint8_t control = payload[in++];
+            if (control < 128U)
+            {
+                size_t n = (size_t)control + 1U;
+                if (((len - in) < n) || ((end - out) < n))
+                {
+                    return -1;
+                }
+                if (fb != NULL)
+                {
+                    memcpy(&fb[out], &payload[in], n);
+                }
+                in += n;
+                out += n;
+            }
+            else if (control > 128U)
+            {
+                size_t n = 257U - (size_t)control;
+                if ((in >= len) || ((end - out) < n))
+                {
+                    return -1;
+                }
+                if (fb != NULL)
+                {
+                    memset(&fb[out], payload[in], n);
+                }
+                in++;
+                out += n;
+            }
+            else
+            {
+                return -1;
+            }
+        }
+
+        if (fb != NULL)
+        {
+            for (uint32_t tile = first; tile < (first + count); tile++)
+            {
+                dirty->rows[tile / VIDEO_TILE_COLS] |= (uint16_t)(1U << (tile % VIDEO_TILE_COLS));
+            }
+        }
+        tiles += (int32_t)count;
+    }
+    return tiles;
+}
+
+/**
+ * @brief PackBits-compress a block.
+ *
+ * Runs of three or more equal bytes become repeat codes; everything else is sent as
+ * literals of up to 128 bytes.
+ *
+ * @param src Data.
+ * @param len Length in bytes.
+ * @param dst Output.
+ * @return Compressed length.
+ */
+static size_t Video_PackBits(const uint8_t *src, size_t len, uint8_t *dst)
+{
+    size_t in = 0;
+    size_t out = 0;
+
+    while (in < len)
+    {
+        size_t run = 1;
+        while (((in + run) < len) && (run < 128U) && (src[in + run] == src[in]))
+        {
+            run++;
+        }
+        if (run >= 3U)
+        {
+            dst[out++] = (uint8_t)(257U - run);
+            dst[out++] = src[in];
+            in += run;
+            continue;
+        }
+
+        size_t start = in;
+        size_t literal = 0;
+        while ((in < len) && (literal < 128U))
+        {
+            if (((in + 2U) < len) && (src[in] == src[in + 1U]) && (src[in] == src[in + 2U]))
+            {
+                break;
+            }
+            in++;
+            literal++;
+        }
+        dst[out++] = (uint8_t)(literal - 1U);
+        memcpy(&dst[out], &src[start], literal);
+        out += literal;
+    }
+    return out;
+}
+
+/**
+ * @brief Write the header and CRC around a payload already at out + VIDEO_HEADER_SIZE.
+ * @param out         Packet.
+ * @param type        VideoPacketType_t.
+ * @param flags       Flags.
+ * @param seq         Sequence number.
+ * @param payload_len Payload length.
+ * @return Packet length.
+ */
+static size_t Video_Seal(uint8_t *out, uint8_t type, uint8_t flags, uint16_t seq, size_t payload_len)
+{
+    size_t end = VIDEO_HEADER_SIZE + payload_len;
+
+    out[0] = VIDEO_SYNC0;
+    out[1] = VIDEO_SYNC1;
+    out[2] = type;
+    out[3] = flags;
+    out[4] = (uint8_t)seq;
+    out[5] = (uint8_t)(seq >> 8);
+    out[6] = (uint8_t)payload_len;
+    out[7] = (uint8_t)(payload_len >> 8);
+    uint16_t crc = CRC16_Compute(&out[2], end - 2U);
+    out[end] = (uint8_t)crc;
+    out[end + 1U] = (uint8_t)(crc >> 8);
+    return end + VIDEO_CRC_SIZE;
+}
+
+/**
+ * @brief Encode a frame packet, with a time stamp if one is given.
+ *
+ * Runs of consecutive changed tiles become one record each. Without a previous frame, or if
+ * every tile changed, the frame is sent as a key frame.
+ *
+ * @param prev  Previous frame, or NULL.
+ * @param cur   Frame to send.
+ * @param seq   Sequence number.
+ * @param key   Force a key frame.
+ * @param stamp Time stamp, or NULL for none.
+ * @param out   Packet output (at least VIDEO_MAX_PACKET bytes).
+ * @return Packet length.
+ */
+static size_t Video_EncodePacket(const uint8_t *prev, const uint8_t *cur, uint16_t seq, bool key,
+                                 const uint32_t *stamp, uint8_t *out)
+{
+    uint8_t *payload = out + VIDEO_HEADER_SIZE;
+    uint8_t flags = 0U;
+    size_t start = 0;
+
+    if (stamp != NULL)
+    {
+        payload[0] = (uint8_t)*stamp;
+        payload[1] = (uint8_t)(*stamp >> 8);
+        payload[2] = (uint8_t)(*stamp >> 16);
+        payload[3] = (uint8_t)(*stamp >> 24);
+        start = VIDEO_STAMP_SIZE;
+        flags |= VIDEO_FLAG_STAMP;
+    }
+    if (prev == NULL)
+    {
+        key = true;
+    }
+
+    size_t len = start;
+    for (uint32_t tile = 0; !key && (tile < VIDEO_TILES); )
+    {
+        const uint8_t *a = &prev[tile * VIDEO_TILE_BYTES];
+        const uint8_t *b = &cur[tile * VIDEO_TILE_BYTES];
+        if (memcmp(a, b, VIDEO_TILE_BYTES) == 0)
+        {
+            tile++;
+            continue;
+        }
+        uint32_t first = tile;
+        while ((tile < VIDEO_TILES) &&
+               (memcmp(&prev[tile * VIDEO_TILE_BYTES], &cur[tile * VIDEO_TILE_BYTES], VIDEO_TILE_BYTES) != 0))
+        {
+            tile++;
+        }
+        if ((first == 0U) && (tile == VIDEO_TILES))
+        {
+            key = true;
+            break;
+        }
+        payload[len++] = (uint8_t)first;
+        payload[len++] = (uint8_t)(tile - first);
+        len += Video_PackBits(&cur[first * VIDEO_TILE_BYTES], (tile - first) * VIDEO_TILE_BYTES, &payload[len]);
+    }
+    if (key)
+    {
+        payload[start] = 0;
+        payload[start + 1U] = (uint8_t)VIDEO_TILES;
+        len = start + 2U + Video_PackBits(cur, VIDEO_FRAME_BYTES, &payload[start + 2U]);
+        flags |= VIDEO_FLAG_KEY;
+    }
+    return Video_Seal(out, VIDEO_PKT_FRAME, flags, seq, len);
+}
@@ -0,0 +1,530 @@
+/**
+ * @file    widget.c
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Retained widgets on top of u8g2 with per-widget invalidation.
+ *
+ * @details
+ * Every widget is drawn with the u8g2 clip window set to its box, so a long text or a graph
+ * sample out of range cannot spill into a neighbour that is not redrawn with it. Bitmaps use
+ * Screens_DrawImage(), whose page copy ignores the clip window: give a bitmap widget a box at
+ * least as large as its image.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "widget.h"
+#include "screens.h"
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * @defgroup WIDGET_Private_Defines Widget Private Defines
+ * @{
+ */
+/** Tile side (pixels) */
+#define WIDGET_TILE   8U
+/** Longest decimal int32_t with sign and terminator */
+#define WIDGET_NUM_LEN 12
+/** @} */
+
+/**
+ * @defgroup WIDGET_Private_Functions Widget Private Functions
+ * @{
+ */
+/**
+ * @brief Draw one widget inside its box
+ * @param u8g2   Pointer to the u8g2 display structure
+ * @param widget Widget
+ */
+static void Widget_Draw(u8g2_t *u8g2, const Widget_t *widget);
+/**
+ * @brief Draw a text at the alignment of a label or numeric widget
+ * @param u8g2   Pointer to the u8g2 display structure
+ * @param widget Widget
+ * @param text   NUL-terminated text
+ */
+static void Widget_DrawText(u8g2_t *u8g2, const Widget_t *widget, const char *text);
+/**
+ * @brief Draw a progress bar
+ * @param u8g2   Pointer to the u8g2 display structure
+ * @param widget Widget
+ */
+static void Widget_DrawProgress(u8g2_t *u8g2, const Widget_t *widget);
+/**
+ * @brief Draw a line graph
+ * @param u8g2   Pointer to the u8g2 display structure
+ * @param widget Widget
+ */
+static void Widget_DrawGraph(u8g2_t *u8g2, const Widget_t *widget);
+/**
+ * @brief Scale a value of [min, max] to 0 .. span, clamped
+ * @param widget Widget holding min and max
+ * @param value  Value
+ * @param span   Result for max
+ * @return Scaled value
+ */
+static uint32_t Widget_Scale(const Widget_t *widget, int32_t value, uint32_t span);
+/**
+ * @brief Whether the boxes of two widgets share a pixel
+ * @param a First widget
+ * @param b Second widget
+ * @return true if they overlap
+ */
+static bool Widget_Overlap(const Widget_t *a, const Widget_t *b);
+/**
+ * @brief Add the tiles covered by the box of a widget
+ * @param widget Widget
+ * @param tiles  Tile set
+ */
+static void Widget_AddTiles(const Widget_t *widget, VideoTiles_t *tiles);
+/** @} */
+
+
+/**
+ * @brief  Set up a widget: type, box, no content, dirty; the baseline is the bottom of the box.
+ * @param widget Widget.
+ * @param type   WidgetType_t.
+ * @param x      Left edge (pixels).
+ * @param y      Top edge (pixels).
+ * @param width  Width (pixels).
+ * @param height Height (pixels).
+ * @return None
+ */
+void Widget_Init(Widget_t *widget, WidgetType_t type, uint8_t x, uint8_t y, uint8_t width, uint8_t height)
+{
+    memset(widget, 0, sizeof(*widget));
+    widget->type = (uint8_t)type;
+    widget->flags = WIDGET_F_DIRTY;
+    widget->x = x;
+    widget->y = y;
+    widget->width = width;
+    widget->height = height;
+    widget->baseline = height;
+    widget->max = 100;
+}
+
+/**
+ * @brief  Show a text (label); dirty unless it is the same text at the same address.
+ *
+ * A buffer rewritten in place keeps its address: call Widget_Invalidate() after changing it.
+ *
+ * @param widget Label.
+ * @param text   NUL-terminated text, kept by reference.
+ * @return None
+ */
+void Widget_SetText(Widget_t *widget, const char *text)
+{
+    if (widget->u.text != text)
+    {
+        widget->u.text = text;
+        widget->flags |= WIDGET_F_DIRTY;
+    }
+}
+
+/**
+ * @brief  Show a value (numeric, progress); dirty if it changed.
+ * @param widget Numeric or progress widget.
+ * @param value  New value.
+ * @return None
+ */
+void Widget_SetValue(Widget_t *widget, int32_t value)
+{
+    if (widget->value != value)
+    {
+        widget->value = value;
+        widget->flags |= WIDGET_F_DIRTY;
+    }
+}
+
+/**
+ * @brief  Set the value range of a progress bar or graph.
+ * @param widget Progress or graph widget.
+ * @param min    Value of an empty bar / bottom row.
+ * @param max    Value of a full bar / top row (greater than min).
+ * @return None
+ */
+void Widget_SetRange(Widget_t *widget, int32_t min, int32_t max)
+{
+    widget->min = min;
+    widget->max = max;
+    widget->flags |= WIDGET_F_DIRTY;
+}
+
+/**
+ * @brief  Show an image asset (bitmap); dirty if it changed.
+ * @param widget Bitmap widget.
+ * @param id     Asset id of an image.
+ * @return None
+ */
+void Widget_SetImage(Widget_t *widget, AssetId_t id)
+{
+    if (widget->u.image != id)
+    {
+        widget->u.image = id;
+        widget->flags |= WIDGET_F_DIRTY;
+    }
+}
+
+/**
+ * @brief  Give a graph its sample storage (emptied).
+ * @param widget   Graph widget.
+ * @param samples  Storage for capacity samples.
+ * @param capacity Number of samples.
+ * @return None
+ */
+void Widget_SetGraphBuffer(Widget_t *widget, int32_t *samples, uint16_t capacity)
+{
+    widget->u.graph.samples = samples;
+    widget->u.graph.capacity = capacity;
+    widget->u.graph.count = 0;
+    widget->u.graph.head = 0;
+    widget->flags |= WIDGET_F_DIRTY;
+}
+
+/**
+ * @brief  Append a sample to a graph, dropping the oldest when full; always dirty.
+ * @param widget Graph widget.
+ * @param value  Sample.
+ * @return None
+ */
+void Widget_GraphPush(Widget_t *widget, int32_t value)
+{
+    if (widget->u.graph.capacity == 0U)
+    {
+        return;
+    }
+    widget->u.graph.samples[widget->u.graph.head] = value;
+    widget->u.graph.head = (uint16_t)((widget->u.graph.head + 1U) % widget->u.graph.capacity);
+    if (widget->u.graph.count < widget->u.graph.capacity)
+    {
+        widget->u.graph.count++;
+    }
+    widget->flags |= WIDGET_F_DIRTY;
+}
+
+/**
+ * @brief  Draw a custom widget with a callback.
+ * @param widget Custom widget.
+ * @param draw   Draw callback.
+ * @param arg    Callback argument.
+ * @return None
+ */
+void Widget_SetCustom(Widget_t *widget, WidgetDrawFn_t draw, const void *arg)
+{
+    widget->u.custom.draw = draw;
+    widget->u.custom.arg = arg;
+    widget->flags |= WIDGET_F_DIRTY;
+}
+
+/**
+ * @brief  Mark a widget dirty.
+ * @param widget Widget.
+ * @return None
+ */
+void Widget_Invalidate(Widget_t *widget)
+{
+    widget->flags |= WIDGET_F_DIRTY;
+}
+
+/**
+ * @brief  Whether any widget of a screen is dirty.
+ * @param widgets Widgets.
+ * @param count   Number of widgets.
+ * @return true if at least one is dirty.
+ */
+bool Widget_AnyDirty(const Widget_t *widgets, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        if ((widgets[i].flags & WIDGET_F_DIRTY) != 0U)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief  Draw every widget into a cleared buffer and mark them clean.
+ * @param u8g2    Pointer to the u8g2 display structure (full buffer).
+ * @param widgets Widgets, drawn in order.
+ * @param count   Number of widgets.
+ * @return None
+ */
+void Widget_DrawAll(u8g2_t *u8g2, Widget_t *widgets, size_t count)
+{
+    const uint8_t *font = u8g2->font;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        Widget_Draw(u8g2, &widgets[i]);
+        widgets[i].flags &= (uint8_t)~WIDGET_F_DIRTY;
+    }
+    if (font != NULL)
+    {
+        u8g2_SetFont(u8g2, font);
+    }
+}
+
+/**
+ * @brief  Clear and redraw the dirty widgets and the widgets overlapping them; mark them clean.
+ *
+ * Clearing a box erases the part of every widget under it, so dirtiness first spreads to all
+ * overlapping widgets. Then all dirty boxes are cleared before any widget is drawn, which
+ * keeps the array order for overlapping widgets.
+ *
+ * @param u8g2    Pointer to the u8g2 display structure (full buffer holding the last frame).
+ * @param widgets Widgets, drawn in order.
+ * @param count   Number of widgets.
+ * @param tiles   Tiles covered by the redrawn boxes are added.
+ * @return Number of widgets redrawn.
+ */
+uint32_t Widget_DrawDirty(u8g2_t *u8g2, Widget_t *widgets, size_t count, VideoTiles_t *tiles)
+{
+    const uint8_t *font = u8g2->font;
+    uint32_t drawn = 0;
+    bool spread = true;
+
+    while (spread)
+    {
+        spread = false;
+        for (size_t i = 0; i < count; i++)
+        {
+            if ((widgets[i].flags & WIDGET_F_DIRTY) == 0U)
+            {
+                continue;
+            }
+            for (size_t j = 0; j < count; j++)
+            {
+                if (((widgets[j].flags & WIDGET_F_DIRTY) == 0U) && Widget_Overlap(&widgets[i], &widgets[j]))
+                {
+                    widgets[j].flags |= WIDGET_F_DIRTY;
+                    spread = true;
+                }
+            }
+        }
+    }
+
+    u8g2_SetDrawColor(u8g2, 0);
+    for (size_t i = 0; i < count; i++)
+    {
+        if ((widgets[i].flags & WIDGET_F_DIRTY) != 0U)
+        {
+            u8g2_DrawBox(u8g2, widgets[i].x, widgets[i].y, widgets[i].width, widgets[i].height);
+            Widget_AddTiles(&widgets[i], tiles);
+        }
+    }
+    u8g2_SetDrawColor(u8g2, 1);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        if ((widgets[i].flags & WIDGET_F_DIRTY) != 0U)
+        {
+            Widget_Draw(u8g2, &widgets[i]);
+            widgets[i].flags &= (uint8_t)~WIDGET_F_DIRTY;
+            drawn++;
+        }
+    }
+    if (font != NULL)
+    {
+        u8g2_SetFont(u8g2, font);
+    }
+    return drawn;
+}
+
+/**
+ * @brief Draw one widget inside its box.
+ * @param u8g2   Pointer to the u8g2 display structure.
+ * @param widget Widget.
+ * @return None
+ */
+static void Widget_Draw(u8g2_t *u8g2, const Widget_t *widget)
+{
+    char text[WIDGET_NUM_LEN];
+
+    if ((widget->width == 0U) || (widget->height == 0U))
+    {
+        return;
+    }
+    u8g2_SetClipWindow(u8g2, widget->x, widget->y, (u8g2_uint_t)(widget->x + widget->width),
+                       (u8g2_uint_t)(widget->y + widget->height));
+    switch (widget->type)
+    {
+        case WIDGET_LABEL:
+            if (widget->u.text != NULL)
+            {
+                Widget_DrawText(u8g2, widget, widget->u.text);
+            }
+            break;
+        case WIDGET_NUMERIC:
+            snprintf(text, sizeof(text), "%ld", (long)widget->value);
+            Widget_DrawText(u8g2, widget, text);
+            break;
+        case WIDGET_PROGRESS:
+            Widget_DrawProgress(u8g2, widget);
+            break;
+        case WIDGET_BITMAP:
+            (void)Screens_DrawImage(u8g2, widget->u.image, widget->x, widget->y);
+            break;
+        case WIDGET_GRAPH:
+            Widget_DrawGraph(u8g2, widget);
+            break;
+        case WIDGET_CUSTOM:
+            if (widget->u.custom.draw != NULL)
+            {
+                widget->u.custom.draw(u8g2, widget);
+            }
+            break;
+        default:
+            break;
+    }
+    u8g2_SetMaxClipWindow(u8g2);
+}
+
+/**
+ * @brief Draw a text at the alignment of a label or numeric widget.
+ * @param u8g2   Pointer to the u8g2 display structure.
+ * @param widget Widget.
+ * @param text   NUL-terminated text.
+ * @return None
+ */
+static void Widget_DrawText(u8g2_t *u8g2, const Widget_t *widget, const char *text)
+{
+    u8g2_uint_t x = widget->x;
+
+    if (widget->font != NULL)
+    {
+        u8g2_SetFont(u8g2, widget->font);
+    }
+    if ((widget->flags & (WIDGET_F_ALIGN_RIGHT | WIDGET_F_ALIGN_CENTER)) != 0U)
+    {
+        u8g2_uint_t text_width = u8g2_GetStrWidth(u8g2, text);
+        if (text_width < widget->width)
+        {
+            u8g2_uint_t space = (u8g2_uint_t)(widget->width - text_width);
+            x = (u8g2_uint_t)(x + (((widget->flags & WIDGET_F_ALIGN_RIGHT) != 0U) ? space : (space / 2U)));
+        }
+    }
+    u8g2_DrawStr(u8g2, x, (u8g2_uint_t)(widget->y + widget->baseline), text);
+}
+
+/**
+ * @brief Draw a progress bar: outline and a bar filled from the left.
+ * @param u8g2   Pointer to the u8g2 display structure.
+ * @param widget Widget.
+ * @return None
+ */
+static void Widget_DrawProgress(u8g2_t *u8g2, const Widget_t *widget)
+{
+    u8g2_DrawFrame(u8g2, widget->x, widget->y, widget->width, widget->height);
+    if ((widget->width <= 2U) || (widget->height <= 2U))
+    {
+        return;
+    }
+    uint32_t fill = Widget_Scale(widget, widget->value, widget->width - 2U);
+    if (fill > 0U)
+    {
+        u8g2_DrawBox(u8g2, (u8g2_uint_t)(widget->x + 1U), (u8g2_uint_t)(widget->y + 1U),
+                     (u8g2_uint_t)fill, (u8g2_uint_t)(widget->height - 2U));
+    }
+}
+
+/**
+ * @brief Draw a line graph: one sample per column, the newest in the last column drawn.
+ * @param u8g2   Pointer to the u8g2 display structure.
+ * @param widget Widget.
+ * @return None
+ */
+static void Widget_DrawGraph(u8g2_t *u8g2, const Widget_t *widget)
+{
+    uint16_t shown = widget->u.graph.count;
+    u8g2_uint_t bottom = (u8g2_uint_t)(widget->y + widget->height - 1U);
+    u8g2_uint_t prev_y = 0;
+
+    if (shown > widget->width)
+    {
+        shown = widget->width;
+    }
+    for (uint16_t i = 0; i < shown; i++)
+    {
+        /* Oldest shown sample first */
+        uint32_t slot = ((uint32_t)widget->u.graph.head + widget->u.graph.capacity - shown + i) %
+                        widget->u.graph.capacity;
+        u8g2_uint_t x = (u8g2_uint_t)(widget->x + i);
+        u8g2_uint_t y = (u8g2_uint_t)(bottom - Widget_Scale(widget, widget->u.graph.samples[slot],
+                                                            widget->height - 1U));
+        if (i == 0U)
+        {
+            u8g2_DrawPixel(u8g2, x, y);
+        }
+        else
+        {
+            u8g2_DrawLine(u8g2, (u8g2_uint_t)(x - 1U), prev_y, x, y);
+        }
+        prev_y = y;
+    }
+}
+
+/**
+ * @brief Scale a value of [min, max] to 0 .. span, clamped.
+ * @param widget Widget holding min and max.
+ * @param value  Value.
+ * @param span   Result for max.
+ * @return Scaled value.
+ */
+static uint32_t Widget_Scale(const Widget_t *widget, int32_t value, uint32_t span)
+{
+    if ((widget->max <= widget->min) || (value <= widget->min))
+    {
+        return 0U;
+    }
+    if (value >= widget->max)
+    {
+        return span;
+    }
+    return (uint32_t)(((int64_t)value - widget->min) * span / ((int64_t)widget->max - widget->min));
+}
+
+/**
+ * @brief Whether the boxes of two widgets share a pixel.
+ * @param a First widget.
+ * @param b Second widget.
+ * @return true if they overlap.
+ */
+static bool Widget_Overlap(const Widget_t *a, const Widget_t *b)
+{
+    return ((uint32_t)a->x < (uint32_t)b->x + b->width) && ((uint32_t)b->x < (uint32_t)a->x + a->width) &&
+           ((uint32_t)a->y < (uint32_t)b->y + b->height) && ((uint32_t)b->y < (uint32_t)a->y + a->height);
+}
+
+/**
+ * @brief Add the tiles covered by the box of a widget.
+ * @param widget Widget.
+ * @param tiles  Tile set.
+ * @return None
+ */
+static void Widget_AddTiles(const Widget_t *widget, VideoTiles_t *tiles)
+{
+    if ((widget->width == 0U) || (widget->height == 0U))
+    {
+        return;
+    }
+    uint32_t col0 = widget->x / WIDGET_TILE;
+    uint32_t col1 = ((uint32_t)widget->x + widget->width - 1U) / WIDGET_TILE;
+    uint32_t page0 = widget->y / WIDGET_TILE;
+    uint32_t page1 = ((uint32_t)widget->y + widget->height - 1U) / WIDGET_TILE;
+
+    if (col1 >= VIDEO_TILE_COLS)
+    {
+        col1 = VIDEO_TILE_COLS - 1U;
+    }
+    if (page1 >= VIDEO_PAGES)
+    {
+        page1 = VIDEO_PAGES - 1U;
+    }
+    uint16_t mask = (uint16_t)(((1UL << (col1 + 1U)) - 1U) & ~((1UL << col0) - 1U));
+    for (uint32_t page = page0; page <= page1; page++)
+    {
+        tiles->rows[page] |= mask;
+    }
+}
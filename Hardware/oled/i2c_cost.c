@@ -0,0 +1,130 @@
+/**
+ * @file    i2c_cost.c
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   I2C bus cost model of the OLED transport.
+ *
+ * @details
+ * A transfer starts with a control byte. Co = 1 (bit 7) means one payload byte follows and
+ * then another control byte; Co = 0 means the rest of the transfer is a payload stream.
+ * u8x8_cad_ssd13xx_i2c sends every command as its own 0x00 + command transfer, while the
+ * _fast_ variant packs a command sequence behind one 0x00, so the split between control and
+ * payload bytes is what tells the transports apart.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "i2c_cost.h"
+#include <string.h>
+
+/**
+ * @defgroup I2C_COST_Private_Defines I2C Cost Private Defines
+ * @{
+ */
+/** Continuation bit of a control byte */
+#define I2C_COST_CTRL_CO    0x80U
+/** @} */
+
+
+/**
+ * @brief  Clear the counters.
+ * @param cost Counters.
+ * @return None
+ */
+void I2C_Cost_Reset(I2cBusCost_t *cost)
+{
+    memset(cost, 0, sizeof(*cost));
+}
+
+/**
+ * @brief  Account one write transfer.
+ * @param cost Counters.
+ * @param data Bytes after the address byte (control and payload).
+ * @param len  Number of bytes.
+ * @return None
+ */
+void I2C_Cost_AddTransfer(I2cBusCost_t *cost, const uint8_t *data, uint32_t len)
+{
+    uint32_t control = 0;
+    uint32_t i = 0;
+
+    while (i < len)
+    {
+        control++;
+        if ((data[i] & I2C_COST_CTRL_CO) == 0U)
+        {
+            break;
+        }
+        i += 2U;
+    }
+
+    cost->starts++;
+    cost->address_bytes++;
+    cost->control_bytes += control;
+    cost->payload_bytes += len - control;
+    cost->ack_bits += len + 1U;
+}
+
+/**
+ * @brief  Counters accumulated between two snapshots.
+ * @param now    Later snapshot.
+ * @param before Earlier snapshot.
+ * @param delta  Result (may alias @p now).
+ * @return None
+ */
+void I2C_Cost_Diff(const I2cBusCost_t *now, const I2cBusCost_t *before, I2cBusCost_t *delta)
+{
+    delta->starts = now->starts - before->starts;
+    delta->address_bytes = now->address_bytes - before->address_bytes;
+    delta->control_bytes = now->control_bytes - before->control_bytes;
+    delta->payload_bytes = now->payload_bytes - before->payload_bytes;
+    delta->ack_bits = now->ack_bits - before->ack_bits;
+}
+
+/**
+ * @brief  Bytes on the wire (address + control + payload).
+ * @param cost Counters.
+ * @return Byte count.
+ */
+uint32_t I2C_Cost_Bytes(const I2cBusCost_t *cost)
+{
+    return cost->address_bytes + cost->control_bytes + cost->payload_bytes;
+}
+
+/**
+ * @brief  SCL clocks needed for the counted activity.
+ * @param cost Counters.
+ * @return Clock count.
+ */
+uint32_t I2C_Cost_Clocks(const I2cBusCost_t *cost)
+{
+    return cost->starts * I2C_COST_START_STOP_CLOCKS +
+           I2C_Cost_Bytes(cost) * (I2C_COST_BYTE_CLOCKS - 1U) + cost->ack_bits;
+}
+
+/**
+ * @brief  Predicted wire time.
+ * @param cost   Counters.
+ * @param bus_hz SCL frequency.
+ * @return Microseconds (rounded up).
+ */
+uint32_t I2C_Cost_BusTimeUs(const I2cBusCost_t *cost, uint32_t bus_hz)
+{
+    uint64_t clocks = I2C_Cost_Clocks(cost);
+    return (uint32_t)((clocks * 1000000ULL + bus_hz - 1U) / bus_hz);
+}
+
+/**
+ * @brief  Highest frame rate the bus sustains if @p frame is sent every frame.
+ * @param frame  Counters of one frame.
+ * @param bus_hz SCL frequency.
+ * @return Frames per second x 10 (0 if the frame is empty).
+ */
+uint32_t I2C_Cost_MaxFpsX10(const I2cBusCost_t *frame, uint32_t bus_hz)
+{
+    uint64_t clocks = I2C_Cost_Clocks(frame);
+    if (clocks == 0U)
+    {
+        return 0;
+    }
+    return (uint32_t)((uint64_t)bus_hz * 10U / clocks);
+}
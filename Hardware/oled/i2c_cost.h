@@ -0,0 +1,113 @@
+/**
+ * @file    i2c_cost.h
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   I2C bus cost model of the OLED transport (SSD13xx/SH1106 control-byte protocol).
+ *
+ * @details
+ * Every I2C write handed to the byte backend is classified into START conditions, address
+ * bytes, control bytes (0x00/0x40 stream selectors and 0x80/0xC0 single-byte selectors) and
+ * payload bytes, plus one ACK bit per byte. The counters convert into bus clocks and predicted
+ * wire time for any SCL frequency:
+ *
+ *   clocks = transfers x (START + STOP) + bytes x (8 data bits + ACK)
+ *
+ * which is the same idealised model as the host SH1106 emulator (no clock stretching and no
+ * gaps between bytes). Comparing the counters of one frame sent with u8x8_cad_ssd13xx_i2c,
+ * u8x8_cad_ssd13xx_fast_i2c or a new transport gives the bus-bound frame rate of each.
+ *
+ * The module has no HAL dependency and is also built on the host (Host/bench/bench_i2c_cost.c).
+ */
+
+#ifndef I2C_COST_H
+#define I2C_COST_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+/** Standard-mode SCL frequency (Hz) */
+#define I2C_COST_STANDARD_HZ    100000U
+/** Fast-mode SCL frequency (Hz) */
+#define I2C_COST_FAST_HZ        400000U
+/** Fast-mode Plus SCL frequency (Hz) */
+#define I2C_COST_FAST_PLUS_HZ   1000000U
+/** Bus clocks of one START plus one STOP condition */
+#define I2C_COST_START_STOP_CLOCKS  2U
+/** Bus clocks per byte (8 data bits + ACK) */
+#define I2C_COST_BYTE_CLOCKS        9U
+
+/**
+ * @struct I2cBusCost_t
+ * @brief Bus activity counters (cumulative, or the difference of two snapshots).
+ */
+typedef struct {
+    uint32_t starts;          /**< START conditions (one per write transfer) */
+    uint32_t address_bytes;   /**< Slave address bytes */
+    uint32_t control_bytes;   /**< Control bytes selecting command or data */
+    uint32_t payload_bytes;   /**< Command and display data bytes */
+    uint32_t ack_bits;        /**< ACK clocks (one per byte on the wire) */
+} I2cBusCost_t;
+
+/* Exported functions --------------------------------------------------------*/
+/**
+ * @brief  Clear the counters.
+ * @param cost Counters.
+ */
+void I2C_Cost_Reset(I2cBusCost_t *cost);
+
+/**
+ * @brief  Account one write transfer.
+ * @param cost Counters.
+ * @param data Bytes after the address byte (control and payload).
+ * @param len  Number of bytes.
+ */
+void I2C_Cost_AddTransfer(I2cBusCost_t *cost, const uint8_t *data, uint32_t len);
+
+/**
+ * @brief  Counters accumulated between two snapshots.
+ * @param now    Later snapshot.
+ * @param before Earlier snapshot.
+ * @param delta  Result (may alias @p now).
+ */
+void I2C_Cost_Diff(const I2cBusCost_t *now, const I2cBusCost_t *before, I2cBusCost_t *delta);
+
+/**
+ * @brief  Bytes on the wire (address + control + payload).
+ * @param cost Counters.
+ * @return Byte count.
+ */
+uint32_t I2C_Cost_Bytes(const I2cBusCost_t *cost);
+
+/**
+ * @brief  SCL clocks needed for the counted activity.
+ * @param cost Counters.
+ * @return Clock count.
+ */
+uint32_t I2C_Cost_Clocks(const I2cBusCost_t *cost);
+
+/**
+ * @brief  Predicted wire time.
+ * @param cost   Counters.
+ * @param bus_hz SCL frequency.
+ * @return Microseconds (rounded up).
+ */
+uint32_t I2C_Cost_BusTimeUs(const I2cBusCost_t *cost, uint32_t bus_hz);
+
+/**
+ * @brief  Highest frame rate the bus sustains if @p frame is sent every frame.
+ * @param frame  Counters of one frame.
+ * @param bus_hz SCL frequency.
+ * @return Frames per second x 10 (0 if the frame is empty).
+ */
+uint32_t I2C_Cost_MaxFpsX10(const I2cBusCost_t *frame, uint32_t bus_hz);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // I2C_COST_H
@@ -15,7 +15,13 @@
  */
 
 #include "oled_driver.h"
+#include "oled_splash.h"
 #include "i2c.h"
+#include "trace.h"
+#include "mem_layout.h"
+#include "dwt_timer.h"
+#include "cmsis_os2.h"
+#include <string.h>
 
 
 
@@ -24,13 +30,42 @@
  *
  * This static object holds the state and configuration for the SH1106 OLED display.
  */
-static u8g2_t u8g2;
+static u8g2_t u8g2 CCM_SECTION("u8g2");
+
+/**
+ * @brief I2C bus activity since start-up (written by the display task only).
+ */
+static I2cBusCost_t oled_bus_cost;
+
+/**
+ * @brief Millisecond wait for the display controller.
+ *
+ * Blocks the calling task with osDelay() once the scheduler runs, so the reset pulse and the
+ * post-reset wait of OLED_Init() leave the CPU to other tasks; before that it falls back to
+ * the busy-waiting HAL_Delay(). One tick is added because the first tick of osDelay() may be
+ * partial, which keeps the wait at least as long as requested.
+ *
+ * @param[in] ms Milliseconds to wait.
+ */
+static void OLED_DelayMs(uint32_t ms)
+{
+    if (osKernelGetState() == osKernelRunning)
+    {
+        uint32_t ticks = ((ms * osKernelGetTickFreq()) + 999U) / 1000U;
+        (void)osDelay(ticks + 1U);
+    }
+    else
+    {
+        HAL_Delay(ms);
+    }
+}
 
 /**
  * @brief STM32-specific delay and GPIO callback for u8g2/u8x8.
  *
- * Provides timing and GPIO control for the u8g2 library on STM32 platforms. Handles delay messages
- * and basic GPIO operations as required by the u8g2/u8x8 interface.
+ * Provides timing and GPIO control for the u8g2 library on STM32 platforms. Millisecond delays
+ * block the calling task (OLED_DelayMs()); sub-millisecond delays busy-wait on the DWT cycle
+ * counter, which U8X8_MSG_GPIO_AND_DELAY_INIT starts if tracing has not already done so.
  *
  * @param[in] u8x8    Pointer to u8x8 structure.
  * @param[in] msg     Message type (U8X8_MSG_*).
@@ -43,14 +78,20 @@ uint8_t u8x8_stm32_gpio_and_delay(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, vo
 {
     switch (msg)
     {
+        case U8X8_MSG_GPIO_AND_DELAY_INIT:
+            DWT_Timer_Init();
+            break;
         case U8X8_MSG_DELAY_MILLI:
-            HAL_Delay(arg_int);
+            OLED_DelayMs(arg_int);
             break;
         case U8X8_MSG_DELAY_10MICRO:
-            HAL_Delay(1);
+            DWT_Timer_DelayUs(10U * arg_int);
             break;
         case U8X8_MSG_DELAY_100NANO:
-            __NOP();
+            DWT_Timer_DelayNs(100U * arg_int);
+            break;
+        case U8X8_MSG_DELAY_NANO:
+            DWT_Timer_DelayNs(arg_int);
             break;
         default:
             return 0;
@@ -73,7 +114,7 @@ uint8_t u8x8_stm32_gpio_and_delay(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, vo
  */
 uint8_t u8x8_byte_stm32_i2c(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr)
 {
-    static uint8_t buffer[32];
+    static uint8_t buffer[32] DMA_SECTION("oled");
     static uint8_t buf_idx;
     uint8_t *data;
 
@@ -96,6 +137,8 @@ uint8_t u8x8_byte_stm32_i2c(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *ar
             break;
         case U8X8_MSG_BYTE_END_TRANSFER:
             HAL_I2C_Master_Transmit(&hi2c1, (u8x8_GetI2CAddress(u8x8) << 1), buffer, buf_idx, HAL_MAX_DELAY);
+            I2C_Cost_AddTransfer(&oled_bus_cost, buffer, buf_idx);
+            TRACE_EVENT(TRACE_EVT_I2C_TRANSFER, 0, buf_idx);
             break;
         default:
             return 0;
@@ -107,15 +150,26 @@ uint8_t u8x8_byte_stm32_i2c(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *ar
  * @brief Initializes the OLED display (SH1106 I2C 128x64).
  *
  * Sets up the internal u8g2 object, configures the I2C address, initializes the display, and powers it on.
+ * After a boot splash the panel is already initialized and on: the reset sequence is skipped and the
+ * u8g2 buffer starts with the splash frame, so nothing on the panel changes until the first redraw.
  *
  * @note This function must be called before any drawing operations.
  */
 void OLED_Init(void)
 {
     u8g2_Setup_sh1106_i2c_128x64_noname_f(&u8g2, U8G2_R0, u8x8_byte_stm32_i2c, u8x8_stm32_gpio_and_delay);
-    u8g2_SetI2CAddress(&u8g2, 0x3C);
-    u8g2_InitDisplay(&u8g2);
-    u8g2_SetPowerSave(&u8g2, 0);
+    u8g2_SetI2CAddress(&u8g2, OLED_I2C_ADDRESS);
+    if (OLED_Splash_IsShown())
+    {
+        u8x8_gpio_Init(u8g2_GetU8x8(&u8g2));
+        OLED_Splash_CopyFrame(u8g2_GetBufferPtr(&u8g2),
+                              (size_t)u8g2_GetBufferTileWidth(&u8g2) * u8g2_GetBufferTileHeight(&u8g2) * 8U);
+    }
+    else
+    {
+        u8g2_InitDisplay(&u8g2);
+        u8g2_SetPowerSave(&u8g2, 0);
+    }
 }
 
 /**
@@ -128,4 +182,30 @@ void OLED_Init(void)
 u8g2_t* OLED_GetDisplay(void)
 {
     return &u8g2;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Returns the number of bytes sent to the display over I2C since start-up.
+ *
+ * Each transfer counts its payload plus the address byte. The counter wraps at 2^32; take
+ * differences to measure a frame.
+ *
+ * @return Cumulative I2C byte count.
+ */
+uint32_t OLED_GetBusBytes(void)
+{
+    return I2C_Cost_Bytes(&oled_bus_cost);
+}
+
+/**
+ * @brief Copies the I2C bus activity counters (START, address, control, payload, ACK).
+ *
+ * Only the display task updates the counters; called from another task the copy can be off
+ * by the transfer in progress.
+ *
+ * @param[out] cost Destination for the cumulative counters.
+ */
+void OLED_GetBusCost(I2cBusCost_t *cost)
+{
+    memcpy(cost, &oled_bus_cost, sizeof(*cost));
+}
@@ -15,17 +15,25 @@
 #define OLED_DRIVER_H
 
 #include "u8g2.h"
+#include "i2c_cost.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * @def OLED_I2C_ADDRESS
+ * @brief 7-bit I2C address of the SH1106 module.
+ */
+#define OLED_I2C_ADDRESS 0x3C
 
 /**
  * @brief Initializes the OLED display (SH1106 I2C 128x64).
  *
  * Sets up the internal u8g2 object, configures the I2C address, initializes the display,
  * and powers it on. This function must be called before any drawing operations.
+ * If the boot splash is on the panel (oled_splash.h), the controller is left as it is and
+ * the splash frame is copied into the u8g2 buffer instead.
  *
  * @note Call once during system startup before using any display functions.
  */
@@ -42,6 +50,28 @@ void OLED_Init(void);
 u8g2_t* OLED_GetDisplay(void);
 
 
+/**
+ * @brief Returns the number of bytes sent to the display over I2C since start-up.
+ *
+ * Each transfer counts its payload plus the address byte. The counter wraps at 2^32; take
+ * differences to measure a frame.
+ *
+ * @return Cumulative I2C byte count.
+ */
+uint32_t OLED_GetBusBytes(void);
+
+
+/**
+ * @brief Copies the I2C bus activity counters (START, address, control, payload, ACK).
+ *
+ * The counters are cumulative since start-up; use I2C_Cost_Diff() on two snapshots to get
+ * the cost of one frame.
+ *
+ * @param[out] cost Destination for the cumulative counters.
+ */
+void OLED_GetBusCost(I2cBusCost_t *cost);
+
+
 /**
  * @brief STM32 I2C transfer callback for u8g2/u8x8.
  *
@@ -0,0 +1,194 @@
+/**
+ * @file    oled_splash.c
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Boot splash: a pre-baked frame pushed to the SH1106 straight after MX_I2C1_Init().
+ *
+ * @details
+ * Every transfer is one I2C write: the command list with control byte 0x00, then per page
+ * a short command write (start line, column, page) and the 128 data bytes with control byte
+ * 0x40. The panel is switched on only after page 7, so the power-on contents of the GRAM are
+ * never visible. The u8g2 reset delays are skipped: the module has no reset line from the
+ * MCU, and a panel still in its power-on reset just does not acknowledge, which the first
+ * transfer retries (OLED_SPLASH_ATTEMPTS).
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "oled_splash.h"
+#include "oled_driver.h"
+#include "main.h"
+#include "i2c.h"
+#include "dwt_timer.h"
+#include "../Image/splash_pages.h"
+#include <string.h>
+
+/**
+ * @defgroup OLED_SPLASH_Private_Defines OLED Splash Private Defines
+ * @{
+ */
+/** Control byte: the rest of the transfer is commands */
+#define SPLASH_CTRL_CMD         0x00U
+/** Control byte: the rest of the transfer is display data */
+#define SPLASH_CTRL_DATA        0x40U
+/** Pages of the panel */
+#define SPLASH_PAGES            8U
+/** Columns of the panel */
+#define SPLASH_COLUMNS          128U
+/** First visible column of the 132-column SH1106 RAM */
+#define SPLASH_COLUMN_OFFSET    2U
+/** Timeout of one transfer (ms) */
+#define SPLASH_I2C_TIMEOUT_MS   50U
+/** @} */
+
+/**
+ * @defgroup OLED_SPLASH_Private_Variables OLED Splash Private Variables
+ * @{
+ */
+/**
+ * SH1106 set-up, the register values of u8x8_d_ssd1306_128x64_noname_init_seq (the sequence
+ * u8g2_Setup_sh1106_i2c_128x64_noname_f() sends), so the display task can skip its own init.
+ */
+static const uint8_t splash_init_cmds[] = {
+    SPLASH_CTRL_CMD,
+    0xAE,               /* display off */
+    0xD5, 0x80,         /* clock divide ratio and oscillator frequency */
+    0xA8, 0x3F,         /* multiplex ratio 64 */
+    0xD3, 0x00,         /* display offset */
+    0x40,               /* start line 0 */
+    0x8D, 0x14,         /* charge pump (SSD1306 only, ignored by the SH1106) */
+    0x20, 0x00,         /* addressing mode (SSD1306 only) */
+    0xA1,               /* segment remap */
+    0xC8,               /* COM scan direction reversed */
+    0xDA, 0x12,         /* COM pins configuration */
+    0x81, 0xCF,         /* contrast */
+    0xD9, 0xF1,         /* pre-charge period */
+    0xDB, 0x40,         /* VCOMH deselect level */
+    0x2E,               /* scroll off */
+    0xA4,               /* output RAM to display */
+    0xA6                /* normal (not inverted) display */
+};
+/** Display on, sent after the last page */
+static const uint8_t splash_on_cmd[] = { SPLASH_CTRL_CMD, 0xAF };
+/** Set when the whole splash reached the panel */
+static bool splash_shown;
+/** DWT cycles from reset to the end of SystemClock_Config() (run on the HSI) */
+static uint32_t splash_hsi_cycles;
+/** Reset to the last splash byte (us) */
+static uint32_t splash_boot_us;
+/** @} */
+
+/**
+ * @defgroup OLED_SPLASH_Private_Functions OLED Splash Private Functions
+ * @{
+ */
+/**
+ * @brief Write one transfer to the panel
+ * @param data Control byte followed by the payload
+ * @param len  Length in bytes
+ * @return HAL status
+ */
+static HAL_StatusTypeDef OLED_Splash_Write(const uint8_t *data, uint16_t len);
+/** @} */
+
+
+/**
+ * @brief  Record the end of the HSI phase of the boot. Call right after SystemClock_Config().
+ * @return None
+ */
+void OLED_Splash_MarkClockSwitch(void)
+{
+    splash_hsi_cycles = DWT_Timer_GetCycles();
+}
+
+/**
+ * @brief  Initialize the panel and show the splash frame (polling I2C1, before the kernel).
+ * @return None
+ */
+void OLED_Splash_Show(void)
+{
+#if OLED_SPLASH_ENABLE
+    uint8_t page_buf[1U + SPLASH_COLUMNS];
+    HAL_StatusTypeDef status = HAL_ERROR;
+
+    DWT_Timer_Init();
+    for (uint32_t attempt = 0; (attempt < OLED_SPLASH_ATTEMPTS) && (status != HAL_OK); attempt++)
+    {
+        if (attempt > 0U)
+        {
+            HAL_Delay(1);
+        }
+        status = OLED_Splash_Write(splash_init_cmds, sizeof(splash_init_cmds));
+    }
+
+    for (uint32_t page = 0; (page < SPLASH_PAGES) && (status == HAL_OK); page++)
+    {
+        const uint8_t address[] = {
+            SPLASH_CTRL_CMD,
+            0x40,                                           /* start line 0 */
+            (uint8_t)(0x10U | (SPLASH_COLUMN_OFFSET >> 4)), /* column, high nibble */
+            (uint8_t)(SPLASH_COLUMN_OFFSET & 0x0FU),        /* column, low nibble */
+            (uint8_t)(0xB0U | page)                         /* page */
+        };
+        status = OLED_Splash_Write(address, sizeof(address));
+        if (status == HAL_OK)
+        {
+            page_buf[0] = SPLASH_CTRL_DATA;
+            memcpy(&page_buf[1], &gImage_splash_pages[page * SPLASH_COLUMNS], SPLASH_COLUMNS);
+            status = OLED_Splash_Write(page_buf, sizeof(page_buf));
+        }
+    }
+
+    if (status == HAL_OK)
+    {
+        status = OLED_Splash_Write(splash_on_cmd, sizeof(splash_on_cmd));
+    }
+    if (status == HAL_OK)
+    {
+        uint32_t pll_cycles = DWT_Timer_GetCycles() - splash_hsi_cycles;
+        splash_boot_us = (uint32_t)(((uint64_t)splash_hsi_cycles * 1000000U) / HSI_VALUE) +
+                         DWT_Timer_CyclesToUs(pll_cycles);
+        splash_shown = true;
+    }
+#endif
+}
+
+/**
+ * @brief  Whether the splash reached the panel.
+ * @return true if the display task must not reset or clear the panel.
+ */
+bool OLED_Splash_IsShown(void)
+{
+    return splash_shown;
+}
+
+/**
+ * @brief  Time from reset to the last splash byte on the wire.
+ * @return Microseconds, or 0 if the splash was not shown.
+ */
+uint32_t OLED_Splash_GetBootUs(void)
+{
+    return splash_boot_us;
+}
+
+/**
+ * @brief  Copy the splash frame into a u8g2 full frame buffer.
+ * @param buf Destination.
+ * @param len Destination size in bytes.
+ * @return None
+ */
+void OLED_Splash_CopyFrame(uint8_t *buf, size_t len)
+{
+    memcpy(buf, gImage_splash_pages, (len < sizeof(gImage_splash_pages)) ? len : sizeof(gImage_splash_pages));
+}
+
+/**
+ * @brief Write one transfer to the panel.
+ * @param data Control byte followed by the payload.
+ * @param len  Length in bytes.
+ * @return HAL status.
+ */
+static HAL_StatusTypeDef OLED_Splash_Write(const uint8_t *data, uint16_t len)
+{
+    return HAL_I2C_Master_Transmit(&hi2c1, (uint16_t)(OLED_I2C_ADDRESS << 1), (uint8_t *)data, len,
+                                   SPLASH_I2C_TIMEOUT_MS);
+}
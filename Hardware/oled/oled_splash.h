@@ -0,0 +1,84 @@
+/**
+ * @file    oled_splash.h
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Boot splash: a pre-baked frame pushed to the SH1106 straight after MX_I2C1_Init().
+ *
+ * @details
+ * The normal path shows the first frame only after the kernel starts, OLED_Init() runs the
+ * u8g2 reset sequence (3 x 100 ms) and the display task clears and redraws the screen. The
+ * splash instead initializes the controller with the same register values as the u8g2 SH1106
+ * init sequence, writes Image/splash_pages.h (made by Tools/xbm_to_pages.py) page by page
+ * with polling I2C from main(), and switches the panel on. The display task then takes the
+ * panel over without resetting or clearing it (OLED_Init(), OLED_Display_Task()).
+ *
+ * The reset-to-splash time is measured with the DWT cycle counter, which SystemInit() starts
+ * from zero; OLED_Splash_MarkClockSwitch() separates the cycles run on the 16 MHz HSI from
+ * those after SystemClock_Config().
+ */
+
+#ifndef OLED_SPLASH_H
+#define OLED_SPLASH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+/**
+ * @def OLED_SPLASH_ENABLE
+ * @brief Set to 0 to skip the splash and use the full u8g2 init in the display task.
+ */
+#ifndef OLED_SPLASH_ENABLE
+#define OLED_SPLASH_ENABLE      1
+#endif
+
+/**
+ * @def OLED_SPLASH_ATTEMPTS
+ * @brief Tries of the first command transfer, 1 ms apart, while the panel is still in its
+ *        power-on reset and does not acknowledge its address.
+ */
+#define OLED_SPLASH_ATTEMPTS    20U
+
+/* Exported functions --------------------------------------------------------*/
+/**
+ * @brief  Record the end of the HSI phase of the boot. Call right after SystemClock_Config().
+ */
+void OLED_Splash_MarkClockSwitch(void);
+
+/**
+ * @brief  Initialize the panel and show the splash frame (polling I2C1, before the kernel).
+ * @note   Requires MX_GPIO_Init() and MX_I2C1_Init(). On an I2C error the splash is abandoned
+ *         and the display task falls back to the full u8g2 init.
+ */
+void OLED_Splash_Show(void);
+
+/**
+ * @brief  Whether the splash reached the panel (which is then initialized and switched on).
+ * @return true if the display task must not reset or clear the panel.
+ */
+bool OLED_Splash_IsShown(void);
+
+/**
+ * @brief  Time from reset to the last splash byte on the wire.
+ * @return Microseconds, or 0 if the splash was not shown.
+ */
+uint32_t OLED_Splash_GetBootUs(void);
+
+/**
+ * @brief  Copy the splash frame into a u8g2 full frame buffer (same page layout).
+ * @param buf Destination.
+ * @param len Destination size in bytes (at most the frame size is copied).
+ */
+void OLED_Splash_CopyFrame(uint8_t *buf, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // OLED_SPLASH_H
@@ -59,6 +59,7 @@
 #define U8G2_H
 
 #include "u8x8.h"
+#include "u8g2_prof.h"
 
 /*
   The following macro enables 16 Bit mode. 
@@ -85,6 +85,7 @@ void u8g2_DrawHorizontalBitmap(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_
 /* u8glib compatible bitmap draw function */
 void u8g2_DrawBitmap(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t cnt, u8g2_uint_t h, const uint8_t *bitmap)
 {
+  U8G2_PROF_ENTER(U8G2_PROF_DRAW_BITMAP);
   u8g2_uint_t w;
   w = cnt;
   w *= 8;
@@ -138,6 +139,7 @@ void u8g2_DrawHXBM(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len,
 
 void u8g2_DrawXBM(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap)
 {
+  U8G2_PROF_ENTER(U8G2_PROF_DRAW_XBM);
   u8g2_uint_t blen;
   blen = w;
   blen += 7;
@@ -197,6 +199,7 @@ void u8g2_DrawHXBMP(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len,
 
 void u8g2_DrawXBMP(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap)
 {
+  U8G2_PROF_ENTER(U8G2_PROF_DRAW_XBMP);
   u8g2_uint_t blen;
   blen = w;
   blen += 7;
@@ -41,6 +41,7 @@
 */
 void u8g2_DrawBox(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h)
 {
+  U8G2_PROF_ENTER(U8G2_PROF_DRAW_BOX);
 #ifdef U8G2_WITH_INTERSECTION
   if ( u8g2_IsIntersection(u8g2, x, y, x+w, y+h) == 0 ) 
     return;
@@ -60,6 +61,7 @@ void u8g2_DrawBox(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g
 */
 void u8g2_DrawFrame(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h)
 {
+  U8G2_PROF_ENTER(U8G2_PROF_DRAW_FRAME);
   u8g2_uint_t xtmp = x;
   
 #ifdef U8G2_WITH_INTERSECTION
@@ -87,6 +89,7 @@ void u8g2_DrawFrame(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u
 
 void u8g2_DrawRBox(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, u8g2_uint_t r)
 {
+  U8G2_PROF_ENTER(U8G2_PROF_DRAW_RBOX);
   u8g2_uint_t xl, yu;
   u8g2_uint_t yl, xr;
 
@@ -146,6 +149,7 @@ void u8g2_DrawRBox(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8
 
 void u8g2_DrawRFrame(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, u8g2_uint_t r)
 {
+  U8G2_PROF_ENTER(U8G2_PROF_DRAW_RFRAME);
   u8g2_uint_t xl, yu;
 
 #ifdef U8G2_WITH_INTERSECTION
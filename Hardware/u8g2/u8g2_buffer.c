@@ -39,11 +39,13 @@
 /*============================================*/
 void u8g2_ClearBuffer(u8g2_t *u8g2)
 {
+  U8G2_PROF_ENTER(U8G2_PROF_CLEAR_BUFFER);
   size_t cnt;
   cnt = u8g2_GetU8x8(u8g2)->display_info->tile_width;
   cnt *= u8g2->tile_buf_height;
   cnt *= 8;
   memset(u8g2->tile_buf_ptr, 0, cnt);
+  U8G2_PROF_BYTES(cnt);
 }
 
 /*============================================*/
@@ -92,6 +94,8 @@ static void u8g2_send_buffer(u8g2_t *u8g2)
 /* same as u8g2_send_buffer but also send the DISPLAY_REFRESH message (used by SSD1606) */
 void u8g2_SendBuffer(u8g2_t *u8g2)
 {
+  U8G2_PROF_ENTER(U8G2_PROF_SEND_BUFFER);
+  U8G2_PROF_BYTES((uint32_t)u8g2_GetU8x8(u8g2)->display_info->tile_width * u8g2->tile_buf_height * 8U);
   u8g2_send_buffer(u8g2);
   u8x8_RefreshDisplay( u8g2_GetU8x8(u8g2) );  
 }
@@ -152,12 +156,14 @@ uint8_t u8g2_NextPage(u8g2_t *u8g2)
 */
 void u8g2_UpdateDisplayArea(u8g2_t *u8g2, uint8_t  tx, uint8_t ty, uint8_t tw, uint8_t th)
 {
+  U8G2_PROF_ENTER(U8G2_PROF_UPDATE_AREA);
   uint16_t page_size;
   uint8_t *ptr;
   
   /* check, whether we are in full buffer mode */
   if ( u8g2->tile_buf_height != u8g2_GetU8x8(u8g2)->display_info->tile_height )
     return; /* not in full buffer mode, do nothing */
+  U8G2_PROF_BYTES((uint32_t)tw * th * 8U);
 
   page_size = u8g2->pixel_buf_width;  /* 8*u8g2->u8g2_GetU8x8(u8g2)->display_info->tile_width */
     
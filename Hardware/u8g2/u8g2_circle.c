@@ -108,6 +108,7 @@ static void u8g2_draw_circle(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_
 
 void u8g2_DrawCircle(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t rad, uint8_t option)
 {
+  U8G2_PROF_ENTER(U8G2_PROF_DRAW_CIRCLE);
   /* check for bounding box */
 #ifdef U8G2_WITH_INTERSECTION
   {
@@ -194,6 +195,7 @@ static void u8g2_draw_disc(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_ui
 
 void u8g2_DrawDisc(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t rad, uint8_t option)
 {
+  U8G2_PROF_ENTER(U8G2_PROF_DRAW_DISC);
   /* check for bounding box */
 #ifdef U8G2_WITH_INTERSECTION
   {
@@ -332,6 +334,7 @@ static void u8g2_draw_ellipse(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2
 
 void u8g2_DrawEllipse(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t rx, u8g2_uint_t ry, uint8_t option)
 {
+  U8G2_PROF_ENTER(U8G2_PROF_DRAW_ELLIPSE);
   /* check for bounding box */
 #ifdef U8G2_WITH_INTERSECTION
   {
@@ -465,6 +468,7 @@ static void u8g2_draw_filled_ellipse(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y
 
 void u8g2_DrawFilledEllipse(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t rx, u8g2_uint_t ry, uint8_t option)
 {
+  U8G2_PROF_ENTER(U8G2_PROF_DRAW_FILLED_ELLIPSE);
   /* check for bounding box */
 #ifdef U8G2_WITH_INTERSECTION
   {
@@ -935,6 +935,7 @@ void u8g2_SetFontMode(u8g2_t *u8g2, uint8_t is_transparent)
 
 u8g2_uint_t u8g2_DrawGlyph(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, uint16_t encoding)
 {
+  U8G2_PROF_ENTER(U8G2_PROF_DRAW_GLYPH);
 #ifdef U8G2_WITH_FONT_ROTATION
   switch(u8g2->font_decode.dir)
   {
@@ -1038,6 +1039,7 @@ static u8g2_uint_t u8g2_draw_string_2x(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t
 
 u8g2_uint_t u8g2_DrawStr(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, const char *str)
 {
+  U8G2_PROF_ENTER(U8G2_PROF_DRAW_STR);
   u8g2->u8x8.next_cb = u8x8_ascii_next;
   return u8g2_draw_string(u8g2, x, y, str);
 }
@@ -1060,6 +1062,7 @@ Bits	from 		to			bytes	Byte 1 		Byte 2 		Byte 3 		Byte 4 		Byte 5 		Byte 6
 */
 u8g2_uint_t u8g2_DrawUTF8(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, const char *str)
 {
+  U8G2_PROF_ENTER(U8G2_PROF_DRAW_UTF8);
   u8g2->u8x8.next_cb = u8x8_utf8_next;
   return u8g2_draw_string(u8g2, x, y, str);
 }
@@ -202,6 +202,7 @@ void u8g2_DrawHVLine(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len
 
 void u8g2_DrawHLine(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len)
 {
+  U8G2_PROF_ENTER(U8G2_PROF_DRAW_HLINE);
 // #ifdef U8G2_WITH_INTERSECTION
 //   if ( u8g2_IsIntersection(u8g2, x, y, x+len, y+1) == 0 ) 
 //     return;
@@ -211,6 +212,7 @@ void u8g2_DrawHLine(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len)
 
 void u8g2_DrawVLine(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len)
 {
+  U8G2_PROF_ENTER(U8G2_PROF_DRAW_VLINE);
 // #ifdef U8G2_WITH_INTERSECTION
 //   if ( u8g2_IsIntersection(u8g2, x, y, x+1, y+len) == 0 ) 
 //     return;
@@ -220,6 +222,7 @@ void u8g2_DrawVLine(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len)
 
 void u8g2_DrawPixel(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y)
 {
+  U8G2_PROF_ENTER(U8G2_PROF_DRAW_PIXEL);
 #ifdef U8G2_WITH_INTERSECTION
   if ( y < u8g2->user_y0 )
     return;
@@ -38,6 +38,7 @@
 
 void u8g2_DrawLine(u8g2_t *u8g2, u8g2_uint_t x1, u8g2_uint_t y1, u8g2_uint_t x2, u8g2_uint_t y2)
 {
+  U8G2_PROF_ENTER(U8G2_PROF_DRAW_LINE);
   u8g2_uint_t tmp;
   u8g2_uint_t x,y;
   u8g2_uint_t dx, dy;
@@ -71,6 +71,7 @@
 */
 void u8g2_ll_hvline_vertical_top_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir)
 {
+  U8G2_PROF_ENTER(U8G2_PROF_LL_HVLINE);
   uint16_t offset;
   uint8_t *ptr;
   uint8_t bit_pos, mask;
@@ -105,6 +106,7 @@ void u8g2_ll_hvline_vertical_top_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y,
   ptr += offset;
   ptr += x;
   
+  U8G2_PROF_PIXELS(len, (dir == 0) ? len : (((y & 7) + len + 7) >> 3));
   if ( dir == 0 )
   {
       do
@@ -200,6 +202,8 @@ static void u8g2_draw_pixel_vertical_top_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_u
 */
 void u8g2_ll_hvline_vertical_top_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir)
 {
+  U8G2_PROF_ENTER(U8G2_PROF_LL_HVLINE);
+  U8G2_PROF_PIXELS(len, (dir == 0) ? len : (((y & 7) + len + 7) >> 3));
   if ( dir == 0 )
   {
     do
@@ -243,6 +247,7 @@ void u8g2_ll_hvline_vertical_top_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y,
 /* SH1122, LD7032, ST7920, ST7986, LC7981, T6963, SED1330, RA8835, MAX7219, LS0 */ 
 void u8g2_ll_hvline_horizontal_right_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir)
 {
+  U8G2_PROF_ENTER(U8G2_PROF_LL_HVLINE);
   uint16_t offset;
   uint8_t *ptr;
   uint8_t bit_pos;
@@ -260,6 +265,7 @@ void u8g2_ll_hvline_horizontal_right_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_
   ptr = u8g2->tile_buf_ptr;
   ptr += offset;
   
+  U8G2_PROF_PIXELS(len, (dir == 0) ? (((x & 7) + len + 7) >> 3) : len);
   if ( dir == 0 )
   {
       
@@ -348,6 +354,8 @@ static void u8g2_draw_pixel_horizontal_right_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8
 /* SH1122, LD7032, ST7920, ST7986, LC7981, T6963, SED1330, RA8835, MAX7219, LS0 */ 
 void u8g2_ll_hvline_horizontal_right_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir)
 {
+  U8G2_PROF_ENTER(U8G2_PROF_LL_HVLINE);
+  U8G2_PROF_PIXELS(len, (dir == 0) ? (((x & 7) + len + 7) >> 3) : len);
   if ( dir == 0 )
   {
     do
@@ -337,6 +337,7 @@ void u8g2_DrawPolygon(u8g2_t *u8g2)
 
 void u8g2_DrawTriangle(u8g2_t *u8g2, int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2)
 {
+  U8G2_PROF_ENTER(U8G2_PROF_DRAW_TRIANGLE);
   u8g2_ClearPolygonXY();
   u8g2_AddPolygonXY(u8g2, x0, y0);
   u8g2_AddPolygonXY(u8g2, x1, y1);
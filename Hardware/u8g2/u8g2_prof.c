@@ -0,0 +1,196 @@
+/**
+ * @file    u8g2_prof.c
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Per-primitive profiling table of the u8g2 drawing functions.
+ *
+ * @details
+ * Open scopes are kept on a small stack so that pixels written by u8g2_ll_hvline are added
+ * to every instrumented caller (inclusive counts). The time base is the DWT cycle counter on
+ * the target and CLOCK_MONOTONIC on the host; both wrap at 2^32 and are only used for
+ * differences within one call.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "u8g2_prof.h"
+#include <stdio.h>
+#include <string.h>
+
+#if defined(__arm__) || defined(__ARMCC_VERSION)
+#include "dwt_timer.h"
+/** Unit of the time column */
+#define U8G2_PROF_TICK_UNIT     "cyc"
+#else
+#include <time.h>
+/** Unit of the time column */
+#define U8G2_PROF_TICK_UNIT     "ns"
+#endif
+
+/**
+ * @defgroup U8G2_PROF_Private_Defines U8G2 Profiling Private Defines
+ * @{
+ */
+/** Length of one report line */
+#define U8G2_PROF_LINE_LEN      80
+/** @} */
+
+/**
+ * @defgroup U8G2_PROF_Private_Variables U8G2 Profiling Private Variables
+ * @{
+ */
+/** Accumulated counters per row */
+static U8g2ProfEntry_t prof_table[U8G2_PROF_COUNT];
+/** Rows of the open scopes, outermost first */
+static uint8_t prof_stack[U8G2_PROF_MAX_DEPTH];
+/** Number of open scopes (may exceed U8G2_PROF_MAX_DEPTH; deeper scopes get no pixels) */
+static uint8_t prof_depth;
+
+#if U8G2_PROF_ENABLE
+/** Row names used by the report */
+static const char *const prof_names[U8G2_PROF_COUNT] = {
+    "ClearBuffer", "SendBuffer", "UpdateDisplayArea", "DrawPixel", "DrawHLine", "DrawVLine",
+    "DrawLine", "DrawBox", "DrawFrame", "DrawRBox", "DrawRFrame", "DrawCircle", "DrawDisc",
+    "DrawEllipse", "DrawFilledEllipse", "DrawTriangle", "DrawBitmap", "DrawXBM", "DrawXBMP",
+    "DrawGlyph", "DrawStr", "DrawUTF8", "ll_hvline"
+};
+#endif
+/** @} */
+
+/**
+ * @defgroup U8G2_PROF_Private_Functions U8G2 Profiling Private Functions
+ * @{
+ */
+/**
+ * @brief Current timestamp
+ * @return DWT cycles (target) or nanoseconds (host), wrapping at 2^32
+ */
+static uint32_t U8G2_Prof_Now(void);
+/** @} */
+
+
+/**
+ * @brief  Open a scope: count the call and take the start timestamp.
+ * @param id Row (U8g2ProfId_t).
+ * @return Scope state.
+ */
+U8g2ProfScope_t U8G2_Prof_Enter(uint8_t id)
+{
+    U8g2ProfScope_t scope;
+
+    prof_table[id].calls++;
+    if (prof_depth < U8G2_PROF_MAX_DEPTH)
+    {
+        prof_stack[prof_depth] = id;
+    }
+    prof_depth++;
+
+    scope.id = id;
+    scope.start = U8G2_Prof_Now();
+    return scope;
+}
+
+/**
+ * @brief  Close a scope (cleanup handler): add the elapsed time.
+ * @param scope Scope opened by U8G2_Prof_Enter().
+ * @return None
+ */
+void U8G2_Prof_Exit(U8g2ProfScope_t *scope)
+{
+    prof_table[scope->id].ticks += (uint32_t)(U8G2_Prof_Now() - scope->start);
+    if (prof_depth > 0U)
+    {
+        prof_depth--;
+    }
+}
+
+/**
+ * @brief  Account pixels and bytes to all open scopes.
+ * @param pixels Pixels written.
+ * @param bytes  Bytes written or sent.
+ * @return None
+ */
+void U8G2_Prof_AddPixels(uint32_t pixels, uint32_t bytes)
+{
+    uint8_t depth = (prof_depth < U8G2_PROF_MAX_DEPTH) ? prof_depth : U8G2_PROF_MAX_DEPTH;
+    for (uint8_t i = 0; i < depth; i++)
+    {
+        prof_table[prof_stack[i]].pixels += pixels;
+        prof_table[prof_stack[i]].bytes += bytes;
+    }
+}
+
+/**
+ * @brief  Clear the table.
+ * @return None
+ */
+void U8G2_Prof_Reset(void)
+{
+    memset(prof_table, 0, sizeof(prof_table));
+}
+
+/**
+ * @brief  Copy one row of the table.
+ * @param id    Row (U8g2ProfId_t).
+ * @param entry Destination.
+ * @return None
+ */
+void U8G2_Prof_Get(uint8_t id, U8g2ProfEntry_t *entry)
+{
+    *entry = prof_table[id];
+}
+
+/**
+ * @brief  Write the table as text, one line per called row, and clear it.
+ *
+ * Columns: calls, pixels and bytes (inclusive), total time in microseconds and average
+ * time per call in the native unit (cycles or ns).
+ *
+ * @param out Output function.
+ * @return None
+ */
+void U8G2_Prof_Report(void (*out)(const char *s))
+{
+#if U8G2_PROF_ENABLE
+    char line[U8G2_PROF_LINE_LEN];
+
+    snprintf(line, sizeof(line), "%-18s %8s %9s %8s %10s %9s/call\r\n",
+             "Primitive", "Calls", "Pixels", "Bytes", "Time us", U8G2_PROF_TICK_UNIT);
+    out(line);
+    for (uint8_t id = 0; id < U8G2_PROF_COUNT; id++)
+    {
+        const U8g2ProfEntry_t *entry = &prof_table[id];
+        if (entry->calls == 0U)
+        {
+            continue;
+        }
+#if defined(__arm__) || defined(__ARMCC_VERSION)
+        uint32_t time_us = DWT_Timer_CyclesToUs((uint32_t)entry->ticks);
+#else
+        uint32_t time_us = (uint32_t)(entry->ticks / 1000U);
+#endif
+        snprintf(line, sizeof(line), "%-18s %8lu %9lu %8lu %10lu %14lu\r\n", prof_names[id],
+                 (unsigned long)entry->calls, (unsigned long)entry->pixels,
+                 (unsigned long)entry->bytes, (unsigned long)time_us,
+                 (unsigned long)(entry->ticks / entry->calls));
+        out(line);
+    }
+    U8G2_Prof_Reset();
+#else
+    out("u8g2 profiling is compiled out (build with U8G2_PROF_ENABLE=1)\r\n");
+#endif
+}
+
+/**
+ * @brief Current timestamp.
+ * @return DWT cycles (target) or nanoseconds (host), wrapping at 2^32.
+ */
+static uint32_t U8G2_Prof_Now(void)
+{
+#if defined(__arm__) || defined(__ARMCC_VERSION)
+    return DWT_Timer_GetCycles();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec);
+#endif
+}
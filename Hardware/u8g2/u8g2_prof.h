@@ -0,0 +1,161 @@
+/**
+ * @file    u8g2_prof.h
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Optional per-primitive profiling hooks for the u8g2 drawing functions.
+ *
+ * @details
+ * With U8G2_PROF_ENABLE=1 every instrumented u8g2 entry point (ClearBuffer, SendBuffer,
+ * UpdateDisplayArea, the pixel/line/box/circle/bitmap/text primitives) and the low-level
+ * u8g2_ll_hvline callback count calls, pixels and frame buffer bytes written, and elapsed
+ * time into a table indexed by U8g2ProfId_t. Time is DWT cycles on the target and
+ * nanoseconds (clock_gettime) on the host.
+ *
+ * Numbers are inclusive: DrawStr contains the time and pixels of its DrawGlyph calls, and
+ * every primitive contains the u8g2_ll_hvline work done on its behalf. The scope guard uses
+ * the cleanup attribute (GCC, Clang, Arm Compiler 6), so early returns are accounted too.
+ *
+ * With U8G2_PROF_ENABLE=0 (default) all hooks expand to nothing; U8G2_Prof_Report() then
+ * only prints a note. Only one task may draw while profiling is enabled.
+ *
+ * This header is included from u8g2.h and must not include it.
+ */
+
+#ifndef U8G2_PROF_H
+#define U8G2_PROF_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+/**
+ * @def U8G2_PROF_ENABLE
+ * @brief Set to 1 (e.g. -DU8G2_PROF_ENABLE=1) to compile in the u8g2 profiling hooks.
+ */
+#ifndef U8G2_PROF_ENABLE
+#define U8G2_PROF_ENABLE        0
+#endif
+
+/**
+ * @def U8G2_PROF_MAX_DEPTH
+ * @brief Deepest nesting of instrumented calls that receives pixel and byte counts.
+ */
+#define U8G2_PROF_MAX_DEPTH     8
+
+/**
+ * @enum U8g2ProfId_t
+ * @brief Rows of the profiling table.
+ */
+typedef enum {
+    U8G2_PROF_CLEAR_BUFFER = 0,
+    U8G2_PROF_SEND_BUFFER,
+    U8G2_PROF_UPDATE_AREA,
+    U8G2_PROF_DRAW_PIXEL,
+    U8G2_PROF_DRAW_HLINE,
+    U8G2_PROF_DRAW_VLINE,
+    U8G2_PROF_DRAW_LINE,
+    U8G2_PROF_DRAW_BOX,
+    U8G2_PROF_DRAW_FRAME,
+    U8G2_PROF_DRAW_RBOX,
+    U8G2_PROF_DRAW_RFRAME,
+    U8G2_PROF_DRAW_CIRCLE,
+    U8G2_PROF_DRAW_DISC,
+    U8G2_PROF_DRAW_ELLIPSE,
+    U8G2_PROF_DRAW_FILLED_ELLIPSE,
+    U8G2_PROF_DRAW_TRIANGLE,
+    U8G2_PROF_DRAW_BITMAP,
+    U8G2_PROF_DRAW_XBM,
+    U8G2_PROF_DRAW_XBMP,
+    U8G2_PROF_DRAW_GLYPH,
+    U8G2_PROF_DRAW_STR,
+    U8G2_PROF_DRAW_UTF8,
+    U8G2_PROF_LL_HVLINE,
+    U8G2_PROF_COUNT
+} U8g2ProfId_t;
+
+/**
+ * @struct U8g2ProfEntry_t
+ * @brief Accumulated counters of one row.
+ */
+typedef struct {
+    uint32_t calls;         /**< Number of calls */
+    uint32_t pixels;        /**< Pixels written (through u8g2_ll_hvline) */
+    uint32_t bytes;         /**< Frame buffer bytes written, or sent for SendBuffer/UpdateDisplayArea */
+    uint64_t ticks;         /**< Inclusive time (DWT cycles on target, ns on host) */
+} U8g2ProfEntry_t;
+
+/**
+ * @struct U8g2ProfScope_t
+ * @brief State of one active instrumented call (lives on the caller's stack).
+ */
+typedef struct {
+    uint32_t start;         /**< Timestamp at entry */
+    uint8_t  id;            /**< Row (U8g2ProfId_t) */
+} U8g2ProfScope_t;
+
+/* Exported macros -----------------------------------------------------------*/
+#if U8G2_PROF_ENABLE
+#if !defined(__GNUC__) && !defined(__clang__)
+#error "U8G2_PROF_ENABLE needs the cleanup attribute (GCC, Clang or Arm Compiler 6)"
+#endif
+/** Open a profiling scope for the rest of the enclosing block (place before other statements) */
+#define U8G2_PROF_ENTER(id) \
+    U8g2ProfScope_t u8g2_prof_scope __attribute__((cleanup(U8G2_Prof_Exit))) = U8G2_Prof_Enter(id)
+/** Account pixels and frame buffer bytes to every open scope */
+#define U8G2_PROF_PIXELS(pixels, bytes)     U8G2_Prof_AddPixels((pixels), (bytes))
+/** Account bytes only (buffer clear and transfer) */
+#define U8G2_PROF_BYTES(bytes)              U8G2_Prof_AddPixels(0U, (bytes))
+#else
+#define U8G2_PROF_ENTER(id)
+#define U8G2_PROF_PIXELS(pixels, bytes)     ((void)0)
+#define U8G2_PROF_BYTES(bytes)              ((void)0)
+#endif
+
+/* Exported functions --------------------------------------------------------*/
+/**
+ * @brief  Open a scope: count the call and take the start timestamp.
+ * @param id Row (U8g2ProfId_t).
+ * @return Scope state.
+ */
+U8g2ProfScope_t U8G2_Prof_Enter(uint8_t id);
+
+/**
+ * @brief  Close a scope (cleanup handler): add the elapsed time.
+ * @param scope Scope opened by U8G2_Prof_Enter().
+ */
+void U8G2_Prof_Exit(U8g2ProfScope_t *scope);
+
+/**
+ * @brief  Account pixels and bytes to all open scopes.
+ * @param pixels Pixels written.
+ * @param bytes  Bytes written or sent.
+ */
+void U8G2_Prof_AddPixels(uint32_t pixels, uint32_t bytes);
+
+/**
+ * @brief  Clear the table.
+ */
+void U8G2_Prof_Reset(void);
+
+/**
+ * @brief  Copy one row of the table.
+ * @param id    Row (U8g2ProfId_t).
+ * @param entry Destination.
+ */
+void U8G2_Prof_Get(uint8_t id, U8g2ProfEntry_t *entry);
+
+/**
+ * @brief  Write the table as text, one line per called row, and clear it.
+ * @param out Output function (same signature as used by u8g2_WriteBufferPBM()).
+ */
+void U8G2_Prof_Report(void (*out)(const char *s));
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // U8G2_PROF_H
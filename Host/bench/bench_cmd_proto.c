@@ -0,0 +1,472 @@
+/**
+ * @file    bench_cmd_proto.c
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Throughput and fuzz test of the USART3 command frame parser (cmd_proto.h).
+ *
+ * @details
+ * The parser runs on a simulated RX ring of the firmware's size (UART_RX_BUFFER_SIZE) that a
+ * "DMA" fills in random-sized bursts, and is driven the way Console_Poll() drives it: bytes
+ * up to the next CMD_SYNC0 are console keys, a frame start goes to Cmd_Parse(), MORE waits
+ * for the next burst and every other result consumes what the parser says.
+ *
+ *   - clean:   valid frames mixed with console text; every frame must come out once, in
+ *              order and unchanged, with no error. Reports the polling time per frame and per
+ *              byte and the CPU share that parsing a saturated 115200 baud line takes here.
+ *   - noisy:   the same with random garbage (sync pairs included) and corrupted copies of
+ *              frames (bit flips, truncation, wrong length) in between. A corrupted copy must
+ *              never be accepted; an intact frame may only be lost under a garbage candidate
+ *              that passed the CRC by chance (1 in 65536), which is counted as "false".
+ *   - random:  random bytes as views split at random points; each result is checked against
+ *              an independent bitwise CRC and against the same bytes parsed unsplit.
+ *
+ *   ./bench_cmd_proto                  all three, about 2 s of random input
+ *   ./bench_cmd_proto --seconds 60     longer random run
+ *
+ * Build with -fsanitize=address,undefined to catch out-of-bounds reads. Exit status 1 on any
+ * failure.
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "cmd_proto.h"
+
+/** Ring size of the firmware (uart_rx.c) */
+#define RING_SIZE       4096u
+/** Largest DMA burst (half a ring, like the half-transfer event) */
+#define MAX_BURST       (RING_SIZE / 2u)
+/** Frames per traffic run */
+#define RUN_FRAMES      200000u
+/** Frame type of the generated frames; the payload starts with the frame number */
+#define TEST_TYPE       0x10u
+/** Line rate for the utilisation figure */
+#define LINE_BAUD       115200u
+/** Traffic buffer */
+#define TRAFFIC_CAP     (RUN_FRAMES * 160u)
+
+typedef struct {
+    uint8_t  data[RING_SIZE];
+    uint32_t head;      /**< Bytes written by the "DMA" */
+    uint32_t tail;      /**< Bytes consumed */
+} ring_t;
+
+typedef struct {
+    uint32_t frames;        /**< Genuine frames received */
+    uint32_t next;          /**< Next genuine frame number expected */
+    uint32_t missed;        /**< Genuine frames skipped */
+    uint32_t false_accepts; /**< Garbage accepted as a frame (CRC match by chance) */
+    uint32_t duplicates;    /**< Genuine frame numbers accepted twice or out of order */
+    uint32_t errors;        /**< Parser errors (sync, length, CRC) */
+    uint32_t console;       /**< Console bytes */
+    uint32_t calls;         /**< Cmd_Parse() calls */
+    uint64_t parse_ns;      /**< Time spent polling the ring */
+} result_t;
+
+static uint8_t traffic[TRAFFIC_CAP];
+static ring_t ring;
+static uint32_t rng_state = 12345u;
+
+static uint32_t rng(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+/** Bit-by-bit CRC-16/CCITT-FALSE, independent of the table in crc16.c */
+static uint16_t crc_ref(const uint8_t *data, size_t len)
+{
+    uint16_t crc = 0xFFFFu;
+    while (len-- > 0u)
+    {
+        crc ^= (uint16_t)(*data++ << 8);
+        for (int bit = 0; bit < 8; bit++)
+        {
+            crc = (crc & 0x8000u) ? (uint16_t)((crc << 1) ^ 0x1021u) : (uint16_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+/** Payload of genuine frame n: 4-byte frame number, then bytes derived from it */
+static size_t test_payload(uint32_t n, uint8_t *out)
+{
+    size_t len = 4u + (n * 7u) % (CMD_MAX_PAYLOAD - 3u);
+    memcpy(out, &n, 4);
+    for (size_t i = 4; i < len; i++)
+    {
+        out[i] = (uint8_t)(n * 31u + i * 17u);
+    }
+    return len;
+}
+
+static int is_genuine(const CmdFrame_t *frame, uint32_t *number)
+{
+    uint8_t expect[CMD_MAX_PAYLOAD];
+    uint32_t n;
+
+    if ((frame->type != TEST_TYPE) || (frame->len < 4u))
+    {
+        return 0;
+    }
+    memcpy(&n, frame->payload, 4);
+    if ((n >= RUN_FRAMES) || (test_payload(n, expect) != frame->len) ||
+        (memcmp(expect, frame->payload, frame->len) != 0))
+    {
+        return 0;
+    }
+    *number = n;
+    return 1;
+}
+
+/** Console text between frames: printable, so never CMD_SYNC0 */
+static size_t put_console(uint8_t *out)
+{
+    static const char keys[] = "sphi\r\n";
+    size_t len = rng() % 4u;
+    for (size_t i = 0; i < len; i++)
+    {
+        out[i] = (uint8_t)keys[rng() % (sizeof(keys) - 1u)];
+    }
+    return len;
+}
+
+/** Garbage, biased towards sync bytes and plausible headers */
+static size_t put_garbage(uint8_t *out)
+{
+    size_t len = 1u + rng() % 40u;
+    for (size_t i = 0; i < len; i++)
+    {
+        uint32_t r = rng() % 8u;
+        out[i] = (r == 0u) ? CMD_SYNC0 : (r == 1u) ? CMD_SYNC1 : (uint8_t)rng();
+    }
+    return len;
+}
+
+/** A corrupted copy of a frame that must not be accepted */
+static size_t put_corrupt(uint8_t *out, uint32_t n)
+{
+    uint8_t payload[CMD_MAX_PAYLOAD];
+    size_t len = Cmd_Encode(TEST_TYPE, payload, test_payload(n, payload), out, CMD_MAX_FRAME);
+
+    switch (rng() % 3u)
+    {
+        case 0:
+        {
+            /* One bit flip in type, payload or CRC: always caught by the CRC */
+            size_t at = 3u + rng() % (len - 3u);
+            out[at] ^= (uint8_t)(1u << (rng() % 8u));
+            return len;
+        }
+        case 1:
+            /* Truncated: the next frame start lands inside the CRC range */
+            return 3u + rng() % (len - 3u);
+        default:
+            /* Length byte off by a few */
+            out[2] = (uint8_t)(out[2] + 1u + rng() % 4u);
+            return len;
+    }
+}
+
+/** Build the traffic of a run; returns its length */
+static size_t make_traffic(int noisy)
+{
+    uint8_t payload[CMD_MAX_PAYLOAD];
+    size_t pos = 0;
+
+    for (uint32_t n = 0; n < RUN_FRAMES; n++)
+    {
+        pos += put_console(&traffic[pos]);
+        if (noisy)
+        {
+            uint32_t r = rng() % 4u;
+            if (r == 0u)
+            {
+                pos += put_garbage(&traffic[pos]);
+            }
+            else if (r == 1u)
+            {
+                pos += put_corrupt(&traffic[pos], n);
+            }
+        }
+        pos += Cmd_Encode(TEST_TYPE, payload, test_payload(n, payload), &traffic[pos], CMD_MAX_FRAME);
+    }
+    return pos;
+}
+
+static void ring_view(UartRxView_t *view)
+{
+    uint32_t fill = ring.head - ring.tail;
+    uint32_t start = ring.tail % RING_SIZE;
+    uint32_t first = RING_SIZE - start;
+
+    if (first > fill)
+    {
+        first = fill;
+    }
+    view->data[0] = &ring.data[start];
+    view->len[0] = first;
+    view->data[1] = ring.data;
+    view->len[1] = fill - first;
+}
+
+/** Consume what Console_Poll() would; returns 0 when it has to wait for more bytes */
+static int poll_ring(result_t *res, int flush)
+{
+    static uint8_t scratch[CMD_MAX_PAYLOAD];
+    UartRxView_t view;
+    int progress = 0;
+
+    for (;;)
+    {
+        ring_view(&view);
+        if ((view.len[0] + view.len[1]) == 0u)
+        {
+            return progress;
+        }
+        if (view.data[0][0] != CMD_SYNC0)
+        {
+            res->console++;
+            ring.tail++;
+            progress = 1;
+            continue;
+        }
+
+        CmdFrame_t frame;
+        size_t consumed;
+        CmdParseResult_t result = Cmd_Parse(&view, scratch, &frame, &consumed);
+        res->calls++;
+
+        if (result == CMD_PARSE_MORE)
+        {
+            if (!flush)
+            {
+                return progress;
+            }
+            /* End of input: the firmware's frame timeout */
+            consumed = 1;
+            res->errors++;
+        }
+        else if (result == CMD_PARSE_FRAME)
+        {
+            uint32_t n;
+            if (!is_genuine(&frame, &n))
+            {
+                res->false_accepts++;
+            }
+            else
+            {
+                if (n < res->next)
+                {
+                    /* A corrupted copy got through */
+                    res->duplicates++;
+                }
+                else
+                {
+                    res->missed += n - res->next;
+                    res->next = n + 1u;
+                    res->frames++;
+                }
+            }
+        }
+        else
+        {
+            res->errors++;
+        }
+        ring.tail += (uint32_t)consumed;
+        progress = 1;
+    }
+}
+
+/** Feed the traffic through the ring in random bursts and parse it */
+static void run_traffic(size_t len, result_t *res)
+{
+    size_t pos = 0;
+
+    memset(res, 0, sizeof(*res));
+    memset(&ring, 0, sizeof(ring));
+    while (pos < len)
+    {
+        uint32_t space = RING_SIZE - (ring.head - ring.tail);
+        uint32_t burst = 1u + rng() % MAX_BURST;
+        if (burst > space)
+        {
+            burst = space;
+        }
+        if (burst > (len - pos))
+        {
+            burst = (uint32_t)(len - pos);
+        }
+        for (uint32_t i = 0; i < burst; i++)
+        {
+            ring.data[(ring.head + i) % RING_SIZE] = traffic[pos + i];
+        }
+        ring.head += burst;
+        pos += burst;
+        uint64_t t0 = now_ns();
+        int progress = poll_ring(res, 0);
+        res->parse_ns += now_ns() - t0;
+        if (!progress && ((ring.head - ring.tail) == RING_SIZE))
+        {
+            /* A full ring that cannot be parsed would stall the firmware */
+            fprintf(stderr, "ring full without progress\n");
+            res->duplicates++;
+            return;
+        }
+    }
+    (void)poll_ring(res, 1);
+    res->missed += RUN_FRAMES - res->next;
+}
+
+/**
+ * Clean traffic must come through whole and without errors. In noisy traffic a random
+ * candidate passes the CRC with a chance of 1 in 65536; such a false accept may cover the
+ * start of the few genuine frames that fit in its span, nothing else may be lost.
+ */
+static int report_traffic(const char *name, size_t len, const result_t *res, int noisy)
+{
+    uint32_t hidden_max = res->false_accepts * (CMD_MAX_FRAME / (CMD_HEADER_SIZE + 4u + CMD_CRC_SIZE) + 1u);
+    int ok = ((res->frames + res->missed) == RUN_FRAMES) && (res->duplicates == 0u) &&
+             (noisy ? (res->missed <= hidden_max) : ((res->missed == 0u) && (res->errors == 0u) &&
+                                                     (res->false_accepts == 0u)));
+    double ns_per_byte = (double)res->parse_ns / (double)len;
+    double line_bytes_per_s = LINE_BAUD / 10.0;
+
+    printf("%-7s %8zu bytes %7" PRIu32 " frames %3" PRIu32 " missed %3" PRIu32 " false %8" PRIu32
+           " errors %8" PRIu32 " calls  %6.1f ns/frame %5.2f ns/byte  line %.4f%% CPU  %s\n",
+           name, len, res->frames, res->missed, res->false_accepts, res->errors, res->calls,
+           (double)res->parse_ns / (double)res->frames, ns_per_byte,
+           ns_per_byte * line_bytes_per_s / 1e7, ok ? "ok" : "FAIL");
+    return ok ? 0 : 1;
+}
+
+/** Check one Cmd_Parse() result on a split view against the contiguous bytes */
+static int check_random(const uint8_t *bytes, size_t total, size_t split)
+{
+    static uint8_t scratch[CMD_MAX_PAYLOAD];
+    static uint8_t whole_scratch[CMD_MAX_PAYLOAD];
+    UartRxView_t view = { { bytes, bytes + split }, { split, total - split } };
+    UartRxView_t whole = { { bytes, bytes + total }, { total, 0 } };
+    CmdFrame_t frame;
+    CmdFrame_t whole_frame;
+    size_t consumed;
+    size_t whole_consumed;
+
+    CmdParseResult_t result = Cmd_Parse(&view, scratch, &frame, &consumed);
+    CmdParseResult_t whole_result = Cmd_Parse(&whole, whole_scratch, &whole_frame, &whole_consumed);
+    if ((result != whole_result) || (consumed != whole_consumed) || (consumed > total))
+    {
+        return 1;
+    }
+    if ((result == CMD_PARSE_MORE) != (consumed == 0u))
+    {
+        return 1;
+    }
+    if (result != CMD_PARSE_FRAME)
+    {
+        return ((result != CMD_PARSE_MORE) && (consumed != 1u)) ? 1 : 0;
+    }
+    size_t size = CMD_HEADER_SIZE + frame.len + CMD_CRC_SIZE;
+    uint16_t crc = (uint16_t)(bytes[size - 2u] | (bytes[size - 1u] << 8));
+    if ((consumed != size) || (frame.len > CMD_MAX_PAYLOAD) || (frame.type != bytes[3]) ||
+        (crc_ref(&bytes[2], frame.len + 2u) != crc) ||
+        (memcmp(frame.payload, &bytes[CMD_HEADER_SIZE], frame.len) != 0) ||
+        (memcmp(whole_frame.payload, &bytes[CMD_HEADER_SIZE], frame.len) != 0))
+    {
+        return 1;
+    }
+    /* Zero-copy unless the split falls inside the payload */
+    int split_payload = (split > CMD_HEADER_SIZE) && (split < (CMD_HEADER_SIZE + frame.len));
+    return ((frame.payload == scratch) != split_payload) ? 1 : 0;
+}
+
+static int run_random(double seconds)
+{
+    uint8_t bytes[CMD_MAX_FRAME + 16u];
+    uint64_t cases = 0;
+    uint64_t frames = 0;
+    uint64_t failures = 0;
+    uint64_t end = now_ns() + (uint64_t)(seconds * 1e9);
+
+    while (now_ns() < end)
+    {
+        for (int batch = 0; batch < 10000; batch++)
+        {
+            size_t total = rng() % sizeof(bytes);
+            for (size_t i = 0; i < total; i++)
+            {
+                bytes[i] = (uint8_t)rng();
+            }
+            if ((total >= 2u) && (rng() % 2u))
+            {
+                /* Half the cases start with a sync pair, some with a valid frame */
+                bytes[0] = CMD_SYNC0;
+                bytes[1] = CMD_SYNC1;
+                if ((total >= CMD_HEADER_SIZE) && (rng() % 2u))
+                {
+                    size_t len = rng() % (CMD_MAX_PAYLOAD + 1u);
+                    if ((CMD_HEADER_SIZE + len + CMD_CRC_SIZE) <= total)
+                    {
+                        (void)Cmd_Encode(bytes[3], &bytes[CMD_HEADER_SIZE], len, bytes, sizeof(bytes));
+                        frames++;
+                    }
+                }
+            }
+            size_t split = (total > 0u) ? rng() % (total + 1u) : 0u;
+            if (check_random(bytes, total, split) != 0)
+            {
+                if (failures++ < 5u)
+                {
+                    fprintf(stderr, "random case failed: %zu bytes split at %zu\n", total, split);
+                }
+            }
+            cases++;
+        }
+    }
+    printf("random  %" PRIu64 " cases (%" PRIu64 " valid frames) split at random points, %" PRIu64
+           " failures  %s\n", cases, frames, failures, failures ? "FAIL" : "ok");
+    return failures ? 1 : 0;
+}
+
+int main(int argc, char **argv)
+{
+    double seconds = 2.0;
+    result_t res;
+    int failures = 0;
+
+    if ((argc == 3) && (strcmp(argv[1], "--seconds") == 0))
+    {
+        seconds = atof(argv[2]);
+    }
+    else if (argc != 1)
+    {
+        fprintf(stderr, "usage: %s [--seconds N]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    if (crc_ref((const uint8_t *)"123456789", 9) != 0x29B1u)
+    {
+        fprintf(stderr, "reference CRC broken\n");
+        return EXIT_FAILURE;
+    }
+
+    printf("ring %u bytes, bursts of 1..%u bytes, %u frames per run\n", RING_SIZE, MAX_BURST, RUN_FRAMES);
+    for (int noisy = 0; noisy <= 1; noisy++)
+    {
+        size_t len = make_traffic(noisy);
+        run_traffic(len, &res);
+        failures += report_traffic(noisy ? "noisy" : "clean", len, &res, noisy);
+    }
+    failures += run_random(seconds);
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,202 @@
+/**
+ * @file    bench_i2c_cost.c
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   I2C frame-rate calculator: bus cost of the u8x8 SSD13xx I2C transports.
+ *
+ * @details
+ * Runs the display initialisation and one full-buffer frame through each u8x8 CAD layer that
+ * can drive the SH1106 over I2C, counts START conditions, address, control and payload bytes
+ * and ACK bits with the firmware cost model (Hardware/oled/i2c_cost.c) and prints the predicted
+ * wire time and bus-bound frame rate at 100 kHz, 400 kHz, 1 MHz and an optional extra clock.
+ *
+ * Every transfer is also decoded by the SH1106 emulator, so a transport that produces a wrong
+ * picture is flagged, and the model is checked against the emulator's wire time.
+ *
+ * @code
+ * ./bench_i2c_cost              # standard speeds
+ * ./bench_i2c_cost -b 800000    # add an 800 kHz column
+ * @endcode
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "u8g2.h"
+#include "sh1106_emu.h"
+#include "i2c_cost.h"
+#include "bongo_cat_1.h"
+
+/** Width of the bongo cat bitmap (pixels) */
+#define BONGO_WIDTH     101
+/** Height of the bongo cat bitmap (pixels) */
+#define IMAGE_SIZE      64
+/** Largest transfer buffered by the byte callback (u8x8_byte_stm32_i2c uses 32) */
+#define MAX_TRANSFER    32
+/** Number of bus clocks reported */
+#define MAX_SPEEDS      4
+
+/** One I2C transport under test */
+typedef struct {
+    const char *name;       /**< Transport name */
+    u8x8_msg_cb cad;        /**< u8x8 CAD layer */
+} Transport_t;
+
+static const Transport_t transports[] = {
+    { "ssd13xx_i2c",      u8x8_cad_ssd13xx_i2c },
+    { "ssd13xx_fast_i2c", u8x8_cad_ssd13xx_fast_i2c },
+};
+
+static Sh1106Emu_t emu;
+static I2cBusCost_t bus_cost;
+static uint8_t transfer[MAX_TRANSFER];
+static size_t transfer_len;
+static uint32_t overflows;
+
+/** Byte backend: buffer one transfer like the firmware, then cost and emulate it. */
+static uint8_t cost_byte_cb(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr)
+{
+    const uint8_t *data = (const uint8_t *)arg_ptr;
+
+    switch (msg)
+    {
+        case U8X8_MSG_BYTE_SEND:
+            while (arg_int-- > 0)
+            {
+                if (transfer_len < MAX_TRANSFER)
+                {
+                    transfer[transfer_len++] = *data;
+                }
+                else
+                {
+                    overflows++;
+                }
+                data++;
+            }
+            break;
+        case U8X8_MSG_BYTE_START_TRANSFER:
+            transfer_len = 0;
+            break;
+        case U8X8_MSG_BYTE_END_TRANSFER:
+            I2C_Cost_AddTransfer(&bus_cost, transfer, (uint32_t)transfer_len);
+            SH1106_Emu_Write(&emu, (uint8_t)u8x8_GetI2CAddress(u8x8), transfer, transfer_len);
+            break;
+        default:
+            break;
+    }
+    return 1;
+}
+
+/** Panel pixels that differ from the u8g2 frame buffer. */
+static uint32_t count_mismatches(u8g2_t *u8g2)
+{
+    const uint8_t *buf = u8g2_GetBufferPtr(u8g2);
+    uint32_t mismatches = 0;
+
+    for (int y = 0; y < SH1106_EMU_ROWS; y++)
+    {
+        for (int x = 0; x < SH1106_EMU_PANEL_WIDTH; x++)
+        {
+            int expected = (buf[(y / 8) * SH1106_EMU_PANEL_WIDTH + x] >> (y % 8)) & 1;
+            mismatches += (uint32_t)(SH1106_Emu_GetPixel(&emu, x, y) != expected);
+        }
+    }
+    return mismatches;
+}
+
+static void print_row(const char *transport, const char *phase, const I2cBusCost_t *cost,
+                      const uint32_t *speeds, int speed_count)
+{
+    printf("%-17s %-6s %6" PRIu32 " %6" PRIu32 " %8" PRIu32 " %6" PRIu32 " %7" PRIu32,
+           transport, phase, cost->starts, cost->control_bytes, cost->payload_bytes,
+           cost->ack_bits, I2C_Cost_Clocks(cost));
+    for (int i = 0; i < speed_count; i++)
+    {
+        uint32_t fps_x10 = I2C_Cost_MaxFpsX10(cost, speeds[i]);
+        printf(" | %7" PRIu32 " %4" PRIu32 ".%" PRIu32,
+               I2C_Cost_BusTimeUs(cost, speeds[i]), fps_x10 / 10u, fps_x10 % 10u);
+    }
+    printf("\n");
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "usage: %s [-b bus_hz]\n", prog);
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t speeds[MAX_SPEEDS] = { I2C_COST_STANDARD_HZ, I2C_COST_FAST_HZ, I2C_COST_FAST_PLUS_HZ };
+    int speed_count = 3;
+    int status = 0;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "-b") == 0) && (i + 1 < argc))
+        {
+            speeds[speed_count++] = (uint32_t)strtoul(argv[++i], NULL, 0);
+            if (speeds[speed_count - 1] == 0u)
+            {
+                usage(argv[0]);
+                return 2;
+            }
+        }
+        else
+        {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+
+    printf("%-17s %-6s %6s %6s %8s %6s %7s", "Transport", "Phase", "Starts", "Ctrl", "Payload", "ACK", "Clocks");
+    for (int i = 0; i < speed_count; i++)
+    {
+        char label[16];
+        snprintf(label, sizeof(label), "%" PRIu32 "k us", speeds[i] / 1000u);
+        printf(" | %7s %6s", label, "fps");
+    }
+    printf("\n");
+
+    for (size_t t = 0; t < sizeof(transports) / sizeof(transports[0]); t++)
+    {
+        u8g2_t u8g2;
+        I2cBusCost_t init_cost;
+
+        SH1106_Emu_Init(&emu, I2C_COST_FAST_HZ);
+        u8g2_Setup_sh1106_i2c_128x64_noname_f(&u8g2, U8G2_R0, cost_byte_cb, SH1106_Emu_GpioAndDelayCb);
+        u8g2_GetU8x8(&u8g2)->cad_cb = transports[t].cad;
+        u8x8_SetUserPtr(u8g2_GetU8x8(&u8g2), &emu);
+        u8g2_SetI2CAddress(&u8g2, 0x3C);
+        overflows = 0;
+
+        I2C_Cost_Reset(&bus_cost);
+        u8g2_InitDisplay(&u8g2);
+        u8g2_SetPowerSave(&u8g2, 0);
+        init_cost = bus_cost;
+
+        u8g2_ClearBuffer(&u8g2);
+        u8g2_DrawXBMP(&u8g2, 13, 0, BONGO_WIDTH, IMAGE_SIZE, gImage_bongo_cat_1);
+        I2C_Cost_Reset(&bus_cost);
+        SH1106_Emu_ResetStats(&emu);
+        u8g2_SendBuffer(&u8g2);
+
+        print_row(transports[t].name, "init", &init_cost, speeds, speed_count);
+        print_row(transports[t].name, "frame", &bus_cost, speeds, speed_count);
+
+        uint32_t mismatches = count_mismatches(&u8g2);
+        uint64_t model_ns = (uint64_t)I2C_Cost_Clocks(&bus_cost) * 1000000000ull / I2C_COST_FAST_HZ;
+        uint64_t emu_ns = emu.stats.bus_time_ns;
+        uint64_t diff_ns = (model_ns > emu_ns) ? (model_ns - emu_ns) : (emu_ns - model_ns);
+        if ((mismatches != 0u) || (overflows != 0u) || (diff_ns > emu.stats.transactions))
+        {
+            printf("  %s: %" PRIu32 " wrong pixels, %" PRIu32 " bytes over the %d-byte buffer, "
+                   "model %" PRIu64 " ns vs emulator %" PRIu64 " ns\n",
+                   transports[t].name, mismatches, overflows, MAX_TRANSFER, model_ns, emu_ns);
+            status = 1;
+        }
+    }
+
+    printf("fps = bus-bound maximum for a full-buffer flush (one frame = one u8g2_SendBuffer()).\n");
+    return status;
+}
@@ -0,0 +1,267 @@
+/**
+ * @file    bench_mem_pool.c
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Host stress test of the fixed-block pools against heap_4.
+ *
+ * @details
+ * Runs inside a FreeRTOS task on the POSIX port. The same seeded random sequence of
+ * allocations and releases (mostly text payloads, few frame buffers, never more live blocks
+ * per class than the pool holds) is replayed twice: once through
+ * MemPool_Alloc()/MemPool_Free() and once through pvPortMalloc()/vPortFree(). Every call is
+ * timed with CLOCK_MONOTONIC; the report gives mean, median, 99th percentile and worst case
+ * per allocator and operation, the failed allocations and, for heap_4, the free block list
+ * while the working set is still live (fragmentation).
+ *
+ * Host numbers are not target numbers. Every pool call enters several critical sections (the
+ * CMSIS semaphore, the free list, the counters), and on the POSIX port each one masks signals
+ * with a system call, while heap_4 only suspends the scheduler. On the Cortex-M4 a critical
+ * section is a few cycles, so compare the spread (p99 and worst case against the median) and
+ * the heap fragmentation rather than the means.
+ *
+ * @code
+ * ./bench_mem_pool            # 200000 operations, seed 1
+ * ./bench_mem_pool 50000 7    # operations, seed
+ * @endcode
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "cmsis_os2.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "mem_pool.h"
+
+/** Default number of operations per allocator */
+#define BENCH_DEFAULT_OPS   200000u
+/** Bench task stack size (bytes) */
+#define BENCH_STACK_SIZE    (1024 * 4)
+/** Largest live set of one class */
+#define BENCH_MAX_LIVE      MEM_POOL_TEXT_COUNT
+
+/** Allocator under test */
+typedef enum {
+    BENCH_POOL = 0,
+    BENCH_HEAP,
+    BENCH_ALLOCATOR_COUNT
+} BenchAllocator_t;
+
+/** Latency samples of one allocator */
+typedef struct {
+    uint32_t *alloc_ns;     /**< Allocation latencies */
+    uint32_t *free_ns;      /**< Release latencies */
+    uint32_t allocs;        /**< Number of allocation samples */
+    uint32_t frees;         /**< Number of release samples */
+    uint32_t failures;      /**< Allocations that returned NULL */
+} BenchResult_t;
+
+/** Request sizes and live-set limits per class, indexed by MemPoolId_t */
+static const uint32_t class_size[MEM_POOL_COUNT] = {
+    MEM_POOL_TEXT_SIZE, MEM_POOL_FRAME_SIZE
+};
+static const uint32_t class_limit[MEM_POOL_COUNT] = {
+    MEM_POOL_TEXT_COUNT, MEM_POOL_FRAME_COUNT
+};
+static const char *const allocator_name[BENCH_ALLOCATOR_COUNT] = { "pool", "heap_4" };
+
+static uint32_t bench_ops = BENCH_DEFAULT_OPS;
+static uint32_t bench_seed = 1u;
+static BenchResult_t results[BENCH_ALLOCATOR_COUNT];
+static HeapStats_t heap_live_stats;
+
+static uint32_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec);
+}
+
+/** xorshift32: the same sequence for both allocators */
+static uint32_t next_random(uint32_t *state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+/** Class of the next operation: 95 % text, 5 % frame buffers */
+static MemPoolId_t pick_class(uint32_t r)
+{
+    return ((r % 100u) < 95u) ? MEM_POOL_TEXT : MEM_POOL_FRAME;
+}
+
+static void *do_alloc(BenchAllocator_t allocator, MemPoolId_t cls)
+{
+    return (allocator == BENCH_POOL) ? MemPool_Alloc(cls, 0u) : pvPortMalloc(class_size[cls]);
+}
+
+static void do_free(BenchAllocator_t allocator, MemPoolId_t cls, void *block)
+{
+    if (allocator == BENCH_POOL)
+    {
+        (void)MemPool_Free(cls, block);
+    }
+    else
+    {
+        vPortFree(block);
+    }
+}
+
+/** Replay the seeded sequence through one allocator. */
+static void run(BenchAllocator_t allocator, BenchResult_t *res)
+{
+    void *live[MEM_POOL_COUNT][BENCH_MAX_LIVE];
+    uint32_t live_count[MEM_POOL_COUNT] = { 0 };
+    uint32_t state = bench_seed;
+
+    res->alloc_ns = malloc(bench_ops * sizeof(uint32_t));
+    res->free_ns = malloc(bench_ops * sizeof(uint32_t));
+    if ((res->alloc_ns == NULL) || (res->free_ns == NULL))
+    {
+        fprintf(stderr, "out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+
+    for (uint32_t op = 0; op < bench_ops; op++)
+    {
+        MemPoolId_t cls = pick_class(next_random(&state));
+        uint32_t r = next_random(&state);
+        uint32_t n = live_count[cls];
+        int allocate = (n == 0u) || ((n < class_limit[cls]) && ((r & 0xFFu) < 140u));
+
+        if (allocate)
+        {
+            uint32_t t0 = now_ns();
+            void *block = do_alloc(allocator, cls);
+            res->alloc_ns[res->allocs++] = now_ns() - t0;
+            if (block == NULL)
+            {
+                res->failures++;
+                continue;
+            }
+            memset(block, (int)op, class_size[cls]);
+            live[cls][live_count[cls]++] = block;
+        }
+        else
+        {
+            uint32_t slot = (r >> 8) % n;
+            void *block = live[cls][slot];
+            live[cls][slot] = live[cls][--live_count[cls]];
+            uint32_t t0 = now_ns();
+            do_free(allocator, cls, block);
+            res->free_ns[res->frees++] = now_ns() - t0;
+        }
+
+        /* Fragmentation snapshot halfway through, with a working set still allocated */
+        if ((allocator == BENCH_HEAP) && (op == bench_ops / 2u))
+        {
+            vPortGetHeapStats(&heap_live_stats);
+        }
+    }
+
+    for (uint32_t cls = 0; cls < MEM_POOL_COUNT; cls++)
+    {
+        while (live_count[cls] > 0u)
+        {
+            do_free(allocator, (MemPoolId_t)cls, live[cls][--live_count[cls]]);
+        }
+    }
+}
+
+static int cmp_u32(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+static void print_row(const char *allocator, const char *op, uint32_t *samples, uint32_t count)
+{
+    if (count == 0u)
+    {
+        return;
+    }
+    uint64_t sum = 0;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        sum += samples[i];
+    }
+    qsort(samples, count, sizeof(samples[0]), cmp_u32);
+    printf("%-8s %-6s %9" PRIu32 " %9.1f %8" PRIu32 " %8" PRIu32 " %9" PRIu32 "\n",
+           allocator, op, count, (double)sum / count, samples[count / 2u],
+           samples[(uint32_t)((uint64_t)count * 99u / 100u)], samples[count - 1u]);
+}
+
+static void report(void)
+{
+    printf("%u operations, seed %u\n\n", (unsigned)bench_ops, (unsigned)bench_seed);
+    printf("%-8s %-6s %9s %9s %8s %8s %9s\n", "Alloc", "Op", "Count", "Mean ns", "p50 ns",
+           "p99 ns", "Max ns");
+    for (uint32_t a = 0; a < BENCH_ALLOCATOR_COUNT; a++)
+    {
+        print_row(allocator_name[a], "alloc", results[a].alloc_ns, results[a].allocs);
+        print_row(allocator_name[a], "free", results[a].free_ns, results[a].frees);
+    }
+
+    printf("\nFailed allocations: pool %" PRIu32 ", heap_4 %" PRIu32 "\n",
+           results[BENCH_POOL].failures, results[BENCH_HEAP].failures);
+    printf("heap_4 at mid-run: %u bytes free in %u blocks, largest %u, smallest %u\n",
+           (unsigned)heap_live_stats.xAvailableHeapSpaceInBytes,
+           (unsigned)heap_live_stats.xNumberOfFreeBlocks,
+           (unsigned)heap_live_stats.xSizeOfLargestFreeBlockInBytes,
+           (unsigned)heap_live_stats.xSizeOfSmallestFreeBlockInBytes);
+
+    printf("\n");
+    fflush(stdout);
+    MemPool_Print();
+}
+
+static void bench_task(void *argument)
+{
+    (void)argument;
+    run(BENCH_POOL, &results[BENCH_POOL]);
+    run(BENCH_HEAP, &results[BENCH_HEAP]);
+    vTaskSuspendAll();
+    report();
+    exit(EXIT_SUCCESS);
+}
+
+int main(int argc, char **argv)
+{
+    if (argc > 1)
+    {
+        bench_ops = (uint32_t)strtoul(argv[1], NULL, 0);
+    }
+    if (argc > 2)
+    {
+        bench_seed = (uint32_t)strtoul(argv[2], NULL, 0);
+    }
+    if ((bench_ops == 0u) || (bench_seed == 0u))
+    {
+        fprintf(stderr, "usage: %s [operations] [seed (non-zero)]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    osKernelInitialize();
+    MemPool_Init();
+
+    const osThreadAttr_t bench_task_attributes = {
+        .name = "Bench",
+        .priority = osPriorityNormal,
+        .stack_size = BENCH_STACK_SIZE
+    };
+    if (osThreadNew(bench_task, NULL, &bench_task_attributes) == NULL)
+    {
+        fprintf(stderr, "Failed to create bench task\n");
+        return EXIT_FAILURE;
+    }
+
+    osKernelStart();
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,173 @@
+/**
+ * @file    bench_qr.c
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Run time of the QR encoder and of the symbol renderer, and a check against the
+ *          former static QR bitmap.
+ *
+ * @details
+ * For every supported version and error correction level a payload of exactly the version's
+ * capacity is encoded -n times; mean and worst-case encode time are printed together with the
+ * symbol size, chosen mask and the RAM the symbol occupies. The renderer is timed drawing the
+ * version 2 and version 4 symbols into the 64 x 64 area of the QR screen.
+ *
+ * The default payload (OLED_QR_PAYLOAD) is also compared module by module with
+ * Image/img_qrcode.h, the bitmap the QR screen showed before it encoded on the device
+ * (25 modules scaled to 60 px at a 2 px offset, light pixels set). Exit status 1 on a mismatch
+ * or an encoder error.
+ *
+ * @code
+ * ./bench_qr              # 2000 encodes per case
+ * ./bench_qr -n 20000
+ * @endcode
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "u8g2.h"
+#include "qr_encode.h"
+#include "screens.h"
+#include "img_qrcode.h"
+
+/** Default encodes per case */
+#define BENCH_ITERATIONS    2000
+/** Side of Image/img_qrcode.h (pixels) */
+#define REF_IMAGE_SIZE      64
+/** Modules of the symbol in Image/img_qrcode.h */
+#define REF_MODULES         25
+/** Pixels of the symbol in Image/img_qrcode.h, and its offset */
+#define REF_SYMBOL_PX       60.0
+#define REF_OFFSET_PX       2.0
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static uint8_t null_cb(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr)
+{
+    (void)u8x8;
+    (void)msg;
+    (void)arg_int;
+    (void)arg_ptr;
+    return 1;
+}
+
+/** Compare the default payload with the former bitmap; returns the number of differing modules. */
+static int check_reference(void)
+{
+    QrCode_t qr;
+    const double pitch = REF_SYMBOL_PX / REF_MODULES;
+    const int stride = REF_IMAGE_SIZE / 8;
+    int diffs = 0;
+
+    if (QR_Encode(&qr, (const uint8_t *)OLED_QR_PAYLOAD, strlen(OLED_QR_PAYLOAD), QR_ECC_L) != 0)
+    {
+        return -1;
+    }
+    if (qr.size != REF_MODULES)
+    {
+        printf("reference: version %u (%u modules), bitmap has %d\n", qr.version, qr.size, REF_MODULES);
+        return -1;
+    }
+    for (int my = 0; my < REF_MODULES; my++)
+    {
+        for (int mx = 0; mx < REF_MODULES; mx++)
+        {
+            int px = (int)(REF_OFFSET_PX + (mx + 0.5) * pitch);
+            int py = (int)(REF_OFFSET_PX + (my + 0.5) * pitch);
+            int lit = (gImage_img_qrcode[py * stride + px / 8] >> (px % 8)) & 1;
+            diffs += (lit == QR_GetModule(&qr, (uint8_t)mx, (uint8_t)my));
+        }
+    }
+    printf("reference: \"%s\" -> version %u, mask %u, %d of %d modules differ from img_qrcode.h\n",
+           OLED_QR_PAYLOAD, qr.version, qr.mask, diffs, REF_MODULES * REF_MODULES);
+    return diffs;
+}
+
+int main(int argc, char **argv)
+{
+    int iterations = BENCH_ITERATIONS;
+    int failures = 0;
+    uint8_t payload[QR_PAYLOAD_MAX];
+    static const char *ecc_names[] = { "L", "M" };
+
+    for (int i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "-n") == 0) && (i + 1 < argc))
+        {
+            iterations = atoi(argv[++i]);
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [-n iterations]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (iterations < 1)
+    {
+        iterations = 1;
+    }
+
+    for (size_t i = 0; i < sizeof(payload); i++)
+    {
+        payload[i] = (uint8_t)("https://example.com/0123456789abcdefghijklmnopqrstuvwxyz"[i % 56]);
+    }
+
+    printf("sizeof(QrCode_t) = %zu bytes, %d encodes per case\n\n", sizeof(QrCode_t), iterations);
+    printf("%-8s %4s %8s %5s %5s %10s %10s\n", "Version", "ECC", "Payload", "Size", "Mask", "Mean us", "Max us");
+    for (uint8_t version = 1; version <= QR_VERSION_MAX; version++)
+    {
+        for (int ecc = QR_ECC_L; ecc <= QR_ECC_M; ecc++)
+        {
+            QrCode_t qr;
+            size_t len = QR_Capacity(version, (QrEcc_t)ecc);
+            double total = 0.0;
+            double worst = 0.0;
+
+            for (int n = 0; n < iterations; n++)
+            {
+                double t0 = now_ns();
+                int rc = QR_Encode(&qr, payload, len, (QrEcc_t)ecc);
+                double dt = now_ns() - t0;
+                total += dt;
+                worst = (dt > worst) ? dt : worst;
+                if ((rc != 0) || (qr.version != version))
+                {
+                    failures++;
+                    break;
+                }
+            }
+            printf("%-8u %4s %8zu %5u %5u %10.2f %10.2f\n", version, ecc_names[ecc], len, qr.size, qr.mask,
+                   total / iterations / 1e3, worst / 1e3);
+        }
+    }
+
+    u8g2_t u8g2;
+    u8g2_Setup_sh1106_i2c_128x64_noname_f(&u8g2, U8G2_R0, null_cb, null_cb);
+    printf("\n%-22s %10s\n", "Render", "Mean us");
+    for (uint8_t version = 2; version <= QR_VERSION_MAX; version += 2)
+    {
+        QrCode_t qr;
+        (void)QR_Encode(&qr, payload, QR_Capacity(version, QR_ECC_L), QR_ECC_L);
+        double t0 = now_ns();
+        for (int n = 0; n < iterations; n++)
+        {
+            Screens_DrawQRSymbol(&u8g2, &qr, 0, 0, SCREENS_QR_AREA);
+        }
+        printf("version %u (%u px/module) %10.2f\n", version, (qr.size + 2) * 2 <= SCREENS_QR_AREA ? 2U : 1U,
+               (now_ns() - t0) / iterations / 1e3);
+    }
+
+    printf("\n");
+    if (check_reference() != 0)
+    {
+        failures++;
+    }
+    printf("%d failure(s)\n", failures);
+    return (failures != 0) ? 1 : 0;
+}
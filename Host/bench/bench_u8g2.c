@@ -0,0 +1,308 @@
+/**
+ * @file    bench_u8g2.c
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Host micro-benchmarks of the u8g2 primitives used by the display task.
+ *
+ * @details
+ * Each case runs one u8g2 call on the 128x64 SH1106 full-buffer setup used by OLED_Init().
+ * The iteration count is calibrated until a batch takes at least --min-time-ms, then
+ * BENCH_REPETITIONS batches are timed and the median is reported as ns/op. "bytes" is what
+ * one call touches: frame buffer bytes changed when drawing into a cleared buffer (the whole
+ * buffer for ClearBuffer), or bytes put on the I2C bus for SendBuffer.
+ *
+ * --json writes the results in the Google Benchmark JSON layout, so a stored baseline can be
+ * compared with Tools/bench_compare.py (or Google Benchmark's compare.py):
+ *
+ * @code
+ * ./bench_u8g2 --json baseline.json        # before a change
+ * ./bench_u8g2 --json current.json         # after it
+ * python3 Tools/bench_compare.py baseline.json current.json
+ * @endcode
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "u8g2.h"
+#include "sh1106_emu.h"
+#include "bongo_cat_1.h"
+#include "img_qrcode.h"
+
+/** Timed batches per case (the median is reported) */
+#define BENCH_REPETITIONS    5
+/** Default minimum duration of one timed batch */
+#define BENCH_MIN_TIME_MS    20
+/** Width of the bongo cat bitmap (pixels) */
+#define BONGO_WIDTH          101
+/** Size of the QR code bitmap and bongo cat height (pixels) */
+#define IMAGE_SIZE           64
+
+/** One benchmark case */
+typedef struct {
+    const char *name;                   /**< Case name (Group/variant) */
+    void (*run)(u8g2_t *u8g2);          /**< One operation */
+    int send;                           /**< Non-zero: bytes are bus bytes of one run */
+} BenchCase_t;
+
+/** Result of one case */
+typedef struct {
+    const BenchCase_t *bench;
+    uint64_t iterations;                /**< Iterations per timed batch */
+    double real_ns;                     /**< Median wall time per operation */
+    double cpu_ns;                      /**< Median CPU time per operation */
+    uint32_t bytes;                     /**< Bytes touched per operation */
+} BenchResult_t;
+
+static u8g2_t u8g2_null;
+static u8g2_t u8g2_emu;
+static Sh1106Emu_t emu;
+static uint64_t null_bus_bytes;
+
+static uint8_t null_byte_cb(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr)
+{
+    (void)u8x8;
+    (void)arg_ptr;
+    if (msg == U8X8_MSG_BYTE_SEND)
+    {
+        null_bus_bytes += arg_int;
+    }
+    return 1;
+}
+
+static uint8_t null_gpio_cb(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr)
+{
+    (void)u8x8;
+    (void)msg;
+    (void)arg_int;
+    (void)arg_ptr;
+    return 1;
+}
+
+static void run_clear(u8g2_t *u8g2)        { u8g2_ClearBuffer(u8g2); }
+static void run_xbmp_bongo(u8g2_t *u8g2)   { u8g2_DrawXBMP(u8g2, 13, 0, BONGO_WIDTH, IMAGE_SIZE, gImage_bongo_cat_1); }
+static void run_xbmp_qrcode(u8g2_t *u8g2)  { u8g2_DrawXBMP(u8g2, 0, 0, IMAGE_SIZE, IMAGE_SIZE, gImage_img_qrcode); }
+static void run_box_full(u8g2_t *u8g2)     { u8g2_DrawBox(u8g2, 0, 0, 128, 64); }
+static void run_box_small(u8g2_t *u8g2)    { u8g2_DrawBox(u8g2, 5, 5, 32, 16); }
+static void run_line_diag(u8g2_t *u8g2)    { u8g2_DrawLine(u8g2, 0, 0, 127, 63); }
+static void run_line_hor(u8g2_t *u8g2)     { u8g2_DrawLine(u8g2, 0, 31, 127, 31); }
+static void run_disc_large(u8g2_t *u8g2)   { u8g2_DrawDisc(u8g2, 64, 32, 31, U8G2_DRAW_ALL); }
+static void run_disc_small(u8g2_t *u8g2)   { u8g2_DrawDisc(u8g2, 20, 20, 8, U8G2_DRAW_ALL); }
+static void run_send(u8g2_t *u8g2)         { u8g2_SendBuffer(u8g2); }
+#ifdef BENCH_HAVE_FONTS
+static void run_str(u8g2_t *u8g2)          { u8g2_DrawStr(u8g2, 0, 15, "Hi, NUCLEO-F429ZI!"); }
+#endif
+
+static const BenchCase_t cases[] = {
+    { "ClearBuffer",             run_clear,        0 },
+#ifdef BENCH_HAVE_FONTS
+    { "DrawStr/ncenB08",         run_str,          0 },
+#endif
+    { "DrawXBMP/bongo_101x64",   run_xbmp_bongo,   0 },
+    { "DrawXBMP/qrcode_64x64",   run_xbmp_qrcode,  0 },
+    { "DrawBox/128x64",          run_box_full,     0 },
+    { "DrawBox/32x16",           run_box_small,    0 },
+    { "DrawLine/diagonal",       run_line_diag,    0 },
+    { "DrawLine/horizontal",     run_line_hor,     0 },
+    { "DrawDisc/r31",            run_disc_large,   0 },
+    { "DrawDisc/r8",             run_disc_small,   0 },
+    { "SendBuffer/null",         run_send,         1 },
+    { "SendBuffer/sh1106_emu",   run_send,         2 },
+};
+
+static double clock_ns(clockid_t clock)
+{
+    struct timespec ts;
+    clock_gettime(clock, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static int compare_double(const void *a, const void *b)
+{
+    double da = *(const double *)a;
+    double db = *(const double *)b;
+    return (da > db) - (da < db);
+}
+
+static u8g2_t *display_for(const BenchCase_t *bench)
+{
+    return (bench->send == 2) ? &u8g2_emu : &u8g2_null;
+}
+
+/** Bytes one operation touches (see file header). */
+static uint32_t measure_bytes(const BenchCase_t *bench)
+{
+    u8g2_t *u8g2 = display_for(bench);
+    uint8_t *buf = u8g2_GetBufferPtr(u8g2);
+    size_t size = (size_t)u8g2_GetBufferTileWidth(u8g2) * u8g2_GetBufferTileHeight(u8g2) * 8u;
+    uint32_t changed = 0;
+
+    if (bench->send != 0)
+    {
+        uint64_t before = (bench->send == 2) ? emu.stats.bus_bytes : null_bus_bytes;
+        bench->run(u8g2);
+        return (uint32_t)(((bench->send == 2) ? emu.stats.bus_bytes : null_bus_bytes) - before);
+    }
+
+    memset(buf, (bench->run == run_clear) ? 0xFF : 0x00, size);
+    uint8_t *copy = malloc(size);
+    memcpy(copy, buf, size);
+    bench->run(u8g2);
+    for (size_t i = 0; i < size; i++)
+    {
+        changed += (buf[i] != copy[i]);
+    }
+    free(copy);
+    return changed;
+}
+
+static double time_batch(const BenchCase_t *bench, uint64_t iterations, double *cpu_ns)
+{
+    u8g2_t *u8g2 = display_for(bench);
+    double c0 = clock_ns(CLOCK_PROCESS_CPUTIME_ID);
+    double t0 = clock_ns(CLOCK_MONOTONIC);
+    for (uint64_t i = 0; i < iterations; i++)
+    {
+        bench->run(u8g2);
+    }
+    double t1 = clock_ns(CLOCK_MONOTONIC);
+    *cpu_ns = clock_ns(CLOCK_PROCESS_CPUTIME_ID) - c0;
+    return t1 - t0;
+}
+
+static void run_case(const BenchCase_t *bench, double min_time_ns, BenchResult_t *result)
+{
+    double real[BENCH_REPETITIONS];
+    double cpu[BENCH_REPETITIONS];
+    uint64_t iterations = 1;
+    double cpu_ns;
+
+    result->bench = bench;
+    result->bytes = measure_bytes(bench);
+
+    /* Calibrate: grow the batch until it lasts min_time_ns */
+    for (;;)
+    {
+        double elapsed = time_batch(bench, iterations, &cpu_ns);
+        if (elapsed >= min_time_ns)
+        {
+            break;
+        }
+        double scale = (elapsed > 0.0) ? (min_time_ns * 1.4 / elapsed) : 10.0;
+        iterations = (uint64_t)((double)iterations * ((scale > 10.0) ? 10.0 : scale)) + 1u;
+    }
+
+    for (int r = 0; r < BENCH_REPETITIONS; r++)
+    {
+        real[r] = time_batch(bench, iterations, &cpu_ns) / (double)iterations;
+        cpu[r] = cpu_ns / (double)iterations;
+    }
+    qsort(real, BENCH_REPETITIONS, sizeof(double), compare_double);
+    qsort(cpu, BENCH_REPETITIONS, sizeof(double), compare_double);
+    result->iterations = iterations;
+    result->real_ns = real[BENCH_REPETITIONS / 2];
+    result->cpu_ns = cpu[BENCH_REPETITIONS / 2];
+}
+
+static int write_json(const char *path, const BenchResult_t *results, size_t count)
+{
+    FILE *file = fopen(path, "w");
+    char date[32];
+    time_t now = time(NULL);
+
+    if (file == NULL)
+    {
+        perror(path);
+        return -1;
+    }
+    strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", localtime(&now));
+    fprintf(file, "{\n  \"context\": {\n    \"date\": \"%s\",\n    \"executable\": \"bench_u8g2\",\n"
+                  "    \"library_build_type\": \"%s\",\n    \"repetitions\": %d\n  },\n  \"benchmarks\": [\n",
+            date, BENCH_BUILD_TYPE, BENCH_REPETITIONS);
+    for (size_t i = 0; i < count; i++)
+    {
+        const BenchResult_t *r = &results[i];
+        fprintf(file, "    {\n      \"name\": \"%s\",\n      \"run_name\": \"%s\",\n      \"run_type\": \"iteration\",\n"
+                      "      \"iterations\": %" PRIu64 ",\n      \"real_time\": %.3f,\n      \"cpu_time\": %.3f,\n"
+                      "      \"time_unit\": \"ns\",\n      \"bytes_touched\": %" PRIu32 "\n    }%s\n",
+                r->bench->name, r->bench->name, r->iterations, r->real_ns, r->cpu_ns, r->bytes,
+                (i + 1u < count) ? "," : "");
+    }
+    fprintf(file, "  ]\n}\n");
+    return (fclose(file) == 0) ? 0 : -1;
+}
+
+static void setup_displays(void)
+{
+    u8g2_Setup_sh1106_i2c_128x64_noname_f(&u8g2_null, U8G2_R0, null_byte_cb, null_gpio_cb);
+    u8g2_SetI2CAddress(&u8g2_null, 0x3C);
+    u8g2_InitDisplay(&u8g2_null);
+    u8g2_SetPowerSave(&u8g2_null, 0);
+
+    SH1106_Emu_Init(&emu, 400000u);
+    u8g2_Setup_sh1106_i2c_128x64_noname_f(&u8g2_emu, U8G2_R0, SH1106_Emu_ByteCb, SH1106_Emu_GpioAndDelayCb);
+    u8x8_SetUserPtr(u8g2_GetU8x8(&u8g2_emu), &emu);
+    u8g2_SetI2CAddress(&u8g2_emu, 0x3C);
+    u8g2_InitDisplay(&u8g2_emu);
+    u8g2_SetPowerSave(&u8g2_emu, 0);
+
+#ifdef BENCH_HAVE_FONTS
+    u8g2_SetFont(&u8g2_null, u8g2_font_ncenB08_tr);
+    u8g2_SetFont(&u8g2_emu, u8g2_font_ncenB08_tr);
+#endif
+}
+
+int main(int argc, char *argv[])
+{
+    static BenchResult_t results[sizeof(cases) / sizeof(cases[0])];
+    const char *json_path = NULL;
+    const char *filter = NULL;
+    double min_time_ms = BENCH_MIN_TIME_MS;
+    size_t count = 0;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--json") == 0) && (i + 1 < argc))
+        {
+            json_path = argv[++i];
+        }
+        else if ((strcmp(argv[i], "--filter") == 0) && (i + 1 < argc))
+        {
+            filter = argv[++i];
+        }
+        else if ((strcmp(argv[i], "--min-time-ms") == 0) && (i + 1 < argc))
+        {
+            min_time_ms = atof(argv[++i]);
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [--json out.json] [--filter substring] [--min-time-ms ms]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    setup_displays();
+    printf("%-24s %12s %12s %12s %8s\n", "Benchmark", "ns/op", "cpu ns/op", "iterations", "bytes");
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        if ((filter != NULL) && (strstr(cases[i].name, filter) == NULL))
+        {
+            continue;
+        }
+        BenchResult_t *r = &results[count++];
+        run_case(&cases[i], min_time_ms * 1e6, r);
+        printf("%-24s %12.1f %12.1f %12" PRIu64 " %8" PRIu32 "\n",
+               r->bench->name, r->real_ns, r->cpu_ns, r->iterations, r->bytes);
+    }
+#ifndef BENCH_HAVE_FONTS
+    printf("(DrawStr skipped: Hardware/u8g2/u8g2_fonts.c not present)\n");
+#endif
+
+    if ((json_path != NULL) && (write_json(json_path, results, count) != 0))
+    {
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,383 @@
+/**
+ * @file    bench_video.c
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Loopback benchmark of the tile-delta video stream (video_stream.h).
+ *
+ * @details
+ * Renders four synthetic clips (bongo cat, bouncing ball with a progress bar, horizontal
+ * scroll, random noise), encodes them with a key frame every 30 frames and decodes the stream
+ * in random-sized pieces into a u8g2 buffer whose changed tiles are flushed to the SH1106
+ * emulator, like the display task does. Every decoded frame and the final panel must match
+ * the source. Reports stream size, encode/decode time, the frame rate the serial link allows
+ * at 115200 / 921600 / 2000000 baud, the I2C time of the tile flushes at 400 kHz and the
+ * resulting sustained frame rate. A corrupted and a noisy stream check resynchronisation.
+ *
+ *   ./bench_video                  run the clips and the recovery checks
+ *   ./bench_video --file v.bin     decode a stream written by Tools/video_stream.py --out
+ *
+ * Exit status 1 on any mismatch.
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "u8g2.h"
+#include "sh1106_emu.h"
+#include "video_stream.h"
+#include "bongo_cat_1.h"
+#include "bongo_cat_2.h"
+
+/** Frames per clip */
+#define CLIP_FRAMES     300
+/** Key frame interval (frames) */
+#define KEY_INTERVAL    30
+/** Largest piece handed to the decoder at once (bytes) */
+#define MAX_PIECE       300
+/** Emulated I2C clock */
+#define BUS_HZ          400000u
+/** Stream buffer of one clip */
+#define STREAM_CAP      (CLIP_FRAMES * VIDEO_MAX_PACKET)
+
+typedef void (*clip_fn)(u8g2_t *u8g2, uint32_t frame);
+
+typedef struct {
+    const char *name;
+    clip_fn     draw;
+} clip_t;
+
+/** Receiving side: decoder, u8g2 buffer and emulated panel */
+typedef struct {
+    VideoDecoder_t dec;
+    u8g2_t         u8g2;
+    Sh1106Emu_t    emu;
+    uint64_t       decode_ns;
+    uint64_t       bus_ns;
+    uint32_t       tiles;
+} sink_t;
+
+static const uint32_t link_bauds[] = { 115200u, 921600u, 2000000u };
+static uint8_t stream[STREAM_CAP];
+static uint32_t rng_state = 12345u;
+
+static uint32_t rng(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+static void draw_bongo(u8g2_t *u8g2, uint32_t frame)
+{
+    u8g2_DrawXBMP(u8g2, 13, 0, 101, 64, ((frame / 4u) & 1u) ? gImage_bongo_cat_2 : gImage_bongo_cat_1);
+}
+
+static void draw_ball(u8g2_t *u8g2, uint32_t frame)
+{
+    uint32_t x = frame % 216u;
+    uint32_t y = frame % 88u;
+    x = (x < 108u) ? x : 216u - x;
+    y = (y < 44u) ? y : 88u - y;
+    u8g2_DrawFrame(u8g2, 0, 0, 128, 50);
+    u8g2_DrawDisc(u8g2, (u8g2_uint_t)(10u + x), (u8g2_uint_t)(3u + y), 6, U8G2_DRAW_ALL);
+    u8g2_DrawFrame(u8g2, 0, 54, 128, 10);
+    u8g2_DrawBox(u8g2, 2, 56, (u8g2_uint_t)(frame * 124u / CLIP_FRAMES), 6);
+}
+
+static void draw_scroll(u8g2_t *u8g2, uint32_t frame)
+{
+    for (u8g2_uint_t x = 0; x < 128; x++)
+    {
+        uint32_t phase = (x + frame) % 32u;
+        u8g2_DrawVLine(u8g2, x, (u8g2_uint_t)(phase < 16u ? phase : 32u - phase), (u8g2_uint_t)(32u + phase));
+    }
+}
+
+static void draw_noise(u8g2_t *u8g2, uint32_t frame)
+{
+    uint8_t *buf = u8g2_GetBufferPtr(u8g2);
+    (void)frame;
+    for (uint32_t i = 0; i < VIDEO_FRAME_BYTES; i++)
+    {
+        buf[i] = (uint8_t)rng();
+    }
+}
+
+static const clip_t clips[] = {
+    { "bongo",  draw_bongo },
+    { "ball",   draw_ball },
+    { "scroll", draw_scroll },
+    { "noise",  draw_noise },
+};
+
+static void sink_init(sink_t *sink)
+{
+    memset(sink, 0, sizeof(*sink));
+    Video_DecoderInit(&sink->dec);
+    SH1106_Emu_Init(&sink->emu, BUS_HZ);
+    u8g2_Setup_sh1106_i2c_128x64_noname_f(&sink->u8g2, U8G2_R0, SH1106_Emu_ByteCb, SH1106_Emu_GpioAndDelayCb);
+    u8x8_SetUserPtr(u8g2_GetU8x8(&sink->u8g2), &sink->emu);
+    u8g2_SetI2CAddress(&sink->u8g2, 0x3C);
+    u8g2_InitDisplay(&sink->u8g2);
+    u8g2_SetPowerSave(&sink->u8g2, 0);
+    u8g2_ClearBuffer(&sink->u8g2);
+    u8g2_SendBuffer(&sink->u8g2);
+}
+
+/** Feed bytes in random pieces; flush the tiles of every decoded frame */
+static uint32_t sink_feed(sink_t *sink, const uint8_t *data, size_t len)
+{
+    uint32_t events = 0;
+
+    while (len > 0u)
+    {
+        size_t piece = 1u + rng() % MAX_PIECE;
+        VideoTiles_t dirty;
+        if (piece > len)
+        {
+            piece = len;
+        }
+        memset(&dirty, 0, sizeof(dirty));
+        uint64_t start = now_ns();
+        uint32_t ev = Video_Decode(&sink->dec, data, piece, u8g2_GetBufferPtr(&sink->u8g2), &dirty);
+        sink->decode_ns += now_ns() - start;
+        if (ev & VIDEO_EVT_FRAME)
+        {
+            uint64_t before = sink->emu.stats.bus_time_ns;
+            sink->tiles += Video_UpdateDisplay(&sink->u8g2, &dirty);
+            sink->bus_ns += sink->emu.stats.bus_time_ns - before;
+        }
+        events |= ev;
+        data += piece;
+        len -= piece;
+    }
+    return events;
+}
+
+static int panel_matches(const sink_t *sink, const uint8_t *fb)
+{
+    for (int y = 0; y < 64; y++)
+    {
+        for (int x = 0; x < 128; x++)
+        {
+            if (SH1106_Emu_GetPixel(&sink->emu, x, y) != ((fb[(y / 8) * 128 + x] >> (y % 8)) & 1))
+            {
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+/** Render a clip; frames[i] receives frame i */
+static void render_clip(const clip_t *clip, uint8_t (*frames)[VIDEO_FRAME_BYTES])
+{
+    static u8g2_t src;
+    u8g2_Setup_sh1106_i2c_128x64_noname_f(&src, U8G2_R0, u8x8_byte_empty, u8x8_dummy_cb);
+    for (uint32_t f = 0; f < CLIP_FRAMES; f++)
+    {
+        u8g2_ClearBuffer(&src);
+        clip->draw(&src, f);
+        memcpy(frames[f], u8g2_GetBufferPtr(&src), VIDEO_FRAME_BYTES);
+    }
+}
+
+/** Encode a clip; packet i starts at offsets[i] */
+static size_t encode_clip(uint8_t (*frames)[VIDEO_FRAME_BYTES], size_t *offsets, uint64_t *encode_ns)
+{
+    size_t len = 0;
+    *encode_ns = 0;
+    for (uint32_t f = 0; f < CLIP_FRAMES; f++)
+    {
+        uint64_t start = now_ns();
+        offsets[f] = len;
+        len += Video_EncodeFrame((f % KEY_INTERVAL) ? frames[f - 1u] : NULL, frames[f], (uint16_t)f,
+                                 (f % KEY_INTERVAL) == 0u, &stream[len], STREAM_CAP - len);
+        *encode_ns += now_ns() - start;
+    }
+    offsets[CLIP_FRAMES] = len;
+    return len;
+}
+
+static int run_clip(const clip_t *clip, uint64_t full_flush_ns)
+{
+    static uint8_t frames[CLIP_FRAMES][VIDEO_FRAME_BYTES];
+    static size_t offsets[CLIP_FRAMES + 1];
+    static sink_t sink;
+    uint64_t encode_ns;
+    int failures = 0;
+
+    render_clip(clip, frames);
+    size_t len = encode_clip(frames, offsets, &encode_ns);
+
+    sink_init(&sink);
+    for (uint32_t f = 0; f < CLIP_FRAMES; f++)
+    {
+        (void)sink_feed(&sink, &stream[offsets[f]], offsets[f + 1u] - offsets[f]);
+        if (memcmp(u8g2_GetBufferPtr(&sink.u8g2), frames[f], VIDEO_FRAME_BYTES) != 0)
+        {
+            failures++;
+        }
+    }
+    if (!panel_matches(&sink, frames[CLIP_FRAMES - 1u]) || (sink.dec.stats.frames != CLIP_FRAMES))
+    {
+        failures++;
+    }
+
+    double per_frame = (double)len / CLIP_FRAMES;
+    double panel_fps = 1e9 * CLIP_FRAMES / (double)sink.bus_ns;
+    printf("%-7s %8.1f %6.1fx %7.1f %7.1f |", clip->name, per_frame,
+           (double)VIDEO_FRAME_BYTES / per_frame, (double)encode_ns / CLIP_FRAMES / 1e3,
+           (double)sink.decode_ns / CLIP_FRAMES / 1e3);
+    for (size_t i = 0; i < sizeof(link_bauds) / sizeof(link_bauds[0]); i++)
+    {
+        printf(" %7.1f", (double)link_bauds[i] / 10.0 / per_frame);
+    }
+    double link_fps = (double)link_bauds[1] / 10.0 / per_frame;
+    printf(" | %6.1f %7.2f %7.2f %7.1f | %7.1f %s\n", (double)sink.tiles / CLIP_FRAMES,
+           (double)sink.bus_ns / CLIP_FRAMES / 1e6, (double)full_flush_ns / 1e6, panel_fps,
+           (link_fps < panel_fps) ? link_fps : panel_fps, failures ? "MISMATCH" : "ok");
+    return failures;
+}
+
+/** Corrupt one delta frame, then add garbage between packets: the decoder must recover */
+static int run_recovery(void)
+{
+    static uint8_t frames[CLIP_FRAMES][VIDEO_FRAME_BYTES];
+    static size_t offsets[CLIP_FRAMES + 1];
+    static uint8_t noisy[STREAM_CAP * 2];
+    static sink_t sink;
+    uint64_t encode_ns;
+    int failures = 0;
+
+    render_clip(&clips[1], frames);
+    size_t len = encode_clip(frames, offsets, &encode_ns);
+
+    /* A flipped bit in frame 40: frames 40..59 are not shown, 60 (key) resynchronises */
+    stream[offsets[40] + VIDEO_HEADER_SIZE + 3u] ^= 0x10u;
+    sink_init(&sink);
+    for (uint32_t f = 0; f < CLIP_FRAMES; f++)
+    {
+        (void)sink_feed(&sink, &stream[offsets[f]], offsets[f + 1u] - offsets[f]);
+        uint32_t shown = ((f >= 40u) && (f < 60u)) ? 39u : f;
+        if (memcmp(u8g2_GetBufferPtr(&sink.u8g2), frames[shown], VIDEO_FRAME_BYTES) != 0)
+        {
+            failures++;
+        }
+    }
+    printf("corrupt frame: %" PRIu32 " crc errors, %" PRIu32 " skipped, %" PRIu32 " frames shown %s\n",
+           sink.dec.stats.crc_errors, sink.dec.stats.skipped, sink.dec.stats.frames,
+           (failures == 0) && (sink.dec.stats.crc_errors == 1u) ? "ok" : "FAILED");
+    if (sink.dec.stats.crc_errors != 1u)
+    {
+        failures++;
+    }
+    stream[offsets[40] + VIDEO_HEADER_SIZE + 3u] ^= 0x10u;
+
+    /* Random bytes (including sync bytes) before every key frame */
+    size_t noisy_len = 0;
+    for (uint32_t f = 0; f < CLIP_FRAMES; f++)
+    {
+        if ((f % KEY_INTERVAL) == 0u)
+        {
+            for (uint32_t i = 0; i < 64u; i++)
+            {
+                noisy[noisy_len++] = (i % 7u == 0u) ? VIDEO_SYNC0 : (uint8_t)rng();
+            }
+        }
+        memcpy(&noisy[noisy_len], &stream[offsets[f]], offsets[f + 1u] - offsets[f]);
+        noisy_len += offsets[f + 1u] - offsets[f];
+    }
+    sink_init(&sink);
+    (void)sink_feed(&sink, noisy, noisy_len);
+    int noisy_ok = (memcmp(u8g2_GetBufferPtr(&sink.u8g2), frames[CLIP_FRAMES - 1u], VIDEO_FRAME_BYTES) == 0) &&
+                   panel_matches(&sink, frames[CLIP_FRAMES - 1u]) && (sink.dec.stats.frames >= CLIP_FRAMES - KEY_INTERVAL);
+    printf("noisy stream:  %" PRIu32 " of %u frames shown, %" PRIu32 " crc / %" PRIu32 " format errors %s\n",
+           sink.dec.stats.frames, CLIP_FRAMES, sink.dec.stats.crc_errors, sink.dec.stats.format_errors,
+           noisy_ok ? "ok" : "FAILED");
+    (void)len;
+    return failures + (noisy_ok ? 0 : 1);
+}
+
+static int run_file(const char *path)
+{
+    static sink_t sink;
+    static uint8_t buf[1u << 16];
+    FILE *file = fopen(path, "rb");
+    uint32_t events = 0;
+    size_t total = 0;
+    size_t n;
+
+    if (file == NULL)
+    {
+        perror(path);
+        return EXIT_FAILURE;
+    }
+    sink_init(&sink);
+    while ((n = fread(buf, 1, sizeof(buf), file)) > 0u)
+    {
+        events |= sink_feed(&sink, buf, n);
+        total += n;
+    }
+    fclose(file);
+
+    const VideoStats_t *s = &sink.dec.stats;
+    printf("%s: %zu bytes, %" PRIu32 " frames (%" PRIu32 " key), %" PRIu32 " crc / %" PRIu32
+           " format errors, %" PRIu32 " skipped, end %s\n", path, total, s->frames, s->key_frames,
+           s->crc_errors, s->format_errors, s->skipped, (events & VIDEO_EVT_END) ? "yes" : "no");
+    if (s->frames > 0u)
+    {
+        printf("%.1f bytes/frame, %.2f ms I2C/frame at 400 kHz\n", (double)total / s->frames,
+               (double)sink.bus_ns / s->frames / 1e6);
+    }
+    if (SH1106_Emu_WritePBM(&sink.emu, "video_stream.pbm", 0) == 0)
+    {
+        printf("last frame written to video_stream.pbm\n");
+    }
+    return ((s->frames > 0u) && (s->crc_errors == 0u) && (s->format_errors == 0u)) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int main(int argc, char **argv)
+{
+    static sink_t full;
+    int failures = 0;
+
+    if ((argc == 3) && (strcmp(argv[1], "--file") == 0))
+    {
+        return run_file(argv[2]);
+    }
+    if (argc != 1)
+    {
+        fprintf(stderr, "usage: %s [--file stream.bin]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    /* Reference: u8g2_SendBuffer() of a whole frame */
+    sink_init(&full);
+    SH1106_Emu_ResetStats(&full.emu);
+    u8g2_SendBuffer(&full.u8g2);
+    uint64_t full_flush_ns = full.emu.stats.bus_time_ns;
+
+    printf("%u frames per clip, key frame every %u, pieces of 1..%u bytes, I2C at %u kHz\n",
+           CLIP_FRAMES, KEY_INTERVAL, MAX_PIECE, BUS_HZ / 1000u);
+    printf("clip    B/frame  ratio  enc us  dec us |  115200  921600      2M fps (link) |"
+           "  tiles  I2C ms full ms   panel | sustained @921600\n");
+    for (size_t i = 0; i < sizeof(clips) / sizeof(clips[0]); i++)
+    {
+        failures += run_clip(&clips[i], full_flush_ns);
+    }
+    failures += run_recovery();
+
+    printf("%s\n", failures ? "FAILED" : "all frames decoded exactly");
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,326 @@
+/**
+ * @file    bench_widgets.c
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Full versus incremental redraw of widget screens (widget.h).
+ *
+ * @details
+ * Drives two copies of the dashboard (Screens_InitDashboardWidgets()), each with its own u8g2
+ * buffer and SH1106 emulator at 400 kHz. Every frame the same 1, 2, 4 or 8 of the eight values
+ * change. One copy redraws like a screen without widgets: clear the buffer, draw everything,
+ * send all 128 tiles. The other calls Widget_DrawDirty() and sends only the tiles of the
+ * redrawn widgets with Video_UpdateDisplay(), as the display task does. Both buffers must be
+ * equal after every frame, and both panels at the end. Reports render time, tiles and I2C
+ * time per frame and the bus-bound frame rate of both.
+ *
+ * A second screen mixes overlapping labels, numerics, progress bars, a graph and a bitmap
+ * with random updates and checks the incremental result against a full redraw, which covers
+ * the spreading of dirtiness to overlapping widgets.
+ *
+ * Without Hardware/u8g2/u8g2_fonts.c the dashboard values are shown as progress bars and the
+ * labels are left out (same boxes, no text).
+ *
+ *   ./bench_widgets                run both parts, exit status 1 on a mismatch
+ *   ./bench_widgets --frames N     frames per case (default 2000)
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "u8g2.h"
+#include "sh1106_emu.h"
+#include "screens.h"
+#include "widget.h"
+#include "../Image/asset_ids.h"
+
+/** Emulated I2C clock */
+#define BUS_HZ          400000u
+/** Default frames per case */
+#define DEFAULT_FRAMES  2000u
+/** Widgets of the mixed screen */
+#define MIXED_WIDGETS   8u
+
+/** One redraw path: buffer, emulated panel and its counters */
+typedef struct {
+    u8g2_t      u8g2;
+    Sh1106Emu_t emu;
+    Widget_t    widgets[SCREENS_DASHBOARD_WIDGETS];
+    uint64_t    render_ns;
+    uint64_t    bus_ns;
+    uint32_t    tiles;
+} path_t;
+
+static const char *const labels[SCREENS_DASHBOARD_VALUES] = {
+    "Temp C", "Humidity %", "Fan rpm", "Load %", "Rx bytes", "Errors", "Uptime s", "Battery mV"
+};
+static uint32_t rng_state = 2463534242u;
+
+static uint32_t rng(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+static void path_init(path_t *path)
+{
+    memset(path, 0, sizeof(*path));
+    SH1106_Emu_Init(&path->emu, BUS_HZ);
+    u8g2_Setup_sh1106_i2c_128x64_noname_f(&path->u8g2, U8G2_R0, SH1106_Emu_ByteCb, SH1106_Emu_GpioAndDelayCb);
+    u8x8_SetUserPtr(u8g2_GetU8x8(&path->u8g2), &path->emu);
+    u8g2_SetI2CAddress(&path->u8g2, 0x3C);
+    u8g2_InitDisplay(&path->u8g2);
+    u8g2_SetPowerSave(&path->u8g2, 0);
+}
+
+/** Lay out the dashboard and show it once (not counted) */
+static void dashboard_init(path_t *path)
+{
+    static const int32_t zero[SCREENS_DASHBOARD_VALUES];
+
+#ifdef BENCH_HAVE_FONTS
+    Screens_InitDashboardWidgets(path->widgets, u8g2_font_5x7_tr, labels, zero);
+#else
+    Screens_InitDashboardWidgets(path->widgets, NULL, labels, zero);
+    for (uint32_t i = 0; i < SCREENS_DASHBOARD_VALUES; i++)
+    {
+        Widget_SetText(&path->widgets[SCREENS_DASHBOARD_LABEL(i)], NULL);
+        path->widgets[SCREENS_DASHBOARD_VALUE(i)].type = WIDGET_PROGRESS;
+        Widget_SetRange(&path->widgets[SCREENS_DASHBOARD_VALUE(i)], 0, 1000);
+    }
+#endif
+    u8g2_ClearBuffer(&path->u8g2);
+    Widget_DrawAll(&path->u8g2, path->widgets, SCREENS_DASHBOARD_WIDGETS);
+    u8g2_SendBuffer(&path->u8g2);
+    SH1106_Emu_ResetStats(&path->emu);
+}
+
+/** Redraw everything and send the whole buffer */
+static void frame_full(path_t *path, Widget_t *widgets, size_t count)
+{
+    uint64_t t0 = now_ns();
+    u8g2_ClearBuffer(&path->u8g2);
+    Widget_DrawAll(&path->u8g2, widgets, count);
+    uint64_t t1 = now_ns();
+    uint64_t bus = path->emu.stats.bus_time_ns;
+    u8g2_SendBuffer(&path->u8g2);
+    path->render_ns += t1 - t0;
+    path->bus_ns += path->emu.stats.bus_time_ns - bus;
+    path->tiles += VIDEO_TILES;
+}
+
+/** Redraw the dirty widgets and send their tiles */
+static void frame_incremental(path_t *path, Widget_t *widgets, size_t count)
+{
+    VideoTiles_t tiles;
+
+    memset(&tiles, 0, sizeof(tiles));
+    uint64_t t0 = now_ns();
+    (void)Widget_DrawDirty(&path->u8g2, widgets, count, &tiles);
+    uint64_t t1 = now_ns();
+    uint64_t bus = path->emu.stats.bus_time_ns;
+    path->tiles += Video_UpdateDisplay(&path->u8g2, &tiles);
+    path->render_ns += t1 - t0;
+    path->bus_ns += path->emu.stats.bus_time_ns - bus;
+}
+
+static int panels_equal(const path_t *a, const path_t *b)
+{
+    for (uint8_t y = 0; y < SH1106_EMU_ROWS; y++)
+    {
+        for (uint8_t x = 0; x < SH1106_EMU_PANEL_WIDTH; x++)
+        {
+            if (SH1106_Emu_GetPixel(&a->emu, x, y) != SH1106_Emu_GetPixel(&b->emu, x, y))
+            {
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+/** One dashboard case: `changing` values change every frame; returns the number of mismatches */
+static uint32_t run_dashboard(uint32_t changing, uint32_t frames)
+{
+    static path_t full;
+    static path_t inc;
+    int32_t values[SCREENS_DASHBOARD_VALUES] = { 0 };
+    uint32_t mismatches = 0;
+
+    path_init(&full);
+    path_init(&inc);
+    dashboard_init(&full);
+    dashboard_init(&inc);
+
+    for (uint32_t f = 0; f < frames; f++)
+    {
+        for (uint32_t k = 0; k < changing; k++)
+        {
+            /* Spread the changing values over both columns and all rows */
+            uint32_t i = (k * 5u + f) % SCREENS_DASHBOARD_VALUES;
+            values[i] = (int32_t)(rng() % 1000u) * (((rng() & 7u) == 0u) ? -1000 : 1);
+            Widget_SetValue(&full.widgets[SCREENS_DASHBOARD_VALUE(i)], values[i]);
+            Widget_SetValue(&inc.widgets[SCREENS_DASHBOARD_VALUE(i)], values[i]);
+        }
+        frame_full(&full, full.widgets, SCREENS_DASHBOARD_WIDGETS);
+        frame_incremental(&inc, inc.widgets, SCREENS_DASHBOARD_WIDGETS);
+        if (memcmp(u8g2_GetBufferPtr(&full.u8g2), u8g2_GetBufferPtr(&inc.u8g2), VIDEO_FRAME_BYTES) != 0)
+        {
+            mismatches++;
+        }
+    }
+    if (!panels_equal(&full, &inc))
+    {
+        mismatches++;
+    }
+
+    double full_bus = (double)full.bus_ns / frames;
+    double inc_bus = (double)inc.bus_ns / frames;
+    printf("%u of %u  %8.2f %8.2f | %6.1f %6.1f | %7.2f %7.2f | %6.1f %6.1f  %s\n",
+           changing, SCREENS_DASHBOARD_VALUES,
+           (double)full.render_ns / frames / 1e3, (double)inc.render_ns / frames / 1e3,
+           (double)full.tiles / frames, (double)inc.tiles / frames,
+           full_bus / 1e6, inc_bus / 1e6, 1e9 / full_bus, 1e9 / inc_bus,
+           mismatches ? "MISMATCH" : "ok");
+    return mismatches;
+}
+
+/** Overlapping widgets of every type; random updates, incremental against full redraw */
+static uint32_t run_mixed(uint32_t frames)
+{
+    static path_t full;
+    static path_t inc;
+    static int32_t samples[2][64];
+    static char text[2][MIXED_WIDGETS][8];
+    Widget_t widgets[2][MIXED_WIDGETS];
+    uint32_t mismatches = 0;
+    uint32_t redrawn = 0;
+
+    path_init(&full);
+    path_init(&inc);
+    for (uint32_t p = 0; p < 2u; p++)
+    {
+        Widget_t *w = widgets[p];
+        Widget_Init(&w[0], WIDGET_BITMAP, 13, 0, 101, 64);
+        Widget_SetImage(&w[0], ASSET_ID_BONGO_CAT_1);
+        Widget_Init(&w[1], WIDGET_GRAPH, 0, 20, 64, 30);
+        Widget_SetGraphBuffer(&w[1], samples[p], 64);
+        Widget_SetRange(&w[1], 0, 100);
+        Widget_Init(&w[2], WIDGET_PROGRESS, 4, 52, 120, 10);
+        Widget_Init(&w[3], WIDGET_PROGRESS, 90, 4, 10, 50);
+        Widget_Init(&w[4], WIDGET_PROGRESS, 40, 30, 60, 6);
+        Widget_Init(&w[5], WIDGET_PROGRESS, 70, 10, 30, 30);
+        Widget_Init(&w[6], WIDGET_PROGRESS, 0, 0, 20, 8);
+        Widget_Init(&w[7], WIDGET_PROGRESS, 100, 40, 28, 24);
+#ifdef BENCH_HAVE_FONTS
+        w[4].type = WIDGET_NUMERIC;
+        w[4].font = u8g2_font_5x7_tr;
+        w[4].baseline = 6;
+        w[6].type = WIDGET_LABEL;
+        w[6].font = u8g2_font_5x7_tr;
+        w[6].baseline = 7;
+        snprintf(text[p][6], sizeof(text[p][6]), "start");
+        Widget_SetText(&w[6], text[p][6]);
+#endif
+    }
+    u8g2_ClearBuffer(&inc.u8g2);
+    Widget_DrawAll(&inc.u8g2, widgets[1], MIXED_WIDGETS);
+    u8g2_SendBuffer(&inc.u8g2);
+
+    for (uint32_t f = 0; f < frames; f++)
+    {
+        uint32_t which = rng() % MIXED_WIDGETS;
+        int32_t value = (int32_t)(rng() % 110u) - 5;
+        for (uint32_t p = 0; p < 2u; p++)
+        {
+            Widget_t *w = &widgets[p][which];
+            switch (w->type)
+            {
+                case WIDGET_BITMAP:
+                    Widget_SetImage(w, (value & 1) ? ASSET_ID_BONGO_CAT_2 : ASSET_ID_BONGO_CAT_1);
+                    break;
+                case WIDGET_GRAPH:
+                    Widget_GraphPush(w, value);
+                    break;
+                case WIDGET_LABEL:
+                    /* Rewritten in place: the address stays, so invalidate explicitly */
+                    snprintf(text[p][which], sizeof(text[p][which]), "t%ld", (long)value);
+                    Widget_Invalidate(w);
+                    break;
+                default:
+                    Widget_SetValue(w, value);
+                    break;
+            }
+        }
+        frame_full(&full, widgets[0], MIXED_WIDGETS);
+        uint32_t before = inc.tiles;
+        frame_incremental(&inc, widgets[1], MIXED_WIDGETS);
+        redrawn += (inc.tiles != before) ? 1u : 0u;
+        if (memcmp(u8g2_GetBufferPtr(&full.u8g2), u8g2_GetBufferPtr(&inc.u8g2), VIDEO_FRAME_BYTES) != 0)
+        {
+            mismatches++;
+        }
+    }
+    if (!panels_equal(&full, &inc))
+    {
+        mismatches++;
+    }
+    printf("mixed screen: %u frames (%u with a change), %.1f tiles/frame instead of %u, %u mismatches %s\n",
+           frames, redrawn, (double)inc.tiles / frames, VIDEO_TILES, mismatches, mismatches ? "FAILED" : "ok");
+    return mismatches;
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t frames = DEFAULT_FRAMES;
+    uint32_t failures = 0;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--frames") == 0) && (i + 1 < argc))
+        {
+            frames = (uint32_t)strtoul(argv[++i], NULL, 0);
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [--frames N]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (frames == 0u)
+    {
+        frames = 1u;
+    }
+    if (Asset_Init() != 0)
+    {
+        fprintf(stderr, "asset pack invalid\n");
+        return 1;
+    }
+
+    printf("dashboard, %u frames per case, I2C at %u kHz%s\n", frames, BUS_HZ / 1000u,
+#ifdef BENCH_HAVE_FONTS
+           ""
+#else
+           " (no fonts: values drawn as bars, no labels)"
+#endif
+           );
+    printf("changing  render us     |  tiles/frame  |  I2C ms/frame   |  max fps\n");
+    printf("values    full   incr.  |  full  incr.  |   full   incr.  |  full  incr.\n");
+    for (uint32_t changing = 1; changing <= SCREENS_DASHBOARD_VALUES; changing *= 2u)
+    {
+        failures += run_dashboard(changing, frames);
+    }
+    failures += run_mixed(frames);
+    printf("%s\n", failures ? "FAILED" : "incremental redraw matches full redraw");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,403 @@
+/**
+ * @file    sh1106_emu.c
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   SH1106 OLED controller emulator for host builds of the display stack.
+ *
+ * @details
+ * Only the write path is modelled (the module is write-only on I2C). Panel orientation follows
+ * the u8g2 SH1106 128x64 setup: with segment remap 0xA1 and COM scan 0xC8 the GRAM is shown
+ * upright with the 128 visible columns starting at column 2.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "sh1106_emu.h"
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * @defgroup SH1106_EMU_Private_Defines SH1106 Emulator Private Defines
+ * @{
+ */
+/** Default 7-bit address of the module (as configured by OLED_Init()) */
+#define SH1106_EMU_DEFAULT_ADDRESS  0x3C
+/** Control byte: continuation bit (another control byte follows the next byte) */
+#define SH1106_CONTROL_CO           0x80
+/** Control byte: data (1) / command (0) selection */
+#define SH1106_CONTROL_DC           0x40
+/** @} */
+
+/**
+ * @defgroup SH1106_EMU_Private_Functions SH1106 Emulator Private Functions
+ * @{
+ */
+/**
+ * @brief Decode one command byte (or the argument of a pending double-byte command)
+ * @param emu Emulator
+ * @param c   Command byte
+ */
+static void SH1106_Emu_Command(Sh1106Emu_t *emu, uint8_t c);
+/**
+ * @brief Write one data byte at the current page/column
+ * @param emu Emulator
+ * @param d   Data byte
+ */
+static void SH1106_Emu_Data(Sh1106Emu_t *emu, uint8_t d);
+/** @} */
+
+
+/**
+ * @brief  Reset the controller to its power-on state and clear the counters.
+ *
+ * @param emu    Emulator.
+ * @param bus_hz I2C clock used to compute bus time.
+ * @return None
+ */
+void SH1106_Emu_Init(Sh1106Emu_t *emu, uint32_t bus_hz)
+{
+    memset(emu, 0, sizeof(*emu));
+    emu->contrast = 0x80;
+    emu->multiplex = 63;
+    emu->i2c_address = SH1106_EMU_DEFAULT_ADDRESS;
+    emu->bus_hz = bus_hz;
+}
+
+/**
+ * @brief  Clear the counters, keeping GRAM and registers.
+ * @param emu Emulator.
+ * @return None
+ */
+void SH1106_Emu_ResetStats(Sh1106Emu_t *emu)
+{
+    memset(&emu->stats, 0, sizeof(emu->stats));
+}
+
+/**
+ * @brief  Wire time of one write transaction.
+ *
+ * @param bus_hz      I2C clock.
+ * @param payload_len Payload bytes after the address byte.
+ * @return Nanoseconds.
+ */
+uint64_t SH1106_Emu_TransactionTimeNs(uint32_t bus_hz, size_t payload_len)
+{
+    /* START + (address + payload) x (8 data bits + ACK) + STOP */
+    uint64_t clocks = 1U + 9U * (1U + (uint64_t)payload_len) + 1U;
+    return (clocks * 1000000000ULL + bus_hz / 2U) / bus_hz;
+}
+
+/**
+ * @brief  Feed one complete I2C write transaction.
+ *
+ * @param emu      Emulator.
+ * @param address7 7-bit slave address.
+ * @param data     Payload after the address byte.
+ * @param len      Payload length.
+ * @return None
+ */
+void SH1106_Emu_Write(Sh1106Emu_t *emu, uint8_t address7, const uint8_t *data, size_t len)
+{
+    size_t i = 0;
+
+    emu->stats.transactions++;
+    emu->stats.bus_bytes += (uint32_t)(len + 1U);
+    emu->stats.bus_time_ns += SH1106_Emu_TransactionTimeNs(emu->bus_hz, len);
+
+    if (address7 != emu->i2c_address)
+    {
+        emu->stats.wrong_address++;
+        return;
+    }
+
+    while (i < len)
+    {
+        uint8_t control = data[i++];
+        int is_data = (control & SH1106_CONTROL_DC) != 0;
+
+        if ((control & SH1106_CONTROL_CO) != 0)
+        {
+            /* One byte, then another control byte */
+            if (i < len)
+            {
+                if (is_data)
+                {
+                    SH1106_Emu_Data(emu, data[i++]);
+                }
+                else
+                {
+                    SH1106_Emu_Command(emu, data[i++]);
+                }
+            }
+        }
+        else
+        {
+            /* The rest of the transaction is one stream */
+            while (i < len)
+            {
+                if (is_data)
+                {
+                    SH1106_Emu_Data(emu, data[i++]);
+                }
+                else
+                {
+                    SH1106_Emu_Command(emu, data[i++]);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief  u8x8 byte backend; drop-in replacement for u8x8_byte_stm32_i2c().
+ *
+ * @param u8x8    Pointer to u8x8 structure (user pointer = Sh1106Emu_t).
+ * @param msg     Message type (U8X8_MSG_BYTE_*).
+ * @param arg_int Integer argument.
+ * @param arg_ptr Pointer argument.
+ * @retval 1 Handled.
+ * @retval 0 Not handled.
+ */
+uint8_t SH1106_Emu_ByteCb(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr)
+{
+    Sh1106Emu_t *emu = (Sh1106Emu_t *)u8x8_GetUserPtr(u8x8);
+    const uint8_t *data;
+
+    switch (msg)
+    {
+        case U8X8_MSG_BYTE_SEND:
+            data = (const uint8_t *)arg_ptr;
+            while ((arg_int > 0U) && (emu->transfer_len < SH1106_EMU_MAX_TRANSFER))
+            {
+                emu->transfer[emu->transfer_len++] = *data++;
+                arg_int--;
+            }
+            break;
+        case U8X8_MSG_BYTE_INIT:
+        case U8X8_MSG_BYTE_SET_DC:
+            break;
+        case U8X8_MSG_BYTE_START_TRANSFER:
+            emu->transfer_len = 0;
+            break;
+        case U8X8_MSG_BYTE_END_TRANSFER:
+            SH1106_Emu_Write(emu, u8x8_GetI2CAddress(u8x8), emu->transfer, emu->transfer_len);
+            break;
+        default:
+            return 0;
+    }
+    return 1;
+}
+
+/**
+ * @brief  u8x8 gpio/delay backend: no real delays, requested time is added to stats.delay_ns.
+ *
+ * @param u8x8    Pointer to u8x8 structure (user pointer = Sh1106Emu_t).
+ * @param msg     Message type (U8X8_MSG_DELAY_* / U8X8_MSG_GPIO_*).
+ * @param arg_int Integer argument.
+ * @param arg_ptr Pointer argument (unused).
+ * @retval 1 Handled.
+ */
+uint8_t SH1106_Emu_GpioAndDelayCb(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr)
+{
+    Sh1106Emu_t *emu = (Sh1106Emu_t *)u8x8_GetUserPtr(u8x8);
+    (void)arg_ptr;
+
+    if (emu == NULL)
+    {
+        return 1;
+    }
+    switch (msg)
+    {
+        case U8X8_MSG_DELAY_MILLI:
+            emu->stats.delay_ns += (uint64_t)arg_int * 1000000U;
+            break;
+        case U8X8_MSG_DELAY_10MICRO:
+            emu->stats.delay_ns += (uint64_t)arg_int * 10000U;
+            break;
+        case U8X8_MSG_DELAY_100NANO:
+            emu->stats.delay_ns += (uint64_t)arg_int * 100U;
+            break;
+        case U8X8_MSG_DELAY_NANO:
+            emu->stats.delay_ns += arg_int;
+            break;
+        default:
+            /* GPIO messages have no effect on an I2C module */
+            break;
+    }
+    return 1;
+}
+
+/**
+ * @brief  Pixel as seen on the 128x64 panel.
+ *
+ * @param emu Emulator.
+ * @param x   Panel column (0..127).
+ * @param y   Panel row (0..63).
+ * @return 1 if lit.
+ */
+int SH1106_Emu_GetPixel(const Sh1106Emu_t *emu, int x, int y)
+{
+    if (!emu->display_on)
+    {
+        return 0;
+    }
+    if (emu->entire_on)
+    {
+        return 1;
+    }
+
+    int column = emu->segment_remap ? (x + SH1106_EMU_PANEL_X_OFFSET)
+                                    : (SH1106_EMU_COLUMNS - 1 - SH1106_EMU_PANEL_X_OFFSET - x);
+    int row = emu->com_reverse ? y : (SH1106_EMU_ROWS - 1 - y);
+    row = (row + emu->start_line) % SH1106_EMU_ROWS;
+
+    int lit = (emu->gram[row / 8][column] >> (row % 8)) & 1;
+    return emu->inverse ? !lit : lit;
+}
+
+/**
+ * @brief  Write an image as binary PBM (P4).
+ *
+ * @param emu      Emulator.
+ * @param path     Output file.
+ * @param full_ram Non-zero: raw 132x64 GRAM; zero: the visible 128x64 panel.
+ * @return 0 on success, -1 on I/O error.
+ */
+int SH1106_Emu_WritePBM(const Sh1106Emu_t *emu, const char *path, int full_ram)
+{
+    int width = full_ram ? SH1106_EMU_COLUMNS : SH1106_EMU_PANEL_WIDTH;
+    FILE *f = fopen(path, "wb");
+    if (f == NULL)
+    {
+        return -1;
+    }
+
+    fprintf(f, "P4\n%d %d\n", width, SH1106_EMU_ROWS);
+    for (int y = 0; y < SH1106_EMU_ROWS; y++)
+    {
+        uint8_t bits = 0;
+        for (int x = 0; x < width; x++)
+        {
+            int lit = full_ram ? ((emu->gram[y / 8][x] >> (y % 8)) & 1) : SH1106_Emu_GetPixel(emu, x, y);
+            bits = (uint8_t)((bits << 1) | (lit ? 1U : 0U));
+            if ((x % 8) == 7)
+            {
+                fputc(bits, f);
+                bits = 0;
+            }
+        }
+        if ((width % 8) != 0)
+        {
+            fputc(bits << (8 - width % 8), f);
+        }
+    }
+    return (fclose(f) == 0) ? 0 : -1;
+}
+
+/**
+ * @brief Decode one command byte (or the argument of a pending double-byte command).
+ *
+ * @param emu Emulator.
+ * @param c   Command byte.
+ * @return None
+ */
+static void SH1106_Emu_Command(Sh1106Emu_t *emu, uint8_t c)
+{
+    emu->stats.command_bytes++;
+
+    if (emu->pending_command != 0U)
+    {
+        switch (emu->pending_command)
+        {
+            case 0x81:
+                emu->contrast = c;
+                break;
+            case 0xA8:
+                emu->multiplex = c & 0x3F;
+                break;
+            case 0xD3:
+                emu->display_offset = c & 0x3F;
+                break;
+            default:
+                /* 0xAD DC-DC, 0xD5 clock, 0xD9 pre-charge, 0xDA COM pins, 0xDB VCOM: no visible effect */
+                break;
+        }
+        emu->pending_command = 0;
+        return;
+    }
+
+    if (c <= 0x0F)
+    {
+        emu->column = (uint8_t)((emu->column & 0xF0) | c);
+    }
+    else if (c <= 0x1F)
+    {
+        emu->column = (uint8_t)((emu->column & 0x0F) | ((c & 0x0F) << 4));
+    }
+    else if ((c >= 0x30) && (c <= 0x33))
+    {
+        /* Pump voltage */
+    }
+    else if ((c >= 0x40) && (c <= 0x7F))
+    {
+        emu->start_line = c & 0x3F;
+    }
+    else if ((c == 0x81) || (c == 0xA8) || (c == 0xAD) || (c == 0xD3) ||
+             (c == 0xD5) || (c == 0xD9) || (c == 0xDA) || (c == 0xDB))
+    {
+        emu->pending_command = c;
+    }
+    else if ((c == 0xA0) || (c == 0xA1))
+    {
+        emu->segment_remap = c & 1U;
+    }
+    else if ((c == 0xA4) || (c == 0xA5))
+    {
+        emu->entire_on = c & 1U;
+    }
+    else if ((c == 0xA6) || (c == 0xA7))
+    {
+        emu->inverse = c & 1U;
+    }
+    else if ((c == 0xAE) || (c == 0xAF))
+    {
+        emu->display_on = c & 1U;
+    }
+    else if ((c >= 0xB0) && (c <= 0xB7))
+    {
+        emu->page = c & 0x07;
+    }
+    else if ((c >= 0xC0) && (c <= 0xCF))
+    {
+        emu->com_reverse = (c & 0x08) != 0U;
+    }
+    else if ((c == 0xE0) || (c == 0xEE) || (c == 0xE3))
+    {
+        /* Read-modify-write start/end, NOP */
+    }
+    else
+    {
+        emu->stats.unknown_commands++;
+    }
+}
+
+/**
+ * @brief Write one data byte at the current page/column.
+ *
+ * The column address increments after each write and stops at the last column.
+ *
+ * @param emu Emulator.
+ * @param d   Data byte.
+ * @return None
+ */
+static void SH1106_Emu_Data(Sh1106Emu_t *emu, uint8_t d)
+{
+    emu->stats.data_bytes++;
+    if (emu->column < SH1106_EMU_COLUMNS)
+    {
+        emu->gram[emu->page][emu->column++] = d;
+    }
+    else
+    {
+        emu->stats.column_overflows++;
+    }
+}
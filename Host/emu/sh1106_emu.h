@@ -0,0 +1,159 @@
+/**
+ * @file    sh1106_emu.h
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   SH1106 OLED controller emulator for host builds of the display stack.
+ *
+ * @details
+ * The emulator replaces u8x8_byte_stm32_i2c() as the u8x8 byte backend. Every I2C write is
+ * decoded like the real controller does it: control bytes (0x00 command stream, 0x40 data
+ * stream, 0x80/0xC0 single byte with continuation), single- and double-byte commands (page
+ * 0xB0, column 0x10/0x00, start line 0x40, contrast 0x81, power 0xAE/0xAF, ...) and data
+ * writes into a 132x64 GRAM with column auto-increment. Commands the SH1106 does not know
+ * (e.g. the SSD1306-only 0x8D/0x20 in the u8g2 init sequence) are ignored as on the chip.
+ *
+ * Each transaction is also costed on the wire: START + address + payload bytes at 9 clocks
+ * per byte + STOP, at a configurable bus clock, so flush strategies can be compared without
+ * hardware.
+ *
+ * @code
+ * Sh1106Emu_t emu;
+ * SH1106_Emu_Init(&emu, 400000);
+ * u8g2_Setup_sh1106_i2c_128x64_noname_f(&u8g2, U8G2_R0, SH1106_Emu_ByteCb, SH1106_Emu_GpioAndDelayCb);
+ * u8x8_SetUserPtr(u8g2_GetU8x8(&u8g2), &emu);
+ * @endcode
+ */
+
+#ifndef SH1106_EMU_H
+#define SH1106_EMU_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+#include "u8x8.h"
+
+/* Exported constants --------------------------------------------------------*/
+/** GRAM columns of the SH1106 */
+#define SH1106_EMU_COLUMNS        132
+/** GRAM pages (8 rows each) */
+#define SH1106_EMU_PAGES          8
+/** GRAM rows */
+#define SH1106_EMU_ROWS           (SH1106_EMU_PAGES * 8)
+/** Visible panel width of the 128x64 module */
+#define SH1106_EMU_PANEL_WIDTH    128
+/** First GRAM column shown on the 128x64 module */
+#define SH1106_EMU_PANEL_X_OFFSET 2
+/** Largest I2C write buffered by the byte backend */
+#define SH1106_EMU_MAX_TRANSFER   256
+
+/**
+ * @struct Sh1106EmuStats_t
+ * @brief Bus and decoder counters.
+ */
+typedef struct {
+    uint32_t transactions;       /**< I2C write transactions */
+    uint32_t bus_bytes;          /**< Bytes on the wire, including the address byte */
+    uint32_t command_bytes;      /**< Command and command-argument bytes decoded */
+    uint32_t data_bytes;         /**< GRAM data bytes written */
+    uint32_t unknown_commands;   /**< Command bytes the SH1106 ignores */
+    uint32_t column_overflows;   /**< Data bytes written past the last column (dropped) */
+    uint32_t wrong_address;      /**< Transactions addressed to another device */
+    uint64_t bus_time_ns;        /**< Emulated wire time at the configured clock */
+    uint64_t delay_ns;           /**< Delays requested through the gpio/delay callback */
+} Sh1106EmuStats_t;
+
+/**
+ * @struct Sh1106Emu_t
+ * @brief Emulated controller state.
+ */
+typedef struct {
+    uint8_t  gram[SH1106_EMU_PAGES][SH1106_EMU_COLUMNS]; /**< Display RAM, LSB = top row of a page */
+    uint8_t  column;             /**< Column address (0..131) */
+    uint8_t  page;               /**< Page address (0..7) */
+    uint8_t  start_line;         /**< Display start line (0..63) */
+    uint8_t  contrast;           /**< Contrast (0x81) */
+    uint8_t  display_on;         /**< 0xAF on / 0xAE off (power save) */
+    uint8_t  inverse;            /**< 0xA7 inverse / 0xA6 normal */
+    uint8_t  entire_on;          /**< 0xA5 all pixels on / 0xA4 follow RAM */
+    uint8_t  segment_remap;      /**< 0xA1 / 0xA0 */
+    uint8_t  com_reverse;        /**< 0xC8 / 0xC0 */
+    uint8_t  display_offset;     /**< 0xD3 argument */
+    uint8_t  multiplex;          /**< 0xA8 argument */
+    uint8_t  pending_command;    /**< Double-byte command waiting for its argument, 0 if none */
+    uint8_t  i2c_address;        /**< 7-bit address the emulator answers to */
+    uint32_t bus_hz;             /**< I2C clock used for timing */
+    Sh1106EmuStats_t stats;      /**< Counters */
+    uint8_t  transfer[SH1106_EMU_MAX_TRANSFER]; /**< Byte backend transfer buffer */
+    size_t   transfer_len;       /**< Bytes buffered in transfer[] */
+} Sh1106Emu_t;
+
+/* Exported functions --------------------------------------------------------*/
+/**
+ * @brief  Reset the controller to its power-on state and clear the counters.
+ * @param emu    Emulator.
+ * @param bus_hz I2C clock used to compute bus time (e.g. 100000, 400000, 1000000).
+ */
+void SH1106_Emu_Init(Sh1106Emu_t *emu, uint32_t bus_hz);
+
+/**
+ * @brief  Clear the counters, keeping GRAM and registers.
+ * @param emu Emulator.
+ */
+void SH1106_Emu_ResetStats(Sh1106Emu_t *emu);
+
+/**
+ * @brief  Feed one complete I2C write transaction.
+ * @param emu      Emulator.
+ * @param address7 7-bit slave address.
+ * @param data     Payload after the address byte.
+ * @param len      Payload length.
+ */
+void SH1106_Emu_Write(Sh1106Emu_t *emu, uint8_t address7, const uint8_t *data, size_t len);
+
+/**
+ * @brief  Wire time of one write transaction.
+ * @param bus_hz      I2C clock.
+ * @param payload_len Payload bytes after the address byte.
+ * @return Nanoseconds (START + address + payload at 9 clocks per byte + STOP).
+ */
+uint64_t SH1106_Emu_TransactionTimeNs(uint32_t bus_hz, size_t payload_len);
+
+/**
+ * @brief  u8x8 byte backend; drop-in replacement for u8x8_byte_stm32_i2c().
+ *
+ * The emulator is taken from u8x8_GetUserPtr().
+ */
+uint8_t SH1106_Emu_ByteCb(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr);
+
+/**
+ * @brief  u8x8 gpio/delay backend: no real delays, requested time is added to stats.delay_ns.
+ */
+uint8_t SH1106_Emu_GpioAndDelayCb(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr);
+
+/**
+ * @brief  Pixel as seen on the 128x64 panel (start line, inverse, power and all-on applied).
+ * @param emu Emulator.
+ * @param x   Panel column (0..127).
+ * @param y   Panel row (0..63).
+ * @return 1 if lit.
+ */
+int SH1106_Emu_GetPixel(const Sh1106Emu_t *emu, int x, int y);
+
+/**
+ * @brief  Write an image as binary PBM (P4).
+ * @param emu      Emulator.
+ * @param path     Output file.
+ * @param full_ram Non-zero: raw 132x64 GRAM; zero: the visible 128x64 panel.
+ * @return 0 on success, -1 on I/O error.
+ */
+int SH1106_Emu_WritePBM(const Sh1106Emu_t *emu, const char *path, int full_ram);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SH1106_EMU_H
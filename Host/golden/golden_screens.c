@@ -0,0 +1,308 @@
+/**
+ * @file    golden_screens.c
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Golden-image regression check of the OLED screen renderers.
+ *
+ * @details
+ * Renders every screen of Core/Src/screens.c (info, QR code, both bongo cat frames, dashboard) and the
+ * QR symbol renderer at both module sizes (version 2 at 2 px, version 4 at 1 px) and one
+ * asset pack image looked up by name into a
+ * cleared 128x64 full buffer, captures it with u8g2_WriteBufferPBM() and compares it byte for
+ * byte with <golden dir>/<screen>.pbm. A mismatch reports the number of differing pixels and
+ * their bounding box and writes the render next to the working directory as
+ * <screen>.actual.pbm. Any change to the drawing path (blitters, glyph caches, raster ops)
+ * must keep all screens identical.
+ *
+ * Screens that draw text need Hardware/u8g2/u8g2_fonts.c; without it they are skipped.
+ *
+ * @code
+ * ./golden_screens                  # compare, exit status 1 on any difference
+ * ./golden_screens --update         # accept the current renders as the new goldens
+ * ./golden_screens --xbm out/       # also write each render as XBM
+ * @endcode
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "u8g2.h"
+#include "screens.h"
+
+#ifndef GOLDEN_DIR
+#define GOLDEN_DIR  "."
+#endif
+
+/** Capacity of one captured PBM/XBM (128x64 PBM is 8 KiB plus header) */
+#define CAPTURE_SIZE  (32 * 1024)
+
+/** One screen under test */
+typedef struct {
+    const char *name;                   /**< Golden file stem */
+    void (*draw)(u8g2_t *u8g2);         /**< Renderer */
+    int needs_font;                     /**< Non-zero: draws text */
+} GoldenCase_t;
+
+static char capture[CAPTURE_SIZE];
+static size_t capture_len;
+static int capture_overflow;
+
+static void draw_info(u8g2_t *u8g2)     { Screens_DrawInfo(u8g2); }
+static void draw_qrcode(u8g2_t *u8g2)   { Screens_DrawQRCode(u8g2); }
+static void draw_bongo_1(u8g2_t *u8g2)  { Screens_DrawBongoCat(u8g2, 0); }
+static void draw_bongo_2(u8g2_t *u8g2)  { Screens_DrawBongoCat(u8g2, 1); }
+
+/** Encode a payload and draw the bare symbol (no caption, no font needed) */
+static void draw_qr(u8g2_t *u8g2, const char *payload, uint8_t x)
+{
+    QrCode_t qr;
+    if (QR_Encode(&qr, (const uint8_t *)payload, strlen(payload), OLED_QR_ECC) == 0)
+    {
+        Screens_DrawQRSymbol(u8g2, &qr, x, 0, SCREENS_QR_AREA);
+    }
+}
+
+static void draw_qr_v2(u8g2_t *u8g2)    { draw_qr(u8g2, OLED_QR_PAYLOAD, 0); }
+static void draw_qr_v4(u8g2_t *u8g2)    { draw_qr(u8g2, "https://github.com/olikraus/u8g2/wiki/u8g2reference#drawxbmp", 32); }
+static void draw_asset(u8g2_t *u8g2)    { (void)Screens_DrawImage(u8g2, Asset_FindId("qr_static"), 0, 0); }
+
+static void draw_dashboard(u8g2_t *u8g2)
+{
+    static const char *const labels[SCREENS_DASHBOARD_VALUES] = {
+        "Temp C", "Humidity %", "Fan rpm", "Load %", "Rx bytes", "Errors", "Uptime s", "A long label cut"
+    };
+    static const int32_t values[SCREENS_DASHBOARD_VALUES] = { 21, 48, 1200, 7, 123456, 0, 86400, -2147483647 - 1 };
+#ifdef GOLDEN_HAVE_FONTS
+    u8g2_SetFont(u8g2, u8g2_font_5x7_tr);
+#endif
+    Screens_DrawDashboard(u8g2, labels, values);
+}
+
+static const GoldenCase_t cases[] = {
+    { "info",        draw_info,    1 },
+    { "qrcode",      draw_qrcode,  1 },
+    { "bongo_cat_1", draw_bongo_1, 0 },
+    { "bongo_cat_2", draw_bongo_2, 0 },
+    { "qr_v2",       draw_qr_v2,   0 },
+    { "qr_v4",       draw_qr_v4,   0 },
+    { "asset_qr",    draw_asset,   0 },
+    { "dashboard",   draw_dashboard, 1 },
+};
+
+static uint8_t null_cb(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr)
+{
+    (void)u8x8;
+    (void)msg;
+    (void)arg_int;
+    (void)arg_ptr;
+    return 1;
+}
+
+static void capture_out(const char *s)
+{
+    size_t len = strlen(s);
+    if (capture_len + len > sizeof(capture))
+    {
+        capture_overflow = 1;
+        return;
+    }
+    memcpy(capture + capture_len, s, len);
+    capture_len += len;
+}
+
+static void capture_reset(void)
+{
+    capture_len = 0;
+    capture_overflow = 0;
+}
+
+static int write_file(const char *path, const char *data, size_t len)
+{
+    FILE *f = fopen(path, "wb");
+    if (f == NULL)
+    {
+        fprintf(stderr, "cannot write %s: %s\n", path, strerror(errno));
+        return -1;
+    }
+    size_t done = fwrite(data, 1, len, f);
+    fclose(f);
+    return (done == len) ? 0 : -1;
+}
+
+/** Read a whole file; returns NULL if it does not exist. */
+static char *read_file(const char *path, size_t *len)
+{
+    FILE *f = fopen(path, "rb");
+    if (f == NULL)
+    {
+        return NULL;
+    }
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    char *data = malloc((size_t)size + 1u);
+    *len = fread(data, 1, (size_t)size, f);
+    fclose(f);
+    return data;
+}
+
+/** Skip the three header lines of a plain PBM (P1, width, height). */
+static const char *pbm_pixels(const char *pbm, size_t len)
+{
+    const char *p = pbm;
+    for (int line = 0; line < 3; line++)
+    {
+        const char *nl = memchr(p, '\n', len - (size_t)(p - pbm));
+        if (nl == NULL)
+        {
+            return NULL;
+        }
+        p = nl + 1;
+    }
+    return p;
+}
+
+/** Print how two PBMs differ: pixel count and bounding box. */
+static void report_diff(const char *name, const char *golden, size_t golden_len)
+{
+    const char *a = pbm_pixels(golden, golden_len);
+    const char *b = pbm_pixels(capture, capture_len);
+    size_t a_len = (a != NULL) ? golden_len - (size_t)(a - golden) : 0;
+    size_t b_len = (b != NULL) ? capture_len - (size_t)(b - capture) : 0;
+
+    if ((a == NULL) || (b == NULL) || (a_len != b_len) || (golden_len != capture_len))
+    {
+        printf("FAIL  %-12s size or header differs (golden %zu bytes, render %zu bytes)\n",
+               name, golden_len, capture_len);
+        return;
+    }
+
+    int x = 0, y = 0, diffs = 0;
+    int x0 = 1 << 30, y0 = 1 << 30, x1 = -1, y1 = -1;
+    for (size_t i = 0; i < a_len; i++)
+    {
+        if (a[i] == '\n')
+        {
+            x = 0;
+            y++;
+            continue;
+        }
+        if (a[i] != b[i])
+        {
+            diffs++;
+            x0 = (x < x0) ? x : x0;
+            y0 = (y < y0) ? y : y0;
+            x1 = (x > x1) ? x : x1;
+            y1 = (y > y1) ? y : y1;
+        }
+        x++;
+    }
+    printf("FAIL  %-12s %d pixels differ in (%d,%d)-(%d,%d)\n", name, diffs, x0, y0, x1, y1);
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "usage: %s [-d golden_dir] [--update] [--xbm dir]\n", prog);
+}
+
+int main(int argc, char **argv)
+{
+    const char *golden_dir = GOLDEN_DIR;
+    const char *xbm_dir = NULL;
+    int update = 0;
+    int failures = 0;
+    char path[512];
+
+    for (int i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "-d") == 0) && (i + 1 < argc))
+        {
+            golden_dir = argv[++i];
+        }
+        else if ((strcmp(argv[i], "--xbm") == 0) && (i + 1 < argc))
+        {
+            xbm_dir = argv[++i];
+        }
+        else if (strcmp(argv[i], "--update") == 0)
+        {
+            update = 1;
+        }
+        else
+        {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+
+    u8g2_t u8g2;
+    u8g2_Setup_sh1106_i2c_128x64_noname_f(&u8g2, U8G2_R0, null_cb, null_cb);
+
+    for (size_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++)
+    {
+        const GoldenCase_t *gc = &cases[c];
+
+#ifndef GOLDEN_HAVE_FONTS
+        if (gc->needs_font)
+        {
+            printf("SKIP  %-12s needs Hardware/u8g2/u8g2_fonts.c\n", gc->name);
+            continue;
+        }
+#else
+        u8g2_SetFont(&u8g2, u8g2_font_ncenB08_tr);
+#endif
+        u8g2_ClearBuffer(&u8g2);
+        gc->draw(&u8g2);
+
+        if (xbm_dir != NULL)
+        {
+            capture_reset();
+            u8g2_WriteBufferXBM(&u8g2, capture_out);
+            snprintf(path, sizeof(path), "%s/%s.xbm", xbm_dir, gc->name);
+            failures += (write_file(path, capture, capture_len) != 0);
+        }
+
+        capture_reset();
+        u8g2_WriteBufferPBM(&u8g2, capture_out);
+        if (capture_overflow)
+        {
+            printf("FAIL  %-12s capture larger than %d bytes\n", gc->name, CAPTURE_SIZE);
+            failures++;
+            continue;
+        }
+
+        snprintf(path, sizeof(path), "%s/%s.pbm", golden_dir, gc->name);
+        if (update)
+        {
+            int ok = (write_file(path, capture, capture_len) == 0);
+            printf("%s  %-12s %s\n", ok ? "SAVE" : "FAIL", gc->name, path);
+            failures += !ok;
+            continue;
+        }
+
+        size_t golden_len = 0;
+        char *golden = read_file(path, &golden_len);
+        if (golden == NULL)
+        {
+            printf("FAIL  %-12s no golden %s (run with --update)\n", gc->name, path);
+            failures++;
+            continue;
+        }
+
+        if ((golden_len == capture_len) && (memcmp(golden, capture, capture_len) == 0))
+        {
+            printf("OK    %s\n", gc->name);
+        }
+        else
+        {
+            report_diff(gc->name, golden, golden_len);
+            snprintf(path, sizeof(path), "%s.actual.pbm", gc->name);
+            (void)write_file(path, capture, capture_len);
+            failures++;
+        }
+        free(golden);
+    }
+
+    printf("%d failure(s)\n", failures);
+    return (failures != 0) ? 1 : 0;
+}
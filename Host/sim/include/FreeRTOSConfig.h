@@ -0,0 +1,104 @@
+/**
+ * @file    FreeRTOSConfig.h
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   FreeRTOS configuration of the host firmware simulation (POSIX port).
+ *
+ * @details
+ * Mirrors Core/Inc/FreeRTOSConfig.h (tick rate, priorities, CMSIS-RTOS2 options, run-time
+ * stats and trace hooks) so the application behaves as on the board. Differences:
+ *   - No Cortex-M interrupt priority or handler mapping (the POSIX port owns the tick).
+ *   - The heap is larger: TCBs, queues and stacks use 64-bit pointers and StackType_t.
+ *   - configASSERT() reports the location and aborts instead of spinning.
+ */
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+#include <stdint.h>
+extern uint32_t SystemCoreClock;
+void Sim_AssertFailed(const char *file, int line);
+
+#ifndef CMSIS_device_header
+#define CMSIS_device_header "stm32f4xx.h"
+#endif /* CMSIS_device_header */
+
+#define configUSE_PREEMPTION                     1
+#define configSUPPORT_STATIC_ALLOCATION          1
+#define configSUPPORT_DYNAMIC_ALLOCATION         1
+#define configUSE_IDLE_HOOK                      0
+#define configUSE_TICK_HOOK                      0
+#define configCPU_CLOCK_HZ                       ( SystemCoreClock )
+#define configTICK_RATE_HZ                       ((TickType_t)1000)
+#define configMAX_PRIORITIES                     ( 56 )
+#define configMINIMAL_STACK_SIZE                 ((uint16_t)128)
+#define configTOTAL_HEAP_SIZE                    ((size_t)(64 * 1024))
+#define configMAX_TASK_NAME_LEN                  ( 16 )
+#define configUSE_TRACE_FACILITY                 1
+#define configGENERATE_RUN_TIME_STATS            1
+#define configUSE_16_BIT_TICKS                   0
+#define configUSE_MUTEXES                        1
+#define configQUEUE_REGISTRY_SIZE                8
+#define configUSE_RECURSIVE_MUTEXES              1
+#define configUSE_COUNTING_SEMAPHORES            1
+#define configUSE_PORT_OPTIMISED_TASK_SELECTION  0
+#define configMESSAGE_BUFFER_LENGTH_TYPE         size_t
+
+/* Co-routine definitions. */
+#define configUSE_CO_ROUTINES                    0
+#define configMAX_CO_ROUTINE_PRIORITIES          ( 2 )
+
+/* Software timer definitions. */
+#define configUSE_TIMERS                         1
+#define configTIMER_TASK_PRIORITY                ( 2 )
+#define configTIMER_QUEUE_LENGTH                 10
+#define configTIMER_TASK_STACK_DEPTH             256
+
+/* CMSIS-RTOS V2 flags */
+#define configUSE_OS2_THREAD_SUSPEND_RESUME  1
+#define configUSE_OS2_THREAD_ENUMERATE       1
+#define configUSE_OS2_EVENTFLAGS_FROM_ISR    1
+#define configUSE_OS2_THREAD_FLAGS           1
+#define configUSE_OS2_TIMER                  1
+#define configUSE_OS2_MUTEX                  1
+
+#define INCLUDE_vTaskPrioritySet             1
+#define INCLUDE_uxTaskPriorityGet            1
+#define INCLUDE_vTaskDelete                  1
+#define INCLUDE_vTaskCleanUpResources        0
+#define INCLUDE_vTaskSuspend                 1
+#define INCLUDE_vTaskDelayUntil              1
+#define INCLUDE_vTaskDelay                   1
+#define INCLUDE_xTaskGetSchedulerState       1
+#define INCLUDE_xTimerPendFunctionCall       1
+#define INCLUDE_xQueueGetMutexHolder         1
+#define INCLUDE_uxTaskGetStackHighWaterMark  1
+#define INCLUDE_xTaskGetCurrentTaskHandle    1
+#define INCLUDE_eTaskGetState                1
+
+/* Run-time stats clock (freertos.c forwards to the same functions on the board) */
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS RTOS_Stats_TimerInit
+#define portGET_RUN_TIME_COUNTER_VALUE         RTOS_Stats_GetRunTimeCounter
+
+#define USE_FreeRTOS_HEAP_4
+
+#define configASSERT( x ) if ((x) == 0) { Sim_AssertFailed(__FILE__, __LINE__); }
+
+/* Kernel trace hooks, identical to the firmware configuration */
+#include "trace.h"
+#include "rtos_stats.h"
+#define traceTASK_SWITCHED_IN()                                                              \
+    do                                                                                       \
+    {                                                                                        \
+        RTOS_Stats_TaskSwitchedIn((uint32_t)pxCurrentTCB->uxTCBNumber);                      \
+        TRACE_EVENT(TRACE_EVT_TASK_SWITCH_IN, 0, pxCurrentTCB->uxTCBNumber);                 \
+    } while (0)
+#if TRACE_ENABLE
+#define traceTASK_SWITCHED_OUT()              Trace_Record(TRACE_EVT_TASK_SWITCH_OUT, 0, (uint16_t)pxCurrentTCB->uxTCBNumber)
+#define traceQUEUE_SEND(pxQueue)              Trace_Record(TRACE_EVT_QUEUE_SEND, 0, (uint16_t)(uintptr_t)(pxQueue))
+#define traceQUEUE_SEND_FROM_ISR(pxQueue)     Trace_Record(TRACE_EVT_QUEUE_SEND_FROM_ISR, 0, (uint16_t)(uintptr_t)(pxQueue))
+#define traceQUEUE_RECEIVE(pxQueue)           Trace_Record(TRACE_EVT_QUEUE_RECEIVE, 0, (uint16_t)(uintptr_t)(pxQueue))
+#define traceQUEUE_RECEIVE_FROM_ISR(pxQueue)  Trace_Record(TRACE_EVT_QUEUE_RECEIVE_FROM_ISR, 0, (uint16_t)(uintptr_t)(pxQueue))
+#endif /* TRACE_ENABLE */
+
+#endif /* FREERTOS_CONFIG_H */
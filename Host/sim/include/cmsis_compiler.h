@@ -0,0 +1,139 @@
+/**
+ * @file    cmsis_compiler.h
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Host replacement of the CMSIS compiler/core intrinsics for the firmware simulation.
+ *
+ * @details
+ * The firmware masks interrupts with __disable_irq()/__set_PRIMASK() and detects interrupt
+ * context with __get_IPSR() (cmsis_os2.c). On the FreeRTOS POSIX port "interrupts" are the
+ * port's signal-driven tick and the simulated peripheral IRQs raised by sim_hal.c, so:
+ *   - PRIMASK is a per-thread flag. Setting it blocks the port signals for the calling thread
+ *     and clearing it restores the previous signal mask, so it nests correctly inside kernel
+ *     critical sections (like PRIMASK under BASEPRI on the Cortex-M4).
+ *   - IPSR is a per-thread exception number set while a simulated IRQ handler runs.
+ */
+
+#ifndef SIM_CMSIS_COMPILER_H
+#define SIM_CMSIS_COMPILER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported macro ------------------------------------------------------------*/
+#ifndef __STATIC_INLINE
+#define __STATIC_INLINE       static inline
+#endif
+#ifndef __STATIC_FORCEINLINE
+#define __STATIC_FORCEINLINE  static inline __attribute__((always_inline))
+#endif
+#ifndef __WEAK
+#define __WEAK                __attribute__((weak))
+#endif
+#ifndef __INLINE
+#define __INLINE              inline
+#endif
+#ifndef __NO_RETURN
+#define __NO_RETURN           __attribute__((__noreturn__))
+#endif
+#ifndef __USED
+#define __USED                __attribute__((used))
+#endif
+#ifndef __ALIGNED
+#define __ALIGNED(x)          __attribute__((aligned(x)))
+#endif
+#ifndef __PACKED
+#define __PACKED              __attribute__((packed, aligned(1)))
+#endif
+
+/* Exported variables --------------------------------------------------------*/
+/** Simulated PRIMASK of the calling thread (1 = interrupts masked) */
+extern __thread uint32_t sim_primask;
+/** Simulated IPSR of the calling thread (0 = thread mode, else exception number) */
+extern __thread uint32_t sim_ipsr;
+
+/* Exported functions --------------------------------------------------------*/
+/**
+ * @brief  Block the port signals for the calling thread, saving the previous mask (sim_hal.c).
+ */
+void Sim_IrqMask(void);
+
+/**
+ * @brief  Restore the signal mask saved by Sim_IrqMask() (sim_hal.c).
+ */
+void Sim_IrqUnmask(void);
+
+__STATIC_INLINE void __disable_irq(void)
+{
+    if (sim_primask == 0U)
+    {
+        Sim_IrqMask();
+        sim_primask = 1U;
+    }
+}
+
+__STATIC_INLINE void __enable_irq(void)
+{
+    if (sim_primask != 0U)
+    {
+        sim_primask = 0U;
+        Sim_IrqUnmask();
+    }
+}
+
+__STATIC_INLINE uint32_t __get_PRIMASK(void)
+{
+    return sim_primask;
+}
+
+__STATIC_INLINE void __set_PRIMASK(uint32_t primask)
+{
+    if ((primask & 1U) != 0U)
+    {
+        __disable_irq();
+    }
+    else
+    {
+        __enable_irq();
+    }
+}
+
+__STATIC_INLINE uint32_t __get_IPSR(void)
+{
+    return sim_ipsr;
+}
+
+__STATIC_INLINE uint32_t __get_BASEPRI(void)
+{
+    return 0U;
+}
+
+__STATIC_INLINE void __NOP(void)
+{
+    __asm__ volatile ("" ::: "memory");
+}
+
+__STATIC_INLINE void __DSB(void)
+{
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+__STATIC_INLINE void __DMB(void)
+{
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+__STATIC_INLINE void __ISB(void)
+{
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SIM_CMSIS_COMPILER_H
@@ -0,0 +1,128 @@
+/**
+ * @file    stm32f4xx.h
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Host replacement of the STM32F429 device header for the firmware simulation.
+ *
+ * @details
+ * Provides only what the application, cmsis_os2.c and the HAL stubs touch: interrupt numbers,
+ * GPIO ports, SysTick/NVIC placeholders and the DWT cycle counter. DWT->CYCCNT is derived from
+ * CLOCK_MONOTONIC at SIM_CORE_CLOCK_HZ on every access, so DWT-based timing (trace, run-time
+ * stats, perf HUD) reports host time in 168 MHz "cycles".
+ */
+
+#ifndef SIM_STM32F4XX_H
+#define SIM_STM32F4XX_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include "cmsis_compiler.h"
+
+/* Exported constants --------------------------------------------------------*/
+/** Core clock reported to the firmware (matches SystemClock_Config()) */
+#define SIM_CORE_CLOCK_HZ            168000000U
+/** Number of NVIC priority bits */
+#define __NVIC_PRIO_BITS             4U
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @enum IRQn_Type
+ * @brief Interrupt numbers used by the application.
+ */
+typedef enum {
+    SVCall_IRQn          = -5,
+    PendSV_IRQn          = -2,
+    SysTick_IRQn         = -1,
+    EXTI3_IRQn           = 9,
+    EXTI4_IRQn           = 10,
+    DMA1_Stream3_IRQn    = 14,
+    TIM1_UP_TIM10_IRQn   = 25,
+    USART3_IRQn          = 39
+} IRQn_Type;
+
+/**
+ * @struct GPIO_TypeDef
+ * @brief GPIO port; only the input and output data registers are modelled.
+ */
+typedef struct {
+    volatile uint32_t IDR;   /**< Input data register (driven by the simulation) */
+    volatile uint32_t ODR;   /**< Output data register */
+} GPIO_TypeDef;
+
+/**
+ * @struct SysTick_Type
+ * @brief SysTick registers (the POSIX port drives the tick, these stay idle).
+ */
+typedef struct {
+    volatile uint32_t CTRL;
+    volatile uint32_t LOAD;
+    volatile uint32_t VAL;
+    volatile uint32_t CALIB;
+} SysTick_Type;
+
+/**
+ * @struct DWT_Type
+ * @brief DWT registers used by dwt_timer.c.
+ */
+typedef struct {
+    volatile uint32_t CTRL;
+    volatile uint32_t CYCCNT;
+} DWT_Type;
+
+/**
+ * @struct CoreDebug_Type
+ * @brief CoreDebug registers used by dwt_timer.c.
+ */
+typedef struct {
+    volatile uint32_t DEMCR;
+} CoreDebug_Type;
+
+/* Exported variables --------------------------------------------------------*/
+/** Core clock (Hz) */
+extern uint32_t SystemCoreClock;
+/** Simulated GPIO ports A..K */
+extern GPIO_TypeDef sim_gpio[11];
+/** Idle SysTick registers */
+extern SysTick_Type sim_systick;
+/** Simulated CoreDebug registers */
+extern CoreDebug_Type sim_coredebug;
+
+/* Exported functions --------------------------------------------------------*/
+/**
+ * @brief  DWT registers with CYCCNT refreshed from the host clock.
+ * @return DWT register block.
+ */
+DWT_Type *Sim_DWT(void);
+
+/* Exported macro ------------------------------------------------------------*/
+#define GPIOA          (&sim_gpio[0])
+#define GPIOB          (&sim_gpio[1])
+#define GPIOC          (&sim_gpio[2])
+#define GPIOD          (&sim_gpio[3])
+#define GPIOE          (&sim_gpio[4])
+#define GPIOF          (&sim_gpio[5])
+#define GPIOG          (&sim_gpio[6])
+#define GPIOH          (&sim_gpio[7])
+
+#define SysTick        (&sim_systick)
+#define DWT            (Sim_DWT())
+#define CoreDebug      (&sim_coredebug)
+
+#define DWT_CTRL_CYCCNTENA_Msk       (1UL << 0)
+#define CoreDebug_DEMCR_TRCENA_Msk   (1UL << 24)
+
+__STATIC_INLINE void NVIC_SetPriority(IRQn_Type irqn, uint32_t priority)
+{
+    (void)irqn;
+    (void)priority;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SIM_STM32F4XX_H
@@ -0,0 +1,145 @@
+/**
+ * @file    stm32f4xx_hal.h
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Host replacement of the STM32F4 HAL for the firmware simulation.
+ *
+ * @details
+ * Declares the subset of HAL types and functions the application sources use. The
+ * implementations in sim_hal.c route I2C1 writes into the SH1106 emulator, read button levels
+ * from the simulated GPIO ports and deliver injected UART3 bytes, so Core/Src and
+ * Hardware/oled compile unchanged against the real main.h, i2c.h and usart.h.
+ */
+
+#ifndef SIM_STM32F4XX_HAL_H
+#define SIM_STM32F4XX_HAL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+#include "stm32f4xx.h"
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @enum HAL_StatusTypeDef
+ * @brief HAL status.
+ */
+typedef enum {
+    HAL_OK       = 0x00U,
+    HAL_ERROR    = 0x01U,
+    HAL_BUSY     = 0x02U,
+    HAL_TIMEOUT  = 0x03U
+} HAL_StatusTypeDef;
+
+/**
+ * @enum GPIO_PinState
+ * @brief GPIO pin level.
+ */
+typedef enum {
+    GPIO_PIN_RESET = 0,
+    GPIO_PIN_SET
+} GPIO_PinState;
+
+/**
+ * @enum HAL_UART_StateTypeDef
+ * @brief UART state (only READY/BUSY_RX are used by the simulation).
+ */
+typedef enum {
+    HAL_UART_STATE_RESET   = 0x00U,
+    HAL_UART_STATE_READY   = 0x20U,
+    HAL_UART_STATE_BUSY_RX = 0x22U
+} HAL_UART_StateTypeDef;
+
+/**
+ * @struct I2C_HandleTypeDef
+ * @brief I2C handle (transfer counters only).
+ */
+typedef struct {
+    uint32_t transfers;   /**< Master transmit calls */
+} I2C_HandleTypeDef;
+
+/**
+ * @struct UART_InitTypeDef
+ * @brief UART configuration (line rate only).
+ */
+typedef struct {
+    uint32_t BaudRate;    /**< Line rate */
+} UART_InitTypeDef;
+
+/**
+ * @struct UART_HandleTypeDef
+ * @brief UART handle with circular DMA reception state.
+ */
+typedef struct {
+    UART_InitTypeDef               Init;       /**< Configuration */
+    volatile HAL_UART_StateTypeDef RxState;    /**< Reception state */
+    uint8_t                       *pRxBuffPtr; /**< Reception ring */
+    uint16_t                       RxXferSize; /**< Reception ring size */
+} UART_HandleTypeDef;
+
+/**
+ * @struct DMA_HandleTypeDef
+ * @brief DMA handle placeholder.
+ */
+typedef struct {
+    uint32_t unused;
+} DMA_HandleTypeDef;
+
+/**
+ * @struct TIM_HandleTypeDef
+ * @brief Timer handle placeholder.
+ */
+typedef struct {
+    uint32_t unused;
+} TIM_HandleTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+#define GPIO_PIN_0      ((uint16_t)0x0001)
+#define GPIO_PIN_1      ((uint16_t)0x0002)
+#define GPIO_PIN_2      ((uint16_t)0x0004)
+#define GPIO_PIN_3      ((uint16_t)0x0008)
+#define GPIO_PIN_4      ((uint16_t)0x0010)
+#define GPIO_PIN_5      ((uint16_t)0x0020)
+#define GPIO_PIN_6      ((uint16_t)0x0040)
+#define GPIO_PIN_7      ((uint16_t)0x0080)
+#define GPIO_PIN_8      ((uint16_t)0x0100)
+#define GPIO_PIN_9      ((uint16_t)0x0200)
+#define GPIO_PIN_10     ((uint16_t)0x0400)
+#define GPIO_PIN_11     ((uint16_t)0x0800)
+#define GPIO_PIN_12     ((uint16_t)0x1000)
+#define GPIO_PIN_13     ((uint16_t)0x2000)
+#define GPIO_PIN_14     ((uint16_t)0x4000)
+#define GPIO_PIN_15     ((uint16_t)0x8000)
+
+#define HAL_MAX_DELAY   0xFFFFFFFFU
+#define HSI_VALUE       16000000U
+
+/* Exported functions --------------------------------------------------------*/
+uint32_t HAL_GetTick(void);
+void HAL_Delay(uint32_t delay);
+
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *port, uint16_t pin);
+void HAL_GPIO_WritePin(GPIO_TypeDef *port, uint16_t pin, GPIO_PinState state);
+void HAL_GPIO_TogglePin(GPIO_TypeDef *port, uint16_t pin);
+void HAL_GPIO_EXTI_IRQHandler(uint16_t pin);
+void HAL_GPIO_EXTI_Callback(uint16_t pin);
+
+HAL_StatusTypeDef HAL_I2C_Master_Transmit(I2C_HandleTypeDef *hi2c, uint16_t address, uint8_t *data,
+                                          uint16_t size, uint32_t timeout);
+
+HAL_StatusTypeDef HAL_UART_Init(UART_HandleTypeDef *huart);
+HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA(UART_HandleTypeDef *huart, uint8_t *data, uint16_t size);
+HAL_StatusTypeDef HAL_UART_AbortReceive(UART_HandleTypeDef *huart);
+void HAL_UART_IRQHandler(UART_HandleTypeDef *huart);
+void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma);
+void HAL_TIM_IRQHandler(TIM_HandleTypeDef *htim);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SIM_STM32F4XX_HAL_H
@@ -0,0 +1,516 @@
+/**
+ * @file    sim_hal.c
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Host HAL stubs of the firmware simulation (tick, GPIO, EXTI, I2C1, USART3 RX DMA, DWT).
+ *
+ * @details
+ * HAL_GetTick() follows the FreeRTOS tick so that button debouncing and script timestamps
+ * share one time base. HAL_I2C_Master_Transmit() feeds the SH1106 emulator and busy-waits for
+ * the emulated wire time, which is what the polling driver does on the board; the end of a
+ * full-frame flush (last column of page 7 written) is reported to the frame hook.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "sim_hal.h"
+#include "main.h"
+#include "stm32f4xx_it.h"
+#include "uart_rx.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/**
+ * @defgroup SIM_HAL_Private_Variables Sim HAL Private Variables
+ * @{
+ */
+/** Emulated display behind I2C1 */
+static Sh1106Emu_t *sim_emu;
+/** Non-zero: I2C writes take their wire time */
+static int sim_wire_delay;
+/** Host clock at Sim_HAL_Init() */
+static uint64_t sim_epoch_ns;
+/** Full-frame flush observer */
+static SimFrameHook_t sim_frame_hook;
+/** Start of the flush in progress (0 if none) */
+static uint64_t sim_flush_start_ns;
+/** DMA write position in the USART3 reception ring */
+static uint32_t sim_uart_rx_pos;
+/** Position reported by the pending USART3 RX event */
+static volatile uint16_t sim_uart_rx_event_pos;
+/** Set while an RX event waits for the USART3 IRQ */
+static volatile uint8_t sim_uart_rx_pending;
+/** DWT registers (CYCCNT recomputed on access) */
+static DWT_Type sim_dwt;
+/** Milliseconds spent spinning in HAL_Delay() */
+static volatile uint32_t sim_delay_spin_ms;
+/** Signal mask saved by Sim_IrqMask() */
+static __thread sigset_t sim_saved_sigmask;
+/** @} */
+
+/**
+ * @defgroup SIM_HAL_Exported_Variables Sim HAL Exported Variables
+ * @{
+ */
+uint32_t SystemCoreClock = SIM_CORE_CLOCK_HZ;
+GPIO_TypeDef sim_gpio[11];
+SysTick_Type sim_systick;
+CoreDebug_Type sim_coredebug;
+__thread uint32_t sim_primask;
+__thread uint32_t sim_ipsr;
+
+I2C_HandleTypeDef hi2c1;
+UART_HandleTypeDef huart3;
+DMA_HandleTypeDef hdma_usart3_rx;
+DMA_HandleTypeDef hdma_usart3_tx;
+TIM_HandleTypeDef htim1;
+/** @} */
+
+/**
+ * @defgroup SIM_HAL_Private_Functions Sim HAL Private Functions
+ * @{
+ */
+/**
+ * @brief Raw host monotonic clock
+ * @return Nanoseconds
+ */
+static uint64_t Sim_MonotonicNs(void);
+/** @} */
+
+
+/**
+ * @brief  Attach the emulator behind I2C1 and reset the simulated peripherals.
+ * @param emu        SH1106 emulator.
+ * @param wire_delay Non-zero: I2C writes take their emulated wire time.
+ * @return None
+ */
+void Sim_HAL_Init(Sh1106Emu_t *emu, int wire_delay)
+{
+    sim_emu = emu;
+    sim_wire_delay = wire_delay;
+    sim_epoch_ns = Sim_MonotonicNs();
+    sim_flush_start_ns = 0;
+    huart3.Init.BaudRate = UART_CONSOLE_BAUD_RATE;
+    huart3.RxState = HAL_UART_STATE_READY;
+}
+
+/**
+ * @brief  Host monotonic clock.
+ * @return Nanoseconds since Sim_HAL_Init().
+ */
+uint64_t Sim_NowNs(void)
+{
+    return Sim_MonotonicNs() - sim_epoch_ns;
+}
+
+/**
+ * @brief  Drive a GPIO input level.
+ * @param port  GPIO port.
+ * @param pin   Pin mask.
+ * @param level New level.
+ * @return None
+ */
+void Sim_SetPin(GPIO_TypeDef *port, uint16_t pin, GPIO_PinState level)
+{
+    if (level == GPIO_PIN_SET)
+    {
+        port->IDR |= pin;
+    }
+    else
+    {
+        port->IDR &= ~(uint32_t)pin;
+    }
+}
+
+/**
+ * @brief  Run the handler of a peripheral IRQ in interrupt context on the calling task.
+ * @param irqn Interrupt number.
+ * @return None
+ */
+void Sim_RaiseIrq(IRQn_Type irqn)
+{
+    uint32_t prev_ipsr = sim_ipsr;
+    sim_ipsr = (uint32_t)((int32_t)irqn + 16);
+
+    switch (irqn)
+    {
+        case EXTI3_IRQn:
+            EXTI3_IRQHandler();
+            break;
+        case EXTI4_IRQn:
+            EXTI4_IRQHandler();
+            break;
+        case DMA1_Stream3_IRQn:
+            DMA1_Stream3_IRQHandler();
+            break;
+        case TIM1_UP_TIM10_IRQn:
+            TIM1_UP_TIM10_IRQHandler();
+            break;
+        case USART3_IRQn:
+            USART3_IRQHandler();
+            break;
+        default:
+            break;
+    }
+
+    sim_ipsr = prev_ipsr;
+}
+
+/**
+ * @brief  Receive one byte on USART3.
+ * @param c Received byte.
+ * @return 0 if delivered, -1 if reception was not armed.
+ */
+int Sim_UartRxInject(uint8_t c)
+{
+    return Sim_UartRxInjectBlock(&c, 1);
+}
+
+/**
+ * @brief  Receive a block of bytes on USART3 through the circular DMA ring.
+ *
+ * The bytes are written in pieces that end at the half-transfer and transfer-complete
+ * points of the ring, and each piece raises an RX event with the new DMA position, like
+ * the HT/TC/idle events of the real reception.
+ *
+ * @param data Received bytes.
+ * @param len  Number of bytes.
+ * @return 0 if delivered, -1 if reception was not armed.
+ */
+int Sim_UartRxInjectBlock(const uint8_t *data, size_t len)
+{
+    if (huart3.RxState != HAL_UART_STATE_BUSY_RX)
+    {
+        return -1;
+    }
+    while (len > 0U)
+    {
+        uint32_t size = huart3.RxXferSize;
+        uint32_t stop = (sim_uart_rx_pos < (size / 2U)) ? (size / 2U) : size;
+        uint32_t count = stop - sim_uart_rx_pos;
+        if (count > len)
+        {
+            count = (uint32_t)len;
+        }
+        memcpy(&huart3.pRxBuffPtr[sim_uart_rx_pos], data, count);
+        data += count;
+        len -= count;
+        sim_uart_rx_pos += count;
+        sim_uart_rx_event_pos = (uint16_t)sim_uart_rx_pos;
+        sim_uart_rx_pending = 1;
+        if (sim_uart_rx_pos == size)
+        {
+            sim_uart_rx_pos = 0;
+        }
+        Sim_RaiseIrq(USART3_IRQn);
+    }
+    return 0;
+}
+
+/**
+ * @brief  Register the full-frame flush observer.
+ * @param hook Callback, or NULL.
+ * @return None
+ */
+void Sim_SetFrameHook(SimFrameHook_t hook)
+{
+    sim_frame_hook = hook;
+}
+
+/**
+ * @brief  Block the port signals for the calling thread, saving the previous mask.
+ * @return None
+ */
+void Sim_IrqMask(void)
+{
+    sigset_t all;
+    sigfillset(&all);
+    pthread_sigmask(SIG_BLOCK, &all, &sim_saved_sigmask);
+}
+
+/**
+ * @brief  Restore the signal mask saved by Sim_IrqMask().
+ * @return None
+ */
+void Sim_IrqUnmask(void)
+{
+    pthread_sigmask(SIG_SETMASK, &sim_saved_sigmask, NULL);
+}
+
+/**
+ * @brief  DWT registers with CYCCNT refreshed from the host clock.
+ * @return DWT register block.
+ */
+DWT_Type *Sim_DWT(void)
+{
+    sim_dwt.CYCCNT = (uint32_t)((Sim_NowNs() * (SIM_CORE_CLOCK_HZ / 1000000U)) / 1000U);
+    return &sim_dwt;
+}
+
+/**
+ * @brief  configASSERT() failure: report the location and abort.
+ * @param file Source file.
+ * @param line Source line.
+ * @return None
+ */
+void Sim_AssertFailed(const char *file, int line)
+{
+    fprintf(stderr, "configASSERT failed at %s:%d\n", file, line);
+    abort();
+}
+
+/**
+ * @brief  Error_Handler() of the simulation: report and exit instead of spinning.
+ * @return None
+ */
+void Error_Handler(void)
+{
+    fprintf(stderr, "Error_Handler called\n");
+    exit(EXIT_FAILURE);
+}
+
+/**
+ * @brief  SysTick handler referenced by cmsis_os2.c; the POSIX port drives the tick itself.
+ * @return None
+ */
+__WEAK void xPortSysTickHandler(void)
+{
+}
+
+/**
+ * @brief  HAL tick (milliseconds), taken from the RTOS tick.
+ * @return Tick count.
+ */
+uint32_t HAL_GetTick(void)
+{
+    return (sim_ipsr != 0U) ? (uint32_t)xTaskGetTickCountFromISR() : (uint32_t)xTaskGetTickCount();
+}
+
+/**
+ * @brief  Busy-wait delay, same semantics as the HAL (at least delay + 1 ticks).
+ * @param delay Delay in milliseconds.
+ * @return None
+ */
+void HAL_Delay(uint32_t delay)
+{
+    uint32_t start = HAL_GetTick();
+    uint32_t wait = delay;
+
+    if (wait < HAL_MAX_DELAY)
+    {
+        wait++;
+    }
+    while ((HAL_GetTick() - start) < wait)
+    {
+    }
+    sim_delay_spin_ms += HAL_GetTick() - start;
+}
+
+/**
+ * @brief  Time spent busy-waiting in HAL_Delay() since start-up.
+ * @return Milliseconds (ticks).
+ */
+uint32_t Sim_GetDelaySpinMs(void)
+{
+    return sim_delay_spin_ms;
+}
+
+/**
+ * @brief  Read a GPIO input.
+ * @param port GPIO port.
+ * @param pin  Pin mask.
+ * @return Pin level.
+ */
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *port, uint16_t pin)
+{
+    return ((port->IDR & pin) != 0U) ? GPIO_PIN_SET : GPIO_PIN_RESET;
+}
+
+/**
+ * @brief  Drive a GPIO output.
+ * @param port  GPIO port.
+ * @param pin   Pin mask.
+ * @param state Output level.
+ * @return None
+ */
+void HAL_GPIO_WritePin(GPIO_TypeDef *port, uint16_t pin, GPIO_PinState state)
+{
+    if (state == GPIO_PIN_SET)
+    {
+        port->ODR |= pin;
+    }
+    else
+    {
+        port->ODR &= ~(uint32_t)pin;
+    }
+}
+
+/**
+ * @brief  Toggle a GPIO output.
+ * @param port GPIO port.
+ * @param pin  Pin mask.
+ * @return None
+ */
+void HAL_GPIO_TogglePin(GPIO_TypeDef *port, uint16_t pin)
+{
+    port->ODR ^= pin;
+}
+
+/**
+ * @brief  EXTI line handler: forward to HAL_GPIO_EXTI_Callback() (stm32f4xx_it.c).
+ * @param pin Pin mask of the line.
+ * @return None
+ */
+void HAL_GPIO_EXTI_IRQHandler(uint16_t pin)
+{
+    HAL_GPIO_EXTI_Callback(pin);
+}
+
+/**
+ * @brief  Polling I2C master write into the SH1106 emulator.
+ *
+ * @param hi2c    I2C handle.
+ * @param address 8-bit (shifted) slave address.
+ * @param data    Payload.
+ * @param size    Payload length.
+ * @param timeout Unused.
+ * @return HAL_OK.
+ */
+HAL_StatusTypeDef HAL_I2C_Master_Transmit(I2C_HandleTypeDef *hi2c, uint16_t address, uint8_t *data,
+                                          uint16_t size, uint32_t timeout)
+{
+    (void)timeout;
+    hi2c->transfers++;
+    if (sim_emu == NULL)
+    {
+        return HAL_OK;
+    }
+
+    uint64_t start = Sim_NowNs();
+    /* Writes from main() (boot splash) do not start a flush of the display task */
+    if ((sim_flush_start_ns == 0U) && (xTaskGetSchedulerState() != taskSCHEDULER_NOT_STARTED))
+    {
+        sim_flush_start_ns = start;
+    }
+
+    uint32_t data_before = sim_emu->stats.data_bytes;
+    SH1106_Emu_Write(sim_emu, (uint8_t)(address >> 1), data, size);
+
+    uint64_t end = start + SH1106_Emu_TransactionTimeNs(sim_emu->bus_hz, size);
+    if (sim_wire_delay)
+    {
+        while (Sim_NowNs() < end)
+        {
+        }
+    }
+
+    if ((sim_emu->stats.data_bytes != data_before) && (sim_emu->page == (SH1106_EMU_PAGES - 1U)) &&
+        (sim_emu->column >= (SH1106_EMU_PANEL_X_OFFSET + SH1106_EMU_PANEL_WIDTH)))
+    {
+        if (sim_frame_hook != NULL)
+        {
+            sim_frame_hook(sim_flush_start_ns, sim_wire_delay ? end : Sim_NowNs());
+        }
+        sim_flush_start_ns = 0;
+    }
+    return HAL_OK;
+}
+
+/**
+ * @brief  Apply a new configuration (only the line rate is kept).
+ * @param huart UART handle.
+ * @return HAL_OK.
+ */
+HAL_StatusTypeDef HAL_UART_Init(UART_HandleTypeDef *huart)
+{
+    huart->RxState = HAL_UART_STATE_READY;
+    return HAL_OK;
+}
+
+/**
+ * @brief  Start circular DMA reception with idle-line events.
+ * @param huart UART handle.
+ * @param data  Reception ring.
+ * @param size  Ring size.
+ * @return HAL_OK, or HAL_BUSY if reception is already running.
+ */
+HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA(UART_HandleTypeDef *huart, uint8_t *data, uint16_t size)
+{
+    if (huart->RxState != HAL_UART_STATE_READY)
+    {
+        return HAL_BUSY;
+    }
+    huart->pRxBuffPtr = data;
+    huart->RxXferSize = size;
+    huart->RxState = HAL_UART_STATE_BUSY_RX;
+    if (huart == &huart3)
+    {
+        sim_uart_rx_pos = 0;
+        sim_uart_rx_pending = 0;
+    }
+    return HAL_OK;
+}
+
+/**
+ * @brief  Stop reception.
+ * @param huart UART handle.
+ * @return HAL_OK.
+ */
+HAL_StatusTypeDef HAL_UART_AbortReceive(UART_HandleTypeDef *huart)
+{
+    huart->RxState = HAL_UART_STATE_READY;
+    return HAL_OK;
+}
+
+/**
+ * @brief  USART IRQ: deliver a pending RX event.
+ *
+ * Calls UART_RX_EventHandler() like HAL_UARTEx_RxEventCallback() in usart.c.
+ *
+ * @param huart UART handle.
+ * @return None
+ */
+void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
+{
+    if ((huart == &huart3) && sim_uart_rx_pending && (huart->RxState == HAL_UART_STATE_BUSY_RX))
+    {
+        sim_uart_rx_pending = 0;
+        UART_RX_EventHandler(sim_uart_rx_event_pos);
+    }
+}
+
+/**
+ * @brief  DMA IRQ (the simulated UART TX does not use DMA).
+ * @param hdma DMA handle.
+ * @return None
+ */
+void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma)
+{
+    (void)hdma;
+}
+
+/**
+ * @brief  Timer IRQ (the HAL time base follows the RTOS tick in the simulation).
+ * @param htim Timer handle.
+ * @return None
+ */
+void HAL_TIM_IRQHandler(TIM_HandleTypeDef *htim)
+{
+    (void)htim;
+}
+
+/**
+ * @brief Raw host monotonic clock.
+ * @return Nanoseconds.
+ */
+static uint64_t Sim_MonotonicNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
@@ -0,0 +1,96 @@
+/**
+ * @file    sim_hal.h
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Simulation controls of the host HAL stubs (GPIO levels, IRQs, UART input, I2C).
+ *
+ * @details
+ * Simulated interrupts run synchronously on the calling FreeRTOS task: Sim_RaiseIrq() sets
+ * the thread's IPSR to the exception number and calls the real handler from stm32f4xx_it.c,
+ * so cmsis_os2.c takes its ISR paths (FromISR APIs, yield on exit) as on the board. One
+ * difference: a context switch requested by the handler happens at the FromISR call instead
+ * of on exception return.
+ * I2C1 writes are decoded by the SH1106 emulator and, unless disabled, the caller busy-waits
+ * for the emulated wire time like the polling HAL_I2C_Master_Transmit() does.
+ */
+
+#ifndef SIM_HAL_H
+#define SIM_HAL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+#include "stm32f4xx_hal.h"
+#include "sh1106_emu.h"
+
+/**
+ * @brief Called after the last byte of a full-frame flush reached the emulated panel.
+ * @param start_ns Time of the first I2C write of the flush (Sim_NowNs()).
+ * @param end_ns   Time the last write completed on the wire.
+ */
+typedef void (*SimFrameHook_t)(uint64_t start_ns, uint64_t end_ns);
+
+/* Exported functions --------------------------------------------------------*/
+/**
+ * @brief  Attach the emulator behind I2C1 and reset the simulated peripherals.
+ * @param emu        SH1106 emulator (already initialized with the bus clock).
+ * @param wire_delay Non-zero: I2C writes take their emulated wire time.
+ */
+void Sim_HAL_Init(Sh1106Emu_t *emu, int wire_delay);
+
+/**
+ * @brief  Host monotonic clock.
+ * @return Nanoseconds since Sim_HAL_Init().
+ */
+uint64_t Sim_NowNs(void);
+
+/**
+ * @brief  Drive a GPIO input level (e.g. a user button).
+ * @param port  GPIO port.
+ * @param pin   Pin mask.
+ * @param level New level.
+ */
+void Sim_SetPin(GPIO_TypeDef *port, uint16_t pin, GPIO_PinState level);
+
+/**
+ * @brief  Run the handler of a peripheral IRQ in interrupt context on the calling task.
+ * @param irqn Interrupt number (EXTI3_IRQn, EXTI4_IRQn, USART3_IRQn, ...).
+ */
+void Sim_RaiseIrq(IRQn_Type irqn);
+
+/**
+ * @brief  Receive one byte on USART3 (raises USART3_IRQn if reception is armed).
+ * @param c Received byte.
+ * @return 0 if delivered, -1 if reception was not armed (byte lost, as an overrun).
+ */
+int Sim_UartRxInject(uint8_t c);
+
+/**
+ * @brief  Receive a block of bytes on USART3 (RX events at half/full ring, like DMA).
+ * @param data Received bytes.
+ * @param len  Number of bytes.
+ * @return 0 if delivered, -1 if reception was not armed.
+ */
+int Sim_UartRxInjectBlock(const uint8_t *data, size_t len);
+
+/**
+ * @brief  Register the full-frame flush observer.
+ * @param hook Callback, or NULL.
+ */
+void Sim_SetFrameHook(SimFrameHook_t hook);
+
+/**
+ * @brief  Time spent busy-waiting in HAL_Delay() since start-up (all callers).
+ * @return Milliseconds (ticks).
+ */
+uint32_t Sim_GetDelaySpinMs(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SIM_HAL_H
@@ -0,0 +1,631 @@
+/**
+ * @file    sim_main.c
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Host firmware simulation: the real application on the FreeRTOS POSIX port.
+ *
+ * @details
+ * Starts the same tasks as main.c (trace, UART TX and RX, deferred log, OLED display task)
+ * with the SH1106 emulator behind I2C1, then replays an input script from a dedicated
+ * highest-priority task. Each script line is "<time_ms> <action> [argument]":
+ *
+ * @code
+ * # time_ms  action   argument
+ *   500      press    1        # SW1 (PE3) goes high, EXTI3 fires
+ *   600      release  1        # SW1 released: short press, bongo cat page
+ *   1500     key      p        # USART3 receives 'p': statistics page
+ *   3000     press    2
+ *   4000     release  2        # long press: perf HUD toggles
+ *   5000     key      v        # video sink: USART3 switches to the video rate
+ *   5100     stream   v.bin    # file received on USART3, paced at the current line rate
+ *   9000     end
+ * @endcode
+ *
+ * Times are RTOS ticks after the scheduler started. At the end the simulation reports the
+ * time from Sim_HAL_Init() ("reset") to the boot splash, from the scheduler start to the end
+ * of the first flush of the display task (display init included), the
+ * frame rate, the flush time, the input-to-photon latency (event injection until the first
+ * flush that shows a different page or HUD state), heap usage and the per-task statistics.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "cmsis_os2.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "rtos_tasks.h"
+#include "rtos_stats.h"
+#include "deferred_log.h"
+#include "uart_rx.h"
+#include "mem_pool.h"
+#include "oled_splash.h"
+#include "perf_hud.h"
+#include "trace.h"
+#include "uart_tx.h"
+#include "sim_hal.h"
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @defgroup SIM_Private_Defines Sim Private Defines
+ * @{
+ */
+/** Largest number of script events */
+#define SIM_MAX_EVENTS          256
+/** Run time when the script has no "end" event (ms after the last event) */
+#define SIM_DEFAULT_TAIL_MS     1000
+/** Default I2C clock (matches MX_I2C1_Init()) */
+#define SIM_DEFAULT_BUS_HZ      400000U
+/** Task slots read at the first frame */
+#define SIM_MAX_TASKS           8
+/** Script task stack size (bytes) */
+#define SIM_TASK_STACK_SIZE     (512 * 4)
+/** Largest block a stream event delivers per tick */
+#define SIM_STREAM_CHUNK        256
+/** Longest script argument (stream file path) */
+#define SIM_ARG_MAX             96
+/** @} */
+
+/**
+ * @enum SimAction_t
+ * @brief Script actions.
+ */
+typedef enum {
+    SIM_ACTION_PRESS = 0,   /**< Button level high + EXTI */
+    SIM_ACTION_RELEASE,     /**< Button level low + EXTI */
+    SIM_ACTION_KEY,         /**< One byte received on USART3 */
+    SIM_ACTION_STREAM,      /**< A file received on USART3 at the line rate */
+    SIM_ACTION_END          /**< Stop and report */
+} SimAction_t;
+
+/**
+ * @struct SimEvent_t
+ * @brief One script event.
+ */
+typedef struct {
+    uint32_t    time_ms;    /**< Tick at which the event is injected */
+    SimAction_t action;     /**< What to inject */
+    uint32_t    arg;        /**< Button number or received byte */
+    char       *path;       /**< File of a stream event */
+} SimEvent_t;
+
+/**
+ * @struct SimMetrics_t
+ * @brief Measurements collected by the frame hook.
+ */
+typedef struct {
+    uint64_t splash_ns;         /**< End of the boot splash (0 if none) */
+    uint32_t splash_bytes;      /**< Bus bytes of the boot splash */
+    uint32_t splash_xfers;      /**< I2C transactions of the boot splash */
+    uint64_t boot_ns;           /**< Scheduler start */
+    uint32_t boot_spin_ms;      /**< HAL_Delay() busy-wait before the first frame */
+    uint32_t boot_idle_us;      /**< Idle task run time before the first frame */
+    uint32_t frames;            /**< Full-frame flushes completed */
+    uint64_t first_frame_ns;    /**< End of the first flush */
+    uint64_t last_frame_ns;     /**< End of the latest flush */
+    uint64_t flush_ns_sum;      /**< Sum of flush durations */
+    uint64_t flush_ns_max;      /**< Longest flush */
+    uint32_t latency_count;     /**< Measured events (release or key) that changed the screen */
+    uint32_t latency_missed;    /**< Events without a visible change before the next event */
+    uint64_t latency_ns_sum;    /**< Sum of input-to-photon latencies */
+    uint64_t latency_ns_min;    /**< Shortest latency */
+    uint64_t latency_ns_max;    /**< Longest latency */
+    uint8_t  pending;           /**< An injected event waits for a visible change */
+    uint64_t pending_ns;        /**< Injection time of the pending event */
+    uint32_t pending_state;     /**< Screen state at injection */
+} SimMetrics_t;
+
+/**
+ * @defgroup SIM_Private_Variables Sim Private Variables
+ * @{
+ */
+/** Script events in time order */
+static SimEvent_t sim_events[SIM_MAX_EVENTS];
+/** Number of script events */
+static uint32_t sim_event_count;
+/** Emulated display */
+static Sh1106Emu_t sim_emu;
+/** Frame and latency measurements (shared by the script task and the OLED task) */
+static SimMetrics_t sim_metrics;
+/** Output image of the final panel contents, or NULL */
+static const char *sim_pbm_path;
+/** UART3 handle (line rate of stream events) */
+extern UART_HandleTypeDef huart3;
+/** @} */
+
+/**
+ * @defgroup SIM_Private_Functions Sim Private Functions
+ * @{
+ */
+/**
+ * @brief Load a script file
+ * @param path Script path
+ * @return 0 on success, -1 on error
+ */
+static int Sim_LoadScript(const char *path);
+/**
+ * @brief Screen state visible to the user (page and HUD)
+ * @return Packed state
+ */
+static uint32_t Sim_ScreenState(void);
+/**
+ * @brief Run time of the idle task so far
+ * @return Microseconds (run-time stats clock)
+ */
+static uint32_t Sim_IdleRunTimeUs(void);
+/**
+ * @brief Full-frame flush observer
+ * @param start_ns Flush start
+ * @param end_ns   Flush end
+ */
+static void Sim_OnFrame(uint64_t start_ns, uint64_t end_ns);
+/**
+ * @brief Inject one event
+ * @param event Event
+ */
+static void Sim_Inject(const SimEvent_t *event);
+/**
+ * @brief Receive a file on USART3 at the current line rate
+ * @param path File
+ */
+static void Sim_Stream(const char *path);
+/**
+ * @brief Print the measurements
+ * @param elapsed_ms Simulated run time
+ */
+static void Sim_Report(uint32_t elapsed_ms);
+/**
+ * @brief Output function of the u8g2 profile report
+ * @param s NUL-terminated text
+ */
+static void Sim_ProfOut(const char *s);
+/**
+ * @brief Script task (RTOS thread entry)
+ * @param argument Unused
+ */
+static void Sim_ScriptTask(void *argument);
+/** @} */
+
+
+/**
+ * @brief  Simulation entry point.
+ *
+ * Usage: oled_sim [-s script] [-b bus_hz] [-n] [-o panel.pbm]
+ *   -s  input script (default: no input, run for SIM_DEFAULT_TAIL_MS)
+ *   -b  I2C clock used for wire timing (default 400000)
+ *   -n  no wire delay: I2C writes complete immediately (CPU-only timing)
+ *   -o  write the final panel contents as PBM
+ *
+ * @return Exit status.
+ */
+int main(int argc, char *argv[])
+{
+    uint32_t bus_hz = SIM_DEFAULT_BUS_HZ;
+    int wire_delay = 1;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "-s") == 0) && (i + 1 < argc))
+        {
+            if (Sim_LoadScript(argv[++i]) != 0)
+            {
+                return EXIT_FAILURE;
+            }
+        }
+        else if ((strcmp(argv[i], "-b") == 0) && (i + 1 < argc))
+        {
+            bus_hz = (uint32_t)strtoul(argv[++i], NULL, 0);
+        }
+        else if (strcmp(argv[i], "-n") == 0)
+        {
+            wire_delay = 0;
+        }
+        else if ((strcmp(argv[i], "-o") == 0) && (i + 1 < argc))
+        {
+            sim_pbm_path = argv[++i];
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [-s script] [-b bus_hz] [-n] [-o panel.pbm]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    SH1106_Emu_Init(&sim_emu, bus_hz);
+    Sim_HAL_Init(&sim_emu, wire_delay);
+    Sim_SetFrameHook(Sim_OnFrame);
+
+    /* Same start-up sequence as main.c */
+    OLED_Splash_Show();
+    sim_metrics.splash_bytes = sim_emu.stats.bus_bytes;
+    sim_metrics.splash_xfers = sim_emu.stats.transactions;
+    osKernelInitialize();
+    Trace_Init();
+    UART_TX_Init();
+    MemPool_Init();
+    UART_RX_Init();
+    Log_Init();
+    OLED_Task_Init();
+
+    const osThreadAttr_t script_task_attributes = {
+        .name = "Sim_Script",
+        .priority = osPriorityRealtime,
+        .stack_size = SIM_TASK_STACK_SIZE
+    };
+    if (osThreadNew(Sim_ScriptTask, NULL, &script_task_attributes) == NULL)
+    {
+        fprintf(stderr, "Failed to create script task\n");
+        return EXIT_FAILURE;
+    }
+
+    sim_metrics.boot_ns = Sim_NowNs();
+    osKernelStart();
+    return EXIT_FAILURE;
+}
+
+/**
+ * @brief Script task: replay the events at their tick, then report and exit.
+ *
+ * Runs above every application task, like the interrupts it injects.
+ *
+ * @param argument Unused.
+ * @return None
+ */
+static void Sim_ScriptTask(void *argument)
+{
+    (void)argument;
+    uint32_t start = osKernelGetTickCount();
+    uint32_t end_ms = SIM_DEFAULT_TAIL_MS;
+
+    for (uint32_t i = 0; i < sim_event_count; i++)
+    {
+        const SimEvent_t *event = &sim_events[i];
+        osDelayUntil(start + event->time_ms);
+        if (event->action == SIM_ACTION_END)
+        {
+            end_ms = event->time_ms;
+            break;
+        }
+        Sim_Inject(event);
+        end_ms = event->time_ms + SIM_DEFAULT_TAIL_MS;
+    }
+
+    osDelayUntil(start + end_ms);
+    vTaskSuspendAll();
+    Sim_Report(osKernelGetTickCount() - start);
+    exit(EXIT_SUCCESS);
+}
+
+/**
+ * @brief Inject one event.
+ *
+ * Releases and received bytes start a latency measurement; a still pending one is counted
+ * as missed (the previous event did not change the screen before this one).
+ *
+ * @param event Event.
+ * @return None
+ */
+static void Sim_Inject(const SimEvent_t *event)
+{
+    /* Button actions and console commands take effect on release / reception */
+    if ((event->action == SIM_ACTION_RELEASE) || (event->action == SIM_ACTION_KEY))
+    {
+        taskENTER_CRITICAL();
+        if (sim_metrics.pending)
+        {
+            sim_metrics.latency_missed++;
+        }
+        sim_metrics.pending = 1;
+        sim_metrics.pending_ns = Sim_NowNs();
+        sim_metrics.pending_state = Sim_ScreenState();
+        taskEXIT_CRITICAL();
+    }
+
+    switch (event->action)
+    {
+        case SIM_ACTION_PRESS:
+        case SIM_ACTION_RELEASE:
+        {
+            GPIO_PinState level = (event->action == SIM_ACTION_PRESS) ? GPIO_PIN_SET : GPIO_PIN_RESET;
+            if (event->arg == 1U)
+            {
+                Sim_SetPin(SW1_GPIO_Port, SW1_Pin, level);
+                Sim_RaiseIrq(SW1_EXTI_IRQn);
+            }
+            else
+            {
+                Sim_SetPin(SW2_GPIO_Port, SW2_Pin, level);
+                Sim_RaiseIrq(SW2_EXTI_IRQn);
+            }
+            break;
+        }
+        case SIM_ACTION_KEY:
+            if (Sim_UartRxInject((uint8_t)event->arg) != 0)
+            {
+                UART_TX_Panic("sim: USART3 reception not armed, key lost\n");
+            }
+            break;
+        case SIM_ACTION_STREAM:
+            Sim_Stream(event->path);
+            break;
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief Receive a file on USART3 at the current line rate.
+ *
+ * Delivers one tick's worth of bytes (10 bits per byte) per tick, so the script task is busy
+ * until the file has been sent and later events are injected after it.
+ *
+ * @param path File.
+ * @return None
+ */
+static void Sim_Stream(const char *path)
+{
+    static uint8_t chunk[SIM_STREAM_CHUNK];
+    FILE *file = fopen(path, "rb");
+
+    if (file == NULL)
+    {
+        perror(path);
+        return;
+    }
+    while (1)
+    {
+        size_t per_tick = huart3.Init.BaudRate / 10U / configTICK_RATE_HZ;
+        if (per_tick > sizeof(chunk))
+        {
+            per_tick = sizeof(chunk);
+        }
+        size_t len = fread(chunk, 1, (per_tick > 0U) ? per_tick : 1U, file);
+        if (len == 0U)
+        {
+            break;
+        }
+        if (Sim_UartRxInjectBlock(chunk, len) != 0)
+        {
+            UART_TX_Panic("sim: USART3 reception not armed, stream lost\n");
+            break;
+        }
+        osDelay(1);
+    }
+    fclose(file);
+}
+
+/**
+ * @brief Full-frame flush observer (runs in the OLED task, or in main() for the boot splash).
+ * @param start_ns Flush start.
+ * @param end_ns   Flush end.
+ * @return None
+ */
+static void Sim_OnFrame(uint64_t start_ns, uint64_t end_ns)
+{
+    uint64_t flush_ns = end_ns - start_ns;
+
+    if (xTaskGetSchedulerState() == taskSCHEDULER_NOT_STARTED)
+    {
+        /* Boot splash, written from main() */
+        sim_metrics.splash_ns = end_ns;
+        return;
+    }
+
+    uint32_t idle_us = (sim_metrics.frames == 0U) ? Sim_IdleRunTimeUs() : 0U;
+
+    taskENTER_CRITICAL();
+    if (sim_metrics.frames == 0U)
+    {
+        sim_metrics.first_frame_ns = end_ns;
+        sim_metrics.boot_spin_ms = Sim_GetDelaySpinMs();
+        sim_metrics.boot_idle_us = idle_us;
+    }
+    sim_metrics.frames++;
+    sim_metrics.last_frame_ns = end_ns;
+    sim_metrics.flush_ns_sum += flush_ns;
+    if (flush_ns > sim_metrics.flush_ns_max)
+    {
+        sim_metrics.flush_ns_max = flush_ns;
+    }
+
+    if (sim_metrics.pending && (Sim_ScreenState() != sim_metrics.pending_state))
+    {
+        uint64_t latency = end_ns - sim_metrics.pending_ns;
+        if ((sim_metrics.latency_count == 0U) || (latency < sim_metrics.latency_ns_min))
+        {
+            sim_metrics.latency_ns_min = latency;
+        }
+        if (latency > sim_metrics.latency_ns_max)
+        {
+            sim_metrics.latency_ns_max = latency;
+        }
+        sim_metrics.latency_ns_sum += latency;
+        sim_metrics.latency_count++;
+        sim_metrics.pending = 0;
+    }
+    taskEXIT_CRITICAL();
+}
+
+/**
+ * @brief Screen state visible to the user: display page and HUD on/off.
+ * @return Packed state.
+ */
+static uint32_t Sim_ScreenState(void)
+{
+    return ((uint32_t)current_display_mode << 1) | (uint32_t)PerfHUD_IsEnabled();
+}
+
+/**
+ * @brief Run time of the idle task so far (as of its last switch-out).
+ * @return Microseconds (run-time stats clock).
+ */
+static uint32_t Sim_IdleRunTimeUs(void)
+{
+    TaskStatus_t tasks[SIM_MAX_TASKS];
+    UBaseType_t count = uxTaskGetSystemState(tasks, SIM_MAX_TASKS, NULL);
+
+    for (UBaseType_t i = 0; i < count; i++)
+    {
+        if (strcmp(tasks[i].pcTaskName, "IDLE") == 0)
+        {
+            return tasks[i].ulRunTimeCounter;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Print the measurements (scheduler suspended).
+ * @param elapsed_ms Simulated run time.
+ * @return None
+ */
+static void Sim_Report(uint32_t elapsed_ms)
+{
+    const SimMetrics_t *m = &sim_metrics;
+    const Sh1106EmuStats_t *bus = &sim_emu.stats;
+
+    printf("\n--- oled_sim report (%" PRIu32 " ms, I2C %" PRIu32 " Hz) ---\n", elapsed_ms, sim_emu.bus_hz);
+    if (m->frames > 1U)
+    {
+        double span_s = (double)(m->last_frame_ns - m->first_frame_ns) / 1e9;
+        printf("frames           %" PRIu32 " (%.2f fps)\n", m->frames, (double)(m->frames - 1U) / span_s);
+    }
+    else
+    {
+        printf("frames           %" PRIu32 "\n", m->frames);
+    }
+    if (m->splash_ns != 0U)
+    {
+        printf("reset->splash    %.1f ms (splash module: %" PRIu32 " us)\n",
+               (double)m->splash_ns / 1e6, OLED_Splash_GetBootUs());
+    }
+    if (m->frames > 0U)
+    {
+        printf("boot->frame      %.1f ms (%" PRIu32 " ms spinning in HAL_Delay, %.1f ms idle)\n",
+               (double)(m->first_frame_ns - m->boot_ns) / 1e6, m->boot_spin_ms,
+               (double)m->boot_idle_us / 1e3);
+        printf("flush            avg %.3f ms, max %.3f ms\n",
+               (double)m->flush_ns_sum / (double)m->frames / 1e6, (double)m->flush_ns_max / 1e6);
+        printf("bus per frame    %.1f bytes, %.1f transactions\n",
+               (double)(bus->bus_bytes - m->splash_bytes) / (double)m->frames,
+               (double)(bus->transactions - m->splash_xfers) / (double)m->frames);
+    }
+    if (m->latency_count > 0U)
+    {
+        printf("input->photon    min %.3f ms, avg %.3f ms, max %.3f ms (%" PRIu32 " events, %" PRIu32 " without change)\n",
+               (double)m->latency_ns_min / 1e6, (double)m->latency_ns_sum / (double)m->latency_count / 1e6,
+               (double)m->latency_ns_max / 1e6, m->latency_count, m->latency_missed + m->pending);
+    }
+    printf("heap             %u of %u bytes used, peak %u\n",
+           (unsigned)(configTOTAL_HEAP_SIZE - xPortGetFreeHeapSize()), (unsigned)configTOTAL_HEAP_SIZE,
+           (unsigned)(configTOTAL_HEAP_SIZE - xPortGetMinimumEverFreeHeapSize()));
+    printf("log drops        %" PRIu32 "\n", Log_GetDroppedCount());
+    fflush(stdout);
+    RTOS_Stats_Print();
+    if (U8G2_PROF_ENABLE)
+    {
+        U8G2_Prof_Report(Sim_ProfOut);
+    }
+
+    if ((sim_pbm_path != NULL) && (SH1106_Emu_WritePBM(&sim_emu, sim_pbm_path, 0) == 0))
+    {
+        printf("panel written to %s\n", sim_pbm_path);
+    }
+    fflush(stdout);
+}
+
+/**
+ * @brief Output function of the u8g2 profile report (stdout).
+ * @param s NUL-terminated text.
+ * @return None
+ */
+static void Sim_ProfOut(const char *s)
+{
+    fputs(s, stdout);
+}
+
+/**
+ * @brief Load a script file; events must be in time order.
+ * @param path Script path.
+ * @return 0 on success, -1 on error.
+ */
+static int Sim_LoadScript(const char *path)
+{
+    FILE *file = fopen(path, "r");
+    char line[128];
+    uint32_t line_no = 0;
+
+    if (file == NULL)
+    {
+        perror(path);
+        return -1;
+    }
+
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        char action[16];
+        char arg[SIM_ARG_MAX] = "";
+        unsigned long time_ms;
+        char *comment = strchr(line, '#');
+
+        line_no++;
+        if (comment != NULL)
+        {
+            *comment = '\0';
+        }
+        int fields = sscanf(line, "%lu %15s %95s", &time_ms, action, arg);
+        if (fields <= 0)
+        {
+            continue;
+        }
+        if ((fields < 2) || (sim_event_count >= SIM_MAX_EVENTS) ||
+            ((sim_event_count > 0U) && (time_ms < sim_events[sim_event_count - 1U].time_ms)))
+        {
+            fprintf(stderr, "%s:%" PRIu32 ": invalid or out-of-order event\n", path, line_no);
+            fclose(file);
+            return -1;
+        }
+
+        SimEvent_t *event = &sim_events[sim_event_count];
+        event->time_ms = (uint32_t)time_ms;
+        if ((strcmp(action, "press") == 0) || (strcmp(action, "release") == 0))
+        {
+            event->action = (action[0] == 'p') ? SIM_ACTION_PRESS : SIM_ACTION_RELEASE;
+            event->arg = (uint32_t)strtoul(arg, NULL, 10);
+            if ((event->arg != 1U) && (event->arg != 2U))
+            {
+                fprintf(stderr, "%s:%" PRIu32 ": button must be 1 or 2\n", path, line_no);
+                fclose(file);
+                return -1;
+            }
+        }
+        else if ((strcmp(action, "key") == 0) && (arg[0] != '\0'))
+        {
+            event->action = SIM_ACTION_KEY;
+            event->arg = (uint8_t)arg[0];
+        }
+        else if ((strcmp(action, "stream") == 0) && (arg[0] != '\0'))
+        {
+            event->action = SIM_ACTION_STREAM;
+            event->arg = 0;
+            event->path = strdup(arg);
+        }
+        else if (strcmp(action, "end") == 0)
+        {
+            event->action = SIM_ACTION_END;
+            event->arg = 0;
+        }
+        else
+        {
+            fprintf(stderr, "%s:%" PRIu32 ": unknown action '%s'\n", path, line_no, action);
+            fclose(file);
+            return -1;
+        }
+        sim_event_count++;
+    }
+
+    fclose(file);
+    return 0;
+}
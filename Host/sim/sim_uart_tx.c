@@ -0,0 +1,183 @@
+/**
+ * @file    sim_uart_tx.c
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   UART3 TX engine of the firmware simulation (replaces Core/Src/uart_tx.c).
+ *
+ * @details
+ * Same API and counters as the DMA engine, but bytes are written straight to stdout with
+ * the port signals masked (no preemption while the write system call runs). The simulated
+ * link never fills up, so the overflow policy is stored but has no effect.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "uart_tx.h"
+#include "main.h"
+#include <string.h>
+#include <unistd.h>
+
+/**
+ * @defgroup SIM_UART_TX_Private_Variables Sim UART TX Private Variables
+ * @{
+ */
+/** Engine counters */
+static UartTxStats_t tx_stats;
+/** Selected overflow policy */
+static UartTxPolicy_t tx_policy = UART_TX_OVERFLOW_POLICY;
+/** @} */
+
+/**
+ * @defgroup SIM_UART_TX_Private_Functions Sim UART TX Private Functions
+ * @{
+ */
+/**
+ * @brief Write all bytes to a file descriptor
+ * @param fd   File descriptor
+ * @param data Bytes
+ * @param len  Number of bytes
+ * @return Bytes written
+ */
+static size_t Sim_UartTx_WriteAll(int fd, const uint8_t *data, size_t len);
+/** @} */
+
+
+/**
+ * @brief  Reset the counters.
+ * @return None
+ */
+void UART_TX_Init(void)
+{
+    memset(&tx_stats, 0, sizeof(tx_stats));
+    tx_policy = UART_TX_OVERFLOW_POLICY;
+}
+
+/**
+ * @brief  Write bytes to stdout.
+ * @param data Bytes to send.
+ * @param len  Number of bytes.
+ * @return Number of bytes written.
+ */
+size_t UART_TX_Write(const uint8_t *data, size_t len)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    size_t written = Sim_UartTx_WriteAll(STDOUT_FILENO, data, len);
+    tx_stats.queued += (uint32_t)written;
+    tx_stats.sent += (uint32_t)written;
+    tx_stats.dropped += (uint32_t)(len - written);
+    tx_stats.transfers++;
+    if (len > tx_stats.peak_fill)
+    {
+        tx_stats.peak_fill = (uint32_t)len;
+    }
+
+    __set_PRIMASK(primask);
+    return written;
+}
+
+/**
+ * @brief  Write a block to stdout in one piece (the simulated ring always has room).
+ * @param data Bytes to send.
+ * @param len  Number of bytes.
+ * @return 0 if written, -1 if the write failed.
+ */
+int UART_TX_TryWrite(const uint8_t *data, size_t len)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    size_t written = Sim_UartTx_WriteAll(STDOUT_FILENO, data, len);
+    tx_stats.queued += (uint32_t)written;
+    tx_stats.sent += (uint32_t)written;
+    tx_stats.transfers++;
+
+    __set_PRIMASK(primask);
+    return (written == len) ? 0 : -1;
+}
+
+/**
+ * @brief  Wait for queued output (written synchronously, so nothing is ever pending).
+ * @param timeout_ms Ignored.
+ * @return 0
+ */
+int UART_TX_Flush(uint32_t timeout_ms)
+{
+    (void)timeout_ms;
+    return 0;
+}
+
+/**
+ * @brief  Select the overflow policy (kept for API compatibility).
+ * @param policy New policy.
+ * @return None
+ */
+void UART_TX_SetPolicy(UartTxPolicy_t policy)
+{
+    tx_policy = policy;
+    (void)tx_policy;
+}
+
+/**
+ * @brief  Copy the current TX counters.
+ * @param stats Destination for the counters.
+ * @return None
+ */
+void UART_TX_GetStats(UartTxStats_t *stats)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    *stats = tx_stats;
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @brief  Panic output: write the message to stderr.
+ * @param msg NUL-terminated message.
+ * @return None
+ */
+void UART_TX_Panic(const char *msg)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    (void)Sim_UartTx_WriteAll(STDERR_FILENO, (const uint8_t *)msg, strlen(msg));
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @brief  USART3 TX-complete hook (no DMA in the simulation).
+ * @return None
+ */
+void UART_TX_TxCpltHandler(void)
+{
+}
+
+/**
+ * @brief  USART3 error hook (no DMA in the simulation).
+ * @return None
+ */
+void UART_TX_ErrorHandler(void)
+{
+}
+
+/**
+ * @brief Write all bytes to a file descriptor, retrying short writes.
+ * @param fd   File descriptor.
+ * @param data Bytes.
+ * @param len  Number of bytes.
+ * @return Bytes written.
+ */
+static size_t Sim_UartTx_WriteAll(int fd, const uint8_t *data, size_t len)
+{
+    size_t done = 0;
+    while (done < len)
+    {
+        ssize_t n = write(fd, data + done, len - done);
+        if (n <= 0)
+        {
+            break;
+        }
+        done += (size_t)n;
+    }
+    return done;
+}
@@ -0,0 +1,358 @@
+/**
+ * @file    fb_viewer.c
+ * @author  Ted Wang
+ * @date    2026-10-18
+ * @brief   Host viewer of the framebuffer mirror (Core/Src/fb_mirror.c).
+ *
+ * @details
+ * Reads USART3 output of the board (the ST-LINK virtual COM port), a pipe or a capture file,
+ * picks the mirror packets out from between the log text with the firmware's own stream
+ * decoder (video_stream.c) and rebuilds the frames in a u8g2 full buffer. The newest frame is
+ * written with u8g2_WriteBufferPBM() (-o, replaced atomically so an image viewer can reload
+ * it) and can be printed as text (-a).
+ *
+ * End-to-end latency is the time from the end of the flush on the board (the stamp of each
+ * packet) to the arrival of the packet's last byte here. The board tick and the host clock
+ * have an unknown offset; it is taken from the packet that arrived quickest, assuming that one
+ * only spent its own wire time in transit, so the figures are a lower bound that includes
+ * rate limiting, TX ring queueing, the wire and the host's serial driver.
+ *
+ * @code
+ * ./fb_viewer /dev/ttyACM0 -o live.pbm          # press 'f' in a terminal first, or use -f
+ * ./fb_viewer -f -a /dev/ttyACM0                 # send 'f' itself, print frames as text
+ * ./oled_sim -s script.txt | ./fb_viewer -b 0 -  # simulated board, no wire time
+ * ./fb_viewer capture.bin -o last.pbm            # capture file: frames only, no latency
+ * @endcode
+ *
+ * Stops at end of input or Ctrl-C and prints the report. Exit status 1 if no frame was
+ * decoded.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#include "u8g2.h"
+#include "video_stream.h"
+
+/** Default line rate (console rate of the firmware) */
+#define DEFAULT_BAUD    115200u
+/** Latency samples kept */
+#define MAX_SAMPLES     100000u
+/** Status line interval (ms) */
+#define STATUS_MS       1000.0
+
+typedef struct {
+    double raw_ms;      /**< Host arrival time minus board stamp */
+    double wire_ms;     /**< Wire time of the packet */
+} sample_t;
+
+static volatile sig_atomic_t stop;
+static sample_t samples[MAX_SAMPLES];
+static size_t sample_count;
+static FILE *pbm_file;
+
+static void on_signal(int sig)
+{
+    (void)sig;
+    stop = 1;
+}
+
+static double now_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e3 + (double)ts.tv_nsec / 1e6;
+}
+
+static speed_t baud_constant(unsigned baud)
+{
+    switch (baud)
+    {
+        case 9600:    return B9600;
+        case 57600:   return B57600;
+        case 115200:  return B115200;
+        case 230400:  return B230400;
+#ifdef B921600
+        case 921600:  return B921600;
+#endif
+        default:      return 0;
+    }
+}
+
+static int setup_tty(int fd, unsigned baud)
+{
+    struct termios tio;
+    speed_t speed = baud_constant(baud);
+
+    if (speed == 0)
+    {
+        fprintf(stderr, "unsupported baud rate %u\n", baud);
+        return -1;
+    }
+    if (tcgetattr(fd, &tio) != 0)
+    {
+        perror("tcgetattr");
+        return -1;
+    }
+    cfmakeraw(&tio);
+    cfsetispeed(&tio, speed);
+    cfsetospeed(&tio, speed);
+    tio.c_cflag |= CLOCAL | CREAD;
+    tio.c_cc[VMIN] = 1;
+    tio.c_cc[VTIME] = 0;
+    if (tcsetattr(fd, TCSANOW, &tio) != 0)
+    {
+        perror("tcsetattr");
+        return -1;
+    }
+    tcflush(fd, TCIFLUSH);
+    return 0;
+}
+
+static void pbm_out(const char *s)
+{
+    fputs(s, pbm_file);
+}
+
+/** Write the frame to path via a temporary file, so readers never see half a PBM */
+static void write_pbm(u8g2_t *u8g2, const char *path)
+{
+    char tmp[512];
+    snprintf(tmp, sizeof(tmp), "%s.tmp", path);
+    pbm_file = fopen(tmp, "w");
+    if (pbm_file == NULL)
+    {
+        perror(tmp);
+        return;
+    }
+    u8g2_WriteBufferPBM(u8g2, pbm_out);
+    fclose(pbm_file);
+    if (rename(tmp, path) != 0)
+    {
+        perror(path);
+    }
+}
+
+static void print_ascii(u8g2_t *u8g2)
+{
+    const uint8_t *buf = u8g2_GetBufferPtr(u8g2);
+    /* Two pixel rows per text line */
+    static const char cell[4] = { ' ', '\'', '.', ':' };
+
+    printf("\033[H");
+    for (int y = 0; y < 64; y += 2)
+    {
+        char line[129];
+        for (int x = 0; x < 128; x++)
+        {
+            int top = (buf[(y / 8) * 128 + x] >> (y % 8)) & 1;
+            int bottom = (buf[((y + 1) / 8) * 128 + x] >> ((y + 1) % 8)) & 1;
+            line[x] = cell[top | (bottom << 1)];
+        }
+        line[128] = '\0';
+        printf("|%s|\n", line);
+    }
+    fflush(stdout);
+}
+
+static int compare_double(const void *a, const void *b)
+{
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+/** Latency per sample with the clock offset of the quickest packet; sorted ascending */
+static size_t latencies(double *out)
+{
+    double offset = 0.0;
+    for (size_t i = 0; i < sample_count; i++)
+    {
+        double candidate = samples[i].raw_ms - samples[i].wire_ms;
+        if ((i == 0) || (candidate < offset))
+        {
+            offset = candidate;
+        }
+    }
+    for (size_t i = 0; i < sample_count; i++)
+    {
+        out[i] = samples[i].raw_ms - offset;
+    }
+    qsort(out, sample_count, sizeof(double), compare_double);
+    return sample_count;
+}
+
+static void report(const VideoDecoder_t *dec, double elapsed_ms, int timed)
+{
+    static double sorted[MAX_SAMPLES];
+    const VideoStats_t *s = &dec->stats;
+
+    fprintf(stderr, "\n--- fb_viewer ---\n");
+    fprintf(stderr, "bytes       %lu (mirror packets and log text)\n", (unsigned long)s->bytes);
+    fprintf(stderr, "frames      %lu (%lu key), %lu tiles", (unsigned long)s->frames,
+            (unsigned long)s->key_frames, (unsigned long)s->tiles);
+    if (timed && (elapsed_ms > 0.0))
+    {
+        fprintf(stderr, ", %.2f fps", s->frames * 1e3 / elapsed_ms);
+    }
+    fprintf(stderr, "\n");
+    fprintf(stderr, "errors      %lu crc, %lu format, %lu skipped waiting for a key frame\n",
+            (unsigned long)s->crc_errors, (unsigned long)s->format_errors, (unsigned long)s->skipped);
+    if (!timed || (sample_count == 0u))
+    {
+        return;
+    }
+    size_t n = latencies(sorted);
+    double sum = 0.0;
+    for (size_t i = 0; i < n; i++)
+    {
+        sum += sorted[i];
+    }
+    fprintf(stderr, "latency     min %.1f ms, avg %.1f ms, p95 %.1f ms, max %.1f ms (%zu frames)\n",
+            sorted[0], sum / (double)n, sorted[(n * 95u) / 100u], sorted[n - 1u], n);
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "usage: %s [-b baud] [-o frame.pbm] [-a] [-f] <tty | file | ->\n"
+                    "  -b baud   line rate of a tty and for wire time (default %u, 0 = no wire time)\n"
+                    "  -o file   write the newest frame as PBM\n"
+                    "  -a        print every frame as text\n"
+                    "  -f        send 'f' first (switch the mirror on)\n", prog, DEFAULT_BAUD);
+}
+
+int main(int argc, char **argv)
+{
+    static VideoDecoder_t dec;
+    static u8g2_t u8g2;
+    static uint8_t buf[4096];
+    unsigned baud = DEFAULT_BAUD;
+    const char *pbm_path = NULL;
+    int ascii = 0;
+    int toggle = 0;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "b:o:afh")) != -1)
+    {
+        switch (opt)
+        {
+            case 'b': baud = (unsigned)strtoul(optarg, NULL, 0); break;
+            case 'o': pbm_path = optarg; break;
+            case 'a': ascii = 1; break;
+            case 'f': toggle = 1; break;
+            default:  usage(argv[0]); return EXIT_FAILURE;
+        }
+    }
+    if (optind != argc - 1)
+    {
+        usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    const char *path = argv[optind];
+    int fd = (strcmp(path, "-") == 0) ? STDIN_FILENO : open(path, (toggle ? O_RDWR : O_RDONLY) | O_NOCTTY);
+    if (fd < 0)
+    {
+        perror(path);
+        return EXIT_FAILURE;
+    }
+    struct stat st;
+    int timed = (fstat(fd, &st) == 0) && !S_ISREG(st.st_mode);
+    if (isatty(fd) && (setup_tty(fd, baud) != 0))
+    {
+        return EXIT_FAILURE;
+    }
+    if (toggle && (write(fd, "f", 1) != 1))
+    {
+        perror("write");
+    }
+
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = on_signal;
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+
+    Video_DecoderInit(&dec);
+    u8g2_Setup_sh1106_i2c_128x64_noname_f(&u8g2, U8G2_R0, u8x8_byte_empty, u8x8_dummy_cb);
+    u8g2_ClearBuffer(&u8g2);
+    if (ascii)
+    {
+        printf("\033[2J");
+    }
+
+    double start = now_ms();
+    double last_status = start;
+    double offset = 0.0;
+    while (!stop)
+    {
+        ssize_t n = read(fd, buf, sizeof(buf));
+        if (n < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            perror("read");
+            break;
+        }
+        if (n == 0)
+        {
+            break;
+        }
+        double arrival = now_ms();
+        VideoTiles_t dirty;
+        memset(&dirty, 0, sizeof(dirty));
+        uint32_t events = Video_Decode(&dec, buf, (size_t)n, u8g2_GetBufferPtr(&u8g2), &dirty);
+        if ((events & VIDEO_EVT_FRAME) == 0u)
+        {
+            continue;
+        }
+        if (timed && (sample_count < MAX_SAMPLES) && (dec.stamp != 0u))
+        {
+            /* dec.need is the length of the packet just applied, unless the same read already
+               completed the next header; close enough for a wire time */
+            sample_t *sample = &samples[sample_count];
+            sample->raw_ms = arrival - (double)dec.stamp;
+            sample->wire_ms = (baud != 0u) ? dec.need * 10.0 * 1e3 / baud : 0.0;
+            if ((sample_count == 0u) || ((sample->raw_ms - sample->wire_ms) < offset))
+            {
+                offset = sample->raw_ms - sample->wire_ms;
+            }
+            sample_count++;
+        }
+        if (pbm_path != NULL)
+        {
+            write_pbm(&u8g2, pbm_path);
+        }
+        if (ascii)
+        {
+            print_ascii(&u8g2);
+        }
+        if (timed && !ascii && ((arrival - last_status) >= STATUS_MS))
+        {
+            last_status = arrival;
+            fprintf(stderr, "\r%lu frames, %lu errors, latency %.1f ms   ", (unsigned long)dec.stats.frames,
+                    (unsigned long)(dec.stats.crc_errors + dec.stats.format_errors + dec.stats.skipped),
+                    (sample_count > 0u) ? samples[sample_count - 1u].raw_ms - offset : 0.0);
+        }
+    }
+
+    if (fd != STDIN_FILENO)
+    {
+        close(fd);
+    }
+    report(&dec, now_ms() - start, timed);
+    if (pbm_path != NULL)
+    {
+        fprintf(stderr, "last frame written to %s\n", pbm_path);
+    }
+    return (dec.stats.frames > 0u) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,13 @@
+/* Generated by Tools/asset_pack.py from Image/assets.txt; do not edit. */
+#ifndef ASSET_IDS_H
+#define ASSET_IDS_H
+
+#define ASSET_ID_BONGO_CAT_1  0U
+#define ASSET_ID_BONGO_CAT_2  1U
+#define ASSET_ID_QR_STATIC    2U
+#define ASSET_ID_BONGO_CAT    3U
+
+#define ASSET_COUNT           4U
+#define ASSET_PACK_CRC        0x5C0A922FUL
+
+#endif // ASSET_IDS_H
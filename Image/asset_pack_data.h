@@ -0,0 +1,150 @@
+/* Generated by Tools/asset_pack.py from Image/assets.txt; do not edit. */
+/* Asset pack: 2328 bytes, format 1 (Core/Inc/asset_pack.h) */
+const uint8_t gAssetPack[2328] ASSET_PACK_SECTION = {
+0X41,0X50,0X4B,0X31,0X01,0X00,0X04,0X00,0X18,0X09,0X00,0X00,0X2F,0X92,0X0A,0X5C,
+0X62,0X6F,0X6E,0X67,0X6F,0X5F,0X63,0X61,0X74,0X5F,0X31,0X00,0X00,0X00,0X00,0X00,
+0X01,0X01,0X65,0X00,0X40,0X00,0X00,0X00,0X90,0X00,0X00,0X00,0X40,0X03,0X00,0X00,
+0X62,0X6F,0X6E,0X67,0X6F,0X5F,0X63,0X61,0X74,0X5F,0X32,0X00,0X00,0X00,0X00,0X00,
+0X01,0X01,0X65,0X00,0X40,0X00,0X00,0X00,0XD0,0X03,0X00,0X00,0X40,0X03,0X00,0X00,
+0X71,0X72,0X5F,0X73,0X74,0X61,0X74,0X69,0X63,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
+0X01,0X01,0X40,0X00,0X40,0X00,0X00,0X00,0X10,0X07,0X00,0X00,0X00,0X02,0X00,0X00,
+0X62,0X6F,0X6E,0X67,0X6F,0X5F,0X63,0X61,0X74,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
+0X02,0X03,0X65,0X00,0X40,0X00,0X01,0X00,0X10,0X09,0X00,0X00,0X08,0X00,0X00,0X00,
+0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
+0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
+0X07,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X80,0X0F,0X00,0X00,
+0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XC0,0X1D,0X00,0X00,0X00,0X00,0X00,
+0X00,0X00,0X00,0X00,0X00,0X00,0XE0,0X18,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
+0X00,0X00,0X00,0X70,0X30,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
+0X38,0X60,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X1C,0X60,0X00,
+0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X80,0X0F,0XC0,0X00,0X00,0X00,0X00,
+0X00,0X00,0X00,0X00,0X00,0X00,0XE0,0X01,0X80,0X0F,0X00,0X00,0X00,0X00,0X00,0X00,
+0X00,0X00,0X00,0X78,0X00,0X00,0X7E,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
+0X1E,0X00,0X00,0XF0,0X01,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X80,0X07,0X00,0X00,
+0X80,0X0F,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XC0,0X01,0X00,0X00,0X00,0X7E,0X00,
+0X00,0X00,0X00,0X00,0X00,0X00,0X70,0X00,0X00,0X00,0X00,0XF0,0X01,0X00,0X00,0X00,
+0X00,0X00,0X00,0X38,0X00,0X00,0X00,0X00,0X80,0X0F,0X00,0X00,0X00,0X00,0X00,0X00,
+0X1C,0X00,0X00,0X00,0X00,0X00,0X1E,0X00,0X00,0X00,0X00,0XE0,0X0F,0X06,0X00,0X00,
+0X00,0X00,0X00,0X78,0X00,0XE0,0X00,0X00,0X70,0X9E,0X03,0X00,0X00,0X00,0X00,0X00,
+0XE0,0X01,0XF8,0X00,0X00,0X1C,0XF0,0X01,0X00,0X00,0X00,0X00,0X00,0X80,0X07,0XDF,
+0X00,0X00,0X0C,0XE0,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XDE,0XC7,0X00,0X00,0X04,
+0X40,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XF8,0XC0,0X00,0X00,0X06,0XC0,0X00,0X00,
+0X00,0X00,0X00,0X00,0X00,0X20,0XC0,0X00,0X00,0X06,0X80,0X01,0X00,0X00,0X00,0X00,
+0X00,0X00,0X00,0XC0,0X00,0X00,0X06,0X00,0X01,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
+0XC0,0X00,0X00,0X06,0X00,0X00,0X70,0X00,0X00,0X00,0X00,0X00,0X00,0XC0,0X00,0X00,
+0X06,0X00,0X00,0XF8,0X00,0X00,0X00,0X00,0X00,0X00,0XC0,0X00,0X00,0X06,0X00,0X00,
+0XF8,0X00,0X00,0X00,0X00,0X00,0X00,0XC0,0X00,0X00,0X06,0X00,0X00,0X78,0X00,0X00,
+0X00,0X00,0X00,0X00,0X60,0X00,0X00,0X06,0X00,0X00,0X20,0X0C,0X01,0X00,0X00,0X00,
+0X00,0X60,0X00,0X00,0X06,0X00,0X00,0X00,0XF8,0X01,0X00,0X00,0X00,0X00,0X30,0X00,
+0X00,0X06,0X00,0X00,0X00,0XF0,0X03,0X00,0X00,0X00,0X00,0X30,0X00,0X00,0X06,0X00,
+0X00,0X00,0X00,0X3F,0X00,0X00,0X00,0X00,0X30,0X00,0X00,0X1C,0X00,0X00,0X00,0X00,
+0X1C,0X00,0X00,0X00,0X00,0X30,0X00,0X00,0XFC,0X01,0X00,0X00,0X00,0X00,0X00,0X07,
+0X00,0X00,0X30,0X00,0X00,0XC0,0X3F,0X00,0X00,0X00,0X00,0X80,0X07,0X00,0X00,0X18,
+0X00,0X00,0X00,0XFC,0X03,0X00,0X00,0X00,0X80,0X07,0X00,0X00,0X18,0X00,0X00,0X00,
+0XC0,0X3F,0X00,0X00,0X00,0X80,0X07,0X00,0X00,0X30,0X00,0X00,0X00,0X00,0XFC,0X03,
+0X00,0X00,0X00,0X00,0X00,0X00,0X70,0X00,0X00,0X00,0X00,0X80,0X3F,0X00,0X00,0X00,
+0X00,0X00,0X00,0X60,0X00,0X00,0X00,0X00,0X00,0XF8,0X03,0X00,0X00,0X00,0X00,0X00,
+0XC0,0X00,0X00,0X00,0X00,0X00,0X80,0X7F,0X00,0X00,0X00,0X00,0X00,0XC0,0X00,0X00,
+0X00,0X00,0X00,0X00,0XF8,0X07,0X00,0X00,0X00,0X00,0X80,0X01,0X00,0X00,0X00,0X00,
+0X00,0X00,0X7F,0X00,0X04,0X00,0X00,0X80,0X01,0X00,0X00,0X00,0X00,0X00,0X00,0XF0,
+0X07,0X06,0X00,0X00,0X00,0X03,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X3F,0X03,0X00,
+0X00,0X00,0X03,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XF0,0X03,0X00,0X00,0X00,0X07,
+0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X80,0X01,0X00,0X00,0X00,0X06,0X00,0X00,0X00,
+0X00,0X00,0X00,0X00,0X80,0X00,0X00,0X00,0X00,0X06,0X00,0X00,0X00,0X00,0X00,0X00,
+0X00,0XC0,0X00,0X00,0X00,0X00,0X04,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X80,0X00,
+0X00,0XFC,0X00,0X0C,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X80,0X00,0X80,0XFF,0X03,
+0X0C,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X80,0X01,0XE0,0XC1,0X3F,0X08,0X00,0X00,
+0X00,0X00,0X00,0X00,0X00,0X80,0X07,0X7E,0X00,0XFC,0X1F,0X00,0X00,0X00,0X00,0X00,
+0X00,0X00,0X00,0XFE,0X07,0X00,0X80,0X1F,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X1E,
+0X00,0X00,0X00,0X00,0X18,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X0F,0X00,0X00,0X00,
+0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X42,0X00,0X00,0X00,0X00,0X00,0X00,
+0X00,0X00,0X00,0X00,0X00,0X00,0X60,0XC0,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
+0X00,0X00,0X00,0X60,0XC0,0X01,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
+0X60,0X80,0X03,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X40,0X00,0X07,
+0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X02,0X00,0X00,0X00,
+0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
+0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
+0X07,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X80,0X0F,0X00,0X00,
+0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XC0,0X0D,0X00,0X00,0X00,0X00,0X00,
+0X00,0X00,0X00,0X00,0X00,0X00,0XE0,0X18,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
+0X00,0X00,0X00,0X70,0X30,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
+0X30,0X60,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X1C,0X60,0X00,
+0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X80,0X0F,0XC0,0X00,0X00,0X00,0X00,
+0X00,0X00,0X00,0X00,0X00,0X00,0XE0,0X01,0X80,0X0F,0X00,0X00,0X00,0X00,0X00,0X00,
+0X00,0X00,0X00,0X78,0X00,0X00,0X7E,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
+0X1E,0X00,0X00,0XF0,0X01,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X80,0X07,0X00,0X00,
+0X80,0X0F,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XC0,0X01,0X00,0X00,0X00,0X7E,0X00,
+0X00,0X00,0X00,0X00,0X00,0X00,0X60,0X00,0X00,0X00,0X00,0XF0,0X01,0X00,0X00,0X00,
+0X00,0X00,0X00,0X38,0X00,0X00,0X00,0X00,0X80,0X0F,0X00,0X00,0X00,0X00,0X00,0X00,
+0X1C,0X00,0X00,0X00,0X00,0X00,0X1E,0X00,0X00,0X00,0X00,0X00,0X00,0X06,0X00,0X00,
+0X00,0X00,0X00,0X78,0X00,0XE0,0X00,0X00,0X00,0X80,0X03,0X00,0X00,0X00,0X00,0X00,
+0XE0,0X01,0XF8,0X00,0X00,0X00,0XC0,0X01,0X00,0X00,0X00,0X00,0X00,0X80,0X07,0XDF,
+0X00,0X00,0X00,0X60,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XDE,0XC7,0X00,0X00,0X00,
+0X30,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XF8,0XC0,0X00,0X00,0X00,0X1C,0X00,0X00,
+0X00,0X00,0X00,0X00,0X00,0X20,0XC0,0X00,0X00,0X00,0X0E,0X00,0X00,0X00,0X00,0X00,
+0X00,0X00,0X00,0XC0,0X00,0X00,0X00,0X07,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
+0XC0,0X00,0X00,0X80,0X03,0X00,0X70,0X00,0X00,0X00,0X00,0X00,0X00,0XC0,0X00,0X00,
+0X80,0X01,0X00,0XF8,0X00,0X00,0X00,0X00,0X00,0X00,0XC0,0X00,0X00,0XC0,0X00,0X00,
+0XF8,0X00,0X00,0X00,0X00,0X00,0X00,0X40,0X00,0X00,0X60,0X00,0X00,0X78,0X00,0X00,
+0X00,0X00,0X00,0X00,0X60,0X00,0X00,0X30,0X00,0X00,0X20,0X0C,0X01,0X00,0X00,0X00,
+0X00,0X60,0X00,0X00,0X18,0X00,0X00,0X00,0XF8,0X01,0X00,0X00,0X1C,0X00,0X30,0X00,
+0X00,0X08,0X00,0X00,0X00,0XF0,0X03,0X00,0X00,0XFF,0X00,0X30,0X00,0X00,0X0C,0X00,
+0X00,0X00,0X00,0X3F,0X00,0X80,0XC3,0X01,0X30,0X00,0X00,0X06,0X00,0X00,0X00,0X00,
+0X1C,0X00,0XC0,0X00,0X03,0X30,0X00,0X00,0X06,0X00,0X00,0X00,0X00,0X00,0X00,0X67,
+0X00,0X03,0X30,0X00,0X00,0X03,0X00,0X00,0X00,0X00,0X00,0X80,0X67,0X00,0X06,0X18,
+0X00,0X00,0X03,0X00,0X00,0X00,0X00,0X00,0X80,0X67,0X00,0X0C,0X18,0X00,0X00,0X03,
+0X00,0X00,0X00,0X00,0X00,0X80,0X27,0X00,0X08,0X30,0X00,0X00,0X01,0X00,0XE0,0X03,
+0X00,0X00,0X00,0X20,0X00,0X00,0X70,0X00,0X00,0X03,0X00,0XBC,0X3F,0X00,0X00,0X00,
+0X20,0X00,0X00,0X60,0X00,0X20,0X03,0X80,0X0F,0XF8,0X03,0X00,0X00,0X20,0X00,0X00,
+0XC0,0X00,0X78,0X07,0XF0,0X01,0X80,0X7F,0X00,0X00,0X20,0X00,0X00,0XC0,0X00,0X1E,
+0XFE,0X7F,0X00,0X00,0XF8,0X07,0X00,0X20,0X00,0X00,0X80,0X01,0X04,0XF8,0X07,0X00,
+0X00,0X00,0X7F,0X00,0X20,0X00,0X00,0X80,0X01,0X40,0X00,0X00,0X00,0X00,0X00,0XF0,
+0X07,0X20,0X00,0X00,0X00,0X03,0X60,0X00,0X00,0X00,0X00,0X00,0X00,0XFF,0X60,0X00,
+0X00,0X00,0X03,0X70,0X40,0X00,0X00,0X00,0X00,0X00,0XF0,0X7F,0X00,0X00,0X00,0X03,
+0X30,0XC0,0X00,0X00,0X00,0X00,0X00,0X00,0XFE,0X00,0X00,0X00,0X06,0X00,0XC0,0X00,
+0X00,0X00,0X00,0X00,0X00,0XE0,0X1F,0X00,0X00,0X06,0X00,0XC0,0X00,0X00,0X00,0X00,
+0X00,0X00,0X00,0XFE,0X01,0X00,0X04,0X00,0X40,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
+0XE0,0X3F,0X00,0X0C,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XFC,0X03,
+0X0C,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XC0,0X3F,0X08,0X00,0X00,
+0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0XF8,0X1F,0X00,0X00,0X00,0X00,0X00,
+0X00,0X00,0X00,0X00,0X00,0X00,0X80,0X1F,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
+0X00,0X00,0X00,0X00,0X18,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
+0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
+0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
+0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
+0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
+0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,0X00,
+0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
+0X03,0X00,0X18,0XFF,0X01,0X18,0X00,0XC0,0X03,0X00,0X18,0XFF,0X01,0X18,0X00,0XC0,
+0X03,0X00,0X18,0XFF,0X01,0X18,0X00,0XC0,0XE3,0XFF,0X19,0X0F,0XCE,0X98,0XFF,0XC7,
+0XE3,0XFF,0X19,0X0F,0XCE,0X98,0XFF,0XC7,0X63,0XC0,0X19,0X7C,0X3E,0X9F,0X03,0XC6,
+0X63,0XC0,0X19,0X7C,0X3E,0X9F,0X03,0XC6,0X63,0XC0,0X19,0X70,0X00,0X9F,0X03,0XC6,
+0X63,0XC0,0X19,0X70,0X00,0X9F,0X03,0XC6,0X63,0XC0,0X19,0X70,0X00,0X9F,0X03,0XC6,
+0X63,0XC0,0XF9,0X70,0X00,0X98,0X03,0XC6,0X63,0XC0,0XF9,0X70,0X00,0X98,0X03,0XC6,
+0XE3,0XFF,0X19,0XF0,0XF1,0X9F,0XFF,0XC7,0XE3,0XFF,0X19,0XF0,0XF1,0X9F,0XFF,0XC7,
+0XE3,0XFF,0X19,0XF0,0XF1,0X9F,0XFF,0XC7,0X03,0X00,0X18,0X73,0XCE,0X18,0X00,0XC0,
+0X03,0X00,0X18,0X73,0XCE,0X18,0X00,0XC0,0XFF,0XFF,0XFF,0X83,0X0F,0XFF,0XFF,0XFF,
+0XFF,0XFF,0XFF,0X83,0X0F,0XFF,0XFF,0XFF,0X83,0X0F,0XF8,0X73,0XCE,0X78,0X0C,0XC0,
+0X83,0X0F,0XF8,0X73,0XCE,0X78,0X0C,0XC0,0X83,0X0F,0XF8,0X73,0XCE,0X78,0X0C,0XC0,
+0X83,0X31,0XE6,0XFF,0X0F,0XE0,0X83,0XF9,0X83,0X31,0XE6,0XFF,0X0F,0XE0,0X83,0XF9,
+0XFF,0X0F,0XE0,0XF0,0X01,0X7F,0X00,0XFE,0XFF,0X0F,0XE0,0XF0,0X01,0X7F,0X00,0XFE,
+0XFF,0XCF,0X1F,0X7C,0X3E,0X1F,0X7C,0XF8,0XFF,0XCF,0X1F,0X7C,0X3E,0X1F,0X7C,0XF8,
+0XFF,0XCF,0X1F,0X7C,0X3E,0X1F,0X7C,0XF8,0X03,0XF0,0XF9,0X8F,0XFF,0X80,0X0F,0XC0,
+0X03,0XF0,0XF9,0X8F,0XFF,0X80,0X0F,0XC0,0XE3,0XC1,0XFF,0X70,0X00,0XE0,0XF3,0XF9,
+0XE3,0XC1,0XFF,0X70,0X00,0XE0,0XF3,0XF9,0XE3,0XC1,0XFF,0X70,0X00,0XE0,0XF3,0XF9,
+0XFF,0XC1,0XF9,0X0C,0X30,0X7F,0X00,0XFE,0XFF,0XC1,0XF9,0X0C,0X30,0X7F,0X00,0XFE,
+0XFF,0XC1,0X1F,0X83,0XCF,0X1F,0X70,0XF8,0XFF,0XC1,0X1F,0X83,0XCF,0X1F,0X70,0XF8,
+0X03,0XFE,0XF9,0X7C,0X3E,0X00,0X00,0XFE,0X03,0XFE,0XF9,0X7C,0X3E,0X00,0X00,0XFE,
+0X03,0XFE,0XF9,0X7C,0X3E,0X00,0X00,0XFE,0XFF,0XFF,0X1F,0XF3,0XCF,0XF8,0XF3,0XFF,
+0XFF,0XFF,0X1F,0XF3,0XCF,0XF8,0XF3,0XFF,0X03,0X00,0XF8,0XF3,0XC1,0X98,0XF3,0XFF,
+0X03,0X00,0XF8,0XF3,0XC1,0X98,0XF3,0XFF,0XE3,0XFF,0X19,0X7C,0XCE,0XF8,0X03,0XF8,
+0XE3,0XFF,0X19,0X7C,0XCE,0XF8,0X03,0XF8,0XE3,0XFF,0X19,0X7C,0XCE,0XF8,0X03,0XF8,
+0X63,0XC0,0X19,0X03,0XFE,0X00,0X00,0XFE,0X63,0XC0,0X19,0X03,0XFE,0X00,0X00,0XFE,
+0X63,0XC0,0XF9,0X73,0X0E,0X1F,0X7C,0XC0,0X63,0XC0,0XF9,0X73,0X0E,0X1F,0X7C,0XC0,
+0X63,0XC0,0XF9,0X73,0X0E,0X1F,0X7C,0XC0,0X63,0XC0,0XF9,0X0F,0X0E,0X87,0X8F,0XF9,
+0X63,0XC0,0XF9,0X0F,0X0E,0X87,0X8F,0XF9,0XE3,0XFF,0X19,0X7C,0XCE,0X1F,0X00,0XF8,
+0XE3,0XFF,0X19,0X7C,0XCE,0X1F,0X00,0XF8,0X03,0X00,0X18,0X03,0X0E,0XFF,0X7F,0XC0,
+0X03,0X00,0X18,0X03,0X0E,0XFF,0X7F,0XC0,0X03,0X00,0X18,0X03,0X0E,0XFF,0X7F,0XC0,
+0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
+0X00,0X00,0XC8,0X00,0X01,0X00,0XC8,0X00,
+};
@@ -0,0 +1,258 @@
+#!/usr/bin/env python3
+"""Build the flash asset pack (images, animations, fonts) from a manifest.
+
+    python3 Tools/asset_pack.py Image/assets.txt
+    python3 Tools/asset_pack.py Image/assets.txt --bin assets.bin --list
+
+The pack is read in place from flash by Core/Src/asset_pack.c. Layout (little-endian, every
+offset from the start of the pack and 4-byte aligned):
+
+    header   magic "APK1", format, entry count, total size, CRC-32 of everything after it
+    index    one 32-byte entry per asset: name[16], type, encoding, width, height, flags,
+             offset and length of the data
+    data     image bits (XBM rows or SH1106 pages), animation frame lists, u8g2 fonts
+
+Outputs, next to the manifest unless given: asset_pack_data.h (the pack as a C array, linked into
+its own flash sector), asset_ids.h (ASSET_ID_<NAME> per asset) and, with --bin, the raw pack
+for flashing that sector on its own (STM32CubeProgrammer: -w assets.bin 0x081E0000).
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+import zlib
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from xbm_to_pages import parse_bitmap, to_pages  # noqa: E402
+
+# Must match Core/Inc/asset_pack.h
+PACK_MAGIC = 0x314B5041         # "APK1"
+PACK_FORMAT = 1
+HEADER = struct.Struct("<IHHII")
+ENTRY = struct.Struct("<16sBBHHHII")
+FRAME = struct.Struct("<HH")
+NAME_LEN = 16
+
+TYPE_IMAGE, TYPE_ANIMATION, TYPE_FONT = 1, 2, 3
+ENC_XBM, ENC_PAGES, ENC_FRAMES, ENC_U8G2_FONT = 1, 2, 3, 4
+ANIM_MODES = {"once": 0, "loop": 1, "pingpong": 2}
+
+# u8g2 font header: byte 9 = largest glyph width, byte 10 = largest glyph height
+U8G2_FONT_HEADER = 23
+
+
+class Asset:
+    def __init__(self, name, kind, encoding, width, height, flags, data):
+        self.name, self.kind, self.encoding = name, kind, encoding
+        self.width, self.height, self.flags, self.data = width, height, flags, data
+
+
+def fail(where, message):
+    sys.exit(f"{where}: {message}")
+
+
+def parse_options(words):
+    flags, values = set(), {}
+    for word in words:
+        if "=" in word:
+            key, value = word.split("=", 1)
+            values[key] = int(value, 0)
+        else:
+            flags.add(word)
+    return flags, values
+
+
+def c_string_bytes(literal):
+    """Bytes of the concatenated C string literals of a u8g2 font array."""
+    out = bytearray()
+    for part in re.findall(r'"((?:[^"\\]|\\.)*)"', literal, flags=re.S):
+        i = 0
+        while i < len(part):
+            c = part[i]
+            if c != "\\":
+                out.append(ord(c))
+                i += 1
+                continue
+            nxt = part[i + 1]
+            if nxt in "01234567":
+                m = re.match(r"[0-7]{1,3}", part[i + 1:])
+                out.append(int(m.group(0), 8) & 0xFF)
+                i += 1 + len(m.group(0))
+            elif nxt == "x":
+                m = re.match(r"[0-9a-fA-F]+", part[i + 2:])
+                out.append(int(m.group(0), 16) & 0xFF)
+                i += 2 + len(m.group(0))
+            else:
+                out.append({"n": 10, "t": 9, "r": 13, "0": 0}.get(nxt, ord(nxt)))
+                i += 2
+    return bytes(out)
+
+
+def load_font(path, array, where):
+    with open(path, encoding="utf-8", errors="replace") as f:
+        text = f.read()
+    m = re.search(r"\b" + re.escape(array) + r"\s*\[[^\]]*\][^=]*=\s*(.*?);", text, flags=re.S)
+    if not m:
+        fail(where, f"array {array} not found in {path}")
+    body = m.group(1)
+    data = c_string_bytes(body) if '"' in body else \
+        bytes(int(v, 0) for v in re.findall(r"0[xX][0-9a-fA-F]+|\b\d+\b", body))
+    if len(data) < U8G2_FONT_HEADER:
+        fail(where, f"{array} is too short for a u8g2 font")
+    return data
+
+
+def parse_manifest(path):
+    base = os.path.dirname(os.path.abspath(path))
+    assets, ids = [], {}
+    with open(path, encoding="utf-8") as f:
+        for number, line in enumerate(f, 1):
+            words = line.split("#", 1)[0].split()
+            if not words:
+                continue
+            where = f"{path}:{number}"
+            if len(words) < 3:
+                fail(where, "expected <kind> <name> <source>")
+            kind, name = words[0], words[1]
+            if not re.fullmatch(r"[a-z][a-z0-9_]*", name) or len(name) >= NAME_LEN:
+                fail(where, f"bad name '{name}' (lower case, digits, '_', at most {NAME_LEN - 1})")
+            if name in ids:
+                fail(where, f"duplicate name '{name}'")
+
+            if kind == "image":
+                flags, values = parse_options(words[3:])
+                with open(os.path.join(base, words[2]), encoding="utf-8", errors="replace") as src:
+                    width, height, bits = parse_bitmap(src.read())
+                width = values.get("width", width)
+                height = values.get("height", height)
+                if not (width and height):
+                    fail(where, "size unknown, add width= and height=")
+                stride = (width + 7) // 8
+                if len(bits) < stride * height:
+                    fail(where, f"{len(bits)} bytes, {width}x{height} needs {stride * height}")
+                if "pages" in flags:
+                    data = bytes(to_pages(bits, width, height, values.get("x", 0), values.get("y", 0),
+                                          "invert" in flags))
+                    asset = Asset(name, TYPE_IMAGE, ENC_PAGES, 128, 64, 0, data)
+                else:
+                    asset = Asset(name, TYPE_IMAGE, ENC_XBM, width, height, 0, bytes(bits[:stride * height]))
+            elif kind == "anim":
+                frames, mode = [], ANIM_MODES["loop"]
+                for word in words[2:]:
+                    if word in ANIM_MODES:
+                        mode = ANIM_MODES[word]
+                        continue
+                    image, _, ms = word.partition(":")
+                    if image not in ids or assets[ids[image]].kind != TYPE_IMAGE:
+                        fail(where, f"frame '{image}' is not an image listed above")
+                    frames.append((ids[image], int(ms or 100)))
+                if not frames:
+                    fail(where, "animation without frames")
+                first = assets[frames[0][0]]
+                data = b"".join(FRAME.pack(image, ms) for image, ms in frames)
+                asset = Asset(name, TYPE_ANIMATION, ENC_FRAMES, first.width, first.height, mode, data)
+            elif kind == "font":
+                source, _, array = words[2].partition(":")
+                data = load_font(os.path.join(base, source), array or name, where)
+                asset = Asset(name, TYPE_FONT, ENC_U8G2_FONT, data[9], data[10], 0, data)
+            else:
+                fail(where, f"unknown kind '{kind}' (image, anim, font)")
+            ids[name] = len(assets)
+            assets.append(asset)
+    if not assets:
+        sys.exit(f"{path}: no assets")
+    return assets
+
+
+def align4(n):
+    return (n + 3) & ~3
+
+
+def build_pack(assets):
+    offset = HEADER.size + ENTRY.size * len(assets)
+    index, blobs = b"", b""
+    for a in assets:
+        offset = align4(offset)
+        index += ENTRY.pack(a.name.encode(), a.kind, a.encoding, a.width, a.height, a.flags,
+                            offset, len(a.data))
+        blobs += b"\0" * (offset - HEADER.size - ENTRY.size * len(assets) - len(blobs)) + a.data
+        offset += len(a.data)
+    body = index + blobs + b"\0" * (align4(offset) - offset)
+    header = HEADER.pack(PACK_MAGIC, PACK_FORMAT, len(assets), HEADER.size + len(body),
+                         zlib.crc32(body) & 0xFFFFFFFF)
+    return header + body
+
+
+def render_pack_header(pack, source):
+    lines = [
+        f"/* Generated by Tools/asset_pack.py from {source}; do not edit. */",
+        f"/* Asset pack: {len(pack)} bytes, format {PACK_FORMAT} (Core/Inc/asset_pack.h) */",
+        f"const uint8_t gAssetPack[{len(pack)}] ASSET_PACK_SECTION = {{",
+    ]
+    for i in range(0, len(pack), 16):
+        lines.append("".join(f"0X{b:02X}," for b in pack[i:i + 16]))
+    lines.append("};")
+    return "\n".join(lines) + "\n"
+
+
+def render_ids_header(assets, pack, source):
+    width = max(len(a.name) for a in assets) + len("ASSET_ID_") + 1
+    lines = [
+        f"/* Generated by Tools/asset_pack.py from {source}; do not edit. */",
+        "#ifndef ASSET_IDS_H",
+        "#define ASSET_IDS_H",
+        "",
+    ]
+    for i, a in enumerate(assets):
+        lines.append(f"#define {'ASSET_ID_' + a.name.upper():<{width}} {i}U")
+    lines += [
+        "",
+        f"#define {'ASSET_COUNT':<{width}} {len(assets)}U",
+        f"#define {'ASSET_PACK_CRC':<{width}} 0x{struct.unpack_from('<I', pack, 12)[0]:08X}UL",
+        "",
+        "#endif // ASSET_IDS_H",
+    ]
+    return "\n".join(lines) + "\n"
+
+
+def write(path, data, mode="w"):
+    if "b" in mode:
+        with open(path, mode) as f:
+            f.write(data)
+    else:
+        with open(path, mode, encoding="utf-8", newline="\n") as f:
+            f.write(data)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("manifest", help="asset list (see Image/assets.txt)")
+    parser.add_argument("--header", help="C array output (default <manifest dir>/asset_pack_data.h)")
+    parser.add_argument("--ids", help="asset id output (default <manifest dir>/asset_ids.h)")
+    parser.add_argument("--bin", help="also write the raw pack for flashing it on its own")
+    parser.add_argument("--list", action="store_true", help="print the index")
+    args = parser.parse_args()
+
+    base = os.path.dirname(args.manifest)
+    assets = parse_manifest(args.manifest)
+    pack = build_pack(assets)
+    source = os.path.relpath(args.manifest).replace(os.sep, "/")
+    write(args.header or os.path.join(base, "asset_pack_data.h"), render_pack_header(pack, source))
+    write(args.ids or os.path.join(base, "asset_ids.h"), render_ids_header(assets, pack, source))
+    if args.bin:
+        write(args.bin, pack, "wb")
+
+    if args.list:
+        kinds = {TYPE_IMAGE: "image", TYPE_ANIMATION: "anim", TYPE_FONT: "font"}
+        print(f"{'Id':>3} {'Name':<16}{'Kind':<6}{'Size':>9}{'Offset':>8}{'Bytes':>7}")
+        for i, a in enumerate(assets):
+            offset = struct.unpack_from("<I", pack, HEADER.size + ENTRY.size * i + 24)[0]
+            print(f"{i:>3} {a.name:<16}{kinds[a.kind]:<6}{a.width:>5}x{a.height:<3}{offset:>8}{len(a.data):>7}")
+    print(f"asset pack: {len(assets)} assets, {len(pack)} bytes, CRC 0x{struct.unpack_from('<I', pack, 12)[0]:08X}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,67 @@
+#!/usr/bin/env python3
+"""Compare two host benchmark runs (Google Benchmark JSON layout).
+
+Produce the files with e.g. Host/build/bench_u8g2 --json <file>, then
+
+    python3 Tools/bench_compare.py baseline.json current.json --threshold 5
+
+prints one row per benchmark with the time change in percent and any change of the
+bytes_touched counter. The exit status is 1 if a benchmark got slower than the threshold
+(or disappeared), so the script can gate a change in CI.
+"""
+
+import argparse
+import json
+import sys
+
+
+def load(path):
+    with open(path, encoding="utf-8") as f:
+        data = json.load(f)
+    runs = {}
+    for bench in data.get("benchmarks", []):
+        if bench.get("run_type", "iteration") != "iteration":
+            continue
+        runs[bench["name"]] = bench
+    return runs
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("baseline", help="stored baseline JSON")
+    parser.add_argument("current", help="JSON of the run to evaluate")
+    parser.add_argument("--threshold", type=float, default=5.0,
+                        help="slowdown in percent reported as a regression (default 5)")
+    parser.add_argument("--metric", choices=("real_time", "cpu_time"), default="real_time",
+                        help="time field to compare (default real_time)")
+    args = parser.parse_args()
+
+    base = load(args.baseline)
+    cur = load(args.current)
+    regressions = 0
+
+    print(f"{'Benchmark':<28} {'base ns':>12} {'new ns':>12} {'change':>9}  bytes")
+    for name, b in base.items():
+        c = cur.get(name)
+        if c is None:
+            print(f"{name:<28} {b[args.metric]:>12.1f} {'missing':>12}")
+            regressions += 1
+            continue
+        change = (c[args.metric] - b[args.metric]) * 100.0 / b[args.metric] if b[args.metric] else 0.0
+        bytes_note = ""
+        if b.get("bytes_touched") != c.get("bytes_touched"):
+            bytes_note = f"{b.get('bytes_touched')} -> {c.get('bytes_touched')}"
+        flag = "  REGRESSION" if change > args.threshold else ""
+        regressions += 1 if flag else 0
+        print(f"{name:<28} {b[args.metric]:>12.1f} {c[args.metric]:>12.1f} {change:>+8.1f}%  {bytes_note}{flag}")
+    for name in cur.keys() - base.keys():
+        print(f"{name:<28} {'new':>12} {cur[name][args.metric]:>12.1f}")
+
+    if regressions:
+        print(f"{regressions} benchmark(s) slower than {args.threshold:.1f}% or missing")
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
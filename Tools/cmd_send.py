@@ -0,0 +1,177 @@
+#!/usr/bin/env python3
+"""Send binary command frames (Core/Inc/cmd_proto.h) to the board over USART3.
+
+    python3 Tools/cmd_send.py --port /dev/ttyACM0 mode=info text=0:"Room 4" fps=10 stats
+    python3 Tools/cmd_send.py --out cmds.bin text=1:"Temp 21.5 C" contrast=40
+    python3 Tools/cmd_send.py --port /dev/ttyACM0 mode=dash text=3:"Temp C" value=0:21 value=1:48
+    python3 Tools/cmd_send.py --decode capture.bin
+
+Commands, in the order given:
+
+    mode=<bongo|qrcode|info|stats|dash|image|0..6>
+                                          show a screen (not video)
+    text=<field>:<text>                   replace a text field (printable ASCII): 0..2 lines of
+                                          the info screen, 3..10 labels of the dashboard
+    value=<field>:<n>                     set dashboard value 0..7 (signed 32 bit)
+    image=<id>                            show image asset <id> on the image screen
+    anim=<id>:<x>:<y>                     start animation asset <id> on the current screen
+    qr=<text>                             new payload of the QR code screen (1..63 bytes, UTF-8)
+    fps=<1..50>                           refresh rate of the statistics page
+    contrast=<0..255>                     panel contrast
+    stats                                 ask for the counters
+
+With --port each frame is sent at 115200 baud and the answer (CMD_RSP_ACK or CMD_RSP_STATS)
+is printed; log text between the frames is ignored. --out writes the frames to a file for the
+simulator's "stream" command, --decode prints the answers found in a capture (e.g. the stdout
+of oled_sim). --port needs pyserial.
+"""
+
+import argparse
+import struct
+import sys
+import time
+
+# Must match Core/Inc/cmd_proto.h
+SYNC = b"\xa5\x5a"
+MAX_PAYLOAD = 64
+CMD_MODE, CMD_TEXT, CMD_FPS, CMD_CONTRAST, CMD_STATS = 1, 2, 3, 4, 5
+CMD_VALUE, CMD_IMAGE, CMD_ANIM, CMD_QR = 6, 7, 8, 9
+RSP_ACK, RSP_STATS = 0x81, 0x85
+TYPE_NAMES = {CMD_MODE: "mode", CMD_TEXT: "text", CMD_FPS: "fps", CMD_CONTRAST: "contrast", CMD_STATS: "stats",
+              CMD_VALUE: "value", CMD_IMAGE: "image", CMD_ANIM: "anim", CMD_QR: "qr"}
+STATUS_NAMES = ("ok", "unknown command", "bad argument", "busy")
+STATS_FIELDS = ("uptime_ms", "mode", "cpu_permille", "heap_free", "rx_bytes", "rx_overruns",
+                "cmd_frames", "cmd_errors")
+MODES = {"bongo": 0, "qrcode": 1, "info": 2, "stats": 3, "dash": 5, "image": 6}
+TEXT_MAX = 31
+QR_MAX = 63
+
+CONSOLE_BAUD = 115200
+
+
+def crc16(data):
+    """CRC-16/CCITT-FALSE."""
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else crc << 1
+            crc &= 0xFFFF
+    return crc
+
+
+def encode(ctype, payload=b""):
+    if len(payload) > MAX_PAYLOAD:
+        raise ValueError("payload too long")
+    body = bytes((len(payload), ctype)) + payload
+    return SYNC + body + struct.pack("<H", crc16(body))
+
+
+def parse_command(arg):
+    """'text=0:Hello' -> frame bytes."""
+    name, _, value = arg.partition("=")
+    if name == "mode":
+        mode = MODES.get(value)
+        if mode is None:
+            mode = int(value, 0)
+        return encode(CMD_MODE, bytes((mode,)))
+    if name == "text":
+        field, _, text = value.partition(":")
+        data = text.encode("ascii")
+        if len(data) > TEXT_MAX:
+            raise ValueError(f"text longer than {TEXT_MAX} characters")
+        return encode(CMD_TEXT, bytes((int(field),)) + data)
+    if name == "value":
+        field, _, number = value.partition(":")
+        return encode(CMD_VALUE, struct.pack("<Bi", int(field), int(number, 0)))
+    if name == "image":
+        return encode(CMD_IMAGE, struct.pack("<H", int(value, 0)))
+    if name == "anim":
+        asset, x, y = value.split(":")
+        return encode(CMD_ANIM, struct.pack("<HBB", int(asset, 0), int(x, 0), int(y, 0)))
+    if name == "qr":
+        data = value.encode("utf-8")
+        if not 1 <= len(data) <= QR_MAX:
+            raise ValueError(f"QR payload must be 1 to {QR_MAX} bytes")
+        return encode(CMD_QR, data)
+    if name == "fps":
+        return encode(CMD_FPS, bytes((int(value, 0),)))
+    if name == "contrast":
+        return encode(CMD_CONTRAST, bytes((int(value, 0),)))
+    if name == "stats":
+        return encode(CMD_STATS)
+    raise ValueError(f"unknown command {arg!r}")
+
+
+def find_frames(data):
+    """Yield (type, payload) of the valid frames in data, skipping everything else."""
+    pos = 0
+    while True:
+        pos = data.find(SYNC, pos)
+        if pos < 0 or pos + 4 > len(data):
+            return
+        length = data[pos + 2]
+        end = pos + 4 + length + 2
+        if length <= MAX_PAYLOAD and end <= len(data):
+            (crc,) = struct.unpack_from("<H", data, end - 2)
+            if crc16(data[pos + 2:end - 2]) == crc:
+                yield data[pos + 3], data[pos + 4:end - 2]
+                pos = end
+                continue
+        pos += 1
+
+
+def describe(ctype, payload):
+    if ctype == RSP_ACK and len(payload) == 2:
+        status = STATUS_NAMES[payload[1]] if payload[1] < len(STATUS_NAMES) else str(payload[1])
+        return f"{TYPE_NAMES.get(payload[0], hex(payload[0]))}: {status}"
+    if ctype == RSP_STATS and len(payload) == 4 * len(STATS_FIELDS):
+        values = struct.unpack(f"<{len(STATS_FIELDS)}I", payload)
+        return "stats: " + ", ".join(f"{k}={v}" for k, v in zip(STATS_FIELDS, values))
+    return f"type 0x{ctype:02x}: {payload.hex()}"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("commands", nargs="*", help="commands, see above")
+    parser.add_argument("--port", help="serial port of the board (needs pyserial)")
+    parser.add_argument("--out", help="write the frames to this file")
+    parser.add_argument("--decode", metavar="FILE", help="print the answers found in a capture")
+    parser.add_argument("--timeout", type=float, default=0.5, help="seconds to wait for an answer")
+    args = parser.parse_args()
+
+    if args.decode:
+        with open(args.decode, "rb") as f:
+            for ctype, payload in find_frames(f.read()):
+                print(describe(ctype, payload))
+        return 0
+    if not args.commands or not (args.out or args.port):
+        parser.error("give commands and --out and/or --port")
+    try:
+        frames = [parse_command(c) for c in args.commands]
+    except ValueError as err:
+        parser.error(str(err))
+
+    if args.out:
+        with open(args.out, "wb") as f:
+            f.write(b"".join(frames))
+    if args.port:
+        try:
+            import serial
+        except ImportError:
+            sys.exit("--port needs pyserial (pip install pyserial)")
+        with serial.Serial(args.port, CONSOLE_BAUD, timeout=0.05) as port:
+            for frame in frames:
+                port.write(frame)
+                received = b""
+                deadline = time.monotonic() + args.timeout
+                answers = []
+                while not answers and time.monotonic() < deadline:
+                    received += port.read(256)
+                    answers = list(find_frames(received))
+                print(describe(*answers[0]) if answers else "no answer")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
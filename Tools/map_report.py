@@ -0,0 +1,208 @@
+#!/usr/bin/env python3
+"""RAM and flash usage per subsystem from a linker map (armlink or GNU ld).
+
+Keil writes the map with *Options for Target -> Listing -> Linker Listing* (memory map
+enabled); the host build writes Host/build/oled_sim.map. Then
+
+    python3 Tools/map_report.py NUCLEO-F429ZI_OLED_RTOS.map
+    python3 Tools/map_report.py firmware.map --by object --top 15
+
+Input sections named .bss.ram.<subsystem>, .bss.ccm.<subsystem> or .bss.dma.<subsystem>
+(RAM_SECTION() in rtos_static.h, CCM_SECTION()/DMA_SECTION() in mem_layout.h) are reported
+under that subsystem; everything else is assigned by object file name. RAM is RW data plus
+zero-initialised data, split into main SRAM and CCM by address; flash is code, read-only
+data and the load copy of RW data.
+
+With --check-dma the exit status is 1 if any .bss.dma.* section lies in CCM, which no DMA
+stream can reach (run it as a post-build step).
+"""
+
+import argparse
+import os
+import re
+import sys
+
+# CCM data RAM of the STM32F429
+CCM_BASE = 0x10000000
+CCM_SIZE = 0x10000
+
+# armlink "Memory Map of the image" row:
+#   Exec Addr  Load Addr  Size  Type  Attr  Idx  [E]  Section Name  Object
+ARMLINK_ROW = re.compile(
+    r"^\s*0x([0-9a-fA-F]+)\s+(?:0x[0-9a-fA-F]+|-)\s+0x([0-9a-fA-F]+)\s+"
+    r"(Code|Data|Zero|Ven)\s+(RO|RW)\s+\d+\s+(?:\*\s+)?(\S+)\s+(.+?)\s*$")
+
+# GNU ld input section, name and placement on one line or the placement on the next line
+GNU_OUTPUT = re.compile(r"^(\.[\w.]+|COMMON)\s+(?:0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+))?\s*$")
+GNU_INPUT = re.compile(r"^ (\.[\w.$]+|COMMON)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*?)\s*$")
+GNU_INPUT_NAME = re.compile(r"^ (\.[\w.$]+|COMMON)\s*$")
+GNU_INPUT_PLACE = re.compile(r"^\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*?)\s*$")
+
+# Output sections of GNU maps that are not loaded into the target
+GNU_SKIP = (".debug", ".comment", ".note", ".ARM.attributes", ".stab", ".gnu.attributes",
+            ".gnu_debuglink", ".interp", ".dynsym", ".dynstr", ".gnu.version", ".gnu.hash",
+            ".rela", ".dynamic", ".got", ".plt")
+GNU_RAM_ZI = (".bss", ".tbss", ".noinit", "._user_heap_stack", "COMMON", ".ccmram_bss")
+GNU_RAM_RW = (".data", ".tdata", ".ccmram", ".init_array", ".fini_array")
+
+# Object file name -> subsystem, first match wins
+SUBSYSTEMS = (
+    ("heap", r"^heap_\d$"),
+    ("kernel", r"^(tasks|queue|list|timers|event_groups|stream_buffer|croutine|port|portasm|"
+               r"cmsis_os2?|freertos|wait_for_event|utils)$"),
+    ("u8g2", r"^(u8g2_|u8x8_|u8log|mui)"),
+    ("hal", r"^(stm32f4xx_hal|stm32f4xx_ll|system_stm32f4xx)"),
+    ("startup", r"^startup_"),
+    ("oled", r"^(rtos_tasks|screen_\w+|display_cmd|screens|widget|qr_encode|anim|perf_hud|oled_driver|oled_splash|i2c_cost)$"),
+    ("log", r"^(deferred_log|log_ring)$"),
+    ("uart", r"^(uart_tx|uart_rx|usart|console|crc16|cmd_proto|cmd_handler)$"),
+    ("video", r"^(video_stream|video_sink|fb_mirror)$"),
+    ("trace", r"^(trace|dwt_timer|rtos_stats)$"),
+    ("pool", r"^mem_pool$"),
+    ("assets", r"^asset_pack$"),
+    ("app", r"^(main|mem_layout|gpio|dma|i2c|stm32f4xx_it|stm32f4xx_hal_msp|stm32f4xx_hal_timebase_tim)$"),
+    ("sim", r"^(sim_|sh1106_emu)"),
+    ("runtime", r"^(S?crt|__|_|lib|c_w|c_p|fz_|m_w|m_p|mc_)"),
+)
+
+
+def object_stem(obj):
+    """'liboled_fw.a(rtos_tasks.c.o)' / 'c_w.l(__main.o)' / 'main.o' -> 'rtos_tasks' / ..."""
+    inner = re.search(r"\(([^()]+)\)\s*$", obj)
+    name = os.path.basename(inner.group(1) if inner else obj)
+    for ext in (".o", ".obj", ".c", ".s"):
+        if name.endswith(ext):
+            name = name[: -len(ext)]
+    if name.endswith(".c"):
+        name = name[:-2]
+    return name
+
+
+def in_ccm(addr):
+    return CCM_BASE <= addr < CCM_BASE + CCM_SIZE
+
+
+def subsystem(section, obj):
+    m = re.match(r"^\.(?:bss|data)\.(?:ram|ccm|dma)\.([A-Za-z0-9_]+)", section)
+    if m:
+        return m.group(1)
+    stem = object_stem(obj)
+    for name, pattern in SUBSYSTEMS:
+        if re.search(pattern, stem):
+            return name
+    # Archive members not matched above belong to their library
+    lib = re.match(r"^(?:.*/)?([^/(]+)\(", obj)
+    return lib.group(1) if lib else "other"
+
+
+def parse_armlink(lines):
+    """Yield (section, object, address, ram, flash)."""
+    for line in lines:
+        m = ARMLINK_ROW.match(line)
+        if not m:
+            continue
+        addr, size = int(m.group(1), 16), int(m.group(2), 16)
+        kind, attr, section, obj = m.group(3), m.group(4), m.group(5), m.group(6)
+        if attr == "RW":
+            yield section, obj, addr, size, (size if kind == "Data" else 0)
+        else:
+            yield section, obj, addr, 0, size
+
+
+def parse_gnu(lines):
+    """Yield (section, object, address, ram, flash)."""
+    in_map = False
+    output = None
+    pending = None
+    for line in lines:
+        if not in_map:
+            in_map = line.startswith("Linker script and memory map")
+            continue
+        m = GNU_OUTPUT.match(line)
+        if m and not line.startswith(" "):
+            output = m.group(1)
+            pending = None
+            continue
+        if output is None or output.startswith(GNU_SKIP):
+            continue
+        m = GNU_INPUT.match(line)
+        if m:
+            section, addr, size, obj = m.group(1), int(m.group(2), 16), int(m.group(3), 16), m.group(4)
+        else:
+            m = GNU_INPUT_NAME.match(line)
+            if m:
+                pending = m.group(1)
+                continue
+            m = GNU_INPUT_PLACE.match(line)
+            if not (m and pending):
+                pending = None
+                continue
+            section, addr, size, obj = pending, int(m.group(1), 16), int(m.group(2), 16), m.group(3)
+            pending = None
+        if size == 0 or obj.startswith("0x"):
+            continue
+        if output.startswith(GNU_RAM_ZI) or section.startswith(".bss"):
+            yield section, obj, addr, size, 0
+        elif output.startswith(GNU_RAM_RW):
+            yield section, obj, addr, size, size
+        else:
+            yield section, obj, addr, 0, size
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("map", help="linker map file")
+    parser.add_argument("--by", choices=("subsystem", "object"), default="subsystem",
+                        help="grouping of the table (default subsystem)")
+    parser.add_argument("--top", type=int, default=0, metavar="N",
+                        help="also list the N largest RAM input sections")
+    parser.add_argument("--check-dma", action="store_true",
+                        help="exit with status 1 if a .bss.dma.* section lies in CCM")
+    args = parser.parse_args()
+
+    with open(args.map, encoding="utf-8", errors="replace") as f:
+        lines = f.read().splitlines()
+    armlink = any("Memory Map of the image" in line for line in lines[:2000]) or \
+        any(ARMLINK_ROW.match(line) for line in lines[:2000])
+    rows = list(parse_armlink(lines) if armlink else parse_gnu(lines))
+    if not rows:
+        sys.exit(f"{args.map}: no sections found (not an armlink or GNU ld map?)")
+
+    groups = {}
+    for section, obj, addr, ram, flash in rows:
+        key = subsystem(section, obj) if args.by == "subsystem" else object_stem(obj)
+        g = groups.setdefault(key, [0, 0, 0])
+        g[1 if in_ccm(addr) else 0] += ram
+        g[2] += flash
+
+    totals = [sum(g[i] for g in groups.values()) for i in range(3)]
+    total_ram = totals[0] + totals[1]
+    label = "Subsystem" if args.by == "subsystem" else "Object"
+    print(f"{'armlink' if armlink else 'GNU ld'} map {args.map}\n")
+    print(f"{label:<24} {'SRAM B':>9} {'CCM B':>9} {'RAM %':>6} {'Flash B':>9}")
+    for key, (sram, ccm, flash) in sorted(groups.items(),
+                                         key=lambda kv: (-(kv[1][0] + kv[1][1]), -kv[1][2])):
+        if sram == 0 and ccm == 0 and flash == 0:
+            continue
+        share = (sram + ccm) * 100.0 / total_ram if total_ram else 0.0
+        print(f"{key:<24} {sram:>9} {ccm:>9} {share:>5.1f}% {flash:>9}")
+    print(f"{'Total':<24} {totals[0]:>9} {totals[1]:>9} {'':>6} {totals[2]:>9}")
+
+    if args.top > 0:
+        print(f"\n{'Largest RAM sections':<32} {'Bytes':>8} {'Region':>6}  Object")
+        ram_rows = sorted((r for r in rows if r[3]), key=lambda r: -r[3])[: args.top]
+        for section, obj, addr, ram, _flash in ram_rows:
+            print(f"{section:<32} {ram:>8} {'CCM' if in_ccm(addr) else 'SRAM':>6}  {object_stem(obj)}")
+
+    if args.check_dma:
+        bad = [r for r in rows if r[0].startswith((".bss.dma.", ".data.dma.")) and in_ccm(r[2])]
+        for section, obj, addr, _ram, _flash in bad:
+            print(f"ERROR: DMA buffer {section} ({object_stem(obj)}) at 0x{addr:08x} is in CCM")
+        if bad:
+            return 1
+        print("\nDMA buffers: none in CCM")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,217 @@
+#!/usr/bin/env python3
+"""Convert a captured NUCLEO-F429ZI trace stream into Chrome trace JSON.
+
+The firmware (built with TRACE_ENABLE=1) interleaves binary trace packets with the plain-text
+log on USART3. Capture the raw bytes, e.g.
+
+    stty -F /dev/ttyACM0 115200 raw && cat /dev/ttyACM0 > capture.bin
+
+then convert and open the result in chrome://tracing or https://ui.perfetto.dev:
+
+    python3 Tools/trace_decode.py capture.bin -o trace.json
+
+Packet formats are documented in Core/Inc/trace.h. Text between packets is ignored unless
+--log is given, in which case it is written to that file.
+"""
+
+import argparse
+import glob
+import json
+import os
+import re
+import struct
+import sys
+
+SYNC = b"\xa5\x5a"
+
+EVT_TASK_SWITCH_IN = 1
+EVT_TASK_SWITCH_OUT = 2
+EVT_QUEUE_SEND = 3
+EVT_QUEUE_SEND_FROM_ISR = 4
+EVT_QUEUE_RECEIVE = 5
+EVT_QUEUE_RECEIVE_FROM_ISR = 6
+EVT_RENDER_START = 7
+EVT_RENDER_END = 8
+EVT_FLUSH_START = 9
+EVT_FLUSH_END = 10
+EVT_TILES_SENT = 11
+EVT_I2C_TRANSFER = 12
+
+QUEUE_EVENTS = {
+    EVT_QUEUE_SEND: "queue send",
+    EVT_QUEUE_SEND_FROM_ISR: "queue send (ISR)",
+    EVT_QUEUE_RECEIVE: "queue receive",
+    EVT_QUEUE_RECEIVE_FROM_ISR: "queue receive (ISR)",
+}
+
+REPO = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+
+def load_display_modes():
+    """Render mode id -> screen name, read from DisplayMode_t, the registry table and the screen files.
+
+    Outside the source tree the render events show the mode id.
+    """
+    src = os.path.join(REPO, "Core", "Src")
+    try:
+        with open(os.path.join(REPO, "Core", "Inc", "rtos_tasks.h"), encoding="utf-8") as f:
+            enum = dict(re.findall(r"\b(DISPLAY_MODE_\w+)\s*=\s*(\d+)", f.read()))
+        with open(os.path.join(src, "screen_registry.c"), encoding="utf-8") as f:
+            table = re.findall(r"\[(DISPLAY_MODE_\w+)\]\s*=\s*&(\w+)", f.read())
+        names = {}
+        for path in glob.glob(os.path.join(src, "screen_*.c")):
+            with open(path, encoding="utf-8") as f:
+                names.update(re.findall(r"const Screen_t (\w+)\s*=\s*\{\s*\.name\s*=\s*\"([^\"]*)\"",
+                                        f.read()))
+    except OSError:
+        return {}
+    return {int(enum[key]): names[desc] for key, desc in table if key in enum and desc in names}
+
+
+DISPLAY_MODES = load_display_modes()
+
+PID = 1
+DISPLAY_TID = 1000
+BUS_TID = 1001
+
+
+def parse_packets(data):
+    """Yield (type, payload) for every packet with a valid checksum, plus skipped text bytes."""
+    pos = 0
+    text = bytearray()
+    while pos < len(data):
+        idx = data.find(SYNC, pos)
+        if idx < 0:
+            text += data[pos:]
+            break
+        text += data[pos:idx]
+        body_start = idx + 2
+        if body_start + 2 > len(data):
+            break
+        ptype = chr(data[body_start])
+        if ptype == "T":
+            length = 2 + data[body_start + 1] * 8
+        elif ptype == "N":
+            if body_start + 3 > len(data):
+                break
+            length = 3 + data[body_start + 2]
+        elif ptype == "M":
+            length = 11
+        else:
+            pos = idx + 1
+            continue
+        end = body_start + length
+        if end + 1 > len(data):
+            break
+        body = data[body_start:end]
+        if (sum(body) & 0xFF) != data[end]:
+            pos = idx + 1
+            continue
+        yield ptype, body, bytes(text)
+        text = bytearray()
+        pos = end + 1
+    if text:
+        yield None, b"", bytes(text)
+
+
+class Decoder:
+    def __init__(self):
+        self.clock_hz = 168_000_000
+        self.overhead_cycles = None
+        self.dropped = 0
+        self.task_names = {}
+        self.events = []
+        self.last_cycles = None
+        self.wraps = 0
+        self.running = None
+        self.records = 0
+
+    def timestamp_us(self, cycles):
+        if self.last_cycles is not None and cycles < self.last_cycles:
+            self.wraps += 1
+        self.last_cycles = cycles
+        return ((self.wraps << 32) + cycles) * 1e6 / self.clock_hz
+
+    def add(self, ph, name, tid, ts, **extra):
+        event = {"ph": ph, "name": name, "pid": PID, "tid": tid, "ts": ts}
+        event.update(extra)
+        self.events.append(event)
+
+    def record(self, cycles, event, arg8, arg16):
+        self.records += 1
+        ts = self.timestamp_us(cycles)
+        if event == EVT_TASK_SWITCH_IN:
+            self.running = arg16
+            self.add("B", self.task_names.get(arg16, "task %d" % arg16), arg16, ts)
+        elif event == EVT_TASK_SWITCH_OUT:
+            if self.running == arg16:
+                self.add("E", self.task_names.get(arg16, "task %d" % arg16), arg16, ts)
+            self.running = None
+        elif event in QUEUE_EVENTS:
+            tid = self.running if self.running is not None else 0
+            self.add("i", QUEUE_EVENTS[event], tid, ts, s="t", args={"queue": "0x%04x" % arg16})
+        elif event == EVT_RENDER_START:
+            self.add("B", "render %s" % DISPLAY_MODES.get(arg8, arg8), DISPLAY_TID, ts)
+        elif event == EVT_RENDER_END:
+            self.add("E", "render %s" % DISPLAY_MODES.get(arg8, arg8), DISPLAY_TID, ts)
+        elif event == EVT_FLUSH_START:
+            self.add("B", "flush", DISPLAY_TID, ts)
+        elif event == EVT_FLUSH_END:
+            self.add("E", "flush", DISPLAY_TID, ts)
+        elif event == EVT_TILES_SENT:
+            self.add("C", "tiles sent", DISPLAY_TID, ts, args={"tiles": arg16})
+        elif event == EVT_I2C_TRANSFER:
+            self.add("i", "i2c", BUS_TID, ts, s="t", args={"bytes": arg16})
+
+    def packet(self, ptype, body):
+        if ptype == "M":
+            self.clock_hz, self.overhead_cycles, self.dropped = struct.unpack_from("<IHI", body, 1)
+        elif ptype == "N":
+            number, length = body[1], body[2]
+            self.task_names[number] = body[3:3 + length].decode("ascii", "replace")
+        elif ptype == "T":
+            for i in range(body[1]):
+                self.record(*struct.unpack_from("<IBBH", body, 2 + i * 8))
+
+    def chrome_trace(self):
+        meta = [{"ph": "M", "name": "process_name", "pid": PID, "args": {"name": "NUCLEO-F429ZI"}},
+                {"ph": "M", "name": "thread_name", "pid": PID, "tid": DISPLAY_TID, "args": {"name": "Display"}},
+                {"ph": "M", "name": "thread_name", "pid": PID, "tid": BUS_TID, "args": {"name": "I2C1"}}]
+        for number, name in sorted(self.task_names.items()):
+            meta.append({"ph": "M", "name": "thread_name", "pid": PID, "tid": number, "args": {"name": name}})
+        return {"traceEvents": meta + self.events, "displayTimeUnit": "ms",
+                "otherData": {"clock_hz": self.clock_hz, "record_overhead_cycles": self.overhead_cycles,
+                              "dropped_records": self.dropped}}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("capture", help="raw USART3 capture file ('-' for stdin)")
+    parser.add_argument("-o", "--output", default="-", help="Chrome trace JSON output (default stdout)")
+    parser.add_argument("--log", help="write the interleaved text log to this file")
+    args = parser.parse_args()
+
+    data = sys.stdin.buffer.read() if args.capture == "-" else open(args.capture, "rb").read()
+    decoder = Decoder()
+    text = bytearray()
+    for ptype, body, skipped in parse_packets(data):
+        text += skipped
+        if ptype is not None:
+            decoder.packet(ptype, body)
+
+    out = sys.stdout if args.output == "-" else open(args.output, "w")
+    json.dump(decoder.chrome_trace(), out)
+    if args.log:
+        with open(args.log, "wb") as log:
+            log.write(bytes(text))
+
+    overhead = decoder.overhead_cycles
+    print("%d records, %d task names, %d dropped on target, record overhead %s cycles (%s)"
+          % (decoder.records, len(decoder.task_names), decoder.dropped,
+             "?" if overhead is None else overhead,
+             "?" if overhead is None else "%.0f ns" % (overhead * 1e9 / decoder.clock_hz)),
+          file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
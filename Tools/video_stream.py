@@ -0,0 +1,251 @@
+#!/usr/bin/env python3
+"""Stream frames to the video sink of the firmware (Core/Src/video_sink.c) over USART3.
+
+    python3 Tools/video_stream.py --demo --port /dev/ttyACM0
+    python3 Tools/video_stream.py --pbm clip/*.pbm --fps 30 --port COM5
+    python3 Tools/video_stream.py --demo --frames 300 --out v.bin
+
+With --port the script sends the console command 'v' at 115200 baud, reopens the port at the
+video rate (--baud, VIDEO_BAUD_RATE of the firmware) and paces the frames at --fps; an END
+packet returns the board to its previous screen. --out writes the stream to a file instead,
+for Host/build/bench_video --file or the simulator's "stream" command. --port needs pyserial.
+
+Frames are 128x64 1-bit images: P1/P4 PBM files or the built-in --demo (bongo cat, a bouncing
+ball and a progress bar). The packet layout and the tile-delta encoding mirror
+Core/Inc/video_stream.h; every --key-every frames a key frame lets the decoder recover from a
+lost packet.
+"""
+
+import argparse
+import os
+import struct
+import sys
+import time
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from xbm_to_pages import PANEL_HEIGHT, PANEL_WIDTH, PAGES, parse_bitmap, to_pages  # noqa: E402
+
+# Must match Core/Inc/video_stream.h
+SYNC = b"\x56\xa5"
+PKT_FRAME, PKT_END = 1, 2
+FLAG_KEY = 0x01
+HEADER = struct.Struct("<2sBBHH")
+TILE_BYTES = 8
+TILES = PAGES * PANEL_WIDTH // TILE_BYTES
+FRAME_BYTES = PAGES * PANEL_WIDTH
+
+CONSOLE_BAUD = 115200
+REPO_ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+
+
+def crc16(data):
+    """CRC-16/CCITT-FALSE."""
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else crc << 1
+            crc &= 0xFFFF
+    return crc
+
+
+def packbits(data):
+    """Runs of three or more equal bytes as repeats, the rest as literals of up to 128 bytes."""
+    out = bytearray()
+    i = 0
+    literal_start = 0
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and run < 128 and data[i + run] == data[i]:
+            run += 1
+        if run >= 3:
+            flush_literals(out, data[literal_start:i])
+            out += bytes((257 - run, data[i]))
+            i += run
+            literal_start = i
+        else:
+            i += run
+            if i - literal_start >= 128:
+                flush_literals(out, data[literal_start:literal_start + 128])
+                literal_start += 128
+    flush_literals(out, data[literal_start:])
+    return bytes(out)
+
+
+def flush_literals(out, data):
+    for start in range(0, len(data), 128):
+        chunk = data[start:start + 128]
+        out.append(len(chunk) - 1)
+        out += chunk
+
+
+def seal(ptype, flags, seq, payload):
+    body = HEADER.pack(SYNC, ptype, flags, seq & 0xFFFF, len(payload)) + payload
+    return body + struct.pack("<H", crc16(body[2:]))
+
+
+def tile(frame, index):
+    return frame[index * TILE_BYTES:(index + 1) * TILE_BYTES]
+
+
+def encode_frame(prev, cur, seq, key):
+    """One FRAME packet: records [first tile][count][PackBits] of the changed tile runs."""
+    payload = bytearray()
+    if prev is not None and not key:
+        index = 0
+        while index < TILES:
+            if tile(prev, index) == tile(cur, index):
+                index += 1
+                continue
+            first = index
+            while index < TILES and tile(prev, index) != tile(cur, index):
+                index += 1
+            if first == 0 and index == TILES:
+                break
+            payload += bytes((first, index - first))
+            payload += packbits(cur[first * TILE_BYTES:index * TILE_BYTES])
+        else:
+            return seal(PKT_FRAME, 0, seq, bytes(payload))
+    return seal(PKT_FRAME, FLAG_KEY, seq, bytes((0, TILES)) + packbits(cur))
+
+
+def encode_end(seq):
+    return seal(PKT_END, 0, seq, b"")
+
+
+def read_pbm(path):
+    """A 128x64 P1 or P4 PBM as SH1106 pages (1 = lit pixel)."""
+    with open(path, "rb") as f:
+        data = f.read()
+    tokens = []
+    pos = 0
+    while len(tokens) < 3:
+        while data[pos:pos + 1].isspace():
+            pos += 1
+        if data[pos:pos + 1] == b"#":
+            pos = data.index(b"\n", pos)
+            continue
+        end = pos
+        while not data[end:end + 1].isspace():
+            end += 1
+        tokens.append(data[pos:end])
+        pos = end
+    magic, width, height = tokens[0], int(tokens[1]), int(tokens[2])
+    if (width, height) != (PANEL_WIDTH, PANEL_HEIGHT):
+        sys.exit(f"{path}: {width}x{height}, the panel is {PANEL_WIDTH}x{PANEL_HEIGHT}")
+    if magic == b"P4":
+        bits = data[pos + 1:]
+        pixel = lambda x, y: (bits[y * (width // 8) + x // 8] >> (7 - x % 8)) & 1  # noqa: E731
+    elif magic == b"P1":
+        digits = [c for c in data[pos:] if c in b"01"]
+        pixel = lambda x, y: digits[y * width + x] == ord("1")  # noqa: E731
+    else:
+        sys.exit(f"{path}: not a P1/P4 PBM")
+    pages = bytearray(FRAME_BYTES)
+    for y in range(height):
+        for x in range(width):
+            if pixel(x, y):
+                pages[(y // 8) * PANEL_WIDTH + x] |= 1 << (y % 8)
+    return bytes(pages)
+
+
+def demo_frames(count):
+    """Bongo cat on the left half of the clip, then a bouncing ball over a progress bar."""
+    cats = []
+    for name in ("bongo_cat_1.h", "bongo_cat_2.h"):
+        with open(os.path.join(REPO_ROOT, "Image", name), encoding="utf-8") as f:
+            width, height, data = parse_bitmap(f.read())
+        cats.append(bytes(to_pages(data, width, height, 13, 0, False)))
+    for n in range(count):
+        if n < count // 2:
+            yield cats[(n // 4) & 1]
+            continue
+        pages = bytearray(FRAME_BYTES)
+
+        def dot(x, y):
+            if 0 <= x < PANEL_WIDTH and 0 <= y < PANEL_HEIGHT:
+                pages[(y // 8) * PANEL_WIDTH + x] |= 1 << (y % 8)
+
+        bx, by = n % 216, n % 88
+        bx, by = (bx if bx < 108 else 216 - bx) + 10, (by if by < 44 else 88 - by) + 3
+        for dy in range(-6, 7):
+            for dx in range(-6, 7):
+                if dx * dx + dy * dy <= 36:
+                    dot(bx + dx, by + dy)
+        for x in range(PANEL_WIDTH):
+            dot(x, 54)
+            dot(x, 63)
+        for x in range(2, 2 + n * 124 // max(count - 1, 1)):
+            for y in range(56, 62):
+                dot(x, y)
+        yield bytes(pages)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    source = parser.add_mutually_exclusive_group(required=True)
+    source.add_argument("--demo", action="store_true", help="built-in animation")
+    source.add_argument("--pbm", nargs="+", metavar="FILE", help="128x64 PBM frames, in order")
+    parser.add_argument("--out", help="write the stream to this file")
+    parser.add_argument("--port", help="serial port of the board (needs pyserial)")
+    parser.add_argument("--baud", type=int, default=921600,
+                        help="video line rate, VIDEO_BAUD_RATE of the firmware (default 921600)")
+    parser.add_argument("--fps", type=float, default=30.0,
+                        help="frame rate on the serial port, 0 = as fast as the line allows (default 30)")
+    parser.add_argument("--key-every", type=int, default=30,
+                        help="key frame interval in frames (default 30)")
+    parser.add_argument("--frames", type=int, default=300,
+                        help="number of --demo frames (default 300)")
+    args = parser.parse_args()
+    if not args.out and not args.port:
+        parser.error("give --out and/or --port")
+
+    frames = demo_frames(args.frames) if args.demo else (read_pbm(p) for p in args.pbm)
+    out = open(args.out, "wb") if args.out else None
+    port = None
+    if args.port:
+        try:
+            import serial
+        except ImportError:
+            sys.exit("--port needs pyserial (pip install pyserial)")
+        with serial.Serial(args.port, CONSOLE_BAUD, timeout=1) as console:
+            console.write(b"v")
+            console.flush()
+            print(console.read_until(b"\n").decode(errors="replace").strip())
+        time.sleep(0.05)
+        port = serial.Serial(args.port, args.baud, timeout=0)
+
+    prev = None
+    total = 0
+    seq = 0
+    start = time.monotonic()
+    for seq, frame in enumerate(frames):
+        packet = encode_frame(prev, frame, seq, args.key_every > 0 and seq % args.key_every == 0)
+        prev = frame
+        total += len(packet)
+        if out:
+            out.write(packet)
+        if port:
+            if args.fps > 0:
+                delay = start + seq / args.fps - time.monotonic()
+                if delay > 0:
+                    time.sleep(delay)
+            port.write(packet)
+    frame_count = seq + 1 if prev is not None else 0
+    end = encode_end(frame_count)
+    if out:
+        out.write(end)
+        out.close()
+    if port:
+        port.write(end)
+        port.flush()
+        port.close()
+    elapsed = time.monotonic() - start
+    if frame_count:
+        print(f"{frame_count} frames, {total} bytes ({total / frame_count:.1f} per frame)"
+              + (f", {frame_count / elapsed:.1f} fps" if port else ""))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,120 @@
+#!/usr/bin/env python3
+"""Convert an XBM bitmap into a pre-baked SH1106 frame (8 pages x 128 columns).
+
+The input is either a standard .xbm file (#define <name>_width/_height and the bits array)
+or one of the Image/*.h arrays written by Image2Lcd, whose leading comment holds the size
+(/* 0X20,0X01,<w lo>,<w hi>,<h lo>,<h hi>, */). Use --width/--height for arrays without it.
+
+    python3 Tools/xbm_to_pages.py Image/bongo_cat_1.h --x 13 \\
+        --name gImage_splash_pages -o Image/splash_pages.h
+
+The output is the byte order the controller expects after "set page": byte x of page p holds
+column x, rows 8p (bit 0) to 8p+7 (bit 7). This is also the layout of the u8g2 full frame
+buffer, so the same array can seed u8g2_GetBufferPtr(). --preview prints the frame as text.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+PANEL_WIDTH = 128
+PANEL_HEIGHT = 64
+PAGES = PANEL_HEIGHT // 8
+
+
+def parse_bitmap(text):
+    """Return (width or None, height or None, bytes) of an XBM or Image2Lcd array."""
+    width = re.search(r"#define\s+\w*_width\s+(\d+)", text)
+    height = re.search(r"#define\s+\w*_height\s+(\d+)", text)
+    body = text[text.index("{") + 1:text.rindex("}")]
+    header = re.match(r"\s*/\*\s*((?:0[xX][0-9a-fA-F]+\s*,\s*){6})\s*\*/", body)
+    if header and not (width and height):
+        fields = [int(v, 16) for v in re.findall(r"0[xX][0-9a-fA-F]+", header.group(1))]
+        w, h = fields[2] | (fields[3] << 8), fields[4] | (fields[5] << 8)
+    else:
+        w = int(width.group(1)) if width else None
+        h = int(height.group(1)) if height else None
+    body = re.sub(r"/\*.*?\*/", "", body, flags=re.S)
+    data = bytes(int(v, 0) for v in re.findall(r"0[xX][0-9a-fA-F]+|\b\d+\b", body))
+    return w, h, data
+
+
+def to_pages(data, width, height, x0, y0, invert):
+    """Place the XBM (LSB = leftmost pixel, rows padded to bytes) on a cleared panel."""
+    stride = (width + 7) // 8
+    if len(data) < stride * height:
+        sys.exit(f"bitmap has {len(data)} bytes, {width}x{height} needs {stride * height}")
+    pages = bytearray(PAGES * PANEL_WIDTH)
+    for y in range(height):
+        py = y0 + y
+        if not 0 <= py < PANEL_HEIGHT:
+            continue
+        for x in range(width):
+            px = x0 + x
+            if not 0 <= px < PANEL_WIDTH:
+                continue
+            if (data[y * stride + x // 8] >> (x % 8)) & 1:
+                pages[(py // 8) * PANEL_WIDTH + px] |= 1 << (py % 8)
+    if invert:
+        pages = bytearray(b ^ 0xFF for b in pages)
+    return pages
+
+
+def render_header(pages, name, source, x0, y0):
+    lines = [
+        f"/* Generated by Tools/xbm_to_pages.py from {source} (x={x0}, y={y0}); do not edit. */",
+        f"/* SH1106 pages: {PAGES} x {PANEL_WIDTH} bytes, byte x of page p = column x, "
+        f"rows 8p (bit 0) .. 8p+7 */",
+        f"const unsigned char {name}[{len(pages)}] = {{",
+    ]
+    for i in range(0, len(pages), 16):
+        lines.append("".join(f"0X{b:02X}," for b in pages[i:i + 16]))
+    lines.append("};")
+    return "\n".join(lines) + "\n"
+
+
+def preview(pages):
+    for y in range(PANEL_HEIGHT):
+        row = "".join("#" if (pages[(y // 8) * PANEL_WIDTH + x] >> (y % 8)) & 1 else "."
+                      for x in range(PANEL_WIDTH))
+        print(row)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("input", help="XBM file or Image2Lcd C array")
+    parser.add_argument("-o", "--output", help="output header (default stdout)")
+    parser.add_argument("--name", default="gImage_splash_pages", help="array name")
+    parser.add_argument("--x", type=int, default=None, help="left edge (default centred)")
+    parser.add_argument("--y", type=int, default=None, help="top edge (default centred)")
+    parser.add_argument("--width", type=int, help="bitmap width if the input does not say")
+    parser.add_argument("--height", type=int, help="bitmap height if the input does not say")
+    parser.add_argument("--invert", action="store_true", help="invert all pixels")
+    parser.add_argument("--preview", action="store_true", help="print the frame as text")
+    args = parser.parse_args()
+
+    with open(args.input, encoding="utf-8", errors="replace") as f:
+        width, height, data = parse_bitmap(f.read())
+    width = args.width or width
+    height = args.height or height
+    if not (width and height):
+        sys.exit(f"{args.input}: size unknown, pass --width and --height")
+    x0 = args.x if args.x is not None else (PANEL_WIDTH - width) // 2
+    y0 = args.y if args.y is not None else (PANEL_HEIGHT - height) // 2
+
+    pages = to_pages(data, width, height, x0, y0, args.invert)
+    source = os.path.relpath(args.input).replace(os.sep, "/")
+    text = render_header(pages, args.name, source, x0, y0)
+    if args.output:
+        with open(args.output, "w", encoding="utf-8", newline="\n") as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+    if args.preview:
+        preview(pages)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())